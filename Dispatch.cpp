@@ -0,0 +1,202 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Selection of the configuration of the dispatch library, see Dispatch.h.
+// The Makefile defines STREFLOP_DISPATCH_HAS_<name> for each configuration it links in.
+
+// getenv
+#include <stdlib.h>
+// strcmp
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#include <cpuid.h>
+#define STREFLOP_DISPATCH_CPUID 1
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#define STREFLOP_DISPATCH_CPUID 1
+#endif
+
+#include "Dispatch.h"
+
+namespace streflop_dispatch {
+
+// Defined by DispatchBackend.cpp, once per configuration
+#define STREFLOP_DISPATCH_DECLARE(name) const Configuration* configuration_##name();
+#ifdef STREFLOP_DISPATCH_HAS_sse_avx
+STREFLOP_DISPATCH_DECLARE(sse_avx)
+#endif
+#ifdef STREFLOP_DISPATCH_HAS_sse
+STREFLOP_DISPATCH_DECLARE(sse)
+#endif
+#ifdef STREFLOP_DISPATCH_HAS_soft
+STREFLOP_DISPATCH_DECLARE(soft)
+#endif
+#ifdef STREFLOP_DISPATCH_HAS_sse_nd
+STREFLOP_DISPATCH_DECLARE(sse_nd)
+#endif
+#ifdef STREFLOP_DISPATCH_HAS_x87_nd
+STREFLOP_DISPATCH_DECLARE(x87_nd)
+#endif
+#undef STREFLOP_DISPATCH_DECLARE
+
+namespace {
+
+enum Feature {
+    FEATURE_NONE = 0,
+    FEATURE_X87 = 1,
+    FEATURE_SSE2 = 2,
+    FEATURE_AVX_FMA = 4
+};
+
+#ifdef STREFLOP_DISPATCH_CPUID
+
+void cpuid(unsigned int leaf, unsigned int regs[4]) {
+#ifdef _MSC_VER
+    int r[4];
+    __cpuid(r, leaf);
+    for (int i = 0; i < 4; ++i) regs[i] = r[i];
+#else
+    regs[0] = regs[1] = regs[2] = regs[3] = 0;
+    __get_cpuid(leaf, &regs[0], &regs[1], &regs[2], &regs[3]);
+#endif
+}
+
+// Whether the system saves the SSE and AVX registers on context switches
+bool avxEnabled() {
+#ifdef _MSC_VER
+    return (_xgetbv(0) & 6) == 6;
+#else
+    unsigned int eax, edx;
+    __asm__ __volatile__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+    return (eax & 6) == 6;
+#endif
+}
+
+int detectFeatures() {
+    unsigned int regs[4];
+    cpuid(0, regs);
+    if (regs[0] < 1) return FEATURE_NONE;
+    cpuid(1, regs);
+    int features = FEATURE_NONE;
+    if (regs[3] & (1u << 0)) features |= FEATURE_X87;
+    if (regs[3] & (1u << 26)) features |= FEATURE_SSE2;
+    // FMA, OSXSAVE and AVX
+    const unsigned int avxBits = (1u << 12) | (1u << 27) | (1u << 28);
+    if ((features & FEATURE_SSE2) && (regs[2] & avxBits) == avxBits && avxEnabled()) features |= FEATURE_AVX_FMA;
+    // Hidden on request, to check the selection of a processor without them
+    if (getenv("STREFLOP_NO_AVX")) features &= ~FEATURE_AVX_FMA;
+    return features;
+}
+
+#else
+
+int detectFeatures() {
+    return FEATURE_NONE;
+}
+
+#endif
+
+struct Entry {
+    const char* name;
+    const Configuration* (*configuration)();
+    int features;
+};
+
+// Fastest first
+const Entry entries[] = {
+#ifdef STREFLOP_DISPATCH_HAS_sse_avx
+    {"sse_avx", &configuration_sse_avx, FEATURE_SSE2 | FEATURE_AVX_FMA},
+#endif
+#ifdef STREFLOP_DISPATCH_HAS_sse
+    {"sse", &configuration_sse, FEATURE_SSE2},
+#endif
+#ifdef STREFLOP_DISPATCH_HAS_sse_nd
+    {"sse_nd", &configuration_sse_nd, FEATURE_SSE2},
+#endif
+#ifdef STREFLOP_DISPATCH_HAS_x87_nd
+    {"x87_nd", &configuration_x87_nd, FEATURE_X87},
+#endif
+#ifdef STREFLOP_DISPATCH_HAS_soft
+    {"soft", &configuration_soft, FEATURE_NONE},
+#endif
+    {0, 0, FEATURE_NONE}
+};
+
+const char* const names[] = {
+#ifdef STREFLOP_DISPATCH_HAS_sse_avx
+    "sse_avx",
+#endif
+#ifdef STREFLOP_DISPATCH_HAS_sse
+    "sse",
+#endif
+#ifdef STREFLOP_DISPATCH_HAS_sse_nd
+    "sse_nd",
+#endif
+#ifdef STREFLOP_DISPATCH_HAS_x87_nd
+    "x87_nd",
+#endif
+#ifdef STREFLOP_DISPATCH_HAS_soft
+    "soft",
+#endif
+    0
+};
+
+bool supported(const Entry& entry) {
+    static const int features = detectFeatures();
+    return (entry.features & features) == entry.features;
+}
+
+const Entry* find(const char* name) {
+    for (const Entry* entry = entries; entry->name; ++entry) {
+        if (!strcmp(entry->name, name)) return entry;
+    }
+    return 0;
+}
+
+const Configuration* best() {
+    const char* forced = getenv("STREFLOP_CONFIGURATION");
+    if (forced) {
+        const Entry* entry = find(forced);
+        if (entry && supported(*entry)) return entry->configuration();
+    }
+    for (const Entry* entry = entries; entry->name; ++entry) {
+        if (supported(*entry)) return entry->configuration();
+    }
+    // Not reached: soft runs everywhere, and the configurations without denormals are only built on x86
+    return 0;
+}
+
+}
+
+const Configuration* current = best();
+
+void select_configuration() {
+    current = best();
+}
+
+bool select_configuration(const char* name) {
+    const Entry* entry = find(name);
+    if (!entry || !supported(*entry)) return false;
+    current = entry->configuration();
+    return true;
+}
+
+const char* const* configuration_names() {
+    return names;
+}
+
+bool configuration_supported(const char* name) {
+    const Entry* entry = find(name);
+    return entry && supported(*entry);
+}
+
+}
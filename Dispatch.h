@@ -0,0 +1,124 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Not included by streflop.h: this is the interface of the dispatch library, which does not
+// depend on the configuration of Makefile.common
+#ifndef STREFLOP_DISPATCH_H
+#define STREFLOP_DISPATCH_H
+
+/*
+    The dispatch library, built by "make dispatch", holds several configurations of streflop
+    that give the same results, see the configurations grid in README.txt. Each is compiled
+    under its own namespace names. When the program starts, the fastest configuration that
+    the processor supports is selected:
+    - with denormals: SSE compiled for AVX and FMA, then SSE, then Soft
+    - with STREFLOP_NO_DENORMALS: SSE, then x87
+
+    The functions below take and return the native float and double, so the same program
+    runs with every configuration. As with streflop_init, call init<float>() or init<double>()
+    on each thread before using the functions of that type, and again after selecting
+    another configuration.
+
+    The STREFLOP_CONFIGURATION environment variable forces a configuration by its name, for
+    example to compare the results of two of them on the same machine. When STREFLOP_NO_AVX
+    is set, the configurations using AVX and FMA are not supported, as on an older processor.
+    Nothing runs with AVX before the selection: the static objects of the library are
+    compiled without it.
+
+    Only these functions are dispatched. The rest of the library (random numbers, sums,
+    batch functions) needs the usual build for one configuration.
+*/
+
+namespace streflop_dispatch {
+
+/// The functions of one real argument
+#define STREFLOP_DISPATCH_UNARY(F) \
+    F(sqrt) F(cbrt) F(exp) F(log) F(log2) F(exp2) F(log10) \
+    F(sin) F(cos) F(tan) F(acos) F(asin) F(atan) \
+    F(cosh) F(sinh) F(tanh) F(acosh) F(asinh) F(atanh) \
+    F(fabs) F(floor) F(ceil) F(trunc) F(rint) F(round) F(nearbyint) F(logb) \
+    F(expm1) F(log1p) F(erf) F(j0) F(j1) F(y0) F(y1)
+
+/// The functions of two real arguments
+#define STREFLOP_DISPATCH_BINARY(F) \
+    F(hypot) F(pow) F(atan2) F(fmod) F(remainder) F(nextafter)
+
+#define STREFLOP_DISPATCH_UNARY_MEMBER(f) float (*f##Simple)(float); double (*f##Double)(double);
+#define STREFLOP_DISPATCH_BINARY_MEMBER(f) float (*f##Simple)(float, float); double (*f##Double)(double, double);
+
+/// The entry points of one configuration
+struct Configuration {
+    const char* name;
+    void (*initSimple)();
+    void (*initDouble)();
+    STREFLOP_DISPATCH_UNARY(STREFLOP_DISPATCH_UNARY_MEMBER)
+    STREFLOP_DISPATCH_BINARY(STREFLOP_DISPATCH_BINARY_MEMBER)
+    void (*sincosSimple)(float, float*, float*);
+    void (*sincosDouble)(double, double*, double*);
+    float (*fmaSimple)(float, float, float);
+    double (*fmaDouble)(double, double, double);
+    float (*ldexpSimple)(float, int);
+    double (*ldexpDouble)(double, int);
+    float (*frexpSimple)(float, int*);
+    double (*frexpDouble)(double, int*);
+};
+
+#undef STREFLOP_DISPATCH_UNARY_MEMBER
+#undef STREFLOP_DISPATCH_BINARY_MEMBER
+
+/// The selected configuration, set when the program starts
+extern const Configuration* current;
+
+/// Selects the fastest configuration for this processor, or the one of STREFLOP_CONFIGURATION.
+/// This is done when the program starts, call it only to use the functions from the
+/// constructors of other static objects.
+void select_configuration();
+
+/// Selects a configuration by its name, returns false when it is not in the library
+/// or not supported by this processor
+bool select_configuration(const char* name);
+
+/// Names of the configurations in the library, fastest first, ending with a null pointer
+const char* const* configuration_names();
+
+/// Whether this processor runs the named configuration
+bool configuration_supported(const char* name);
+
+/// Sets the FPU for the type in the current configuration, like streflop_init
+template<typename T> void init();
+template<> inline void init<float>() {current->initSimple();}
+template<> inline void init<double>() {current->initDouble();}
+
+#define STREFLOP_DISPATCH_UNARY_FUNCTION(f) \
+    inline float f(float x) {return current->f##Simple(x);} \
+    inline double f(double x) {return current->f##Double(x);}
+#define STREFLOP_DISPATCH_BINARY_FUNCTION(f) \
+    inline float f(float x, float y) {return current->f##Simple(x, y);} \
+    inline double f(double x, double y) {return current->f##Double(x, y);}
+
+STREFLOP_DISPATCH_UNARY(STREFLOP_DISPATCH_UNARY_FUNCTION)
+STREFLOP_DISPATCH_BINARY(STREFLOP_DISPATCH_BINARY_FUNCTION)
+
+#undef STREFLOP_DISPATCH_UNARY_FUNCTION
+#undef STREFLOP_DISPATCH_BINARY_FUNCTION
+
+inline void sincos(float x, float* sinx, float* cosx) {current->sincosSimple(x, sinx, cosx);}
+inline void sincos(double x, double* sinx, double* cosx) {current->sincosDouble(x, sinx, cosx);}
+inline float fma(float x, float y, float z) {return current->fmaSimple(x, y, z);}
+inline double fma(double x, double y, double z) {return current->fmaDouble(x, y, z);}
+inline float ldexp(float x, int exp) {return current->ldexpSimple(x, exp);}
+inline double ldexp(double x, int exp) {return current->ldexpDouble(x, exp);}
+inline float frexp(float x, int* exp) {return current->frexpSimple(x, exp);}
+inline double frexp(double x, int* exp) {return current->frexpDouble(x, exp);}
+
+}
+
+#endif
@@ -0,0 +1,90 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// The entry points of one configuration of the dispatch library, see Dispatch.h.
+// Compiled once per configuration by the dispatch target of the Makefile, which also
+// renames the streflop namespaces for that configuration.
+
+#include "streflop.h"
+#include "Dispatch.h"
+
+#ifndef STREFLOP_DISPATCH_VARIANT
+#error STREFLOP: DispatchBackend.cpp is only compiled by the dispatch target of the Makefile
+#endif
+
+#define STREFLOP_DISPATCH_PASTE2(a, b) a##b
+#define STREFLOP_DISPATCH_PASTE(a, b) STREFLOP_DISPATCH_PASTE2(a, b)
+#define STREFLOP_DISPATCH_STRING2(a) #a
+#define STREFLOP_DISPATCH_STRING(a) STREFLOP_DISPATCH_STRING2(a)
+
+namespace streflop_dispatch {
+
+namespace {
+
+using streflop::Simple;
+using streflop::Double;
+
+void initSimple() {streflop::streflop_init<Simple>();}
+void initDouble() {streflop::streflop_init<Double>();}
+
+// The native types are converted exactly to and from the configuration types
+#define STREFLOP_DISPATCH_UNARY_WRAPPER(f) \
+    float f##Simple(float x) {return (float)streflop::f(Simple(x));} \
+    double f##Double(double x) {return (double)streflop::f(Double(x));}
+#define STREFLOP_DISPATCH_BINARY_WRAPPER(f) \
+    float f##Simple(float x, float y) {return (float)streflop::f(Simple(x), Simple(y));} \
+    double f##Double(double x, double y) {return (double)streflop::f(Double(x), Double(y));}
+
+STREFLOP_DISPATCH_UNARY(STREFLOP_DISPATCH_UNARY_WRAPPER)
+STREFLOP_DISPATCH_BINARY(STREFLOP_DISPATCH_BINARY_WRAPPER)
+
+void sincosSimple(float x, float* sinx, float* cosx) {
+    Simple s, c;
+    streflop::sincos(Simple(x), &s, &c);
+    *sinx = (float)s;
+    *cosx = (float)c;
+}
+
+void sincosDouble(double x, double* sinx, double* cosx) {
+    Double s, c;
+    streflop::sincos(Double(x), &s, &c);
+    *sinx = (double)s;
+    *cosx = (double)c;
+}
+
+float fmaSimple(float x, float y, float z) {return (float)streflop::fma(Simple(x), Simple(y), Simple(z));}
+double fmaDouble(double x, double y, double z) {return (double)streflop::fma(Double(x), Double(y), Double(z));}
+float ldexpSimple(float x, int exp) {return (float)streflop::ldexp(Simple(x), exp);}
+double ldexpDouble(double x, int exp) {return (double)streflop::ldexp(Double(x), exp);}
+float frexpSimple(float x, int* exp) {return (float)streflop::frexp(Simple(x), exp);}
+double frexpDouble(double x, int* exp) {return (double)streflop::frexp(Double(x), exp);}
+
+#define STREFLOP_DISPATCH_ENTRY(f) &f##Simple, &f##Double,
+
+const Configuration configuration = {
+    STREFLOP_DISPATCH_STRING(STREFLOP_DISPATCH_VARIANT),
+    &initSimple, &initDouble,
+    STREFLOP_DISPATCH_UNARY(STREFLOP_DISPATCH_ENTRY)
+    STREFLOP_DISPATCH_BINARY(STREFLOP_DISPATCH_ENTRY)
+    &sincosSimple, &sincosDouble,
+    &fmaSimple, &fmaDouble,
+    &ldexpSimple, &ldexpDouble,
+    &frexpSimple, &frexpDouble
+};
+
+}
+
+// Found by Dispatch.cpp
+const Configuration* STREFLOP_DISPATCH_PASTE(configuration_, STREFLOP_DISPATCH_VARIANT)() {
+    return &configuration;
+}
+
+}
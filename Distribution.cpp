@@ -0,0 +1,449 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Non-uniform distributions, see Distribution.h
+
+// memcpy for the bit patterns
+#include <string.h>
+#include "streflop.h"
+
+namespace streflop {
+
+typedef SizedUnsignedInteger<64>::Type uint64;
+typedef SizedUnsignedInteger<32>::Type uint32;
+
+// Alias tables
+
+static inline uint64 bitsOf(Simple x) {
+    uint32 bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+static inline uint64 bitsOf(Double x) {
+    uint64 bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+// The weight as mantissa * 2^exponent. False if negative, infinite or NaN, -0 is accepted.
+static inline bool decomposeWeight(uint64 bits, int mantissaBits, int exponentBits, int bias, uint64& mantissa, int& exponent) {
+    int expField = (int)(bits >> mantissaBits) & ((1 << exponentBits) - 1);
+    bool negative = ((bits >> (mantissaBits + exponentBits)) & 1) != 0;
+    mantissa = bits & ((uint64(1) << mantissaBits) - 1);
+    if (expField == (1 << exponentBits) - 1) return false;
+    if (expField == 0) exponent = 1 - bias - mantissaBits; // subnormal
+    else {
+        mantissa |= uint64(1) << mantissaBits;
+        exponent = expField - bias - mantissaBits;
+    }
+    return !negative || mantissa == 0;
+}
+
+// Number of significant bits of m > 0
+static inline int bitLength(uint64 m) {
+#ifdef __GNUC__
+    return 64 - __builtin_clzll(m);
+#else
+    int n = 0;
+    for (; m != 0; m >>= 1) ++n;
+    return n;
+#endif
+}
+
+// floor(a * 2^32 / b) for a < b < 2^63, by long division
+static inline uint32 fraction32(uint64 a, uint64 b) {
+    uint32 f = 0;
+    for (int i = 0; i < 32; ++i) {
+        a <<= 1;
+        f <<= 1;
+        if (a >= b) {
+            a -= b;
+            f |= 1;
+        }
+    }
+    return f;
+}
+
+template<typename WeightType> static bool buildAliasTable(std::vector<RandomAliasTable::Entry>& entries, const WeightType* weights, size_t n, int mantissaBits, int exponentBits, int bias) {
+    entries.clear();
+    if (n == 0 || n >= (size_t(1) << 31)) return false;
+
+    // Exponent of the bit just above the largest weight
+    std::vector<uint64> scaled(n);
+    std::vector<int> exponent(n);
+    int top = 0;
+    bool nonzero = false;
+    for (size_t i = 0; i < n; ++i) {
+        if (!decomposeWeight(bitsOf(weights[i]), mantissaBits, exponentBits, bias, scaled[i], exponent[i])) return false;
+        if (scaled[i] == 0) continue;
+        int t = exponent[i] + bitLength(scaled[i]);
+        if (!nonzero || t > top) top = t;
+        nonzero = true;
+    }
+    if (!nonzero) return false;
+
+    // Integer weights below 2^32, the largest at least 2^31. The truncation changes
+    // each probability by less than 2^-32.
+    uint64 total = 0;
+    for (size_t i = 0; i < n; ++i) {
+        int shift = exponent[i] + 32 - top;
+        if (shift >= 0) scaled[i] <<= shift;
+        else if (shift > -64) scaled[i] >>= -shift;
+        else scaled[i] = 0;
+        total += scaled[i];
+    }
+
+    // Vose's construction, exact in integers: each column holds total, and item i
+    // brings n * scaled[i] to share between the columns. The lists are used as stacks.
+    std::vector<uint32> small, large;
+    small.reserve(n);
+    large.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        scaled[i] *= n;
+        if (scaled[i] < total) small.push_back(static_cast<uint32>(i));
+        else large.push_back(static_cast<uint32>(i));
+    }
+    entries.resize(n);
+    while (!small.empty() && !large.empty()) {
+        uint32 s = small.back();
+        small.pop_back();
+        uint32 l = large.back();
+        entries[s].threshold = fraction32(scaled[s], total);
+        entries[s].alias = l;
+        // The large item fills the rest of the column
+        scaled[l] -= total - scaled[s];
+        if (scaled[l] < total) {
+            large.pop_back();
+            small.push_back(l);
+        }
+    }
+    // The remaining items hold exactly one column each
+    for (size_t i = 0; i < large.size(); ++i) {
+        entries[large[i]].threshold = 0xFFFFFFFF;
+        entries[large[i]].alias = large[i];
+    }
+    for (size_t i = 0; i < small.size(); ++i) {
+        entries[small[i]].threshold = 0xFFFFFFFF;
+        entries[small[i]].alias = small[i];
+    }
+    return true;
+}
+
+bool RandomAliasTable::build(const Simple* weights, size_t n) {
+    return buildAliasTable(entries, weights, n, 23, 8, 127);
+}
+
+bool RandomAliasTable::build(const Double* weights, size_t n) {
+    return buildAliasTable(entries, weights, n, 52, 11, 1023);
+}
+
+// The column first, then the draw deciding between its item and the alias
+template<class State> static inline uint32 aliasSample(const RandomAliasTable::Entry* entries, uint32 size, State& state) {
+    uint32 column = Random<true, false, uint32>(0, size, state);
+    uint32 x = Random<uint32>(state);
+    return (x < entries[column].threshold) ? column : entries[column].alias;
+}
+
+uint32 RandomAliasTable::sample(RandomState& state) const {
+    return aliasSample(&entries[0], static_cast<uint32>(entries.size()), state);
+}
+
+uint32 RandomAliasTable::sample(CounterRandomState& state) const {
+    return aliasSample(&entries[0], static_cast<uint32>(entries.size()), state);
+}
+
+void RandomAliasTable::fill(uint32* out, size_t n, RandomState& state) const {
+    const Entry* table = &entries[0];
+    uint32 size = static_cast<uint32>(entries.size());
+    for (size_t i = 0; i < n; ++i) out[i] = aliasSample(table, size, state);
+}
+
+void RandomAliasTable::fill(uint32* out, size_t n, CounterRandomState& state) const {
+    const Entry* table = &entries[0];
+    uint32 size = static_cast<uint32>(entries.size());
+    for (size_t i = 0; i < n; ++i) out[i] = aliasSample(table, size, state);
+}
+
+
+// The floating-point distributions. Each is split in the constants of its parameters,
+// computed once by the Fill functions, and the draw. The SoftFloat types have no unary
+// minus, negations are written as subtractions from 0.
+
+// Exponential
+
+template<typename FloatType, class State> static inline FloatType ExpRandom_Generic(FloatType rate, State& state) {
+    // U in (0,1], so that the logarithm is finite
+    return (FloatType(0.0) - log(Random01<false, true, FloatType>(state))) / rate;
+}
+
+// Gamma
+
+template<typename FloatType> struct GammaParameters {
+    FloatType d, c, scale, inv_shape;
+    bool boost;
+    GammaParameters(FloatType shape, FloatType scale_) : scale(scale_) {
+        boost = shape < FloatType(1.0);
+        FloatType a = boost ? shape + FloatType(1.0) : shape;
+        d = a - FloatType(1.0) / FloatType(3.0);
+        c = FloatType(1.0) / sqrt(FloatType(9.0) * d);
+        inv_shape = FloatType(1.0) / shape;
+    }
+};
+
+template<typename FloatType, class State> static inline FloatType GammaRandom_Generic(const GammaParameters<FloatType>& g, State& state) {
+    FloatType x, v, u, x2;
+    for (;;) {
+        do {
+            x = NRandomZiggurat<FloatType>(state);
+            v = FloatType(1.0) + g.c * x;
+        } while (v <= FloatType(0.0));
+        v = v * v * v;
+        u = Random01<false, true, FloatType>(state);
+        x2 = x * x;
+        // Squeeze, then the exact test
+        if (u < FloatType(1.0) - FloatType(0.0331) * x2 * x2) break;
+        if (log(u) < FloatType(0.5) * x2 + g.d * (FloatType(1.0) - v + log(v))) break;
+    }
+    FloatType r = g.d * v;
+    // Gamma(shape) = Gamma(shape + 1) * U^(1/shape)
+    if (g.boost) r = r * exp(log(Random01<false, true, FloatType>(state)) * g.inv_shape);
+    return r * g.scale;
+}
+
+// Beta
+
+template<typename FloatType> struct BetaParameters {
+    GammaParameters<FloatType> ga, gb;
+    FloatType inv_alpha, inv_beta;
+    bool johnk;
+    BetaParameters(FloatType alpha, FloatType beta) : ga(alpha, FloatType(1.0)), gb(beta, FloatType(1.0)) {
+        johnk = (alpha <= FloatType(1.0)) && (beta <= FloatType(1.0));
+        inv_alpha = FloatType(1.0) / alpha;
+        inv_beta = FloatType(1.0) / beta;
+    }
+};
+
+template<typename FloatType, class State> static inline FloatType BetaRandom_Generic(const BetaParameters<FloatType>& p, State& state) {
+    if (!p.johnk) {
+        FloatType x = GammaRandom_Generic(p.ga, state);
+        FloatType y = GammaRandom_Generic(p.gb, state);
+        return x / (x + y);
+    }
+    // Johnk: X = U^(1/alpha), Y = V^(1/beta), accepted when X + Y <= 1
+    for (;;) {
+        FloatType logx = log(Random01<false, true, FloatType>(state)) * p.inv_alpha;
+        FloatType logy = log(Random01<false, true, FloatType>(state)) * p.inv_beta;
+        FloatType x = exp(logx);
+        FloatType y = exp(logy);
+        FloatType sum = x + y;
+        if (sum > FloatType(1.0)) continue;
+        if (sum > FloatType(0.0)) return x / sum;
+        // Both underflow, work on the logarithms
+        FloatType logm = (logx > logy) ? logx : logy;
+        logx = logx - logm;
+        logy = logy - logm;
+        return exp(logx - log(exp(logx) + exp(logy)));
+    }
+}
+
+// log(k!) for the discrete distributions, by Stirling's series:
+// log(k!) = log(sqrt(2 pi)) + (k + 1/2) log(k + 1) - (k + 1) + tail(k)
+
+// tail(k) for k < 10
+static const double StirlingTail[10] = {
+    0.0810614667953272582, 0.0413406959554092940, 0.0276779256849983392, 0.0207906721037650931, 0.0166446911898211033,
+    0.0138761288230707480, 0.0118967099458917701, 0.0104112652619720965, 0.00925546218271273292, 0.00833056343336287126
+};
+
+template<typename FloatType> static inline FloatType stirlingTail(FloatType k) {
+    if (k < FloatType(10.0)) return FloatType(StirlingTail[static_cast<int>(k)]);
+    FloatType kp1 = k + FloatType(1.0);
+    FloatType kp1sq = kp1 * kp1;
+    return (FloatType(1.0) / FloatType(12.0) - (FloatType(1.0) / FloatType(360.0) - FloatType(1.0) / FloatType(1260.0) / kp1sq) / kp1sq) / kp1;
+}
+
+template<typename FloatType> static inline FloatType logFactorial(FloatType k) {
+    FloatType kp1 = k + FloatType(1.0);
+    return FloatType(0.918938533204672741780) + (k + FloatType(0.5)) * log(kp1) - kp1 + stirlingTail(k);
+}
+
+// Poisson
+
+template<typename FloatType> struct PoissonParameters {
+    FloatType mean;
+    bool ptrs;
+    // product method
+    FloatType limit;
+    // PTRS
+    FloatType loglam, a, b, vr, loginvalpha;
+    // The fields of the other method are left at 0
+    PoissonParameters(FloatType mean_) : mean(mean_), ptrs(mean_ >= FloatType(10.0)), limit(0.0),
+        loglam(0.0), a(0.0), b(0.0), vr(0.0), loginvalpha(0.0) {
+        if (!ptrs) {
+            limit = exp(FloatType(0.0) - mean);
+            return;
+        }
+        loglam = log(mean);
+        b = FloatType(0.931) + FloatType(2.53) * sqrt(mean);
+        a = FloatType(-0.059) + FloatType(0.02483) * b;
+        vr = FloatType(0.9277) - FloatType(3.6224) / (b - FloatType(2.0));
+        loginvalpha = log(FloatType(1.1239) + FloatType(1.1328) / (b - FloatType(3.4)));
+    }
+};
+
+template<typename FloatType, class State> static inline uint32 PoissonRandom_Generic(const PoissonParameters<FloatType>& p, State& state) {
+    if (!p.ptrs) {
+        uint32 k = 0;
+        FloatType product = Random01<true, false, FloatType>(state);
+        while (product > p.limit) {
+            ++k;
+            product = product * Random01<true, false, FloatType>(state);
+        }
+        return k;
+    }
+    for (;;) {
+        // U in (-0.5, 0.5) so that us > 0
+        FloatType u = Random01<false, false, FloatType>(state) - FloatType(0.5);
+        FloatType v = Random01<false, true, FloatType>(state);
+        FloatType us = FloatType(0.5) - fabs(u);
+        FloatType k = floor((FloatType(2.0) * p.a / us + p.b) * u + p.mean + FloatType(0.43));
+        if (us >= FloatType(0.07) && v <= p.vr) return static_cast<uint32>(k);
+        if (k < FloatType(0.0) || (us < FloatType(0.013) && v > us)) continue;
+        FloatType lhs = log(v) + p.loginvalpha - log(p.a / (us * us) + p.b);
+        FloatType rhs = k * p.loglam - p.mean - logFactorial(k);
+        if (lhs <= rhs) return static_cast<uint32>(k);
+    }
+}
+
+// Binomial
+
+template<typename FloatType> struct BinomialParameters {
+    uint32 trials;
+    FloatType n, p, q;
+    bool flip, btrs;
+    // inversion
+    FloatType qn, bound;
+    // BTRS
+    FloatType a, b, c, vr, r, alpha, m;
+    // The fields of the other method are left at 0
+    BinomialParameters(uint32 trials_, FloatType prob) : trials(trials_), n(FloatType(trials_)),
+        p(prob > FloatType(0.5) ? FloatType(1.0) - prob : prob), q(0.0), flip(prob > FloatType(0.5)), btrs(false),
+        qn(0.0), bound(0.0), a(0.0), b(0.0), c(0.0), vr(0.0), r(0.0), alpha(0.0), m(0.0) {
+        q = FloatType(1.0) - p;
+        FloatType np = n * p;
+        btrs = np >= FloatType(10.0);
+        if (!btrs) {
+            qn = exp(n * log1p(FloatType(0.0) - p));
+            bound = np + FloatType(10.0) * sqrt(np * q + FloatType(1.0));
+            if (bound > n) bound = n;
+            return;
+        }
+        FloatType stddev = sqrt(np * q);
+        b = FloatType(1.15) + FloatType(2.53) * stddev;
+        a = FloatType(-0.0873) + FloatType(0.0248) * b + FloatType(0.01) * p;
+        c = np + FloatType(0.5);
+        vr = FloatType(0.92) - FloatType(4.2) / b;
+        r = p / q;
+        alpha = (FloatType(2.83) + FloatType(5.1) / b) * stddev;
+        m = floor((n + FloatType(1.0)) * p);
+    }
+};
+
+template<typename FloatType, class State> static inline uint32 BinomialRandom_Generic(const BinomialParameters<FloatType>& bp, State& state) {
+    FloatType k;
+    if (!bp.btrs) {
+        // Subtract the probabilities of 0, 1, 2... successes, restart past the bound.
+        // This also gives 0 for p = 0 or no trials.
+        k = FloatType(0.0);
+        FloatType px = bp.qn;
+        FloatType u = Random01<true, false, FloatType>(state);
+        while (u > px) {
+            k = k + FloatType(1.0);
+            if (k > bp.bound) {
+                k = FloatType(0.0);
+                px = bp.qn;
+                u = Random01<true, false, FloatType>(state);
+            } else {
+                u = u - px;
+                px = ((bp.n - k + FloatType(1.0)) * bp.p * px) / (k * bp.q);
+            }
+        }
+    } else for (;;) {
+        // U in (-0.5, 0.5) so that us > 0
+        FloatType u = Random01<false, false, FloatType>(state) - FloatType(0.5);
+        FloatType v = Random01<false, true, FloatType>(state);
+        FloatType us = FloatType(0.5) - fabs(u);
+        k = floor((FloatType(2.0) * bp.a / us + bp.b) * u + bp.c);
+        if (k < FloatType(0.0) || k > bp.n) continue;
+        if (us >= FloatType(0.07) && v <= bp.vr) break;
+        FloatType lhs = log(v * bp.alpha / (bp.a / (us * us) + bp.b));
+        FloatType nm = bp.n - bp.m;
+        FloatType nk = bp.n - k;
+        FloatType rhs = (bp.m + FloatType(0.5)) * log((bp.m + FloatType(1.0)) / (bp.r * (nm + FloatType(1.0))));
+        rhs = rhs + (bp.n + FloatType(1.0)) * log((nm + FloatType(1.0)) / (nk + FloatType(1.0)));
+        rhs = rhs + (k + FloatType(0.5)) * log(bp.r * (nk + FloatType(1.0)) / (k + FloatType(1.0)));
+        rhs = rhs + stirlingTail(bp.m) + stirlingTail(nm) - stirlingTail(k) - stirlingTail(nk);
+        if (lhs <= rhs) break;
+    }
+    uint32 successes = static_cast<uint32>(k);
+    return bp.flip ? bp.trials - successes : successes;
+}
+
+
+// The exported functions, for each type and state
+
+#define STREFLOP_DISTRIBUTION_DEFINE_FOR_STATE(a_type, State) \
+template<> a_type ExpRandom(a_type rate, State& state) { \
+    return ExpRandom_Generic<a_type>(rate, state); \
+} \
+template<> void ExpRandomFill(a_type* out, size_t n, a_type rate, State& state) { \
+    for (size_t i = 0; i < n; ++i) out[i] = ExpRandom_Generic<a_type>(rate, state); \
+} \
+template<> a_type GammaRandom(a_type shape, a_type scale, State& state) { \
+    return GammaRandom_Generic(GammaParameters<a_type>(shape, scale), state); \
+} \
+template<> void GammaRandomFill(a_type* out, size_t n, a_type shape, a_type scale, State& state) { \
+    GammaParameters<a_type> g(shape, scale); \
+    for (size_t i = 0; i < n; ++i) out[i] = GammaRandom_Generic(g, state); \
+} \
+template<> a_type BetaRandom(a_type alpha, a_type beta, State& state) { \
+    return BetaRandom_Generic(BetaParameters<a_type>(alpha, beta), state); \
+} \
+template<> void BetaRandomFill(a_type* out, size_t n, a_type alpha, a_type beta, State& state) { \
+    BetaParameters<a_type> p(alpha, beta); \
+    for (size_t i = 0; i < n; ++i) out[i] = BetaRandom_Generic(p, state); \
+} \
+template<> uint32 PoissonRandom(a_type mean, State& state) { \
+    return PoissonRandom_Generic(PoissonParameters<a_type>(mean), state); \
+} \
+template<> void PoissonRandomFill(uint32* out, size_t n, a_type mean, State& state) { \
+    PoissonParameters<a_type> p(mean); \
+    for (size_t i = 0; i < n; ++i) out[i] = PoissonRandom_Generic(p, state); \
+} \
+template<> uint32 BinomialRandom(uint32 trials, a_type p, State& state) { \
+    return BinomialRandom_Generic(BinomialParameters<a_type>(trials, p), state); \
+} \
+template<> void BinomialRandomFill(uint32* out, size_t n, uint32 trials, a_type p, State& state) { \
+    BinomialParameters<a_type> bp(trials, p); \
+    for (size_t i = 0; i < n; ++i) out[i] = BinomialRandom_Generic(bp, state); \
+}
+#define STREFLOP_DISTRIBUTION_DEFINE(a_type) \
+STREFLOP_DISTRIBUTION_DEFINE_FOR_STATE(a_type, RandomState) \
+STREFLOP_DISTRIBUTION_DEFINE_FOR_STATE(a_type, CounterRandomState)
+
+STREFLOP_DISTRIBUTION_DEFINE(Simple)
+STREFLOP_DISTRIBUTION_DEFINE(Double)
+#if defined(Extended)
+STREFLOP_DISTRIBUTION_DEFINE(Extended)
+#endif
+
+} // end streflop namespace
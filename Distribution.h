@@ -0,0 +1,152 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Included by the main streflop include file
+#ifndef STREFLOP_DISTRIBUTION_H
+#define STREFLOP_DISTRIBUTION_H
+
+// size_t, for the bulk functions
+#include <stddef.h>
+// storage of the alias tables
+#include <vector>
+
+/*
+    Non-uniform distributions, built on the uniform numbers of Random.h
+
+    Each number is computed from the draws of the given state by a fixed sequence of streflop
+    operations, using the log, exp and sqrt functions of Math.h and never the system ones.
+    The results are then the same in all configurations, for a given state and FPU setup,
+    as for NRandom: call streflop_init for the floating-point type first.
+    The Fill functions give the same numbers as n successive calls, and compute the
+    constants of the distribution only once.
+
+    All accept a CounterRandomState in place of the RandomState, passed explicitly.
+    The parameters are not checked: outside the documented domain the result is undefined.
+*/
+
+namespace streflop {
+
+/** Weighted choice of an item in constant time, by the alias method of Walker,
+    with the construction of M. D. Vose, "A linear algorithm for generating random
+    numbers with a given distribution", 1991.
+
+    build() takes the non-negative weights of n items, at least one of them not zero, and
+    returns false for any other input, like a NaN. It only uses integer arithmetic on the
+    bits of the weights, so the table is the same whatever the configuration and the FPU
+    setup. The probabilities are exact up to 2^-32 for each item.
+
+    sample() returns item i with probability weights[i] / sum(weights), from one bounded
+    integer and one 32-bit draw, see RandomSetIntegerMethod for the first. sample() and
+    fill() need a successful build.
+*/
+struct RandomAliasTable {
+    struct Entry {
+        // The column keeps its own item if a 32-bit draw is below threshold
+        SizedUnsignedInteger<32>::Type threshold;
+        SizedUnsignedInteger<32>::Type alias;
+    };
+    std::vector<Entry> entries;
+
+    inline RandomAliasTable() {}
+    inline RandomAliasTable(const Simple* weights, size_t n) {build(weights, n);}
+    inline RandomAliasTable(const Double* weights, size_t n) {build(weights, n);}
+
+    /// n must be below 2^31
+    bool build(const Simple* weights, size_t n);
+    bool build(const Double* weights, size_t n);
+    /// Number of items, 0 before a successful build
+    inline size_t size() const {return entries.size();}
+
+    SizedUnsignedInteger<32>::Type sample(RandomState& state = DefaultRandomState) const;
+    SizedUnsignedInteger<32>::Type sample(CounterRandomState& state) const;
+    void fill(SizedUnsignedInteger<32>::Type* out, size_t n, RandomState& state = DefaultRandomState) const;
+    void fill(SizedUnsignedInteger<32>::Type* out, size_t n, CounterRandomState& state) const;
+};
+
+/** Exponential distribution of the given rate > 0, with mean 1/rate.
+    This is the time between two events of a Poisson process of that rate: -log(U) / rate.
+*/
+template<typename a_type> a_type ExpRandom(a_type rate, RandomState& state = DefaultRandomState);
+template<typename a_type> void ExpRandomFill(a_type* out, size_t n, a_type rate, RandomState& state = DefaultRandomState);
+
+/** Gamma distribution of the given shape > 0 and scale > 0, with mean shape * scale.
+    Uses the method of G. Marsaglia and W. W. Tsang, "A simple method for generating gamma
+    variables", 2000, on the normal numbers of NRandomZiggurat. A shape below 1 is obtained
+    from shape + 1, times U^(1/shape).
+*/
+template<typename a_type> a_type GammaRandom(a_type shape, a_type scale, RandomState& state = DefaultRandomState);
+template<typename a_type> void GammaRandomFill(a_type* out, size_t n, a_type shape, a_type scale, RandomState& state = DefaultRandomState);
+
+/** Beta distribution of the given shapes alpha > 0 and beta > 0, in [0, 1].
+    This is X / (X + Y) for X and Y of gamma distributions of shapes alpha and beta, or
+    Johnk's method when both shapes are at most 1.
+*/
+template<typename a_type> a_type BetaRandom(a_type alpha, a_type beta, RandomState& state = DefaultRandomState);
+template<typename a_type> void BetaRandomFill(a_type* out, size_t n, a_type alpha, a_type beta, RandomState& state = DefaultRandomState);
+
+/** Poisson distribution of the given mean >= 0, the number of events in a unit of time
+    of a Poisson process of that rate.
+    Below a mean of 10 the uniform numbers are multiplied until their product is below
+    exp(-mean). Above, this is the PTRS transformed rejection of W. Hoermann, "The
+    transformed rejection method for generating Poisson random variables", 1993.
+    The mean must be below 2^31. The type of the mean is the type of the computations,
+    Simple is only accurate up to a mean of about 2^16.
+*/
+template<typename a_type> SizedUnsignedInteger<32>::Type PoissonRandom(a_type mean, RandomState& state = DefaultRandomState);
+template<typename a_type> void PoissonRandomFill(SizedUnsignedInteger<32>::Type* out, size_t n, a_type mean, RandomState& state = DefaultRandomState);
+
+/** Binomial distribution, the number of successes in the given number of trials with
+    the probability p in [0, 1] each.
+    For p > 0.5 this is trials minus the number for 1 - p. Below a mean of 10 the
+    probabilities of 0, 1, 2... successes are subtracted from a uniform number in turn.
+    Above, this is the BTRS transformed rejection of W. Hoermann, "The generation of binomial
+    random variates", 1993. The type of p is the type of the computations, Simple is only
+    accurate up to about 2^16 trials.
+*/
+template<typename a_type> SizedUnsignedInteger<32>::Type BinomialRandom(SizedUnsignedInteger<32>::Type trials, a_type p, RandomState& state = DefaultRandomState);
+template<typename a_type> void BinomialRandomFill(SizedUnsignedInteger<32>::Type* out, size_t n, SizedUnsignedInteger<32>::Type trials, a_type p, RandomState& state = DefaultRandomState);
+
+/// Same with a counter-based state
+template<typename a_type> a_type ExpRandom(a_type rate, CounterRandomState& state);
+template<typename a_type> void ExpRandomFill(a_type* out, size_t n, a_type rate, CounterRandomState& state);
+template<typename a_type> a_type GammaRandom(a_type shape, a_type scale, CounterRandomState& state);
+template<typename a_type> void GammaRandomFill(a_type* out, size_t n, a_type shape, a_type scale, CounterRandomState& state);
+template<typename a_type> a_type BetaRandom(a_type alpha, a_type beta, CounterRandomState& state);
+template<typename a_type> void BetaRandomFill(a_type* out, size_t n, a_type alpha, a_type beta, CounterRandomState& state);
+template<typename a_type> SizedUnsignedInteger<32>::Type PoissonRandom(a_type mean, CounterRandomState& state);
+template<typename a_type> void PoissonRandomFill(SizedUnsignedInteger<32>::Type* out, size_t n, a_type mean, CounterRandomState& state);
+template<typename a_type> SizedUnsignedInteger<32>::Type BinomialRandom(SizedUnsignedInteger<32>::Type trials, a_type p, CounterRandomState& state);
+template<typename a_type> void BinomialRandomFill(SizedUnsignedInteger<32>::Type* out, size_t n, SizedUnsignedInteger<32>::Type trials, a_type p, CounterRandomState& state);
+
+#define STREFLOP_DISTRIBUTION_MAKE_REAL_FOR_STATE(a_type, State) \
+template<> a_type ExpRandom(a_type rate, State& state); \
+template<> void ExpRandomFill(a_type* out, size_t n, a_type rate, State& state); \
+template<> a_type GammaRandom(a_type shape, a_type scale, State& state); \
+template<> void GammaRandomFill(a_type* out, size_t n, a_type shape, a_type scale, State& state); \
+template<> a_type BetaRandom(a_type alpha, a_type beta, State& state); \
+template<> void BetaRandomFill(a_type* out, size_t n, a_type alpha, a_type beta, State& state); \
+template<> SizedUnsignedInteger<32>::Type PoissonRandom(a_type mean, State& state); \
+template<> void PoissonRandomFill(SizedUnsignedInteger<32>::Type* out, size_t n, a_type mean, State& state); \
+template<> SizedUnsignedInteger<32>::Type BinomialRandom(SizedUnsignedInteger<32>::Type trials, a_type p, State& state); \
+template<> void BinomialRandomFill(SizedUnsignedInteger<32>::Type* out, size_t n, SizedUnsignedInteger<32>::Type trials, a_type p, State& state);
+#define STREFLOP_DISTRIBUTION_MAKE_REAL(a_type) \
+STREFLOP_DISTRIBUTION_MAKE_REAL_FOR_STATE(a_type, RandomState) \
+STREFLOP_DISTRIBUTION_MAKE_REAL_FOR_STATE(a_type, CounterRandomState)
+
+STREFLOP_DISTRIBUTION_MAKE_REAL(Simple)
+STREFLOP_DISTRIBUTION_MAKE_REAL(Double)
+#if defined(Extended)
+STREFLOP_DISTRIBUTION_MAKE_REAL(Extended)
+#endif
+
+}
+
+#endif
@@ -45,6 +45,9 @@
 #ifndef STREFLOP_FPU_H
 #define STREFLOP_FPU_H
 
+// STREFLOP_THREAD_LOCAL
+#include "IntegerTypes.h"
+
 // Can safely make the symbols from softfloat visible to user program, protected in namespace
 #if defined(STREFLOP_SOFT)
 #include "softfloat/softfloat.h"
@@ -143,6 +146,18 @@ enum FPU_RoundMode {
 #define STREFLOP_LDMXCSR(cw) do { asm volatile ("ldmxcsr %0" : : "m" (cw) ); } while (0)
 #endif
 
+#if defined(STREFLOP_X87) || defined(STREFLOP_SSE)
+
+/// x87 precision control bits for each type. Unknown types do not compile.
+template<typename T> struct X87Precision;
+template<> struct X87Precision<Simple> { enum { bits = 0x0000 }; };
+template<> struct X87Precision<Double> { enum { bits = 0x0200 }; };
+#ifdef Extended
+template<> struct X87Precision<Extended> { enum { bits = 0x0300 }; };
+#endif
+
+#endif
+
 // Subset of all C99 functions
 
 #if defined(STREFLOP_X87)
@@ -248,6 +263,28 @@ template<> inline void streflop_init<Extended>() {
 }
 #endif
 
+/// Sets up the FPU for type T during its lifetime, then restores the previous mode.
+/// Same effect as streflop_init<T>(), but the control word is only loaded when it differs.
+/// Reading it is cheap, loading it serializes the pipeline. The current word is always read,
+/// so the mode set by foreign code is seen. Use it to protect code called back from foreign code.
+template<typename T> class FPUScope {
+    unsigned short previous;
+    // Not copyable
+    FPUScope(const FPUScope&);
+    FPUScope& operator=(const FPUScope&);
+public:
+    FPUScope() {
+        STREFLOP_FSTCW(previous);
+        unsigned short fpu_mode = (previous & 0xFCFF) | X87Precision<T>::bits;
+        if (fpu_mode != previous) STREFLOP_FLDCW(fpu_mode);
+    }
+    ~FPUScope() {
+        unsigned short fpu_mode;
+        STREFLOP_FSTCW(fpu_mode);
+        if (fpu_mode != previous) STREFLOP_FLDCW(previous);
+    }
+};
+
 #elif defined(STREFLOP_SSE)
 
 /// Raise exception for these flags
@@ -406,6 +443,48 @@ template<> inline void streflop_init<Extended>() {
 }
 #endif
 
+/// Sets up the FPU for type T during its lifetime, then restores the previous mode.
+/// Same effect as streflop_init<T>(), but the control words are only loaded when they differ.
+/// Reading them is cheap, loading them serializes the pipeline. The current words are always
+/// read, so the mode set by foreign code is seen. Use it to protect code called back from
+/// foreign code. The SSE status flags raised in the meantime are kept.
+template<typename T> class FPUScope {
+    unsigned short previous_x87;
+    int previous_sse;
+    // Not copyable
+    FPUScope(const FPUScope&);
+    FPUScope& operator=(const FPUScope&);
+
+public:
+    FPUScope() {
+        // Just in case the compiler would store a value on the st(x) registers
+        STREFLOP_FSTCW(previous_x87);
+        unsigned short x87_mode = (previous_x87 & 0xFCFF) | X87Precision<T>::bits;
+        if (x87_mode != previous_x87) STREFLOP_FLDCW(x87_mode);
+
+        STREFLOP_STMXCSR(previous_sse);
+#if defined(STREFLOP_NO_DENORMALS)
+        int sse_mode = previous_sse | 0x8040; // set DAZ and FTZ
+#else
+        int sse_mode = previous_sse & 0xFFFF7FBF; // clear DAZ and FTZ
+#endif
+        if (sse_mode != previous_sse) STREFLOP_LDMXCSR(sse_mode);
+    }
+    ~FPUScope() {
+        unsigned short x87_mode;
+        STREFLOP_FSTCW(x87_mode);
+        if (x87_mode != previous_x87) STREFLOP_FLDCW(previous_x87);
+
+        // Restore the control bits only
+        int sse_mode;
+        STREFLOP_STMXCSR(sse_mode);
+        if ((sse_mode & 0xFFC0) != (previous_sse & 0xFFC0)) {
+            sse_mode = (sse_mode & 0x003F) | (previous_sse & 0xFFC0);
+            STREFLOP_LDMXCSR(sse_mode);
+        }
+    }
+};
+
 
 #elif defined(STREFLOP_SOFT)
 /// Raise exception for these flags
@@ -455,19 +534,12 @@ struct fenv_t {
     int exception_realtraps;
 };
 
-/// Default env. Defined in Math.cpp, initialized to some invalid value for detection
+/// Default env. Defined in Math.cpp, statically initialized to the SoftFloat initial values.
+/// The SoftFloat state is thread-local, so every thread starts with this environment.
 extern fenv_t FE_DFL_ENV;
 
 /// Get FP env into the given structure
 inline int fegetenv(fenv_t *envp) {
-    // check that default env exists, otherwise save it now
-    if (FE_DFL_ENV.tininess==42) {
-        // First use: save default environment now
-        FE_DFL_ENV.tininess = SoftFloat::float_detect_tininess;
-        FE_DFL_ENV.rounding_mode = SoftFloat::float_rounding_mode;
-        FE_DFL_ENV.exception_realtraps = SoftFloat::float_exception_realtraps;
-    }
-    // Now get the current env in the given argument
     envp->tininess = SoftFloat::float_detect_tininess;
     envp->rounding_mode = SoftFloat::float_rounding_mode;
     envp->exception_realtraps = SoftFloat::float_exception_realtraps;
@@ -476,14 +548,6 @@ inline int fegetenv(fenv_t *envp) {
 
 /// Sets FP env from the given structure
 inline int fesetenv(const fenv_t *envp) {
-    // check that default env exists, otherwise save it now
-    if (FE_DFL_ENV.tininess==42) {
-        // First use: save default environment now
-        FE_DFL_ENV.tininess = SoftFloat::float_detect_tininess;
-        FE_DFL_ENV.rounding_mode = SoftFloat::float_rounding_mode;
-        FE_DFL_ENV.exception_realtraps = SoftFloat::float_exception_realtraps;
-    }
-    // Now get the current env in the given argument
     SoftFloat::float_detect_tininess = envp->tininess;
     SoftFloat::float_rounding_mode = envp->rounding_mode;
     SoftFloat::float_exception_realtraps = envp->exception_realtraps;
@@ -511,6 +575,12 @@ template<> inline void streflop_init<Double>() {
 template<> inline void streflop_init<Extended>() {
 }
 
+/// Nothing to set up for SoftFloat, provided for compatibility with the other modes
+template<typename T> class FPUScope {
+public:
+    FPUScope() {}
+};
+
 #else
 #error STREFLOP: Invalid combination or unknown FPU type.
 #endif
@@ -0,0 +1,375 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Fused multiply-add, see Math.h
+
+// memcpy for the bit patterns
+#include <string.h>
+#include "streflop.h"
+
+// The FMA instructions round correctly in the current SSE rounding mode, exactly like the
+// integer code below. They are not used when the denormals are flushed: the flags would
+// apply to the intermediate product too, which the integer code does not reproduce.
+#if defined(STREFLOP_SSE) && defined(__FMA__) && !defined(STREFLOP_NO_DENORMALS)
+#define STREFLOP_FMA_HARDWARE 1
+#include <immintrin.h>
+#endif
+
+namespace streflop {
+
+typedef SizedUnsignedInteger<64>::Type uint64;
+typedef SizedUnsignedInteger<32>::Type uint32;
+typedef SizedUnsignedInteger<16>::Type uint16;
+
+#ifdef STREFLOP_FMA_HARDWARE
+
+Simple fma(Simple x, Simple y, Simple z) {
+    return _mm_cvtss_f32(_mm_fmadd_ss(_mm_set_ss(x), _mm_set_ss(y), _mm_set_ss(z)));
+}
+
+Double fma(Double x, Double y, Double z) {
+    return _mm_cvtsd_f64(_mm_fmadd_sd(_mm_set_sd(x), _mm_set_sd(y), _mm_set_sd(z)));
+}
+
+#else
+
+/* The IEEE formats. precision counts the hidden bit, which Extended stores explicitly.
+   The fields of a number are its sign, the biased exponent and the stored mantissa.
+*/
+struct FmaFormat {
+    int precision;
+    int exponentBits;
+    int bias;
+    bool explicitBit;
+};
+static const FmaFormat SimpleFmaFormat = {24, 8, 127, false};
+static const FmaFormat DoubleFmaFormat = {53, 11, 1023, false};
+#ifdef Extended
+static const FmaFormat ExtendedFmaFormat = {64, 15, 16383, true};
+#endif
+
+struct FmaFields {
+    bool negative;
+    int exponent;
+    uint64 mantissa;
+};
+
+static inline void getFields(Simple x, FmaFields& f) {
+    uint32 bits;
+    memcpy(&bits, &x, sizeof(bits));
+    f.negative = (bits >> 31) != 0;
+    f.exponent = (int)(bits >> 23) & 0xFF;
+    f.mantissa = bits & 0x7FFFFF;
+}
+
+static inline void fromFields(const FmaFields& f, Simple& x) {
+    uint32 bits = (f.negative ? 0x80000000 : 0) | ((uint32)f.exponent << 23) | (uint32)(f.mantissa & 0x7FFFFF);
+    memcpy(static_cast<void*>(&x), &bits, sizeof(bits));
+}
+
+static inline void getFields(Double x, FmaFields& f) {
+    uint64 bits;
+    memcpy(&bits, &x, sizeof(bits));
+    f.negative = (bits >> 63) != 0;
+    f.exponent = (int)(bits >> 52) & 0x7FF;
+    f.mantissa = bits & ((uint64(1) << 52) - 1);
+}
+
+static inline void fromFields(const FmaFields& f, Double& x) {
+    uint64 bits = (f.negative ? uint64(1) << 63 : 0) | ((uint64)f.exponent << 52) | (f.mantissa & ((uint64(1) << 52) - 1));
+    memcpy(static_cast<void*>(&x), &bits, sizeof(bits));
+}
+
+#ifdef Extended
+// Same memory layout for the x87 long double and the SoftFloat floatx80:
+// the 64 bits mantissa first, then the sign and the 15 bits exponent
+static inline void getFields(Extended x, FmaFields& f) {
+    uint16 high;
+    memcpy(&f.mantissa, &x, sizeof(f.mantissa));
+    memcpy(&high, reinterpret_cast<const char*>(&x) + sizeof(f.mantissa), sizeof(high));
+    f.negative = (high >> 15) != 0;
+    f.exponent = high & 0x7FFF;
+}
+
+static inline void fromFields(const FmaFields& f, Extended& x) {
+    uint16 high = (f.negative ? 0x8000 : 0) | (uint16)f.exponent;
+    memcpy(static_cast<void*>(&x), &f.mantissa, sizeof(f.mantissa));
+    memcpy(reinterpret_cast<char*>(&x) + sizeof(f.mantissa), &high, sizeof(high));
+}
+#endif
+
+/* 192 bits unsigned integers, w[2] is the most significant word.
+   The operands are aligned with their top bit at position 190, so the sum has room for a carry.
+*/
+static inline void shiftLeft(uint64 w[3], int n) {
+    while (n >= 64) {
+        w[2] = w[1]; w[1] = w[0]; w[0] = 0;
+        n -= 64;
+    }
+    if (n > 0) {
+        w[2] = (w[2] << n) | (w[1] >> (64 - n));
+        w[1] = (w[1] << n) | (w[0] >> (64 - n));
+        w[0] <<= n;
+    }
+}
+
+// Returns whether a non-zero bit was shifted out
+static inline bool shiftRight(uint64 w[3], int n) {
+    bool sticky = false;
+    if (n >= 192) {
+        sticky = (w[0] | w[1] | w[2]) != 0;
+        w[0] = w[1] = w[2] = 0;
+        return sticky;
+    }
+    while (n >= 64) {
+        sticky |= w[0] != 0;
+        w[0] = w[1]; w[1] = w[2]; w[2] = 0;
+        n -= 64;
+    }
+    if (n > 0) {
+        sticky |= (w[0] << (64 - n)) != 0;
+        w[0] = (w[0] >> n) | (w[1] << (64 - n));
+        w[1] = (w[1] >> n) | (w[2] << (64 - n));
+        w[2] >>= n;
+    }
+    return sticky;
+}
+
+// Position of the highest set bit of a non-zero word, by halves
+static inline int highestBit(uint64 v) {
+    int b = 0;
+    if (v >> 32) {v >>= 32; b += 32;}
+    if (v >> 16) {v >>= 16; b += 16;}
+    if (v >> 8) {v >>= 8; b += 8;}
+    if (v >> 4) {v >>= 4; b += 4;}
+    if (v >> 2) {v >>= 2; b += 2;}
+    return b + (int)(v >> 1);
+}
+
+static inline int highestBit(const uint64 w[3]) {
+    for (int i = 2; i >= 0; --i) if (w[i]) return 64 * i + highestBit(w[i]);
+    return -1;
+}
+
+static inline int compare(const uint64 a[3], const uint64 b[3]) {
+    for (int i = 2; i >= 0; --i) if (a[i] != b[i]) return (a[i] < b[i]) ? -1 : 1;
+    return 0;
+}
+
+// The full 128 bits product, from 32 bits halves
+static inline void multiply(uint64 a, uint64 b, uint64 w[3]) {
+    uint64 a0 = a & 0xFFFFFFFF, a1 = a >> 32, b0 = b & 0xFFFFFFFF, b1 = b >> 32;
+    uint64 p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64 middle = (p00 >> 32) + (p01 & 0xFFFFFFFF) + (p10 & 0xFFFFFFFF);
+    w[0] = (middle << 32) | (p00 & 0xFFFFFFFF);
+    w[1] = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+    w[2] = 0;
+}
+
+/* Value of a finite number as m * 2^exponent, with the top bit of m at position 63.
+   Returns false for a zero. Denormals are zeros when they are flushed.
+*/
+static inline bool unpack(const FmaFields& f, const FmaFormat& format, uint64& m, int& exponent) {
+    const int fraction = format.precision - 1;
+    m = f.mantissa;
+    if (f.exponent == 0) exponent = 1 - format.bias - fraction;
+    else {
+        if (!format.explicitBit) m |= uint64(1) << fraction;
+        exponent = f.exponent - format.bias - fraction;
+    }
+#ifdef STREFLOP_NO_DENORMALS
+    if (f.exponent == 0) m = 0;
+#endif
+    if (m == 0) return false;
+    int shift = 63 - highestBit(m);
+    m <<= shift;
+    exponent -= shift;
+    return true;
+}
+
+// The exact zero sum of two opposite values is -0 only when rounding downward
+static inline void exactZero(bool negativeBoth, bool sameSign, int mode, FmaFields& result) {
+    result.negative = sameSign ? negativeBoth : (mode == FE_DOWNWARD);
+    result.exponent = 0;
+    result.mantissa = 0;
+}
+
+/* Rounds w * 2^exponent with the given sign to the format, in the current rounding mode.
+   sticky tells whether non-zero bits were lost below w, they are always far below the
+   rounding position.
+*/
+static void roundFields(uint64 w[3], int exponent, bool sticky, bool negative, int mode, const FmaFormat& format, FmaFields& result) {
+    const int p = format.precision;
+    const int emin = 1 - format.bias;
+    const int maxExponent = (1 << format.exponentBits) - 1;
+    result.negative = negative;
+
+    // Exponent of the last kept bit
+    int top = highestBit(w);
+    int last = exponent + top - (p - 1);
+    if (last < emin - (p - 1)) last = emin - (p - 1);
+    int shift = last - exponent;
+
+    uint64 q;
+    bool increment = false;
+    if (shift <= 0) {
+        shiftLeft(w, -shift); // exact
+        q = w[0];
+    } else {
+        sticky |= shiftRight(w, shift - 1);
+        bool roundBit = (w[0] & 1) != 0;
+        q = (w[0] >> 1) | (w[1] << 63);
+        switch (mode) {
+            case FE_UPWARD: increment = !negative && (roundBit || sticky); break;
+            case FE_DOWNWARD: increment = negative && (roundBit || sticky); break;
+            case FE_TOWARDZERO: break;
+            default: increment = roundBit && (sticky || (q & 1)); break;
+        }
+    }
+    if (increment) {
+        ++q;
+        if (p < 64 && (q >> p)) {
+            q >>= 1;
+            ++last;
+        } else if (p == 64 && q == 0) {
+            q = uint64(1) << 63;
+            ++last;
+        }
+    }
+
+    if (q >> (p - 1)) {
+        result.exponent = last + (p - 1) + format.bias;
+        if (result.exponent >= maxExponent) {
+            bool infinity = (mode == FE_TONEAREST) || (mode == FE_UPWARD && !negative) || (mode == FE_DOWNWARD && negative);
+            result.exponent = infinity ? maxExponent : maxExponent - 1;
+            q = infinity ? 0 : ~uint64(0) >> (64 - p);
+            if (infinity && format.explicitBit) q = uint64(1) << 63;
+        }
+    } else {
+        result.exponent = 0;
+#ifdef STREFLOP_NO_DENORMALS
+        q = 0;
+#endif
+    }
+    result.mantissa = q;
+}
+
+// Finite x, y and z
+static void fusedMultiplyAdd(const FmaFields& x, const FmaFields& y, const FmaFields& z, const FmaFormat& format, FmaFields& result) {
+    const int mode = fegetround();
+    uint64 mx, my, mz, product[3], c[3];
+    int ex, ey, ez;
+    bool productNegative = x.negative != y.negative;
+    bool hasProduct = unpack(x, format, mx, ex) & unpack(y, format, my, ey);
+    if (hasProduct) {
+        // The 128 bits product in the top words, its top bit is 126 or 127
+        multiply(mx, my, product);
+        product[2] = product[1]; product[1] = product[0]; product[0] = 0;
+        ex += ey - 64;
+        if (product[2] >> 63) {
+            shiftRight(product, 1);
+            ++ex;
+        }
+    }
+    bool hasZ = unpack(z, format, mz, ez);
+    c[0] = 0; c[1] = mz << 63; c[2] = mz >> 1;
+    ez -= 127;
+
+    if (!hasProduct && !hasZ) {
+        exactZero(z.negative, productNegative == z.negative, mode, result);
+        return;
+    }
+    if (!hasProduct) {
+        roundFields(c, ez, false, z.negative, mode, format, result);
+        return;
+    }
+    if (!hasZ) {
+        roundFields(product, ex, false, productNegative, mode, format, result);
+        return;
+    }
+
+    // Align the smaller exponent on the larger one
+    uint64* big = product; uint64* small = c;
+    int bigExponent = ex, smallExponent = ez;
+    bool bigNegative = productNegative, smallNegative = z.negative;
+    if (ez > ex) {
+        big = c; small = product;
+        bigExponent = ez; smallExponent = ex;
+        bigNegative = z.negative; smallNegative = productNegative;
+    }
+    bool sticky = shiftRight(small, bigExponent - smallExponent);
+    // Keep the lost bits as a set bit at the bottom, it cannot reach the rounding position
+    if (sticky) small[0] |= 1;
+
+    uint64 sum[3];
+    if (bigNegative == smallNegative) {
+        uint64 carry = 0;
+        for (int i = 0; i < 3; ++i) {
+            uint64 s = big[i] + small[i];
+            uint64 c1 = s < big[i];
+            sum[i] = s + carry;
+            carry = c1 | (sum[i] < s);
+        }
+    } else {
+        int order = compare(big, small);
+        if (order == 0) {
+            exactZero(bigNegative, false, mode, result);
+            return;
+        }
+        if (order < 0) {
+            uint64* t = big; big = small; small = t;
+            bigNegative = smallNegative;
+        }
+        uint64 borrow = 0;
+        for (int i = 0; i < 3; ++i) {
+            uint64 d = big[i] - small[i];
+            uint64 b1 = big[i] < small[i];
+            sum[i] = d - borrow;
+            borrow = b1 | (d < borrow);
+        }
+    }
+    roundFields(sum, bigExponent, false, bigNegative, mode, format, result);
+}
+
+// Infinities and NaN are left to the FPU, the operations are exact for them
+template<typename T> static inline T fmaT(T x, T y, T z, const FmaFormat& format) {
+    const int maxExponent = (1 << format.exponentBits) - 1;
+    FmaFields fx, fy, fz, result;
+    getFields(x, fx);
+    getFields(y, fy);
+    getFields(z, fz);
+    if (fx.exponent == maxExponent || fy.exponent == maxExponent) return x * y + z;
+    if (fz.exponent == maxExponent) return z + z;
+    fusedMultiplyAdd(fx, fy, fz, format, result);
+    // Zero the padding of Extended
+    T r = T(0.0);
+    fromFields(result, r);
+    return r;
+}
+
+Simple fma(Simple x, Simple y, Simple z) {
+    return fmaT(x, y, z, SimpleFmaFormat);
+}
+
+Double fma(Double x, Double y, Double z) {
+    return fmaT(x, y, z, DoubleFmaFormat);
+}
+
+#endif
+
+// Extended are not always available, and never with SSE
+#ifdef Extended
+Extended fma(Extended x, Extended y, Extended z) {
+    return fmaT(x, y, z, ExtendedFmaFormat);
+}
+#endif
+
+}
@@ -23,6 +23,20 @@
 // Note2: Even if char != 8 bits, it's still possible to define ints in terms of number of char!
 #define STREFLOP_INTEGER_TYPES_CHAR_BITS 8
 
+// Storage class for the per-thread state: SoftFloat rounding mode and flags, multi-precision cache
+// and slow path counters.
+// Define STREFLOP_NO_THREAD_LOCAL for platforms without thread-local storage, the state is
+// then shared by all threads. You may also define STREFLOP_THREAD_LOCAL yourself.
+#ifndef STREFLOP_THREAD_LOCAL
+#if defined(STREFLOP_NO_THREAD_LOCAL)
+#define STREFLOP_THREAD_LOCAL
+#elif defined(_MSC_VER)
+#define STREFLOP_THREAD_LOCAL __declspec(thread)
+#else
+#define STREFLOP_THREAD_LOCAL __thread
+#endif
+#endif
+
 // Avoid conflict with system types, if any
 namespace streflop {
 
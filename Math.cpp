@@ -32,13 +32,14 @@ namespace streflop {
 #endif // _MSC_VER
 
 
-    // Default environment. Initalized to 0, and really set on first access
+    // Default environment. Initalized to 0, and really set on first access.
+    // The SoftFloat one is known statically, which spares a racy lazy save with thread-local state.
 #if defined(STREFLOP_X87)
     fenv_t FE_DFL_ENV = 0;
 #elif defined(STREFLOP_SSE)
     fenv_t FE_DFL_ENV = {0,0};
 #elif defined(STREFLOP_SOFT)
-    fenv_t FE_DFL_ENV = {42,0,0};
+    fenv_t FE_DFL_ENV = {SoftFloat::float_tininess_after_rounding, SoftFloat::float_round_nearest_even, 0};
 #else
 #error STREFLOP: Invalid combination or unknown FPU type.
 #endif
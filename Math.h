@@ -17,6 +17,9 @@
 // just in case, should already be included
 #include "streflop.h"
 
+// size_t, for the batch functions
+#include <stddef.h>
+
 // Names from the libm conversion
 namespace streflop_libm {
 using streflop::Simple;
@@ -48,6 +51,13 @@ extern const Extended ExtendedNaN;
     extern Simple __ieee754_powf(Simple x, Simple y);
     extern Simple __sinf(Simple x);
     extern Simple __cosf(Simple x);
+    extern void __sincosf(Simple x, Simple *sinx, Simple *cosx);
+#ifdef STREFLOP_BATCH_PACKED
+    extern void __expf_batch(const Simple *in, Simple *out, size_t n);
+    extern void __logf_batch(const Simple *in, Simple *out, size_t n);
+    extern void __sinf_batch(const Simple *in, Simple *out, size_t n);
+    extern void __cosf_batch(const Simple *in, Simple *out, size_t n);
+#endif
     extern Simple __tanhf(Simple x);
     extern Simple __tanf(Simple x);
     extern Simple __ieee754_acosf(Simple x);
@@ -77,7 +87,7 @@ extern const Extended ExtendedNaN;
     extern Simple __ldexpf(Simple value, int exp);
     extern Simple __logbf(Simple x);
     extern int __ilogbf(Simple x);
-    extern Simple __copysignf(Simple x);
+    extern Simple __copysignf(Simple x, Simple y);
     extern int __signbitf(Simple x);
     extern Simple __nextafterf(Simple x, Simple y);
     extern Simple __expm1f(Simple x);
@@ -105,6 +115,13 @@ extern const Extended ExtendedNaN;
     extern Double __ieee754_pow(Double x, Double y);
     extern Double __sin(Double x);
     extern Double __cos(Double x);
+    extern void __sincos(Double x, Double *sinx, Double *cosx);
+#ifdef STREFLOP_BATCH_PACKED
+    extern void __exp_batch(const Double *in, Double *out, size_t n);
+    extern void __log_batch(const Double *in, Double *out, size_t n);
+    extern void __sin_batch(const Double *in, Double *out, size_t n);
+    extern void __cos_batch(const Double *in, Double *out, size_t n);
+#endif
     extern Double tan(Double x);
     extern Double __ieee754_acos(Double x);
     extern Double __ieee754_asin(Double x);
@@ -134,7 +151,7 @@ extern const Extended ExtendedNaN;
     extern Double __ldexp(Double value, int exp);
     extern Double __logb(Double x);
     extern int __ilogb(Double x);
-    extern Double __copysign(Double x);
+    extern Double __copysign(Double x, Double y);
     extern int __signbit(Double x);
     extern Double __nextafter(Double x, Double y);
     extern Double __expm1(Double x);
@@ -149,7 +166,7 @@ extern const Extended ExtendedNaN;
     extern Double __scalbn(Double x, int n);
     extern Double __scalbln(Double x, long int n);
     extern int __fpclassify(Double x);
-    extern int __isnanl(Double x);
+    extern int __isnan(Double x);
     extern int __isinf(Double x);
 #ifdef Extended
     extern Extended __ieee754_sqrtl(Extended x);
@@ -157,9 +174,15 @@ extern const Extended ExtendedNaN;
     extern Extended __ieee754_hypotl(Extended x, Extended y);
     extern Extended __ieee754_expl(Extended x);
     extern Extended __ieee754_logl(Extended x);
+    extern Extended __ieee754_log2l(Extended x);
+    extern Extended __ieee754_exp2l(Extended x);
+    extern Extended __ieee754_log10l(Extended x);
+    extern Extended __ieee754_powl(Extended x, Extended y);
     extern Extended __sinl(Extended x);
     extern Extended __cosl(Extended x);
+    extern void __sincosl(Extended x, Extended *sinx, Extended *cosx);
     extern Extended __tanl(Extended x);
+    extern Extended __ieee754_acosl(Extended x);
     extern Extended __ieee754_asinl(Extended x);
     extern Extended __atanl(Extended x);
     extern Extended __ieee754_atan2l(Extended x, Extended y);
@@ -187,7 +210,7 @@ extern const Extended ExtendedNaN;
     extern Extended __ldexpl(Extended value, int exp);
     extern Extended __logbl(Extended x);
     extern int __ilogbl(Extended x);
-    extern Extended __copysignl(Extended x);
+    extern Extended __copysignl(Extended x, Extended y);
     extern int __signbitl(Extended x);
     extern Extended __nextafterl(Extended x, Extended y);
     extern Extended __expm1l(Extended x);
@@ -249,6 +272,7 @@ enum
 
     inline Simple sin(Simple x) {return streflop_libm::__sinf(x);}
     inline Simple cos(Simple x) {return streflop_libm::__cosf(x);}
+    inline void sincos(Simple x, Simple *sinx, Simple *cosx) {streflop_libm::__sincosf(x,sinx,cosx);}
     inline Simple tan(Simple x) {return streflop_libm::__tanf(x);}
     inline Simple acos(Simple x) {return streflop_libm::__ieee754_acosf(x);}
     inline Simple asin(Simple x) {return streflop_libm::__ieee754_asinf(x);}
@@ -281,7 +305,7 @@ enum
     inline Simple ldexp(Simple value, int exp) {return streflop_libm::__ldexpf(value,exp);}
     inline Simple logb(Simple x) {return streflop_libm::__logbf(x);}
     inline int ilogb(Simple x) {return streflop_libm::__ilogbf(x);}
-    inline Simple copysign(Simple x) {return streflop_libm::__copysignf(x);}
+    inline Simple copysign(Simple x, Simple y) {return streflop_libm::__copysignf(x,y);}
 #undef signbit
     inline int signbit (Simple x) {return streflop_libm::__signbitf(x);}
     inline Simple nextafter(Simple x, Simple y) {return streflop_libm::__nextafterf(x,y);}
@@ -297,6 +321,8 @@ enum
     inline Simple yn(int n, Simple x) {return streflop_libm::__ieee754_ynf(n,x);}
     inline Simple scalbn(Simple x, int n) {return streflop_libm::__scalbnf(x,n);}
     inline Simple scalbln(Simple x, long int n) {return streflop_libm::__scalblnf(x,n);}
+    /// Correctly rounded x*y+z, the same in all configurations. Defined in FusedMultiplyAdd.cpp
+    Simple fma(Simple x, Simple y, Simple z);
 
 #undef fpclassify
     inline int fpclassify(Simple x) {return streflop_libm::__fpclassifyf(x);}
@@ -361,6 +387,7 @@ enum
 
     inline Simple sinf(Simple x) {return sin(x);}
     inline Simple cosf(Simple x) {return cos(x);}
+    inline void sincosf(Simple x, Simple *sinx, Simple *cosx) {sincos(x, sinx, cosx);}
     inline Simple tanf(Simple x) {return tan(x);}
     inline Simple acosf(Simple x) {return acos(x);}
     inline Simple asinf(Simple x) {return asin(x);}
@@ -393,7 +420,7 @@ enum
     inline Simple ldexpf(Simple value, int exp) {return ldexp(value,exp);}
     inline Simple logbf(Simple x) {return logb(x);}
     inline int ilogbf(Simple x) {return ilogb(x);}
-    inline Simple copysignf(Simple x) {return copysign(x);}
+    inline Simple copysignf(Simple x, Simple y) {return copysign(x,y);}
     inline int signbitf(Simple x) {return signbit(x);}
     inline Simple nextafterf(Simple x, Simple y) {return nextafter(x, y);}
 
@@ -408,6 +435,7 @@ enum
     inline Simple ynf(int n, Simple x) {return yn(n, x);}
     inline Simple scalbnf(Simple x, int n) {return scalbn(x, n);}
     inline Simple scalblnf(Simple x, long int n) {return scalbln(x, n);}
+    inline Simple fmaf(Simple x, Simple y, Simple z) {return fma(x, y, z);}
 
     inline int fpclassifyf(Simple x) {return fpclassify(x);}
     inline int isnanf(Simple x) {return isnan(x);}
@@ -426,24 +454,33 @@ enum
 // Declare Double functions
 // Simple and double are present in all configurations
 
+// The functions which may fall back to the multi-precision code count their calls
+// when STREFLOP_SLOWPATH_STATS is defined, see SlowPathStats.h
+#ifdef STREFLOP_SLOWPATH_STATS
+#define STREFLOP_SLOWPATH_SCOPE(function, x, y) SlowPathScope slowpath_scope(function, x, y);
+#else
+#define STREFLOP_SLOWPATH_SCOPE(function, x, y)
+#endif
+
     inline Double sqrt(Double x) {return streflop_libm::__ieee754_sqrt(x);}
     inline Double cbrt(Double x) {return streflop_libm::__cbrt(x);}
     inline Double hypot(Double x, Double y) {return streflop_libm::__ieee754_hypot(x,y);}
 
-    inline Double exp(Double x) {return streflop_libm::__ieee754_exp(x);}
-    inline Double log(Double x) {return streflop_libm::__ieee754_log(x);}
+    inline Double exp(Double x) {STREFLOP_SLOWPATH_SCOPE(SlowPathExp, x, Double(0.0)) return streflop_libm::__ieee754_exp(x);}
+    inline Double log(Double x) {STREFLOP_SLOWPATH_SCOPE(SlowPathLog, x, Double(0.0)) return streflop_libm::__ieee754_log(x);}
     inline Double log2(Double x) {return streflop_libm::__ieee754_log2(x);}
     inline Double exp2(Double x) {return streflop_libm::__ieee754_exp2(x);}
     inline Double log10(Double x) {return streflop_libm::__ieee754_log10(x);}
-    inline Double pow(Double x, Double y) {return streflop_libm::__ieee754_pow(x,y);}
+    inline Double pow(Double x, Double y) {STREFLOP_SLOWPATH_SCOPE(SlowPathPow, x, y) return streflop_libm::__ieee754_pow(x,y);}
 
-    inline Double sin(Double x) {return streflop_libm::__sin(x);}
-    inline Double cos(Double x) {return streflop_libm::__cos(x);}
-    inline Double tan(Double x) {return streflop_libm::tan(x);}
-    inline Double acos(Double x) {return streflop_libm::__ieee754_acos(x);}
-    inline Double asin(Double x) {return streflop_libm::__ieee754_asin(x);}
-    inline Double atan(Double x) {return streflop_libm::atan(x);}
-    inline Double atan2(Double x, Double y) {return streflop_libm::__ieee754_atan2(x,y);}
+    inline Double sin(Double x) {STREFLOP_SLOWPATH_SCOPE(SlowPathSin, x, Double(0.0)) return streflop_libm::__sin(x);}
+    inline Double cos(Double x) {STREFLOP_SLOWPATH_SCOPE(SlowPathCos, x, Double(0.0)) return streflop_libm::__cos(x);}
+    inline void sincos(Double x, Double *sinx, Double *cosx) {STREFLOP_SLOWPATH_SCOPE(SlowPathSincos, x, Double(0.0)) streflop_libm::__sincos(x,sinx,cosx);}
+    inline Double tan(Double x) {STREFLOP_SLOWPATH_SCOPE(SlowPathTan, x, Double(0.0)) return streflop_libm::tan(x);}
+    inline Double acos(Double x) {STREFLOP_SLOWPATH_SCOPE(SlowPathAcos, x, Double(0.0)) return streflop_libm::__ieee754_acos(x);}
+    inline Double asin(Double x) {STREFLOP_SLOWPATH_SCOPE(SlowPathAsin, x, Double(0.0)) return streflop_libm::__ieee754_asin(x);}
+    inline Double atan(Double x) {STREFLOP_SLOWPATH_SCOPE(SlowPathAtan, x, Double(0.0)) return streflop_libm::atan(x);}
+    inline Double atan2(Double x, Double y) {STREFLOP_SLOWPATH_SCOPE(SlowPathAtan2, x, y) return streflop_libm::__ieee754_atan2(x,y);}
 
     inline Double cosh(Double x) {return streflop_libm::__ieee754_cosh(x);}
     inline Double sinh(Double x) {return streflop_libm::__ieee754_sinh(x);}
@@ -471,7 +508,7 @@ enum
     inline Double ldexp(Double value, int exp) {return streflop_libm::__ldexp(value,exp);}
     inline Double logb(Double x) {return streflop_libm::__logb(x);}
     inline int ilogb(Double x) {return streflop_libm::__ilogb(x);}
-    inline Double copysign(Double x) {return streflop_libm::__copysign(x);}
+    inline Double copysign(Double x, Double y) {return streflop_libm::__copysign(x,y);}
     inline int signbit(Double x) {return streflop_libm::__signbit(x);}
     inline Double nextafter(Double x, Double y) {return streflop_libm::__nextafter(x,y);}
 
@@ -486,9 +523,11 @@ enum
     inline Double yn(int n, Double x) {return streflop_libm::__ieee754_yn(n,x);}
     inline Double scalbn(Double x, int n) {return streflop_libm::__scalbn(x,n);}
     inline Double scalbln(Double x, long int n) {return streflop_libm::__scalbln(x,n);}
+    /// Correctly rounded x*y+z, the same in all configurations. Defined in FusedMultiplyAdd.cpp
+    Double fma(Double x, Double y, Double z);
 
     inline int fpclassify(Double x) {return streflop_libm::__fpclassify(x);}
-    inline int isnan(Double x) {return streflop_libm::__isnanl(x);}
+    inline int isnan(Double x) {return streflop_libm::__isnan(x);}
     inline int isinf(Double x) {return streflop_libm::__isinf(x);}
     inline int isfinite(Double x) {return !(isnan(x) || isinf(x));}
 
@@ -531,47 +570,46 @@ enum
 // Extended are not always available
 #ifdef Extended
 
+    inline Extended sqrt(Extended x) {return streflop_libm::__ieee754_sqrtl(x);}
     inline Extended cbrt(Extended x) {return streflop_libm::__cbrtl(x);}
     inline Extended hypot(Extended x, Extended y) {return streflop_libm::__ieee754_hypotl(x,y);}
 
-
-// Missing from libm: temporarily switch to Double and execute the Double version,
-// then switch back to Extended and return the result
-    inline Extended sqrt(Extended x) {streflop_init<Double>(); Double res = sqrt(Double(x)); streflop_init<Extended>(); return Extended(res);}
-
-    inline Extended exp(Extended x) {streflop_init<Double>(); Double res = exp(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended log(Extended x) {streflop_init<Double>(); Double res = log(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended log2(Extended x) {streflop_init<Double>(); Double res = log2(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended exp2(Extended x) {streflop_init<Double>(); Double res = exp2(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended log10(Extended x) {streflop_init<Double>(); Double res = log10(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended pow(Extended x, Extended y) {streflop_init<Double>(); Double res = pow(Double(x), Double(y)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended sin(Extended x) {streflop_init<Double>(); Double res = sin(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended cos(Extended x) {streflop_init<Double>(); Double res = cos(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended tan(Extended x) {streflop_init<Double>(); Double res = tan(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended acos(Extended x) {streflop_init<Double>(); Double res = acos(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended asin(Extended x) {streflop_init<Double>(); Double res = asin(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended atan(Extended x) {streflop_init<Double>(); Double res = atan(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended atan2(Extended x, Extended y) {streflop_init<Double>(); Double res = atan2(Double(x), Double(y)); streflop_init<Extended>(); return Extended(res);}
-
-    inline Extended cosh(Extended x) {streflop_init<Double>(); Double res = cosh(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended sinh(Extended x) {streflop_init<Double>(); Double res = sinh(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended tanh(Extended x) {streflop_init<Double>(); Double res = tanh(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended acosh(Extended x) {streflop_init<Double>(); Double res = acosh(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended asinh(Extended x) {streflop_init<Double>(); Double res = asinh(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended atanh(Extended x) {streflop_init<Double>(); Double res = atanh(Double(x)); streflop_init<Extended>(); return Extended(res);}
-
-
-    inline Extended expm1(Extended x) {streflop_init<Double>(); Double res = expm1(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended log1p(Extended x) {streflop_init<Double>(); Double res = log1p(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended erf(Extended x) {streflop_init<Double>(); Double res = erf(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended j0(Extended x) {streflop_init<Double>(); Double res = j0(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended j1(Extended x) {streflop_init<Double>(); Double res = j1(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended jn(int n, Extended x) {streflop_init<Double>(); Double res = jn(n,Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended y0(Extended x) {streflop_init<Double>(); Double res = y0(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended y1(Extended x) {streflop_init<Double>(); Double res = y1(Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended yn(int n, Extended x) {streflop_init<Double>(); Double res = yn(n,Double(x)); streflop_init<Extended>(); return Extended(res);}
-    inline Extended scalbn(Extended x, int n) {streflop_init<Double>(); Double res = scalbn(Double(x),n); streflop_init<Extended>(); return Extended(res);}
-    inline Extended scalbln(Extended x, long int n) {streflop_init<Double>(); Double res = scalbln(Double(x),n); streflop_init<Extended>(); return Extended(res);}
+    inline Extended exp(Extended x) {return streflop_libm::__ieee754_expl(x);}
+    inline Extended log(Extended x) {return streflop_libm::__ieee754_logl(x);}
+    inline Extended log2(Extended x) {return streflop_libm::__ieee754_log2l(x);}
+    inline Extended exp2(Extended x) {return streflop_libm::__ieee754_exp2l(x);}
+    inline Extended log10(Extended x) {return streflop_libm::__ieee754_log10l(x);}
+    inline Extended pow(Extended x, Extended y) {return streflop_libm::__ieee754_powl(x,y);}
+
+    inline Extended sin(Extended x) {return streflop_libm::__sinl(x);}
+    inline Extended cos(Extended x) {return streflop_libm::__cosl(x);}
+    inline void sincos(Extended x, Extended *sinx, Extended *cosx) {streflop_libm::__sincosl(x,sinx,cosx);}
+    inline Extended tan(Extended x) {return streflop_libm::__tanl(x);}
+    inline Extended acos(Extended x) {return streflop_libm::__ieee754_acosl(x);}
+    inline Extended asin(Extended x) {return streflop_libm::__ieee754_asinl(x);}
+    inline Extended atan(Extended x) {return streflop_libm::__atanl(x);}
+    inline Extended atan2(Extended x, Extended y) {return streflop_libm::__ieee754_atan2l(x,y);}
+
+    inline Extended cosh(Extended x) {return streflop_libm::__ieee754_coshl(x);}
+    inline Extended sinh(Extended x) {return streflop_libm::__ieee754_sinhl(x);}
+    inline Extended tanh(Extended x) {return streflop_libm::__tanhl(x);}
+    inline Extended acosh(Extended x) {return streflop_libm::__ieee754_acoshl(x);}
+    inline Extended asinh(Extended x) {return streflop_libm::__asinhl(x);}
+    inline Extended atanh(Extended x) {return streflop_libm::__ieee754_atanhl(x);}
+
+    inline Extended expm1(Extended x) {return streflop_libm::__expm1l(x);}
+    inline Extended log1p(Extended x) {return streflop_libm::__log1pl(x);}
+    inline Extended erf(Extended x) {return streflop_libm::__erfl(x);}
+    inline Extended j0(Extended x) {return streflop_libm::__ieee754_j0l(x);}
+    inline Extended j1(Extended x) {return streflop_libm::__ieee754_j1l(x);}
+    inline Extended jn(int n, Extended x) {return streflop_libm::__ieee754_jnl(n,x);}
+    inline Extended y0(Extended x) {return streflop_libm::__ieee754_y0l(x);}
+    inline Extended y1(Extended x) {return streflop_libm::__ieee754_y1l(x);}
+    inline Extended yn(int n, Extended x) {return streflop_libm::__ieee754_ynl(n,x);}
+    inline Extended scalbn(Extended x, int n) {return streflop_libm::__scalbnl(x,n);}
+    inline Extended scalbln(Extended x, long int n) {return streflop_libm::__scalblnl(x,n);}
+    /// Correctly rounded x*y+z, the same in all configurations. Defined in FusedMultiplyAdd.cpp
+    Extended fma(Extended x, Extended y, Extended z);
 
 
 
@@ -594,7 +632,7 @@ enum
     inline Extended ldexp(Extended value, int exp) {return streflop_libm::__ldexpl(value,exp);}
     inline Extended logb(Extended x) {return streflop_libm::__logbl(x);}
     inline int ilogb(Extended x) {return streflop_libm::__ilogbl(x);}
-    inline Extended copysign(Extended x) {return streflop_libm::__copysignl(x);}
+    inline Extended copysign(Extended x, Extended y) {return streflop_libm::__copysignl(x,y);}
     inline int signbit (Extended x) {return streflop_libm::__signbitl(x);}
     inline Extended nextafter(Extended x, Extended y) {return streflop_libm::__nextafterl(x,y);}
 
@@ -656,6 +694,7 @@ enum
 
     inline Extended sinl(Extended x) {return sin(x);}
     inline Extended cosl(Extended x) {return cos(x);}
+    inline void sincosl(Extended x, Extended *sinx, Extended *cosx) {sincos(x, sinx, cosx);}
     inline Extended tanl(Extended x) {return tan(x);}
     inline Extended acosl(Extended x) {return acos(x);}
     inline Extended asinl(Extended x) {return asin(x);}
@@ -688,7 +727,7 @@ enum
     inline Extended ldexpl(Extended value, int exp) {return ldexp(value,exp);}
     inline Extended logbl(Extended x) {return logb(x);}
     inline int ilogbl(Extended x) {return ilogb(x);}
-    inline Extended copysignl(Extended x) {return copysign(x);}
+    inline Extended copysignl(Extended x, Extended y) {return copysign(x,y);}
     inline int signbitl(Extended x) {return signbit(x);}
     inline Extended nextafterl(Extended x, Extended y) {return nextafter(x, y);}
 
@@ -703,6 +742,7 @@ enum
     inline Extended ynl(int n, Extended x) {return yn(n, x);}
     inline Extended scalbnl(Extended x, int n) {return scalbn(x, n);}
     inline Extended scalblnl(Extended x, long int n) {return scalbln(x, n);}
+    inline Extended fmal(Extended x, Extended y, Extended z) {return fma(x, y, z);}
 
     inline int fpclassifyl(Extended x) {return fpclassify(x);}
     inline int isnanl(Extended x) {return isnan(x);}
@@ -720,6 +760,87 @@ enum
 
 #endif
 
+/** Batch versions of the math functions
+
+    Each function above returning a real from one or two reals also has an array form:
+        void sin(const Double* in, Double* out, size_t n);
+        void pow(const Double* x, const Double* y, Double* out, size_t n);
+    computing out[i] = f(in[i]) for i in [0, n). out may be the same array as an input,
+    other overlaps are undefined. sincos has the form
+        void sincos(const Double* in, Double* sinx, Double* cosx, size_t n);
+    and fma the form
+        void fma(const Double* x, const Double* y, const Double* z, Double* out, size_t n);
+
+    The results are bit-identical to n calls of the scalar function: the very same libm
+    code is run (same polynomials, same range reduction, same slow paths).
+    With SSE and denormals, the Simple and Double exp, log, sin and cos run that code on
+    all the lanes of a vector, operation by operation, and call the scalar function for the
+    arguments off the fast paths, see libm/batch.h. The Double ones only do so in the
+    rounding to nearest, and exp and log only with 256-bit AVX vectors. Elsewhere the batch
+    form only saves the call overhead. batchTest checks the bits and reports the speedups.
+    Where the scalar result is exactly specified by IEEE754 (sqrt, fabs) and the FPU is
+    configured the same way (SSE, denormals, round to nearest), packed SSE2 instructions
+    are used instead. So are the packed FMA instructions for fma when the library is
+    compiled for them (-mfma), as they round correctly in every mode.
+
+    Defined in MathBatch.cpp
+*/
+#define STREFLOP_BATCH_UNARY(func, a_type) void func(const a_type* in, a_type* out, size_t n);
+#define STREFLOP_BATCH_BINARY(func, a_type) void func(const a_type* x, const a_type* y, a_type* out, size_t n);
+#define STREFLOP_BATCH_SINCOS(a_type) void sincos(const a_type* in, a_type* sinx, a_type* cosx, size_t n);
+#define STREFLOP_BATCH_FMA(a_type) void fma(const a_type* x, const a_type* y, const a_type* z, a_type* out, size_t n);
+
+#define STREFLOP_BATCH_DECLARE(a_type) \
+    STREFLOP_BATCH_UNARY(sqrt, a_type) \
+    STREFLOP_BATCH_UNARY(cbrt, a_type) \
+    STREFLOP_BATCH_BINARY(hypot, a_type) \
+    STREFLOP_BATCH_UNARY(exp, a_type) \
+    STREFLOP_BATCH_UNARY(log, a_type) \
+    STREFLOP_BATCH_UNARY(log2, a_type) \
+    STREFLOP_BATCH_UNARY(exp2, a_type) \
+    STREFLOP_BATCH_UNARY(log10, a_type) \
+    STREFLOP_BATCH_BINARY(pow, a_type) \
+    STREFLOP_BATCH_UNARY(sin, a_type) \
+    STREFLOP_BATCH_UNARY(cos, a_type) \
+    STREFLOP_BATCH_SINCOS(a_type) \
+    STREFLOP_BATCH_UNARY(tan, a_type) \
+    STREFLOP_BATCH_UNARY(acos, a_type) \
+    STREFLOP_BATCH_UNARY(asin, a_type) \
+    STREFLOP_BATCH_UNARY(atan, a_type) \
+    STREFLOP_BATCH_BINARY(atan2, a_type) \
+    STREFLOP_BATCH_UNARY(cosh, a_type) \
+    STREFLOP_BATCH_UNARY(sinh, a_type) \
+    STREFLOP_BATCH_UNARY(tanh, a_type) \
+    STREFLOP_BATCH_UNARY(acosh, a_type) \
+    STREFLOP_BATCH_UNARY(asinh, a_type) \
+    STREFLOP_BATCH_UNARY(atanh, a_type) \
+    STREFLOP_BATCH_UNARY(fabs, a_type) \
+    STREFLOP_BATCH_UNARY(floor, a_type) \
+    STREFLOP_BATCH_UNARY(ceil, a_type) \
+    STREFLOP_BATCH_UNARY(trunc, a_type) \
+    STREFLOP_BATCH_BINARY(fmod, a_type) \
+    STREFLOP_BATCH_BINARY(remainder, a_type) \
+    STREFLOP_BATCH_UNARY(rint, a_type) \
+    STREFLOP_BATCH_UNARY(round, a_type) \
+    STREFLOP_BATCH_UNARY(nearbyint, a_type) \
+    STREFLOP_BATCH_UNARY(logb, a_type) \
+    STREFLOP_BATCH_BINARY(nextafter, a_type) \
+    STREFLOP_BATCH_UNARY(expm1, a_type) \
+    STREFLOP_BATCH_UNARY(log1p, a_type) \
+    STREFLOP_BATCH_UNARY(erf, a_type) \
+    STREFLOP_BATCH_UNARY(j0, a_type) \
+    STREFLOP_BATCH_UNARY(j1, a_type) \
+    STREFLOP_BATCH_UNARY(y0, a_type) \
+    STREFLOP_BATCH_UNARY(y1, a_type) \
+    STREFLOP_BATCH_FMA(a_type)
+
+STREFLOP_BATCH_DECLARE(Simple)
+STREFLOP_BATCH_DECLARE(Double)
+#ifdef Extended
+STREFLOP_BATCH_DECLARE(Extended)
+#endif
+
+
 }
 
 #endif
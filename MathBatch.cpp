@@ -0,0 +1,226 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Batch versions of the Math.h functions, see the comments there
+
+// Includes Math.h in turn
+#include "streflop.h"
+
+// Packed instructions are only bit-identical to the scalar libm when the FPU is set up
+// the same way for both. The x87 and soft configurations do not use them at all, and the
+// no denormal SSE mode would flush the inputs the libm handles in software.
+#if defined(STREFLOP_SSE) && defined(__SSE2__) && !defined(STREFLOP_NO_DENORMALS)
+#define STREFLOP_BATCH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Same for the FMA instructions, see FusedMultiplyAdd.cpp
+#if defined(STREFLOP_BATCH_SSE2) && defined(__FMA__)
+#define STREFLOP_BATCH_FMA3 1
+#include <immintrin.h>
+#endif
+
+namespace streflop {
+
+// Generic case: loop over the inlined scalar function
+#define STREFLOP_BATCH_LOOP_UNARY(func, a_type) \
+void func(const a_type* in, a_type* out, size_t n) { \
+    for (size_t i = 0; i < n; ++i) out[i] = func(in[i]); \
+}
+
+#define STREFLOP_BATCH_LOOP_BINARY(func, a_type) \
+void func(const a_type* x, const a_type* y, a_type* out, size_t n) { \
+    for (size_t i = 0; i < n; ++i) out[i] = func(x[i], y[i]); \
+}
+
+#define STREFLOP_BATCH_LOOP_SINCOS(a_type) \
+void sincos(const a_type* in, a_type* sinx, a_type* cosx, size_t n) { \
+    for (size_t i = 0; i < n; ++i) sincos(in[i], &sinx[i], &cosx[i]); \
+}
+
+#define STREFLOP_BATCH_LOOP_FMA(a_type) \
+void fma(const a_type* x, const a_type* y, const a_type* z, a_type* out, size_t n) { \
+    for (size_t i = 0; i < n; ++i) out[i] = fma(x[i], y[i], z[i]); \
+}
+
+// These are the same for all types, sqrt and fabs are handled separately
+#define STREFLOP_BATCH_LOOP_ALL(a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(cbrt, a_type) \
+    STREFLOP_BATCH_LOOP_BINARY(hypot, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(floor, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(ceil, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(trunc, a_type) \
+    STREFLOP_BATCH_LOOP_BINARY(fmod, a_type) \
+    STREFLOP_BATCH_LOOP_BINARY(remainder, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(rint, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(round, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(nearbyint, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(logb, a_type) \
+    STREFLOP_BATCH_LOOP_BINARY(nextafter, a_type)
+
+// The transcendental functions, exp, log, sin and cos are handled separately
+#define STREFLOP_BATCH_LOOP_DOUBLE_BASED(a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(log2, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(exp2, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(log10, a_type) \
+    STREFLOP_BATCH_LOOP_BINARY(pow, a_type) \
+    STREFLOP_BATCH_LOOP_SINCOS(a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(tan, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(acos, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(asin, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(atan, a_type) \
+    STREFLOP_BATCH_LOOP_BINARY(atan2, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(cosh, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(sinh, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(tanh, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(acosh, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(asinh, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(atanh, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(expm1, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(log1p, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(erf, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(j0, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(j1, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(y0, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(y1, a_type)
+
+// These have packed kernels for Simple and Double, see below
+#define STREFLOP_BATCH_LOOP_PACKED(a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(exp, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(log, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(sin, a_type) \
+    STREFLOP_BATCH_LOOP_UNARY(cos, a_type)
+
+STREFLOP_BATCH_LOOP_ALL(Simple)
+STREFLOP_BATCH_LOOP_DOUBLE_BASED(Simple)
+STREFLOP_BATCH_LOOP_ALL(Double)
+STREFLOP_BATCH_LOOP_DOUBLE_BASED(Double)
+
+#ifdef STREFLOP_BATCH_PACKED
+
+// The libm kernels do the operations of the scalar functions on all the lanes of a vector,
+// and call the scalar functions for the arguments off their fast paths. See libm/batch.h
+#define STREFLOP_BATCH_KERNEL(func, a_type, kernel) \
+void func(const a_type* in, a_type* out, size_t n) { \
+    streflop_libm::kernel(in, out, n); \
+}
+
+// The IBM Double functions are written for the rounding to nearest, in the other modes
+// their table indices may fall out of the tables. The scalar calls are kept there.
+#define STREFLOP_BATCH_KERNEL_NEAREST(func, a_type, kernel) \
+void func(const a_type* in, a_type* out, size_t n) { \
+    if (fegetround() == FE_TONEAREST) streflop_libm::kernel(in, out, n); \
+    else for (size_t i = 0; i < n; ++i) out[i] = func(in[i]); \
+}
+
+STREFLOP_BATCH_KERNEL(exp, Simple, __expf_batch)
+STREFLOP_BATCH_KERNEL(log, Simple, __logf_batch)
+STREFLOP_BATCH_KERNEL(sin, Simple, __sinf_batch)
+STREFLOP_BATCH_KERNEL(cos, Simple, __cosf_batch)
+STREFLOP_BATCH_KERNEL_NEAREST(sin, Double, __sin_batch)
+STREFLOP_BATCH_KERNEL_NEAREST(cos, Double, __cos_batch)
+// Not for the table-driven exp and log, nor on two lanes: the table lookups lane by lane
+// take more than the packed operations save, see libm/e_exp_batch.c
+#if defined(STREFLOP_TABLE_EXPLOG) || !defined(__AVX__)
+STREFLOP_BATCH_LOOP_UNARY(exp, Double)
+STREFLOP_BATCH_LOOP_UNARY(log, Double)
+#else
+STREFLOP_BATCH_KERNEL_NEAREST(exp, Double, __exp_batch)
+STREFLOP_BATCH_KERNEL_NEAREST(log, Double, __log_batch)
+#endif
+
+#else
+
+STREFLOP_BATCH_LOOP_PACKED(Simple)
+STREFLOP_BATCH_LOOP_PACKED(Double)
+
+#endif
+
+#ifdef STREFLOP_BATCH_SSE2
+
+// IEEE754 mandates correct rounding for the square root, so the hardware instruction
+// gives the same result as the libm code in the default rounding mode.
+// The other modes are left to the libm, which is not guaranteed to match there.
+void sqrt(const Simple* in, Simple* out, size_t n) {
+    size_t i = 0;
+    if (fegetround() == FE_TONEAREST) {
+        for (; i + 4 <= n; i += 4) _mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_loadu_ps(in + i)));
+    }
+    for (; i < n; ++i) out[i] = sqrt(in[i]);
+}
+
+void sqrt(const Double* in, Double* out, size_t n) {
+    size_t i = 0;
+    if (fegetround() == FE_TONEAREST) {
+        for (; i + 2 <= n; i += 2) _mm_storeu_pd(out + i, _mm_sqrt_pd(_mm_loadu_pd(in + i)));
+    }
+    for (; i < n; ++i) out[i] = sqrt(in[i]);
+}
+
+// The libm only clears the sign bit, NaN payloads included. So do we.
+void fabs(const Simple* in, Simple* out, size_t n) {
+    const __m128 mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) _mm_storeu_ps(out + i, _mm_and_ps(_mm_loadu_ps(in + i), mask));
+    for (; i < n; ++i) out[i] = fabs(in[i]);
+}
+
+void fabs(const Double* in, Double* out, size_t n) {
+    const __m128d mask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) _mm_storeu_pd(out + i, _mm_and_pd(_mm_loadu_pd(in + i), mask));
+    for (; i < n; ++i) out[i] = fabs(in[i]);
+}
+
+#else
+
+STREFLOP_BATCH_LOOP_UNARY(sqrt, Simple)
+STREFLOP_BATCH_LOOP_UNARY(sqrt, Double)
+STREFLOP_BATCH_LOOP_UNARY(fabs, Simple)
+STREFLOP_BATCH_LOOP_UNARY(fabs, Double)
+
+#endif
+
+#ifdef STREFLOP_BATCH_FMA3
+
+// Correctly rounded in all modes, like the scalar fma
+void fma(const Simple* x, const Simple* y, const Simple* z, Simple* out, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) _mm_storeu_ps(out + i, _mm_fmadd_ps(_mm_loadu_ps(x + i), _mm_loadu_ps(y + i), _mm_loadu_ps(z + i)));
+    for (; i < n; ++i) out[i] = fma(x[i], y[i], z[i]);
+}
+
+void fma(const Double* x, const Double* y, const Double* z, Double* out, size_t n) {
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) _mm_storeu_pd(out + i, _mm_fmadd_pd(_mm_loadu_pd(x + i), _mm_loadu_pd(y + i), _mm_loadu_pd(z + i)));
+    for (; i < n; ++i) out[i] = fma(x[i], y[i], z[i]);
+}
+
+#else
+
+STREFLOP_BATCH_LOOP_FMA(Simple)
+STREFLOP_BATCH_LOOP_FMA(Double)
+
+#endif
+
+// Extended are not always available
+#ifdef Extended
+
+STREFLOP_BATCH_LOOP_ALL(Extended)
+STREFLOP_BATCH_LOOP_DOUBLE_BASED(Extended)
+STREFLOP_BATCH_LOOP_PACKED(Extended)
+STREFLOP_BATCH_LOOP_UNARY(sqrt, Extended)
+STREFLOP_BATCH_LOOP_UNARY(fabs, Extended)
+STREFLOP_BATCH_LOOP_FMA(Extended)
+
+#endif
+
+}
@@ -12,16 +12,246 @@
 // Include time(0) function to get a seed based on system time
 #include <time.h>
 #include <iostream>
+// memcpy for the jump ahead
+#include <string.h>
 using namespace std;
 #include "streflop.h"
 
-// Include endian-specific code
+// Include endian-specific code. System.h is already there with STREFLOP_SOFT_INLINE
+#ifndef STREFLOP_SYSTEM_H
 #undef __BYTE_ORDER
 #undef __FLOAT_WORD_ORDER
 #include "System.h"
+#endif
+
+// SSE2 integer instructions for the SFMT generator, whatever the FPU configuration
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 namespace streflop {
 
+//////////////////////////////////////////////////////////////////////
+// Code adapted from SFMT.c, SFMT-sse2.h and SFMT-params19937.h
+//////////////////////////////////////////////////////////////////////
+
+/*
+   SIMD oriented Fast Mersenne Twister (SFMT)
+   Mutsuo Saito (Hiroshima University) and Makoto Matsumoto (Hiroshima University)
+
+   Copyright (C) 2006, 2007 Mutsuo Saito, Makoto Matsumoto and Hiroshima
+   University. All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+
+       * Redistributions of source code must retain the above copyright
+         notice, this list of conditions and the following disclaimer.
+       * Redistributions in binary form must reproduce the above
+         copyright notice, this list of conditions and the following
+         disclaimer in the documentation and/or other materials provided
+         with the distribution.
+       * Neither the name of the Hiroshima University nor the names of
+         its contributors may be used to endorse or promote products
+         derived from this software without specific prior written
+         permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// The SFMT state is the same 19968 bits array as the MT one, seen as 156 128-bit words.
+// It is always handled as 32-bit words, which makes the sequence independent of the
+// byte order and of the generator size. The 64-bit outputs are built from two 32-bit
+// words in the same order as SFMT gen_rand64 on little endian machines.
+#define SFMT_N 156
+#define SFMT_POS1 122
+#define SFMT_SL1 18
+#define SFMT_SL2 1
+#define SFMT_SR1 11
+#define SFMT_SR2 1
+#define SFMT_MSK1 0xdfffffefUL
+#define SFMT_MSK2 0xddfecb7fUL
+#define SFMT_MSK3 0xbffaffffUL
+#define SFMT_MSK4 0xbffffff6UL
+#define SFMT_PARITY1 0x00000001UL
+#define SFMT_PARITY2 0x00000000UL
+#define SFMT_PARITY3 0x00000000UL
+#define SFMT_PARITY4 0x13c9e684UL
+
+inline SizedUnsignedInteger<32>::Type* sfmt_words(RandomState& state) {
+    return reinterpret_cast<SizedUnsignedInteger<32>::Type*>(state.mt);
+}
+
+/* certificate the period of 2^19937-1 */
+inline void sfmt_period_certification(RandomState& state)
+{
+    SizedUnsignedInteger<32>::Type* psfmt32 = sfmt_words(state);
+    static const SizedUnsignedInteger<32>::Type parity[4] = {SFMT_PARITY1, SFMT_PARITY2, SFMT_PARITY3, SFMT_PARITY4};
+    SizedUnsignedInteger<32>::Type inner = 0;
+    int i, j;
+    SizedUnsignedInteger<32>::Type work;
+
+    for (i = 0; i < 4; i++) inner ^= psfmt32[i] & parity[i];
+    for (i = 16; i > 0; i >>= 1) inner ^= inner >> i;
+    inner &= 1;
+    /* check OK */
+    if (inner == 1) return;
+    /* check NG, and modification */
+    for (i = 0; i < 4; i++) {
+        work = 1;
+        for (j = 0; j < 32; j++) {
+            if ((work & parity[i]) != 0) {
+                psfmt32[i] ^= work;
+                return;
+            }
+            work = work << 1;
+        }
+    }
+}
+
+/* initializes the state with a seed, same as MT19937 on the 32-bit words */
+inline void sfmt_init_genrand(SizedUnsignedInteger<32>::Type s, RandomState& state)
+{
+    SizedUnsignedInteger<32>::Type* psfmt32 = sfmt_words(state);
+    state.seed = s;
+    psfmt32[0] = s;
+    for (int i = 1; i < SFMT_N*4; i++) {
+        psfmt32[i] = 1812433253UL * (psfmt32[i-1] ^ (psfmt32[i-1] >> 30)) + i;
+    }
+    sfmt_period_certification(state);
+    state.mti = 19968/STREFLOP_RANDOM_GEN_SIZE;
+}
+
+/* Portable versions, also used for jumping ahead */
+/* 128-bit shifts of 4 32-bit words, by bytes */
+inline void sfmt_rshift128(SizedUnsignedInteger<32>::Type* out, const SizedUnsignedInteger<32>::Type* in, int shift)
+{
+    SizedUnsignedInteger<64>::Type th, tl, oh, ol;
+
+    th = (SizedUnsignedInteger<64>::Type(in[3]) << 32) | in[2];
+    tl = (SizedUnsignedInteger<64>::Type(in[1]) << 32) | in[0];
+
+    oh = th >> (shift * 8);
+    ol = tl >> (shift * 8);
+    ol |= th << (64 - shift * 8);
+    out[1] = SizedUnsignedInteger<32>::Type(ol >> 32);
+    out[0] = SizedUnsignedInteger<32>::Type(ol);
+    out[3] = SizedUnsignedInteger<32>::Type(oh >> 32);
+    out[2] = SizedUnsignedInteger<32>::Type(oh);
+}
+
+inline void sfmt_lshift128(SizedUnsignedInteger<32>::Type* out, const SizedUnsignedInteger<32>::Type* in, int shift)
+{
+    SizedUnsignedInteger<64>::Type th, tl, oh, ol;
+
+    th = (SizedUnsignedInteger<64>::Type(in[3]) << 32) | in[2];
+    tl = (SizedUnsignedInteger<64>::Type(in[1]) << 32) | in[0];
+
+    oh = th << (shift * 8);
+    ol = tl << (shift * 8);
+    oh |= tl >> (64 - shift * 8);
+    out[1] = SizedUnsignedInteger<32>::Type(ol >> 32);
+    out[0] = SizedUnsignedInteger<32>::Type(ol);
+    out[3] = SizedUnsignedInteger<32>::Type(oh >> 32);
+    out[2] = SizedUnsignedInteger<32>::Type(oh);
+}
+
+/* the recursion, on 128-bit words */
+inline void sfmt_recursion(SizedUnsignedInteger<32>::Type* r, const SizedUnsignedInteger<32>::Type* a, const SizedUnsignedInteger<32>::Type* b, const SizedUnsignedInteger<32>::Type* c, const SizedUnsignedInteger<32>::Type* d)
+{
+    SizedUnsignedInteger<32>::Type x[4], y[4];
+
+    sfmt_lshift128(x, a, SFMT_SL2);
+    sfmt_rshift128(y, c, SFMT_SR2);
+    r[0] = a[0] ^ x[0] ^ ((b[0] >> SFMT_SR1) & SFMT_MSK1) ^ y[0] ^ (d[0] << SFMT_SL1);
+    r[1] = a[1] ^ x[1] ^ ((b[1] >> SFMT_SR1) & SFMT_MSK2) ^ y[1] ^ (d[1] << SFMT_SL1);
+    r[2] = a[2] ^ x[2] ^ ((b[2] >> SFMT_SR1) & SFMT_MSK3) ^ y[2] ^ (d[2] << SFMT_SL1);
+    r[3] = a[3] ^ x[3] ^ ((b[3] >> SFMT_SR1) & SFMT_MSK4) ^ y[3] ^ (d[3] << SFMT_SL1);
+}
+
+#if defined(__SSE2__)
+
+/* the recursion, on 128-bit words */
+inline __m128i sfmt_recursion(__m128i a, __m128i b, __m128i c, __m128i d, __m128i mask)
+{
+    __m128i v, x, y, z;
+
+    y = _mm_srli_epi32(b, SFMT_SR1);
+    z = _mm_srli_si128(c, SFMT_SR2);
+    v = _mm_slli_epi32(d, SFMT_SL1);
+    z = _mm_xor_si128(z, a);
+    z = _mm_xor_si128(z, v);
+    x = _mm_slli_si128(a, SFMT_SL2);
+    y = _mm_and_si128(y, mask);
+    z = _mm_xor_si128(z, x);
+    z = _mm_xor_si128(z, y);
+    return z;
+}
+
+/* fills the internal state array with pseudorandom integers */
+inline void sfmt_gen_rand_all(RandomState& state)
+{
+    __m128i* sfmt = reinterpret_cast<__m128i*>(state.mt);
+    const __m128i mask = _mm_set_epi32(SFMT_MSK4, SFMT_MSK3, SFMT_MSK2, SFMT_MSK1);
+    __m128i r, r1, r2;
+    int i;
+
+    r1 = _mm_load_si128(&sfmt[SFMT_N - 2]);
+    r2 = _mm_load_si128(&sfmt[SFMT_N - 1]);
+    for (i = 0; i < SFMT_N - SFMT_POS1; i++) {
+        r = sfmt_recursion(_mm_load_si128(&sfmt[i]), _mm_load_si128(&sfmt[i + SFMT_POS1]), r1, r2, mask);
+        _mm_store_si128(&sfmt[i], r);
+        r1 = r2;
+        r2 = r;
+    }
+    for (; i < SFMT_N; i++) {
+        r = sfmt_recursion(_mm_load_si128(&sfmt[i]), _mm_load_si128(&sfmt[i + SFMT_POS1 - SFMT_N]), r1, r2, mask);
+        _mm_store_si128(&sfmt[i], r);
+        r1 = r2;
+        r2 = r;
+    }
+}
+
+#else
+
+/* fills the internal state array with pseudorandom integers */
+inline void sfmt_gen_rand_all(RandomState& state)
+{
+    SizedUnsignedInteger<32>::Type* sfmt = sfmt_words(state);
+    const SizedUnsignedInteger<32>::Type *r1, *r2;
+    int i;
+
+    r1 = &sfmt[(SFMT_N - 2)*4];
+    r2 = &sfmt[(SFMT_N - 1)*4];
+    for (i = 0; i < SFMT_N - SFMT_POS1; i++) {
+        sfmt_recursion(&sfmt[i*4], &sfmt[i*4], &sfmt[(i + SFMT_POS1)*4], r1, r2);
+        r1 = r2;
+        r2 = &sfmt[i*4];
+    }
+    for (; i < SFMT_N; i++) {
+        sfmt_recursion(&sfmt[i*4], &sfmt[i*4], &sfmt[(i + SFMT_POS1 - SFMT_N)*4], r1, r2);
+        r1 = r2;
+        r2 = &sfmt[i*4];
+    }
+}
+
+#endif
+
+//////////////////////////////////////////////////////////////////////
+// End of code adapted from SFMT
+//////////////////////////////////////////////////////////////////////
+
 //////////////////////////////////////////////////////////////////////
 // Code stolen and adapted from mt19937ar.c
 //////////////////////////////////////////////////////////////////////
@@ -97,36 +327,38 @@ inline void init_genrand(SizedUnsignedInteger<32>::Type s, RandomState& state)
     }
 }
 
-/* generates a random number on [0,0xffffffff]-interval */
-inline SizedUnsignedInteger<32>::Type genrand_int(RandomState& state)
+/* generates N words at one time */
+inline void genrand_block(RandomState& state)
 {
     SizedUnsignedInteger<32>::Type y;
     static SizedUnsignedInteger<32>::Type mag01[2]={0x0UL, MATRIX_A};
     /* mag01[x] = x * MATRIX_A  for x=0,1 */
+    int kk;
 
-    if (state.mti >= N) { /* generate N words at one time */
-        int kk;
+    //if (state.mti == N+1)   /* if init_genrand() has not been called, */
+        //init_genrand(5489UL, state); /* a default initial seed is used */
 
-        //if (state.mti == N+1)   /* if init_genrand() has not been called, */
-            //init_genrand(5489UL, state); /* a default initial seed is used */
-
-        for (kk=0;kk<N-M;kk++) {
-            y = (state.mt[kk]&UPPER_MASK)|(state.mt[kk+1]&LOWER_MASK);
-            state.mt[kk] = state.mt[kk+M] ^ (y >> 1) ^ mag01[y & 0x1UL];
-        }
-        for (;kk<N-1;kk++) {
-            y = (state.mt[kk]&UPPER_MASK)|(state.mt[kk+1]&LOWER_MASK);
-            state.mt[kk] = state.mt[kk+(M-N)] ^ (y >> 1) ^ mag01[y & 0x1UL];
-        }
-        y = (state.mt[N-1]&UPPER_MASK)|(state.mt[0]&LOWER_MASK);
-        state.mt[N-1] = state.mt[M-1] ^ (y >> 1) ^ mag01[y & 0x1UL];
+    if (state.generator == STREFLOP_SFMT19937) sfmt_gen_rand_all(state);
+    else {
 
-        state.mti = 0;
+    for (kk=0;kk<N-M;kk++) {
+        y = (state.mt[kk]&UPPER_MASK)|(state.mt[kk+1]&LOWER_MASK);
+        state.mt[kk] = state.mt[kk+M] ^ (y >> 1) ^ mag01[y & 0x1UL];
+    }
+    for (;kk<N-1;kk++) {
+        y = (state.mt[kk]&UPPER_MASK)|(state.mt[kk+1]&LOWER_MASK);
+        state.mt[kk] = state.mt[kk+(M-N)] ^ (y >> 1) ^ mag01[y & 0x1UL];
+    }
+    y = (state.mt[N-1]&UPPER_MASK)|(state.mt[0]&LOWER_MASK);
+    state.mt[N-1] = state.mt[M-1] ^ (y >> 1) ^ mag01[y & 0x1UL];
     }
-  
-    y = state.mt[state.mti++];
 
-    /* Tempering */
+    state.mti = 0;
+}
+
+/* tempers a MT19937 state word */
+inline SizedUnsignedInteger<32>::Type mt_temper(SizedUnsignedInteger<32>::Type y)
+{
     y ^= (y >> 11);
     y ^= (y << 7) & 0x9d2c5680UL;
     y ^= (y << 15) & 0xefc60000UL;
@@ -135,6 +367,26 @@ inline SizedUnsignedInteger<32>::Type genrand_int(RandomState& state)
     return y;
 }
 
+/* SFMT needs no tempering, the state word is the output */
+inline SizedUnsignedInteger<32>::Type sfmt_output(const RandomState& state, int i)
+{
+    return state.mt[i];
+}
+
+/* converts the state word at index i to the output number */
+inline SizedUnsignedInteger<32>::Type genrand_temper(const RandomState& state, int i)
+{
+    if (state.generator == STREFLOP_SFMT19937) return sfmt_output(state, i);
+    return mt_temper(state.mt[i]);
+}
+
+/* generates a random number on [0,0xffffffff]-interval */
+inline SizedUnsignedInteger<32>::Type genrand_int(RandomState& state)
+{
+    if (state.mti >= N) genrand_block(state);
+    return genrand_temper(state, state.mti++);
+}
+
 #else
 
 //////////////////////////////////////////////////////////////////////
@@ -212,36 +464,39 @@ inline void init_genrand(SizedUnsignedInteger<64>::Type seed, RandomState& state
         state.mt[state.mti] =  (SizedUnsignedInteger<64>::Type(6364136223846793005ULL) * (state.mt[state.mti-1] ^ (state.mt[state.mti-1] >> 62)) + state.mti);
 }
 
-/* generates a random number on [0, 2^64-1]-interval */
-inline SizedUnsignedInteger<64>::Type genrand_int(RandomState& state)
+/* generates NN words at one time */
+inline void genrand_block(RandomState& state)
 {
     int i;
     SizedUnsignedInteger<64>::Type x;
     static SizedUnsignedInteger<64>::Type mag01[2]={0ULL, MATRIX_A};
 
-    if (state.mti >= NN) { /* generate NN words at one time */
-
-        /* if init_genrand64() has not been called, */
-        /* a default initial seed is used     */
-        //if (state.mti == NN+1)
-            //init_genrand64(5489ULL, state);
+    /* if init_genrand64() has not been called, */
+    /* a default initial seed is used     */
+    //if (state.mti == NN+1)
+        //init_genrand64(5489ULL, state);
 
-        for (i=0;i<NN-MM;i++) {
-            x = (state.mt[i]&UM)|(state.mt[i+1]&LM);
-            state.mt[i] = state.mt[i+MM] ^ (x>>1) ^ mag01[(int)(x&1ULL)];
-        }
-        for (;i<NN-1;i++) {
-            x = (state.mt[i]&UM)|(state.mt[i+1]&LM);
-            state.mt[i] = state.mt[i+(MM-NN)] ^ (x>>1) ^ mag01[(int)(x&1ULL)];
-        }
-        x = (state.mt[NN-1]&UM)|(state.mt[0]&LM);
-        state.mt[NN-1] = state.mt[MM-1] ^ (x>>1) ^ mag01[(int)(x&1ULL)];
+    if (state.generator == STREFLOP_SFMT19937) sfmt_gen_rand_all(state);
+    else {
 
-        state.mti = 0;
+    for (i=0;i<NN-MM;i++) {
+        x = (state.mt[i]&UM)|(state.mt[i+1]&LM);
+        state.mt[i] = state.mt[i+MM] ^ (x>>1) ^ mag01[(int)(x&1ULL)];
     }
-  
-    x = state.mt[state.mti++];
+    for (;i<NN-1;i++) {
+        x = (state.mt[i]&UM)|(state.mt[i+1]&LM);
+        state.mt[i] = state.mt[i+(MM-NN)] ^ (x>>1) ^ mag01[(int)(x&1ULL)];
+    }
+    x = (state.mt[NN-1]&UM)|(state.mt[0]&LM);
+    state.mt[NN-1] = state.mt[MM-1] ^ (x>>1) ^ mag01[(int)(x&1ULL)];
+    }
+
+    state.mti = 0;
+}
 
+/* tempers a MT19937-64 state word */
+inline SizedUnsignedInteger<64>::Type mt_temper(SizedUnsignedInteger<64>::Type x)
+{
     x ^= (x >> 29) & 0x5555555555555555ULL;
     x ^= (x << 17) & 0x71D67FFFEDA60000ULL;
     x ^= (x << 37) & 0xFFF7EEE000000000ULL;
@@ -249,26 +504,178 @@ inline SizedUnsignedInteger<64>::Type genrand_int(RandomState& state)
 
     return x;
 }
+
+/* SFMT needs no tempering, assemble the 32-bit words independently of the byte order */
+inline SizedUnsignedInteger<64>::Type sfmt_output(const RandomState& state, int i)
+{
+    const SizedUnsignedInteger<32>::Type* psfmt32 = reinterpret_cast<const SizedUnsignedInteger<32>::Type*>(state.mt) + 2 * i;
+    return (SizedUnsignedInteger<64>::Type(psfmt32[1]) << 32) | psfmt32[0];
+}
+
+/* converts the state word at index i to the output number */
+inline SizedUnsignedInteger<64>::Type genrand_temper(const RandomState& state, int i)
+{
+    if (state.generator == STREFLOP_SFMT19937) return sfmt_output(state, i);
+    return mt_temper(state.mt[i]);
+}
+
+/* generates a random number on [0, 2^64-1]-interval */
+inline SizedUnsignedInteger<64>::Type genrand_int(RandomState& state)
+{
+    if (state.mti >= NN) genrand_block(state);
+    return genrand_temper(state, state.mti++);
+}
 #endif
 
 //////////////////////////////////////////////////////////////////////
 // End of code adapted from mt19937-64.c
 //////////////////////////////////////////////////////////////////////
 
+/* fills out with the next n random numbers, taken directly from the state block */
+inline void genrand_fill(SizedUnsignedInteger<STREFLOP_RANDOM_GEN_SIZE>::Type* out, size_t n, RandomState& state)
+{
+    const int nwords = 19968/STREFLOP_RANDOM_GEN_SIZE;
+    while (n>0) {
+        if (state.mti >= nwords) genrand_block(state);
+        size_t m = nwords - state.mti;
+        if (m > n) m = n;
+        // keep the generator test out of the loops
+        if (state.generator == STREFLOP_SFMT19937) for (size_t i = 0; i < m; ++i) out[i] = sfmt_output(state, state.mti + i);
+        else for (size_t i = 0; i < m; ++i) out[i] = mt_temper(state.mt[state.mti + i]);
+        state.mti += m;
+        out += m;
+        n -= m;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Counter-based generator: Threefry-4x32-20, from
+// J. K. Salmon, M. A. Moraes, R. O. Dror, D. E. Shaw,
+// "Parallel Random Numbers: As Easy as 1, 2, 3", SC11, 2011.
+//////////////////////////////////////////////////////////////////////
+
+/*
+   Each 128-bit counter value is encrypted with the 128-bit key by a reduced Threefish
+   block cipher, giving 4 random 32-bit words. Only additions, rotations and xors on
+   32-bit integers are involved, so the result is the same on all platforms.
+*/
+
+inline SizedUnsignedInteger<32>::Type threefry_rotl(SizedUnsignedInteger<32>::Type x, int n) {
+    return (x << n) | (x >> (32 - n));
+}
+
+/* encrypts ctr with key into out */
+inline void threefry4x32(const SizedUnsignedInteger<32>::Type* ctr, const SizedUnsignedInteger<32>::Type* key, SizedUnsignedInteger<32>::Type* out)
+{
+    static const int rot[8][2] = {{10,26}, {11,21}, {13,27}, {23,5}, {6,20}, {17,11}, {25,10}, {18,20}};
+    SizedUnsignedInteger<32>::Type ks[5];
+    ks[4] = 0x1BD11BDA;
+    for (int i = 0; i < 4; ++i) {
+        ks[i] = key[i];
+        ks[4] ^= key[i];
+    }
+    SizedUnsignedInteger<32>::Type x0 = ctr[0] + ks[0], x1 = ctr[1] + ks[1], x2 = ctr[2] + ks[2], x3 = ctr[3] + ks[3];
+    for (int r = 0; r < 20; ++r) {
+        if ((r & 1) == 0) {
+            x0 += x1; x1 = threefry_rotl(x1, rot[r&7][0]); x1 ^= x0;
+            x2 += x3; x3 = threefry_rotl(x3, rot[r&7][1]); x3 ^= x2;
+        } else {
+            x0 += x3; x3 = threefry_rotl(x3, rot[r&7][0]); x3 ^= x0;
+            x2 += x1; x1 = threefry_rotl(x1, rot[r&7][1]); x1 ^= x2;
+        }
+        // key injection every 4 rounds
+        if ((r & 3) == 3) {
+            int k = (r + 1) >> 2;
+            x0 += ks[k % 5];
+            x1 += ks[(k + 1) % 5];
+            x2 += ks[(k + 2) % 5];
+            x3 += ks[(k + 3) % 5] + k;
+        }
+    }
+    out[0] = x0; out[1] = x1; out[2] = x2; out[3] = x3;
+}
+
+/* generates the block for the current counter, and increments it */
+inline void counter_block(CounterRandomState& state)
+{
+    threefry4x32(state.counter, state.key, state.block);
+    for (int i = 0; i < 4; ++i) if (++state.counter[i] != 0) break;
+    state.index = 0;
+}
+
+/* generates a random number on the generator size interval */
+inline SizedUnsignedInteger<STREFLOP_RANDOM_GEN_SIZE>::Type genrand_int(CounterRandomState& state)
+{
+    if (state.index >= 4) counter_block(state);
+#if STREFLOP_RANDOM_GEN_SIZE == 32
+    return state.block[state.index++];
+#else
+    // low word first, as the 32 bits generator does
+    SizedUnsignedInteger<64>::Type low = state.block[state.index];
+    SizedUnsignedInteger<64>::Type high = state.block[state.index+1];
+    state.index += 2;
+    return low | (high << 32);
+#endif
+}
+
+inline void genrand_fill(SizedUnsignedInteger<STREFLOP_RANDOM_GEN_SIZE>::Type* out, size_t n, CounterRandomState& state)
+{
+    for (size_t i = 0; i < n; ++i) out[i] = genrand_int(state);
+}
+
 // Bit getter utilities
+// The fill functions give the same numbers as n successive calls to getRandomInt
+// State is either RandomState or CounterRandomState
 template<int nbits> struct Accessor {
     typedef typename SizedUnsignedInteger<nbits>::Type Type;
-    static inline Type getRandomInt(RandomState& state) {
+    template<class State> static inline Type getRandomInt(State& state) {
         return static_cast<Type>(genrand_int(state));
     }
+    template<class State> static inline void fillRandomInts(Type* out, size_t n, State& state) {
+        // Go through a buffer to drop the extra bits
+        SizedUnsignedInteger<STREFLOP_RANDOM_GEN_SIZE>::Type buffer[256];
+        while (n>0) {
+            size_t m = (n < 256) ? n : 256;
+            genrand_fill(buffer, m, state);
+            for (size_t i = 0; i < m; ++i) out[i] = static_cast<Type>(buffer[i]);
+            out += m;
+            n -= m;
+        }
+    }
+};
+
+// Direct fill for the generator size
+template<> struct Accessor<STREFLOP_RANDOM_GEN_SIZE> {
+    typedef SizedUnsignedInteger<STREFLOP_RANDOM_GEN_SIZE>::Type Type;
+    template<class State> static inline Type getRandomInt(State& state) {
+        return genrand_int(state);
+    }
+    template<class State> static inline void fillRandomInts(Type* out, size_t n, State& state) {
+        genrand_fill(out, n, state);
+    }
 };
 
 // Specialize for 32 bits generator case
 #if STREFLOP_RANDOM_GEN_SIZE == 32
 template<> struct Accessor<64> {
     typedef SizedUnsignedInteger<64>::Type Type;
-    static inline Type getRandomInt(RandomState& state) {
-        return static_cast<Type>(genrand_int(state)) | (static_cast<Type>(genrand_int(state)) << 32);
+    template<class State> static inline Type getRandomInt(State& state) {
+        // first number in the low bits, explicitly sequenced
+        Type low = genrand_int(state);
+        return low | (static_cast<Type>(genrand_int(state)) << 32);
+    }
+    template<class State> static inline void fillRandomInts(Type* out, size_t n, State& state) {
+        // Fill the array with twice as many 32-bit numbers, then pair them in place
+        SizedUnsignedInteger<32>::Type* words = reinterpret_cast<SizedUnsignedInteger<32>::Type*>(out);
+        genrand_fill(words, 2*n, state);
+        // Little endian: the low word is already first in memory
+#if __BYTE_ORDER != 1234
+        for (size_t i = 0; i < n; ++i) {
+            Type low = words[2*i];
+            Type high = words[2*i+1];
+            out[i] = low | (high << 32);
+        }
+#endif
     }
 };
 #endif
@@ -288,7 +695,7 @@ template<int bits_size> struct RandomIntRestrictor {
 template<> struct RandomIntRestrictor<8> {
     typedef SizedUnsignedInteger<8>::Type Type;
 
-    static inline Type getRestrictedRandomInt(Type n, RandomState& state)
+    template<class State> static inline Type getRestrictedRandomInt(Type n, State& state)
     {
         // First propagate leading 1 to all other bits
         Type mask = n;
@@ -311,7 +718,7 @@ template<> struct RandomIntRestrictor<8> {
 template<> struct RandomIntRestrictor<16> {
     typedef SizedUnsignedInteger<16>::Type Type;
 
-    static inline Type getRestrictedRandomInt(Type n, RandomState& state)
+    template<class State> static inline Type getRestrictedRandomInt(Type n, State& state)
     {
         // First propagate leading 1 to all other bits
         Type mask = n;
@@ -335,7 +742,7 @@ template<> struct RandomIntRestrictor<16> {
 template<> struct RandomIntRestrictor<32> {
     typedef SizedUnsignedInteger<32>::Type Type;
 
-    static inline Type getRestrictedRandomInt(Type n, RandomState& state)
+    template<class State> static inline Type getRestrictedRandomInt(Type n, State& state)
     {
         // First propagate leading 1 to all other bits
         Type mask = n;
@@ -360,7 +767,7 @@ template<> struct RandomIntRestrictor<32> {
 template<> struct RandomIntRestrictor<64> {
     typedef SizedUnsignedInteger<64>::Type Type;
 
-    static inline Type getRestrictedRandomInt(Type n, RandomState& state)
+    template<class State> static inline Type getRestrictedRandomInt(Type n, State& state)
     {
         // First propagate leading 1 to all other bits
         Type mask = n;
@@ -383,6 +790,83 @@ template<> struct RandomIntRestrictor<64> {
 };
 
 
+// Lemire's nearly divisionless method, for STREFLOP_INTEGER_MULTIPLY.
+// A full draw x times the number s of values is in [0, s*2^bits). Its high part is the
+// result, and its low part l tells where x falls in that result's share of the draws.
+// Each result has floor(2^bits/s) or one more draws: rejecting l < 2^bits mod s leaves
+// exactly floor(2^bits/s) draws per result. The division computing 2^bits mod s is
+// only needed when l < s, which is rare for ranges small compared to 2^bits.
+
+template<int bits_size> struct RandomIntMultiplier {
+    typedef typename SizedUnsignedInteger<bits_size>::Type Type;
+
+    // The 8 and 16 bits ranges use a 32-bit draw too, it costs the same
+    template<class State> static inline Type getRestrictedRandomInt(Type n, State& state)
+    {
+        typedef SizedUnsignedInteger<32>::Type Word;
+        typedef SizedUnsignedInteger<64>::Type Product;
+        // Number of values, up to 2^32
+        Product s = static_cast<Product>(n) + 1;
+        Product m = static_cast<Product>(Accessor<32>::getRandomInt(state)) * s;
+        if (static_cast<Word>(m) < s) {
+            Word t = static_cast<Word>(((static_cast<Product>(1) << 32) - s) % s);
+            while (static_cast<Word>(m) < t) {
+                m = static_cast<Product>(Accessor<32>::getRandomInt(state)) * s;
+            }
+        }
+        return static_cast<Type>(m >> 32);
+    }
+};
+
+// for 64-bits
+template<> struct RandomIntMultiplier<64> {
+    typedef SizedUnsignedInteger<64>::Type Type;
+
+    // Full 128 bits product of x and s, in high and low parts
+    static inline Type multiply(Type x, Type s, Type& low)
+    {
+#if defined(__SIZEOF_INT128__) && !defined(STREFLOP_NO_INT128)
+        unsigned __int128 m = static_cast<unsigned __int128>(x) * s;
+        low = static_cast<Type>(m);
+        return static_cast<Type>(m >> 64);
+#else
+        // Schoolbook product on 32 bits halves, no carry is lost
+        Type x0 = x & 0xFFFFFFFFULL, x1 = x >> 32;
+        Type s0 = s & 0xFFFFFFFFULL, s1 = s >> 32;
+        Type p00 = x0 * s0, p01 = x0 * s1, p10 = x1 * s0, p11 = x1 * s1;
+        Type middle = (p00 >> 32) + (p01 & 0xFFFFFFFFULL) + (p10 & 0xFFFFFFFFULL);
+        low = (middle << 32) | (p00 & 0xFFFFFFFFULL);
+        return p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+#endif
+    }
+
+    template<class State> static inline Type getRestrictedRandomInt(Type n, State& state)
+    {
+        // Number of values, 0 for the whole range
+        Type s = n + 1;
+        if (s == 0) return Accessor<64>::getRandomInt(state);
+        Type low;
+        Type high = multiply(Accessor<64>::getRandomInt(state), s, low);
+        if (low < s) {
+            Type t = (0 - s) % s;
+            while (low < t) {
+                high = multiply(Accessor<64>::getRandomInt(state), s, low);
+            }
+        }
+        return high;
+    }
+};
+
+// Selects the algorithm of the state. Any value but STREFLOP_INTEGER_MULTIPLY is the
+// legacy one, so that the sequence of old replays is kept.
+template<int bits_size, class State> static inline typename SizedUnsignedInteger<bits_size>::Type
+getRestrictedRandomInt(typename SizedUnsignedInteger<bits_size>::Type n, State& state)
+{
+    if (state.integer_method == STREFLOP_INTEGER_MULTIPLY) return RandomIntMultiplier<bits_size>::getRestrictedRandomInt(n, state);
+    return RandomIntRestrictor<bits_size>::getRestrictedRandomInt(n, state);
+}
+
+
 // Now implement the Random functions
 
 /* range checker.
@@ -418,22 +902,25 @@ template<typename an_int_type, int num_bounds, int min_excluded> struct RandomSw
 };
 */
 
-#define SPECIALIZE_RANDOM_FOR_TYPE(a_type,use_signed) \
-template<> a_type Random<a_type>(RandomState& state) { \
+#define SPECIALIZE_RANDOM_FOR_TYPE_AND_STATE(a_type,use_signed,State) \
+template<> a_type Random<a_type>(State& state) { \
     return Accessor<sizeof(a_type)*STREFLOP_INTEGER_TYPES_CHAR_BITS>::getRandomInt(state); \
 } \
-template<> a_type Random<true, true, a_type>(a_type min, a_type max, RandomState& state) { \
-    return static_cast<a_type>(RandomIntRestrictor< sizeof(a_type)*STREFLOP_INTEGER_TYPES_CHAR_BITS >::getRestrictedRandomInt(max-min,state)) + min; \
+template<> a_type Random<true, true, a_type>(a_type min, a_type max, State& state) { \
+    return static_cast<a_type>(getRestrictedRandomInt< sizeof(a_type)*STREFLOP_INTEGER_TYPES_CHAR_BITS >(max-min,state)) + min; \
 } \
-template<> a_type Random<true, false, a_type>(a_type min, a_type max, RandomState& state) { \
-    return static_cast<a_type>(RandomIntRestrictor< sizeof(a_type)*STREFLOP_INTEGER_TYPES_CHAR_BITS >::getRestrictedRandomInt(max-min-1,state)) + min; \
+template<> a_type Random<true, false, a_type>(a_type min, a_type max, State& state) { \
+    return static_cast<a_type>(getRestrictedRandomInt< sizeof(a_type)*STREFLOP_INTEGER_TYPES_CHAR_BITS >(max-min-1,state)) + min; \
 } \
-template<> a_type Random<false, true, a_type>(a_type min, a_type max, RandomState& state) { \
-    return max - static_cast<a_type>(RandomIntRestrictor< sizeof(a_type)*STREFLOP_INTEGER_TYPES_CHAR_BITS >::getRestrictedRandomInt(max-min-1,state)); \
+template<> a_type Random<false, true, a_type>(a_type min, a_type max, State& state) { \
+    return max - static_cast<a_type>(getRestrictedRandomInt< sizeof(a_type)*STREFLOP_INTEGER_TYPES_CHAR_BITS >(max-min-1,state)); \
 } \
-template<> a_type Random<false, false, a_type>(a_type min, a_type max, RandomState& state) { \
-    return static_cast<a_type>(RandomIntRestrictor< sizeof(a_type)*STREFLOP_INTEGER_TYPES_CHAR_BITS >::getRestrictedRandomInt(max-min-2,state)) + min + 1; \
+template<> a_type Random<false, false, a_type>(a_type min, a_type max, State& state) { \
+    return static_cast<a_type>(getRestrictedRandomInt< sizeof(a_type)*STREFLOP_INTEGER_TYPES_CHAR_BITS >(max-min-2,state)) + min + 1; \
 }
+#define SPECIALIZE_RANDOM_FOR_TYPE(a_type,use_signed) \
+SPECIALIZE_RANDOM_FOR_TYPE_AND_STATE(a_type,use_signed,RandomState) \
+SPECIALIZE_RANDOM_FOR_TYPE_AND_STATE(a_type,use_signed,CounterRandomState)
 SPECIALIZE_RANDOM_FOR_TYPE(char,true)
 SPECIALIZE_RANDOM_FOR_TYPE(unsigned char,false)
 SPECIALIZE_RANDOM_FOR_TYPE(short,true)
@@ -448,6 +935,11 @@ SPECIALIZE_RANDOM_FOR_TYPE(unsigned long long,false)
 
 // Random for float types is even more dependent on size
 
+// The float functions are implemented once for both state types, and selected by these tags.
+// The exported specializations are defined after them.
+template<typename a_type> struct RandomTypeTag {};
+template<bool include_min, bool include_max, typename a_type> struct Random12Tag {};
+
 
 /*
 
@@ -504,7 +996,7 @@ SPECIALIZE_RANDOM_FOR_SIMPLE_ULP(I,I)
 
 
 // Return a random float
-template<> Simple Random<Simple>(RandomState& state) {
+template<class State> static inline Simple Random_Generic(RandomTypeTag<Simple>, State& state) {
     // Generate bits
     SizedUnsignedInteger<32>::Type ret = Accessor<32>::getRandomInt(state);
 
@@ -516,7 +1008,7 @@ template<> Simple Random<Simple>(RandomState& state) {
 }
 
 // Random in 1..2 - ideal IE case
-template<> Simple Random12<true,false,Simple>(RandomState& state) {
+template<class State> static inline Simple Random12_Generic(Random12Tag<true,false,Simple>, State& state) {
 
     // Get uniform number between 1 and 2 at max precision
 
@@ -533,7 +1025,7 @@ template<> Simple Random12<true,false,Simple>(RandomState& state) {
 }
 
 // Random in 1..2 - near ideal EI case
-template<> Simple Random12<false,true,Simple>(RandomState& state) {
+template<class State> static inline Simple Random12_Generic(Random12Tag<false,true,Simple>, State& state) {
 
     // Get uniform number between 1 and 2 at max precision
 
@@ -553,7 +1045,7 @@ template<> Simple Random12<false,true,Simple>(RandomState& state) {
 }
 
 // Random in 1..2 - need to include both bounds
-template<> Simple Random12<true,true,Simple>(RandomState& state) {
+template<class State> static inline Simple Random12_Generic(Random12Tag<true,true,Simple>, State& state) {
 
     // Get uniform number between 1 and 2 at max precision
 
@@ -581,7 +1073,7 @@ SHR    EDX, 23
 }
 
 // Random in 1..2 - need to exclude both bounds
-template<> Simple Random12<false,false,Simple>(RandomState& state) {
+template<class State> static inline Simple Random12_Generic(Random12Tag<false,false,Simple>, State& state) {
 
     // Get uniform number between 1 and 2 at max precision
 
@@ -604,7 +1096,7 @@ template<> Simple Random12<false,false,Simple>(RandomState& state) {
 ///////// Double versions  ///////////
 
 // Return a random float
-template<> Double Random<Double>(RandomState& state) {
+template<class State> static inline Double Random_Generic(RandomTypeTag<Double>, State& state) {
     // Generate bits
     SizedUnsignedInteger<64>::Type ret = Accessor<64>::getRandomInt(state);
 
@@ -617,7 +1109,7 @@ template<> Double Random<Double>(RandomState& state) {
 
 
 // Random in a 1..2 - ideal IE case
-template<> Double Random12<true,false,Double>(RandomState& state) {
+template<class State> static inline Double Random12_Generic(Random12Tag<true,false,Double>, State& state) {
 
     // Get uniform number between 1 and 2 at max precision
 
@@ -635,7 +1127,7 @@ template<> Double Random12<true,false,Double>(RandomState& state) {
 }
 
 // Random in a 1..2 - near ideal EI case
-template<> Double Random12<false,true,Double>(RandomState& state) {
+template<class State> static inline Double Random12_Generic(Random12Tag<false,true,Double>, State& state) {
 
     // Get uniform number between 1 and 2 at max precision
 
@@ -656,7 +1148,7 @@ template<> Double Random12<false,true,Double>(RandomState& state) {
 }
 
 // Random in a 1..2 - need to include both bounds
-template<> Double Random12<true,true,Double>(RandomState& state) {
+template<class State> static inline Double Random12_Generic(Random12Tag<true,true,Double>, State& state) {
 
     // Get uniform number between 1 and 2 at max precision
 
@@ -680,7 +1172,7 @@ template<> Double Random12<true,true,Double>(RandomState& state) {
 }
 
 // Random in a 1..2 - need to exclude both bounds
-template<> Double Random12<false,false,Double>(RandomState& state) {
+template<class State> static inline Double Random12_Generic(Random12Tag<false,false,Double>, State& state) {
 
     // Get uniform number between 1 and 2 at max precision
 
@@ -763,7 +1255,7 @@ template<> struct ExtendedConverter<16> {
 
 
 // Return a random float
-template<> Extended Random<Extended>(RandomState& state) {
+template<class State> static inline Extended Random_Generic(RandomTypeTag<Extended>, State& state) {
     // Work directly on Extended bits
     Extended ret;
 
@@ -786,7 +1278,7 @@ template<> Extended Random<Extended>(RandomState& state) {
 
 
 // Random in 1..2 - ideal IE case
-template<> Extended Random12<true,false,Extended>(RandomState& state) {
+template<class State> static inline Extended Random12_Generic(Random12Tag<true,false,Extended>, State& state) {
 
     // Get uniform number between 1 and 2 at max precision
 
@@ -808,7 +1300,7 @@ template<> Extended Random12<true,false,Extended>(RandomState& state) {
 }
 
 // Random in 1..2 - near ideal EI case
-template<> Extended Random12<false,true,Extended>(RandomState& state) {
+template<class State> static inline Extended Random12_Generic(Random12Tag<false,true,Extended>, State& state) {
 
     // Get uniform number between 1 and 2 at max precision
 
@@ -833,7 +1325,7 @@ template<> Extended Random12<false,true,Extended>(RandomState& state) {
 }
 
 // Random in 1..2 - need to include both bounds
-template<> Extended Random12<true,true,Extended>(RandomState& state) {
+template<class State> static inline Extended Random12_Generic(Random12Tag<true,true,Extended>, State& state) {
 
     // Get uniform number between 1 and 2 at max precision
 
@@ -864,7 +1356,7 @@ template<> Extended Random12<true,true,Extended>(RandomState& state) {
 }
 
 // Random in 1..2 - need to exclude both bounds
-template<> Extended Random12<false,false,Extended>(RandomState& state) {
+template<class State> static inline Extended Random12_Generic(Random12Tag<false,false,Extended>, State& state) {
 
     // Get uniform number between 1 and 2 at max precision
 
@@ -891,10 +1383,71 @@ template<> Extended Random12<false,false,Extended>(RandomState& state) {
 
 #endif
 
+// Bulk versions of the Random12 functions
+
+// Rejection loops need to draw a variable amount of numbers: simply loop over the single number version
+#define STREFLOP_RANDOM_FILL_LOOP(include_min, include_max, a_type) \
+template<class State> static inline void RandomFill12_Generic(Random12Tag<include_min,include_max,a_type> tag, a_type* out, size_t n, State& state) { \
+    for (size_t i = 0; i < n; ++i) out[i] = Random12_Generic(tag, state); \
+}
+
+// Otherwise, fill the array with the random bits and convert them in place, as in the single number version
+template<class State> static inline void RandomFill12_Generic(Random12Tag<true,false,Simple>, Simple* out, size_t n, State& state) {
+    SizedUnsignedInteger<32>::Type* r12 = reinterpret_cast<SizedUnsignedInteger<32>::Type*>(out);
+    Accessor<32>::fillRandomInts(r12, n, state);
+    for (size_t i = 0; i < n; ++i) r12[i] = (r12[i] & 0x007FFFFF) | 0x3F800000;
+}
+
+template<class State> static inline void RandomFill12_Generic(Random12Tag<false,true,Simple>, Simple* out, size_t n, State& state) {
+    SizedUnsignedInteger<32>::Type* r12 = reinterpret_cast<SizedUnsignedInteger<32>::Type*>(out);
+    Accessor<32>::fillRandomInts(r12, n, state);
+    for (size_t i = 0; i < n; ++i) r12[i] = ((r12[i] & 0x007FFFFF) | 0x3F800000) + 1;
+}
+
+template<class State> static inline void RandomFill12_Generic(Random12Tag<true,true,Simple>, Simple* out, size_t n, State& state) {
+    SizedUnsignedInteger<32>::Type* r12 = reinterpret_cast<SizedUnsignedInteger<32>::Type*>(out);
+    Accessor<32>::fillRandomInts(r12, n, state);
+    for (size_t i = 0; i < n; ++i) r12[i] = (r12[i] % 0x00800001) + 0x3F800000;
+}
+
+STREFLOP_RANDOM_FILL_LOOP(false,false,Simple)
+
+template<class State> static inline void RandomFill12_Generic(Random12Tag<true,false,Double>, Double* out, size_t n, State& state) {
+    SizedUnsignedInteger<64>::Type* r12 = reinterpret_cast<SizedUnsignedInteger<64>::Type*>(out);
+    Accessor<64>::fillRandomInts(r12, n, state);
+    for (size_t i = 0; i < n; ++i) r12[i] = (r12[i] & 0x000FFFFFFFFFFFFFULL) | 0x3FF0000000000000ULL;
+}
+
+template<class State> static inline void RandomFill12_Generic(Random12Tag<false,true,Double>, Double* out, size_t n, State& state) {
+    SizedUnsignedInteger<64>::Type* r12 = reinterpret_cast<SizedUnsignedInteger<64>::Type*>(out);
+    Accessor<64>::fillRandomInts(r12, n, state);
+    for (size_t i = 0; i < n; ++i) r12[i] = ((r12[i] & 0x000FFFFFFFFFFFFFULL) | 0x3FF0000000000000ULL) + 1;
+}
+
+#if STREFLOP_RANDOM_GEN_SIZE == 64
+template<class State> static inline void RandomFill12_Generic(Random12Tag<true,true,Double>, Double* out, size_t n, State& state) {
+    SizedUnsignedInteger<64>::Type* r12 = reinterpret_cast<SizedUnsignedInteger<64>::Type*>(out);
+    Accessor<64>::fillRandomInts(r12, n, state);
+    for (size_t i = 0; i < n; ++i) r12[i] = (r12[i] % 0x0010000000000001ULL) + 0x3FF0000000000000ULL;
+}
+#else
+STREFLOP_RANDOM_FILL_LOOP(true,true,Double)
+#endif
+
+STREFLOP_RANDOM_FILL_LOOP(false,false,Double)
+
+#ifdef Extended
+// Extended bits are not contiguous
+STREFLOP_RANDOM_FILL_LOOP(true,false,Extended)
+STREFLOP_RANDOM_FILL_LOOP(false,true,Extended)
+STREFLOP_RANDOM_FILL_LOOP(true,true,Extended)
+STREFLOP_RANDOM_FILL_LOOP(false,false,Extended)
+#endif
+
 // This is a way to hide the implementation from the header
 // And also to ensure there is only one template instanciation, instead of duplicating
 // the code in all object files
-template<typename FloatType> static inline FloatType NRandom_Generic(FloatType *secondary, RandomState& state) {
+template<typename FloatType, class State> static inline FloatType NRandom_Generic(FloatType *secondary, State& state) {
 
     FloatType x, y, d;
     // Generate a point strictly inside the unit circle
@@ -913,22 +1466,8 @@ template<typename FloatType> static inline FloatType NRandom_Generic(FloatType *
     return y * conv;
 }
 
-// Specialize for the Float types declared in the header
-template<> Simple NRandom(Simple *secondary, RandomState& state) {
-    return NRandom_Generic<Simple>(secondary,state);
-}
-
-template<> Double NRandom(Double *secondary, RandomState& state) {
-    return NRandom_Generic<Double>(secondary,state);
-}
-#if defined(Extended)
-template<> Extended NRandom(Extended *secondary, RandomState& state) {
-    return NRandom_Generic<Extended>(secondary,state);
-}
-#endif
-
 // May save one mul
-template<typename FloatType> static inline FloatType NRandom_Generic(FloatType mean, FloatType std_dev, FloatType *secondary, RandomState& state) {
+template<typename FloatType, class State> static inline FloatType NRandom_Generic(FloatType mean, FloatType std_dev, FloatType *secondary, State& state) {
 
     FloatType x, y, d;
     // Generate a point strictly inside the unit circle
@@ -947,34 +1486,476 @@ template<typename FloatType> static inline FloatType NRandom_Generic(FloatType m
     return y * conv + mean;
 }
 
-// Specialize for the Float types declared in the header
-template<> Simple NRandom(Simple mean, Simple std_dev, Simple *secondary, RandomState& state) {
-    return NRandom_Generic<Simple>(mean, std_dev, secondary,state);
+
+// Bulk normal numbers, by pairs
+template<typename FloatType, class State> static inline void NRandomFill_Generic(FloatType* out, size_t n, FloatType mean, FloatType std_dev, State& state) {
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) out[i] = NRandom_Generic<FloatType>(mean, std_dev, &out[i+1], state);
+    if (i < n) out[i] = NRandom_Generic<FloatType>(mean, std_dev, 0, state);
 }
 
-template<> Double NRandom(Double mean, Double std_dev, Double *secondary, RandomState& state) {
-    return NRandom_Generic<Double>(mean, std_dev, secondary,state);
+template<typename FloatType, class State> static inline void NRandomFill_Generic(FloatType* out, size_t n, State& state) {
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) out[i] = NRandom_Generic<FloatType>(&out[i+1], state);
+    if (i < n) out[i] = NRandom_Generic<FloatType>(0, state);
 }
+
+// Normal numbers by the Ziggurat method, following J. A. Doornik,
+// "An Improved Ziggurat Method to Generate Normal Random Samples", 2005.
+// The tables are built with streflop arithmetic in the target type, so they are the same everywhere.
+#define ZIGGURAT_BLOCKS 128
+template<typename FloatType> struct ZigguratTables {
+    // x[i] is the right edge of block i, x[0] the pseudo edge of the base block with the tail
+    FloatType x[ZIGGURAT_BLOCKS+1];
+    // r[i] = x[i+1]/x[i], the fraction of block i under the curve for sure
+    FloatType r[ZIGGURAT_BLOCKS];
+    // start of the tail, and area of each block
+    static inline FloatType R() {return FloatType(3.442619855899);}
+    static inline FloatType V() {return FloatType(9.91256303526217e-3);}
+
+    ZigguratTables() {
+        FloatType f = exp(FloatType(-0.5) * R() * R());
+        x[0] = V() / f;
+        x[1] = R();
+        x[ZIGGURAT_BLOCKS] = FloatType(0.0);
+        for (int i = 2; i < ZIGGURAT_BLOCKS; ++i) {
+            x[i] = sqrt(FloatType(-2.0) * log(V() / x[i-1] + f));
+            f = exp(FloatType(-0.5) * x[i] * x[i]);
+        }
+        for (int i = 0; i < ZIGGURAT_BLOCKS; ++i) r[i] = x[i+1] / x[i];
+    }
+};
+
+// Uniform number in [-1,1), with the block index taken from the unused random bits
+template<class State> static inline Simple ZigguratUniform(RandomTypeTag<Simple>, int& block, State& state) {
+    SizedUnsignedInteger<32>::Type u = Accessor<32>::getRandomInt(state);
+    block = (u >> 23) & (ZIGGURAT_BLOCKS-1);
+    // Number in [2,4), minus 3 is exact
+    u = (u & 0x007FFFFF) | 0x40000000;
+    return *reinterpret_cast<Simple*>(&u) - Simple(3.0);
+}
+
+template<class State> static inline Double ZigguratUniform(RandomTypeTag<Double>, int& block, State& state) {
+    SizedUnsignedInteger<64>::Type u = Accessor<64>::getRandomInt(state);
+    block = static_cast<int>(u >> 52) & (ZIGGURAT_BLOCKS-1);
+    u = (u & 0x000FFFFFFFFFFFFFULL) | 0x4000000000000000ULL;
+    return *reinterpret_cast<Double*>(&u) - Double(3.0);
+}
+
 #if defined(Extended)
-template<> Extended NRandom(Extended mean, Extended std_dev, Extended *secondary, RandomState& state) {
-    return NRandom_Generic<Extended>(mean, std_dev, secondary,state);
+// All 64 bits are used for the mantissa, draw the index separately
+template<class State> static inline Extended ZigguratUniform(RandomTypeTag<Extended>, int& block, State& state) {
+    Extended u = Random12_Generic(Random12Tag<true,false,Extended>(), state) * Extended(2.0) - Extended(3.0);
+    block = Accessor<8>::getRandomInt(state) & (ZIGGURAT_BLOCKS-1);
+    return u;
+}
+#endif
+
+template<typename FloatType, class State> static inline FloatType NRandomZiggurat_Generic(State& state) {
+    // Computed on first use
+    static const ZigguratTables<FloatType> tables;
+    const FloatType R = ZigguratTables<FloatType>::R();
+    for (;;) {
+        int i;
+        FloatType u = ZigguratUniform(RandomTypeTag<FloatType>(), i, state);
+        // Inside the block rectangle that is entirely under the curve, the usual case
+        if (fabs(u) < tables.r[i]) return u * tables.x[i];
+        // Base block: draw from the tail by Marsaglia's method
+        if (i == 0) {
+            FloatType x, y;
+            do {
+                x = log(Random01<false,true,FloatType>(state)) / R;
+                y = log(Random01<false,true,FloatType>(state));
+            } while (FloatType(-2.0) * y < x * x);
+            return (u < FloatType(0.0)) ? x - R : R - x;
+        }
+        // In the wedge: accept according to the density
+        FloatType x = u * tables.x[i];
+        FloatType f0 = exp(FloatType(-0.5) * (tables.x[i] * tables.x[i] - x * x));
+        FloatType f1 = exp(FloatType(-0.5) * (tables.x[i+1] * tables.x[i+1] - x * x));
+        if (f1 + Random01<true,false,FloatType>(state) * (f0 - f1) < FloatType(1.0)) return x;
+    }
 }
+
+// Specialize for the Float types declared in the header, for both state types
+#define STREFLOP_RANDOM_REAL_FOR_STATE(a_type, State) \
+template<> a_type Random<a_type>(State& state) {return Random_Generic(RandomTypeTag<a_type>(), state);} \
+template<> a_type Random12<true,true,a_type>(State& state) {return Random12_Generic(Random12Tag<true,true,a_type>(), state);} \
+template<> a_type Random12<true,false,a_type>(State& state) {return Random12_Generic(Random12Tag<true,false,a_type>(), state);} \
+template<> a_type Random12<false,true,a_type>(State& state) {return Random12_Generic(Random12Tag<false,true,a_type>(), state);} \
+template<> a_type Random12<false,false,a_type>(State& state) {return Random12_Generic(Random12Tag<false,false,a_type>(), state);} \
+template<> void RandomFill12<true,true,a_type>(a_type* out, size_t n, State& state) {RandomFill12_Generic(Random12Tag<true,true,a_type>(), out, n, state);} \
+template<> void RandomFill12<true,false,a_type>(a_type* out, size_t n, State& state) {RandomFill12_Generic(Random12Tag<true,false,a_type>(), out, n, state);} \
+template<> void RandomFill12<false,true,a_type>(a_type* out, size_t n, State& state) {RandomFill12_Generic(Random12Tag<false,true,a_type>(), out, n, state);} \
+template<> void RandomFill12<false,false,a_type>(a_type* out, size_t n, State& state) {RandomFill12_Generic(Random12Tag<false,false,a_type>(), out, n, state);} \
+template<> a_type NRandom(a_type *secondary, State& state) {return NRandom_Generic<a_type>(secondary, state);} \
+template<> a_type NRandom(a_type mean, a_type std_dev, a_type *secondary, State& state) {return NRandom_Generic<a_type>(mean, std_dev, secondary, state);} \
+template<> void NRandomFill(a_type* out, size_t n, a_type mean, a_type std_dev, State& state) {NRandomFill_Generic<a_type>(out, n, mean, std_dev, state);} \
+template<> void NRandomFill(a_type* out, size_t n, State& state) {NRandomFill_Generic<a_type>(out, n, state);} \
+template<> a_type NRandomZiggurat(State& state) {return NRandomZiggurat_Generic<a_type>(state);} \
+template<> a_type NRandomZiggurat(a_type mean, a_type std_dev, State& state) {return NRandomZiggurat_Generic<a_type>(state) * std_dev + mean;}
+
+STREFLOP_RANDOM_REAL_FOR_STATE(Simple, RandomState)
+STREFLOP_RANDOM_REAL_FOR_STATE(Double, RandomState)
+STREFLOP_RANDOM_REAL_FOR_STATE(Simple, CounterRandomState)
+STREFLOP_RANDOM_REAL_FOR_STATE(Double, CounterRandomState)
+#if defined(Extended)
+STREFLOP_RANDOM_REAL_FOR_STATE(Extended, RandomState)
+STREFLOP_RANDOM_REAL_FOR_STATE(Extended, CounterRandomState)
+#endif
+
+
+//////////////////////////////////////////////////////////////////////
+// Jump ahead, as described in:
+// H. Haramoto, M. Matsumoto, T. Nishimura, F. Panneton, P. L'Ecuyer,
+// "Efficient Jump Ahead for F2-Linear Random Number Generators",
+// INFORMS Journal on Computing 20(3), 2008.
+//////////////////////////////////////////////////////////////////////
+
+/*
+   All generators above are linear over GF(2). Their state can be seen as a window of the
+   next nwords state words, and a step replaces the oldest word by the next one. The sequence
+   satisfies a recurrence given by a polynomial phi, and advancing by J steps is applying
+   (x^J mod phi)(step) to the window, by Horner's scheme. The cost does not depend on J.
+
+   phi is not tabulated, it is recovered from the generator itself by Berlekamp-Massey
+   the first time a jump is requested. This takes a few tens of milliseconds.
+   - For MT, phi is the degree 19937 characteristic polynomial. MT words carry 31 bits that
+     do not belong to the 19937 bits state. These disappear after one step, so jumps are
+     done as one plain step followed by J-1 polynomial steps.
+   - For SFMT, the whole 19968 bits state is linear, and phi is the degree 19968 characteristic
+     polynomial. The extra initial step is harmless.
+*/
+
+// Polynomials over GF(2), bit i of the array is the coefficient of x^i.
+// Up to degree 19968, the size of the SFMT state, see JumpTables.
+#define JUMP_MAX_DEGREE 19968
+#define JUMP_WORDS 313
+typedef SizedUnsignedInteger<64>::Type JumpWord;
+
+/// Mersenne twister window: one state word per number
+struct MTJumpTraits {
+    typedef SizedUnsignedInteger<STREFLOP_RANDOM_GEN_SIZE>::Type Word;
+    enum { nwords = 19968/STREFLOP_RANDOM_GEN_SIZE, numbers_per_word = 1 };
+#if STREFLOP_RANDOM_GEN_SIZE == 32
+    static inline void step(Word* ring, int p) {
+        Word y = (ring[p]&UPPER_MASK)|(ring[(p+1)%N]&LOWER_MASK);
+        ring[p] = ring[(p+M)%N] ^ (y >> 1) ^ ((y & 0x1UL) ? MATRIX_A : 0x0UL);
+    }
+#else
+    static inline void step(Word* ring, int p) {
+        Word x = (ring[p]&UM)|(ring[(p+1)%NN]&LM);
+        ring[p] = ring[(p+MM)%NN] ^ (x>>1) ^ ((x&1ULL) ? MATRIX_A : 0ULL);
+    }
 #endif
+    static inline int bit(const Word& w) {return int(w & 1);}
+    static inline void add(Word& a, const Word& b) {a ^= b;}
+    static inline void clear(Word& a) {a = 0;}
+};
+
+/// SFMT window: one 128-bit word per 128/STREFLOP_RANDOM_GEN_SIZE numbers
+struct SFMTJumpTraits {
+    struct Word {SizedUnsignedInteger<32>::Type u[4];};
+    enum { nwords = SFMT_N, numbers_per_word = 128/STREFLOP_RANDOM_GEN_SIZE };
+    static inline void step(Word* ring, int p) {
+        sfmt_recursion(ring[p].u, ring[p].u, ring[(p+SFMT_POS1)%SFMT_N].u, ring[(p+SFMT_N-2)%SFMT_N].u, ring[(p+SFMT_N-1)%SFMT_N].u);
+    }
+    static inline int bit(const Word& w) {return int(w.u[0] & 1);}
+    static inline void add(Word& a, const Word& b) {a.u[0] ^= b.u[0]; a.u[1] ^= b.u[1]; a.u[2] ^= b.u[2]; a.u[3] ^= b.u[3];}
+    static inline void clear(Word& a) {a.u[0] = a.u[1] = a.u[2] = a.u[3] = 0;}
+};
+
+/// Window of the next nwords state words, starting at index start in the ring
+template<class Traits> struct JumpWindow {
+    typename Traits::Word ring[Traits::nwords];
+    int start;
+
+    inline void step() {
+        Traits::step(ring, start);
+        if (++start == Traits::nwords) start = 0;
+    }
+
+    inline void add(const JumpWindow& other) {
+        int j = other.start;
+        for (int i = start; i < Traits::nwords; ++i) {
+            Traits::add(ring[i], other.ring[j]);
+            if (++j == Traits::nwords) j = 0;
+        }
+        for (int i = 0; i < start; ++i) {
+            Traits::add(ring[i], other.ring[j]);
+            if (++j == Traits::nwords) j = 0;
+        }
+    }
+
+    /// Extract the window from a state, without modifying it
+    /// offset receives the number of numbers already drawn from the first word
+    inline void load(const RandomState& state, int& offset) {
+        memcpy(ring, state.mt, sizeof(ring));
+        int w = state.mti / Traits::numbers_per_word;
+        offset = state.mti % Traits::numbers_per_word;
+        // The state array holds the current block: words before mti were already drawn.
+        // Their replacements are obtained by stepping, in the same order as the block generation.
+        for (int p = 0; p < w; ++p) Traits::step(ring, p);
+        start = (w == Traits::nwords) ? 0 : w;
+    }
+
+    /// Put the window back into a state, as a block with the first word partially drawn
+    inline void store(RandomState& state, int offset) const {
+        typename Traits::Word* words = reinterpret_cast<typename Traits::Word*>(state.mt);
+        int j = start;
+        for (int i = 0; i < Traits::nwords; ++i) {
+            words[i] = ring[j];
+            if (++j == Traits::nwords) j = 0;
+        }
+        state.mti = offset;
+    }
+};
+
+/// Polynomials and tables needed to jump, for one generator
+struct JumpTables {
+    // The characteristic polynomial, and its degree
+    JumpWord phi[JUMP_WORDS];
+    int degree;
+    // phi shifted left by 0 to 63 bits, for the reductions
+    JumpWord shifted[64][JUMP_WORDS+1];
+    // x^(2^STREFLOP_RANDOM_SPLIT_LOG2) mod phi, for RandomSplit
+    JumpWord split[JUMP_WORDS];
+
+    // Reduce a product of two reduced polynomials modulo phi
+    void reduce(JumpWord* prod, JumpWord* out) const {
+        for (int i = 2*degree-2; i >= degree; --i) {
+            if ((prod[i>>6] >> (i&63)) & 1) {
+                int sh = i - degree;
+                const JumpWord* p = shifted[sh & 63];
+                JumpWord* q = prod + (sh >> 6);
+                for (int l = 0; l <= JUMP_WORDS; ++l) q[l] ^= p[l];
+            }
+        }
+        memcpy(out, prod, JUMP_WORDS*sizeof(JumpWord));
+    }
 
+    // out = a^2 mod phi. Squaring over GF(2) only spreads the bits
+    void sqrmod(const JumpWord* a, JumpWord* out) const {
+        JumpWord prod[2*JUMP_WORDS];
+        for (int k = 0; k < JUMP_WORDS; ++k) {
+            prod[2*k] = spread(a[k] & 0xFFFFFFFFULL);
+            prod[2*k+1] = spread(a[k] >> 32);
+        }
+        reduce(prod, out);
+    }
+
+    // out = a*b mod phi, out may be a or b
+    void mulmod(const JumpWord* a, const JumpWord* b, JumpWord* out) const {
+        JumpWord prod[2*JUMP_WORDS];
+        JumpWord bshift[JUMP_WORDS+1];
+        memset(prod, 0, sizeof(prod));
+        for (int j = 0; j < 64; ++j) {
+            bshift[0] = b[0] << j;
+            for (int l = 1; l < JUMP_WORDS; ++l) bshift[l] = (b[l] << j) | (j ? (b[l-1] >> (64-j)) : 0);
+            bshift[JUMP_WORDS] = j ? (b[JUMP_WORDS-1] >> (64-j)) : 0;
+            for (int k = 0; k < JUMP_WORDS; ++k) if ((a[k] >> j) & 1) {
+                for (int l = 0; l <= JUMP_WORDS; ++l) prod[k+l] ^= bshift[l];
+            }
+        }
+        reduce(prod, out);
+    }
+
+    // a = a/x mod phi. phi(0) = 1, so x is invertible
+    void divx(JumpWord* a) const {
+        if (a[0] & 1) for (int l = 0; l < JUMP_WORDS; ++l) a[l] ^= phi[l];
+        for (int l = 0; l < JUMP_WORDS-1; ++l) a[l] = (a[l] >> 1) | (a[l+1] << 63);
+        a[JUMP_WORDS-1] >>= 1;
+    }
+
+    // out = x^(2^log2_steps) mod phi
+    void pow2mod(unsigned int log2_steps, JumpWord* out) const {
+        memset(out, 0, JUMP_WORDS*sizeof(JumpWord));
+        out[0] = 2;
+        for (unsigned int i = 0; i < log2_steps; ++i) sqrmod(out, out);
+    }
+
+    static inline JumpWord spread(JumpWord x) {
+        x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+        x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+        x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        x = (x | (x << 2)) & 0x3333333333333333ULL;
+        x = (x | (x << 1)) & 0x5555555555555555ULL;
+        return x;
+    }
+
+    template<class Traits> void computePhi(RandomGenerator generator) {
+        // Run the generator from an arbitrary seed
+        RandomState state;
+        int offset;
+        RandomInit(5489, generator, state);
+        JumpWindow<Traits> window;
+        window.load(state, offset);
+        window.step();
+
+        // The bit sequence, reversed: bit k of rev is element length-1-k of the sequence
+        const int length = 2*JUMP_MAX_DEGREE;
+        // padded, the discrepancy computation reads whole words past the end
+        JumpWord rev[2*JUMP_WORDS+3];
+        memset(rev, 0, sizeof(rev));
+        for (int n = 0; n < length; ++n) {
+            int k = length-1-n;
+            if (Traits::bit(window.ring[window.start])) rev[k>>6] |= JumpWord(1) << (k&63);
+            window.step();
+        }
+
+        // Berlekamp-Massey, with bit i of c the coefficient of x^i in the connection polynomial
+        JumpWord c[JUMP_WORDS+1], b[JUMP_WORDS+1], t[JUMP_WORDS+1];
+        memset(c, 0, sizeof(c));
+        memset(b, 0, sizeof(b));
+        c[0] = b[0] = 1;
+        int L = 0, m = 1;
+        for (int n = 0; n < length; ++n) {
+            // discrepancy: sum of c_i * s[n-i] for i = 0..L, that is c & (rev >> (length-1-n))
+            int off = length-1-n, w = off>>6, sh = off&63;
+            JumpWord d = 0;
+            for (int l = 0; l <= (L>>6); ++l) d ^= c[l] & ((rev[w+l] >> sh) | (sh ? (rev[w+l+1] << (64-sh)) : 0));
+            d ^= d >> 32; d ^= d >> 16; d ^= d >> 8; d ^= d >> 4; d ^= d >> 2; d ^= d >> 1;
+            if ((d & 1) == 0) {++m; continue;}
+            if (2*L <= n) memcpy(t, c, sizeof(c));
+            // c += x^m b
+            int mw = m>>6, mb = m&63;
+            for (int l = JUMP_WORDS; l >= mw; --l) c[l] ^= (b[l-mw] << mb) | ((mb && l > mw) ? (b[l-mw-1] >> (64-mb)) : 0);
+            if (2*L <= n) {
+                L = n+1-L;
+                memcpy(b, t, sizeof(b));
+                m = 1;
+            }
+            else ++m;
+        }
+
+        // phi is the reciprocal of the connection polynomial: phi_(L-i) = c_i
+        memset(phi, 0, sizeof(phi));
+        for (int i = 0; i <= L; ++i) if ((c[i>>6] >> (i&63)) & 1) phi[(L-i)>>6] |= JumpWord(1) << ((L-i)&63);
+        degree = L;
+    }
+
+    template<class Traits> JumpTables(const Traits*, RandomGenerator generator) {
+        computePhi<Traits>(generator);
+        for (int j = 0; j < 64; ++j) {
+            shifted[j][0] = phi[0] << j;
+            for (int l = 1; l < JUMP_WORDS; ++l) shifted[j][l] = (phi[l] << j) | (j ? (phi[l-1] >> (64-j)) : 0);
+            shifted[j][JUMP_WORDS] = j ? (phi[JUMP_WORDS-1] >> (64-j)) : 0;
+        }
+        pow2mod(STREFLOP_RANDOM_SPLIT_LOG2, split);
+    }
+};
+
+// Computed on first use. Function-local statics are initialized only once even with threads
+template<class Traits> const JumpTables& getJumpTables(RandomGenerator generator) {
+    static const JumpTables tables(static_cast<const Traits*>(0), generator);
+    return tables;
+}
+
+/// Advance the state by J steps, given poly = x^(J-1) mod phi
+template<class Traits> void jumpState(const JumpWord* poly, RandomState& state) {
+    JumpWindow<Traits> window, result;
+    int offset;
+    window.load(state, offset);
+    window.step();
+    for (int i = 0; i < Traits::nwords; ++i) Traits::clear(result.ring[i]);
+    result.start = 0;
+    int i = JUMP_MAX_DEGREE-1;
+    while (i >= 0 && ((poly[i>>6] >> (i&63)) & 1) == 0) --i;
+    // Horner's scheme
+    for (; i >= 0; --i) {
+        result.step();
+        if ((poly[i>>6] >> (i&63)) & 1) result.add(window);
+    }
+    result.store(state, offset);
+}
+
+template<class Traits> void jumpPow2(unsigned int log2_steps, RandomState& state) {
+    const JumpTables& tables = getJumpTables<Traits>(RandomGenerator(state.generator));
+    JumpWord poly[JUMP_WORDS];
+    tables.pow2mod(log2_steps, poly);
+    tables.divx(poly);
+    jumpState<Traits>(poly, state);
+}
+
+template<class Traits> void jumpSplit(SizedUnsignedInteger<32>::Type index, RandomState& state) {
+    const JumpTables& tables = getJumpTables<Traits>(RandomGenerator(state.generator));
+    // x^(index * 2^STREFLOP_RANDOM_SPLIT_LOG2) by square and multiply
+    JumpWord poly[JUMP_WORDS];
+    memset(poly, 0, sizeof(poly));
+    poly[0] = 1;
+    for (int b = 31; b >= 0; --b) {
+        tables.sqrmod(poly, poly);
+        if ((index >> b) & 1) tables.mulmod(poly, tables.split, poly);
+    }
+    tables.divx(poly);
+    jumpState<Traits>(poly, state);
+}
+
+void RandomJump(unsigned int log2_steps, RandomState& state) {
+    if (state.generator == STREFLOP_SFMT19937) jumpPow2<SFMTJumpTraits>(log2_steps, state);
+    else jumpPow2<MTJumpTraits>(log2_steps, state);
+}
+
+void RandomSplit(const RandomState& parent, SizedUnsignedInteger<32>::Type index, RandomState& child) {
+    child = parent;
+    if (index == 0) return;
+    if (child.generator == STREFLOP_SFMT19937) jumpSplit<SFMTJumpTraits>(index, child);
+    else jumpSplit<MTJumpTraits>(index, child);
+}
 
 SizedUnsignedInteger<32>::Type RandomInit(RandomState& state) {
-    return RandomInit(SizedUnsignedInteger<32>::Type(time(0)));
+    return RandomInit(SizedUnsignedInteger<32>::Type(time(0)), state);
 }
 
 SizedUnsignedInteger<32>::Type RandomInit(SizedUnsignedInteger<32>::Type seed, RandomState& state) {
-    init_genrand(seed,state);
+    return RandomInit(seed, STREFLOP_MT19937, state);
+}
+
+SizedUnsignedInteger<32>::Type RandomInit(SizedUnsignedInteger<32>::Type seed, RandomGenerator generator, RandomState& state) {
+    state.generator = generator;
+    state.integer_method = STREFLOP_INTEGER_MASK;
+    if (generator == STREFLOP_SFMT19937) sfmt_init_genrand(seed,state);
+    else init_genrand(seed,state);
     return state.seed;
 }
 
+void RandomSetIntegerMethod(RandomIntegerMethod method, RandomState& state) {
+    state.integer_method = method;
+}
+
+void RandomSetIntegerMethod(RandomIntegerMethod method, CounterRandomState& state) {
+    state.integer_method = method;
+}
+
 SizedUnsignedInteger<32>::Type RandomSeed(RandomState& state) {
     return state.seed;
 }
 
+void RandomInit(SizedUnsignedInteger<32>::Type seed, SizedUnsignedInteger<64>::Type stream, CounterRandomState& state) {
+    state.key[0] = static_cast<SizedUnsignedInteger<32>::Type>(stream);
+    state.key[1] = static_cast<SizedUnsignedInteger<32>::Type>(stream >> 32);
+    state.key[2] = seed;
+    state.key[3] = 0;
+    state.integer_method = STREFLOP_INTEGER_MASK;
+    RandomSeek(0, state);
+}
+
+void RandomSeek(SizedUnsignedInteger<64>::Type position, CounterRandomState& state) {
+    // 4 32-bit words per block
+    SizedUnsignedInteger<64>::Type word = position * (STREFLOP_RANDOM_GEN_SIZE/32);
+    SizedUnsignedInteger<64>::Type block = word >> 2;
+    state.counter[0] = static_cast<SizedUnsignedInteger<32>::Type>(block);
+    state.counter[1] = static_cast<SizedUnsignedInteger<32>::Type>(block >> 32);
+    state.counter[2] = 0;
+    state.counter[3] = 0;
+    // Generate the block now only if it is partially consumed
+    state.index = 4;
+    if ((word & 3) != 0) {
+        counter_block(state);
+        state.index = static_cast<int>(word & 3);
+    }
+}
+
 // Default state holder, so single threaded applications don't bother setting up an object
 RandomState DefaultRandomState;
 
@@ -14,9 +14,39 @@
 
 // Need sized integer types, which are now system-independent thanks to template metaprogramming
 #include "IntegerTypes.h"
+// size_t, for the bulk functions
+#include <stddef.h>
 
 namespace streflop {
 
+/** Generators that may drive a RandomState, see RandomInit
+
+    Both have the same 19937 bits state and period, but produce different sequences.
+    - STREFLOP_MT19937 is the original Mersenne twister, and the default.
+    - STREFLOP_SFMT19937 is the SIMD-oriented Fast Mersenne Twister by Saito and Matsumoto.
+      The state is updated 128 bits at a time, using SSE2 when available.
+      The sequence depends only on the seed, not on the SSE2 availability nor on the FPU mode.
+*/
+enum RandomGenerator {
+    STREFLOP_MT19937 = 0,
+    STREFLOP_SFMT19937 = 1
+};
+
+/** Algorithms for the random integers in a range, see RandomSetIntegerMethod
+
+    - STREFLOP_INTEGER_MASK draws as many bits as needed for the range and rejects the numbers
+      above it. This is the default, and the sequence of the previous streflop versions.
+      A range just above a power of two rejects almost half of the draws.
+    - STREFLOP_INTEGER_MULTIPLY scales a full draw to the range with a multiplication, and
+      keeps its high part. Less than one draw in 2^bits/range is rejected, with a single
+      division only when a rejection is possible (Lemire's method).
+    Both are exactly uniform and reproducible, but give different sequences.
+*/
+enum RandomIntegerMethod {
+    STREFLOP_INTEGER_MASK = 0,
+    STREFLOP_INTEGER_MULTIPLY = 1
+};
+
 /** Random state holder object
     Declare one of this per thread, and use it as context to the random functions
     Object is properly set by the RandomInit functions
@@ -29,6 +59,10 @@ struct RandomState {
     // state vector
     SizedUnsignedInteger<STREFLOP_RANDOM_GEN_SIZE>::Type mt[19968/STREFLOP_RANDOM_GEN_SIZE];
     int mti;
+    // generator using the state vector, one of the RandomGenerator values
+    int generator;
+    // algorithm for the integers in a range, one of the RandomIntegerMethod values
+    int integer_method;
     // random seed that was used for initialization
     SizedUnsignedInteger<32>::Type seed;
 }
@@ -40,6 +74,46 @@ __attribute__ ((aligned (64))) // align state vector on cache line size
 /// Default random state holder
 extern RandomState DefaultRandomState;
 
+/** Counter-based random state, an alternative to RandomState
+
+    The numbers are obtained by encrypting a 128-bit counter with a 128-bit key, using
+    the Threefry-4x32-20 generator by Salmon et al. There is no state vector to update:
+    - The object is small enough to give one to each entity of a simulation.
+    - The key selects the stream, and the counter the position in that stream.
+      Number i of stream k is obtained in constant time by RandomSeek, see below.
+    - Streams with distinct keys are independent, no need to jump ahead.
+
+    All the Random, Random12, Random01, NRandom and fill functions accept this state
+    in place of a RandomState. The state must then be passed explicitly.
+    The key may also be set directly, then call RandomSeek to reset the position, and
+    RandomSetIntegerMethod to set the integer method.
+*/
+struct CounterRandomState {
+    // the encryption key, selecting the stream
+    SizedUnsignedInteger<32>::Type key[4];
+    // the next counter value to encrypt
+    SizedUnsignedInteger<32>::Type counter[4];
+    // the last encrypted block, and the index of the next word to use in it (4 if none)
+    SizedUnsignedInteger<32>::Type block[4];
+    int index;
+    // algorithm for the integers in a range, one of the RandomIntegerMethod values
+    int integer_method;
+};
+
+/** Initialize a counter-based state for the given stream of the given seed.
+    The key is made of the stream number in the low words and of the seed.
+    The integer method is reset to STREFLOP_INTEGER_MASK.
+*/
+void RandomInit(SizedUnsignedInteger<32>::Type seed, SizedUnsignedInteger<64>::Type stream, CounterRandomState& state);
+
+/** Set the position in the stream, counted in STREFLOP_RANDOM_GEN_SIZE bits numbers.
+    The integer method is kept.
+    The next number drawn is then the same as after drawing 'position' numbers from the start.
+    Note that the functions using rejection, like Random12<false,false,...>, may draw more than
+    one number per call. Seeking each entity to an index of its own is always reproducible.
+*/
+void RandomSeek(SizedUnsignedInteger<64>::Type position, CounterRandomState& state);
+
 /** Initialize the random number generator with the given seed.
 
     By default, the seed is taken from system time and printed out
@@ -52,16 +126,49 @@ extern RandomState DefaultRandomState;
 
     The RNG used is the Mersenne twister implementation by the
     original authors Takuji Nishimura and Makoto Matsumoto.
+    The SFMT variant may be selected instead, see RandomGenerator above.
+    The integer method is reset to STREFLOP_INTEGER_MASK.
 
     See also Random.cpp for more information.
 */
 SizedUnsignedInteger<32>::Type RandomInit(RandomState& state = DefaultRandomState);
 SizedUnsignedInteger<32>::Type RandomInit(SizedUnsignedInteger<32>::Type seed, RandomState& state = DefaultRandomState);
+SizedUnsignedInteger<32>::Type RandomInit(SizedUnsignedInteger<32>::Type seed, RandomGenerator generator, RandomState& state = DefaultRandomState);
+
+/** Select the algorithm of the Random functions for integer types in a range.
+    The other functions are not affected. Call it after RandomInit, which resets the method.
+    RandomSplit copies it to the child with the rest of the state.
+*/
+void RandomSetIntegerMethod(RandomIntegerMethod method, RandomState& state = DefaultRandomState);
+void RandomSetIntegerMethod(RandomIntegerMethod method, CounterRandomState& state);
 
 /// Returns the random seed that was used for the initialization
 /// Defaults to 0 if the RNG is not yet initialized
 SizedUnsignedInteger<32>::Type RandomSeed(RandomState& state = DefaultRandomState);
 
+/** Jump ahead and independent substreams
+
+    RandomJump advances the state by 2^log2_steps state words, as if that many words were
+    drawn, at a cost independent of the jump length.
+    A state word is one random number for STREFLOP_MT19937, and one 128-bit block for
+    STREFLOP_SFMT19937, that is 128/STREFLOP_RANDOM_GEN_SIZE random numbers.
+
+    RandomSplit sets child to the parent state advanced by index * 2^STREFLOP_RANDOM_SPLIT_LOG2
+    state words, and leaves the parent untouched. Children with different indices draw from
+    non-overlapping parts of the same sequence, as long as each draws less than
+    2^STREFLOP_RANDOM_SPLIT_LOG2 words. This is the way to get one state per thread that
+    does not depend on the scheduling. Index 0 is a copy of the parent.
+
+    The first call for a given generator computes the jump tables, which takes a few
+    tens of milliseconds. Each call then takes a few milliseconds.
+    Both work on a state that has already been drawn from.
+*/
+#if !defined(STREFLOP_RANDOM_SPLIT_LOG2)
+#define STREFLOP_RANDOM_SPLIT_LOG2 64
+#endif
+void RandomJump(unsigned int log2_steps, RandomState& state = DefaultRandomState);
+void RandomSplit(const RandomState& parent, SizedUnsignedInteger<32>::Type index, RandomState& child);
+
 /** Returns a random number from a uniform distribution.
 
     All integer types are supported, as well as Simple, Double, and Extended
@@ -118,12 +225,22 @@ template<typename a_type> inline a_type RandomIE(a_type min, a_type max, RandomS
 template<typename a_type> inline a_type RandomEI(a_type min, a_type max, RandomState& state = DefaultRandomState) {return Random<false, true, a_type>(min, max, state);}
 template<typename a_type> inline a_type RandomEE(a_type min, a_type max, RandomState& state = DefaultRandomState) {return Random<false, false, a_type>(min, max, state);}
 template<typename a_type> inline a_type RandomII(a_type min, a_type max, RandomState& state = DefaultRandomState) {return Random<true, true, a_type>(min, max, state);}
+// Same with a counter-based state
+template<bool include_min, bool include_max, typename a_type> a_type Random(a_type min, a_type max, CounterRandomState& state);
+template<typename a_type> a_type Random(CounterRandomState& state);
+template<typename a_type> inline a_type RandomIE(a_type min, a_type max, CounterRandomState& state) {return Random<true, false, a_type>(min, max, state);}
+template<typename a_type> inline a_type RandomEI(a_type min, a_type max, CounterRandomState& state) {return Random<false, true, a_type>(min, max, state);}
+template<typename a_type> inline a_type RandomEE(a_type min, a_type max, CounterRandomState& state) {return Random<false, false, a_type>(min, max, state);}
+template<typename a_type> inline a_type RandomII(a_type min, a_type max, CounterRandomState& state) {return Random<true, true, a_type>(min, max, state);}
+#define STREFLOP_RANDOM_MAKE_REAL_FOR_STATE(a_type, State) \
+template<> a_type Random<a_type>(State& state); \
+template<> a_type Random<true, true, a_type>(a_type min, a_type max, State& state); \
+template<> a_type Random<true, false, a_type>(a_type min, a_type max, State& state); \
+template<> a_type Random<false, true, a_type>(a_type min, a_type max, State& state); \
+template<> a_type Random<false, false, a_type>(a_type min, a_type max, State& state);
 #define STREFLOP_RANDOM_MAKE_REAL(a_type) \
-template<> a_type Random<a_type>(RandomState& state); \
-template<> a_type Random<true, true, a_type>(a_type min, a_type max, RandomState& state); \
-template<> a_type Random<true, false, a_type>(a_type min, a_type max, RandomState& state); \
-template<> a_type Random<false, true, a_type>(a_type min, a_type max, RandomState& state); \
-template<> a_type Random<false, false, a_type>(a_type min, a_type max, RandomState& state);
+STREFLOP_RANDOM_MAKE_REAL_FOR_STATE(a_type, RandomState) \
+STREFLOP_RANDOM_MAKE_REAL_FOR_STATE(a_type, CounterRandomState)
 
 STREFLOP_RANDOM_MAKE_REAL(char)
 STREFLOP_RANDOM_MAKE_REAL(unsigned char)
@@ -146,6 +263,12 @@ template<typename a_type> inline a_type Random12IE(RandomState& state = DefaultR
 template<typename a_type> inline a_type Random12EI(RandomState& state = DefaultRandomState) {return Random12<false, true, a_type>(state);}
 template<typename a_type> inline a_type Random12EE(RandomState& state = DefaultRandomState) {return Random12<false, false, a_type>(state);}
 template<typename a_type> inline a_type Random12II(RandomState& state = DefaultRandomState) {return Random12<true, true, a_type>(state);}
+// Same with a counter-based state
+template<bool include_min, bool include_max, typename a_type> a_type Random12(CounterRandomState& state);
+template<typename a_type> inline a_type Random12IE(CounterRandomState& state) {return Random12<true, false, a_type>(state);}
+template<typename a_type> inline a_type Random12EI(CounterRandomState& state) {return Random12<false, true, a_type>(state);}
+template<typename a_type> inline a_type Random12EE(CounterRandomState& state) {return Random12<false, false, a_type>(state);}
+template<typename a_type> inline a_type Random12II(CounterRandomState& state) {return Random12<true, true, a_type>(state);}
 
 /** Additional and faster functions for real numbers
 
@@ -162,36 +285,108 @@ template<typename a_type> inline a_type Random01IE(RandomState& state = DefaultR
 template<typename a_type> inline a_type Random01EI(RandomState& state = DefaultRandomState) {return Random01<false, true, a_type>(state);}
 template<typename a_type> inline a_type Random01EE(RandomState& state = DefaultRandomState) {return Random01<false, false, a_type>(state);}
 template<typename a_type> inline a_type Random01II(RandomState& state = DefaultRandomState) {return Random01<true, true, a_type>(state);}
+// Same with a counter-based state
+template<bool include_min, bool include_max, typename a_type> inline a_type Random01(CounterRandomState& state) {
+    return Random12<include_min, include_max, a_type>(state) - a_type(1.0);
+}
+template<typename a_type> inline a_type Random01IE(CounterRandomState& state) {return Random01<true, false, a_type>(state);}
+template<typename a_type> inline a_type Random01EI(CounterRandomState& state) {return Random01<false, true, a_type>(state);}
+template<typename a_type> inline a_type Random01EE(CounterRandomState& state) {return Random01<false, false, a_type>(state);}
+template<typename a_type> inline a_type Random01II(CounterRandomState& state) {return Random01<true, true, a_type>(state);}
+
+/** Bulk versions of the above, filling out[0..n-1]
+
+    The array receives exactly the numbers that n successive calls to the single number
+    functions would have returned, in the same order, and the state is left the same way.
+    The difference is that the numbers are taken directly from the generator state block,
+    without the per-call overhead. These are only defined over the floating-point types.
+*/
+template<bool include_min, bool include_max, typename a_type> void RandomFill12(a_type* out, size_t n, RandomState& state = DefaultRandomState);
+// Alias that can be useful too
+template<typename a_type> inline void RandomFill12IE(a_type* out, size_t n, RandomState& state = DefaultRandomState) {RandomFill12<true, false, a_type>(out, n, state);}
+template<typename a_type> inline void RandomFill12EI(a_type* out, size_t n, RandomState& state = DefaultRandomState) {RandomFill12<false, true, a_type>(out, n, state);}
+template<typename a_type> inline void RandomFill12EE(a_type* out, size_t n, RandomState& state = DefaultRandomState) {RandomFill12<false, false, a_type>(out, n, state);}
+template<typename a_type> inline void RandomFill12II(a_type* out, size_t n, RandomState& state = DefaultRandomState) {RandomFill12<true, true, a_type>(out, n, state);}
+// Same with a counter-based state
+template<bool include_min, bool include_max, typename a_type> void RandomFill12(a_type* out, size_t n, CounterRandomState& state);
+template<typename a_type> inline void RandomFill12IE(a_type* out, size_t n, CounterRandomState& state) {RandomFill12<true, false, a_type>(out, n, state);}
+template<typename a_type> inline void RandomFill12EI(a_type* out, size_t n, CounterRandomState& state) {RandomFill12<false, true, a_type>(out, n, state);}
+template<typename a_type> inline void RandomFill12EE(a_type* out, size_t n, CounterRandomState& state) {RandomFill12<false, false, a_type>(out, n, state);}
+template<typename a_type> inline void RandomFill12II(a_type* out, size_t n, CounterRandomState& state) {RandomFill12<true, true, a_type>(out, n, state);}
+
+template<bool include_min, bool include_max, typename a_type> inline void RandomFill01(a_type* out, size_t n, RandomState& state = DefaultRandomState) {
+    RandomFill12<include_min, include_max, a_type>(out, n, state);
+    for (size_t i = 0; i < n; ++i) out[i] -= a_type(1.0);
+}
+// Alias that can be useful too
+template<typename a_type> inline void RandomFill01IE(a_type* out, size_t n, RandomState& state = DefaultRandomState) {RandomFill01<true, false, a_type>(out, n, state);}
+template<typename a_type> inline void RandomFill01EI(a_type* out, size_t n, RandomState& state = DefaultRandomState) {RandomFill01<false, true, a_type>(out, n, state);}
+template<typename a_type> inline void RandomFill01EE(a_type* out, size_t n, RandomState& state = DefaultRandomState) {RandomFill01<false, false, a_type>(out, n, state);}
+template<typename a_type> inline void RandomFill01II(a_type* out, size_t n, RandomState& state = DefaultRandomState) {RandomFill01<true, true, a_type>(out, n, state);}
+// Same with a counter-based state
+template<bool include_min, bool include_max, typename a_type> inline void RandomFill01(a_type* out, size_t n, CounterRandomState& state) {
+    RandomFill12<include_min, include_max, a_type>(out, n, state);
+    for (size_t i = 0; i < n; ++i) out[i] -= a_type(1.0);
+}
+template<typename a_type> inline void RandomFill01IE(a_type* out, size_t n, CounterRandomState& state) {RandomFill01<true, false, a_type>(out, n, state);}
+template<typename a_type> inline void RandomFill01EI(a_type* out, size_t n, CounterRandomState& state) {RandomFill01<false, true, a_type>(out, n, state);}
+template<typename a_type> inline void RandomFill01EE(a_type* out, size_t n, CounterRandomState& state) {RandomFill01<false, false, a_type>(out, n, state);}
+template<typename a_type> inline void RandomFill01II(a_type* out, size_t n, CounterRandomState& state) {RandomFill01<true, true, a_type>(out, n, state);}
+
+// Same scaling from the 1..2 range as the single number version
+template<bool include_min, bool include_max, typename a_type> inline void RandomFill(a_type* out, size_t n, a_type min, a_type max, RandomState& state = DefaultRandomState) {
+    RandomFill12<include_min, include_max, a_type>(out, n, state);
+    a_type range = max - min;
+    for (size_t i = 0; i < n; ++i) out[i] = out[i] * range - range + min;
+}
+// Alias that can be useful too
+template<typename a_type> inline void RandomFillIE(a_type* out, size_t n, a_type min, a_type max, RandomState& state = DefaultRandomState) {RandomFill<true, false, a_type>(out, n, min, max, state);}
+template<typename a_type> inline void RandomFillEI(a_type* out, size_t n, a_type min, a_type max, RandomState& state = DefaultRandomState) {RandomFill<false, true, a_type>(out, n, min, max, state);}
+template<typename a_type> inline void RandomFillEE(a_type* out, size_t n, a_type min, a_type max, RandomState& state = DefaultRandomState) {RandomFill<false, false, a_type>(out, n, min, max, state);}
+template<typename a_type> inline void RandomFillII(a_type* out, size_t n, a_type min, a_type max, RandomState& state = DefaultRandomState) {RandomFill<true, true, a_type>(out, n, min, max, state);}
+// Same with a counter-based state
+template<bool include_min, bool include_max, typename a_type> inline void RandomFill(a_type* out, size_t n, a_type min, a_type max, CounterRandomState& state) {
+    RandomFill12<include_min, include_max, a_type>(out, n, state);
+    a_type range = max - min;
+    for (size_t i = 0; i < n; ++i) out[i] = out[i] * range - range + min;
+}
+template<typename a_type> inline void RandomFillIE(a_type* out, size_t n, a_type min, a_type max, CounterRandomState& state) {RandomFill<true, false, a_type>(out, n, min, max, state);}
+template<typename a_type> inline void RandomFillEI(a_type* out, size_t n, a_type min, a_type max, CounterRandomState& state) {RandomFill<false, true, a_type>(out, n, min, max, state);}
+template<typename a_type> inline void RandomFillEE(a_type* out, size_t n, a_type min, a_type max, CounterRandomState& state) {RandomFill<false, false, a_type>(out, n, min, max, state);}
+template<typename a_type> inline void RandomFillII(a_type* out, size_t n, a_type min, a_type max, CounterRandomState& state) {RandomFill<true, true, a_type>(out, n, min, max, state);}
 
 /// Define all 12 and 01 functions only for real types
 /// use the 12 function to generate the other
 
-#define STREFLOP_RANDOM_MAKE_REAL_FLOAT_TYPES(a_type) \
-template<> a_type Random12<true, true, a_type>(RandomState& state); \
-template<> a_type Random12<true, false, a_type>(RandomState& state); \
-template<> a_type Random12<false, true, a_type>(RandomState& state); \
-template<> a_type Random12<false, false, a_type>(RandomState& state); \
-template<> a_type Random<a_type>(RandomState& state); \
-template<> inline a_type Random<true, true, a_type>(a_type min, a_type max, RandomState& state) { \
-    (void)(state);\
+#define STREFLOP_RANDOM_MAKE_REAL_FLOAT_TYPES_FOR_STATE(a_type, State) \
+template<> a_type Random12<true, true, a_type>(State& state); \
+template<> a_type Random12<true, false, a_type>(State& state); \
+template<> a_type Random12<false, true, a_type>(State& state); \
+template<> a_type Random12<false, false, a_type>(State& state); \
+template<> void RandomFill12<true, true, a_type>(a_type* out, size_t n, State& state); \
+template<> void RandomFill12<true, false, a_type>(a_type* out, size_t n, State& state); \
+template<> void RandomFill12<false, true, a_type>(a_type* out, size_t n, State& state); \
+template<> void RandomFill12<false, false, a_type>(a_type* out, size_t n, State& state); \
+template<> a_type Random<a_type>(State& state); \
+template<> inline a_type Random<true, true, a_type>(a_type min, a_type max, State& state) { \
     a_type range = max - min;\
-    return Random12<true,true,a_type>() * range - range + min;\
+    return Random12<true,true,a_type>(state) * range - range + min;\
 } \
-template<> inline a_type Random<true, false, a_type>(a_type min, a_type max, RandomState& state) { \
-    (void)(state);\
+template<> inline a_type Random<true, false, a_type>(a_type min, a_type max, State& state) { \
     a_type range = max - min;\
-    return Random12<true,false,a_type>() * range - range + min;\
+    return Random12<true,false,a_type>(state) * range - range + min;\
 } \
-template<> inline a_type Random<false, true, a_type>(a_type min, a_type max, RandomState& state) { \
-    (void)(state);\
+template<> inline a_type Random<false, true, a_type>(a_type min, a_type max, State& state) { \
     a_type range = max - min;\
-    return Random12<false,true,a_type>() * range - range + min;\
+    return Random12<false,true,a_type>(state) * range - range + min;\
 } \
-template<> inline a_type Random<false, false, a_type>(a_type min, a_type max, RandomState& state) { \
-    (void)(state);\
+template<> inline a_type Random<false, false, a_type>(a_type min, a_type max, State& state) { \
     a_type range = max - min;\
-    return Random12<false,false,a_type>() * range - range + min;\
+    return Random12<false,false,a_type>(state) * range - range + min;\
 }
+#define STREFLOP_RANDOM_MAKE_REAL_FLOAT_TYPES(a_type) \
+STREFLOP_RANDOM_MAKE_REAL_FLOAT_TYPES_FOR_STATE(a_type, RandomState) \
+STREFLOP_RANDOM_MAKE_REAL_FLOAT_TYPES_FOR_STATE(a_type, CounterRandomState)
 
 
 STREFLOP_RANDOM_MAKE_REAL_FLOAT_TYPES(Simple)
@@ -242,6 +437,84 @@ template<> Double NRandom(Double *secondary, RandomState& state);
 #if defined(Extended)
 template<> Extended NRandom(Extended *secondary, RandomState& state);
 #endif
+/// Same with a counter-based state, secondary may be 0
+template<typename a_type> a_type NRandom(a_type mean, a_type std_dev, a_type *secondary, CounterRandomState& state);
+template<> Simple NRandom(Simple mean, Simple std_dev, Simple *secondary, CounterRandomState& state);
+template<> Double NRandom(Double mean, Double std_dev, Double *secondary, CounterRandomState& state);
+#if defined(Extended)
+template<> Extended NRandom(Extended mean, Extended std_dev, Extended *secondary, CounterRandomState& state);
+#endif
+template<typename a_type> a_type NRandom(a_type *secondary, CounterRandomState& state);
+template<> Simple NRandom(Simple *secondary, CounterRandomState& state);
+template<> Double NRandom(Double *secondary, CounterRandomState& state);
+#if defined(Extended)
+template<> Extended NRandom(Extended *secondary, CounterRandomState& state);
+#endif
+
+/** Bulk versions of NRandom, filling out[0..n-1]
+
+    The normal numbers are produced in pairs, so this gives the same numbers as
+    n/2 successive calls using the secondary argument:
+        out[2*i] = NRandom(mean, std_dev, &out[2*i+1], state)
+    plus, when n is odd, a last call without secondary.
+*/
+template<typename a_type> void NRandomFill(a_type* out, size_t n, a_type mean, a_type std_dev, RandomState& state = DefaultRandomState);
+template<> void NRandomFill(Simple* out, size_t n, Simple mean, Simple std_dev, RandomState& state);
+template<> void NRandomFill(Double* out, size_t n, Double mean, Double std_dev, RandomState& state);
+#if defined(Extended)
+template<> void NRandomFill(Extended* out, size_t n, Extended mean, Extended std_dev, RandomState& state);
+#endif
+/// Simplified versions
+template<typename a_type> void NRandomFill(a_type* out, size_t n, RandomState& state = DefaultRandomState);
+template<> void NRandomFill(Simple* out, size_t n, RandomState& state);
+template<> void NRandomFill(Double* out, size_t n, RandomState& state);
+#if defined(Extended)
+template<> void NRandomFill(Extended* out, size_t n, RandomState& state);
+#endif
+/// Same with a counter-based state
+template<typename a_type> void NRandomFill(a_type* out, size_t n, a_type mean, a_type std_dev, CounterRandomState& state);
+template<> void NRandomFill(Simple* out, size_t n, Simple mean, Simple std_dev, CounterRandomState& state);
+template<> void NRandomFill(Double* out, size_t n, Double mean, Double std_dev, CounterRandomState& state);
+#if defined(Extended)
+template<> void NRandomFill(Extended* out, size_t n, Extended mean, Extended std_dev, CounterRandomState& state);
+#endif
+template<typename a_type> void NRandomFill(a_type* out, size_t n, CounterRandomState& state);
+template<> void NRandomFill(Simple* out, size_t n, CounterRandomState& state);
+template<> void NRandomFill(Double* out, size_t n, CounterRandomState& state);
+#if defined(Extended)
+template<> void NRandomFill(Extended* out, size_t n, CounterRandomState& state);
+#endif
+
+/** Normal numbers by the Ziggurat method
+
+    Same role as NRandom, but most numbers are obtained with one random draw, one
+    multiplication and one comparison, without calling sqrt or log. This is several times
+    faster than NRandom, and gives a different sequence.
+    The tables are computed at the first call for each type, using the streflop functions
+    in that type: the FPU must be set up for that type first, as for NRandom.
+    See Random.cpp for the reference.
+*/
+template<typename a_type> a_type NRandomZiggurat(RandomState& state = DefaultRandomState);
+template<typename a_type> a_type NRandomZiggurat(a_type mean, a_type std_dev, RandomState& state = DefaultRandomState);
+template<> Simple NRandomZiggurat(RandomState& state);
+template<> Double NRandomZiggurat(RandomState& state);
+template<> Simple NRandomZiggurat(Simple mean, Simple std_dev, RandomState& state);
+template<> Double NRandomZiggurat(Double mean, Double std_dev, RandomState& state);
+#if defined(Extended)
+template<> Extended NRandomZiggurat(RandomState& state);
+template<> Extended NRandomZiggurat(Extended mean, Extended std_dev, RandomState& state);
+#endif
+/// Same with a counter-based state
+template<typename a_type> a_type NRandomZiggurat(CounterRandomState& state);
+template<typename a_type> a_type NRandomZiggurat(a_type mean, a_type std_dev, CounterRandomState& state);
+template<> Simple NRandomZiggurat(CounterRandomState& state);
+template<> Double NRandomZiggurat(CounterRandomState& state);
+template<> Simple NRandomZiggurat(Simple mean, Simple std_dev, CounterRandomState& state);
+template<> Double NRandomZiggurat(Double mean, Double std_dev, CounterRandomState& state);
+#if defined(Extended)
+template<> Extended NRandomZiggurat(CounterRandomState& state);
+template<> Extended NRandomZiggurat(Extended mean, Extended std_dev, CounterRandomState& state);
+#endif
 
 }
 
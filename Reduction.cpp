@@ -0,0 +1,357 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Reproducible sums, see Reduction.h
+
+// memcpy for the bit patterns
+#include <string.h>
+#include "streflop.h"
+
+#ifndef STREFLOP_NO_THREADS
+#include <thread>
+#include <vector>
+#endif
+
+namespace streflop {
+
+typedef SizedInteger<64>::Type int64;
+typedef SizedUnsignedInteger<64>::Type uint64;
+typedef SizedUnsignedInteger<32>::Type uint32;
+
+// Weight of the first digit, and number of additions between two normalizations
+static const int ReproducibleOffset = 2176;
+static const SizedInteger<32>::Type ReproducibleRoom = 1 << 30;
+
+// The IEEE formats as sign, integer mantissa and exponent of its last bit
+struct ReproducibleFormat {
+    int mantissaBits;   // without the hidden bit
+    int exponentBits;
+    int bias;
+};
+static const ReproducibleFormat SimpleFormat = {23, 8, 127};
+static const ReproducibleFormat DoubleFormat = {52, 11, 1023};
+
+static inline uint64 bitsOf(Simple x) {
+    uint32 bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+static inline uint64 bitsOf(Double x) {
+    uint64 bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+// Returns 0 for a finite x, else the special flags
+static inline int decompose(uint64 bits, const ReproducibleFormat& format, bool& negative, uint64& mantissa, int& exponent) {
+    int expField = (int)(bits >> format.mantissaBits) & ((1 << format.exponentBits) - 1);
+    negative = ((bits >> (format.mantissaBits + format.exponentBits)) & 1) != 0;
+    mantissa = bits & ((uint64(1) << format.mantissaBits) - 1);
+    if (expField == (1 << format.exponentBits) - 1) {
+        if (mantissa != 0) return 4;
+        return negative ? 2 : 1;
+    }
+    if (expField == 0) exponent = 1 - format.bias - format.mantissaBits; // subnormal
+    else {
+        mantissa |= uint64(1) << format.mantissaBits;
+        exponent = expField - format.bias - format.mantissaBits;
+    }
+    return 0;
+}
+
+// Adds or subtracts value * 2^(position - ReproducibleOffset), in 3 digits at most
+static inline void addBits(ReproducibleAccumulator& acc, uint64 value, int position, bool negative) {
+    if (acc.room == 0) acc.normalize();
+    --acc.room;
+    int i = position >> 5, o = position & 31;
+    int64 d0, d1, d2;
+    if (o == 0) {
+        d0 = (int64)(value & 0xFFFFFFFF);
+        d1 = (int64)(value >> 32);
+        d2 = 0;
+    } else {
+        d0 = (int64)((value << o) & 0xFFFFFFFF);
+        d1 = (int64)((value >> (32 - o)) & 0xFFFFFFFF);
+        d2 = (int64)(value >> (64 - o));
+    }
+    if (negative) {
+        acc.digit[i] -= d0; acc.digit[i+1] -= d1; acc.digit[i+2] -= d2;
+    } else {
+        acc.digit[i] += d0; acc.digit[i+1] += d1; acc.digit[i+2] += d2;
+    }
+}
+
+void ReproducibleAccumulator::clear() {
+    memset(digit, 0, sizeof(digit));
+    room = ReproducibleRoom;
+    special = 0;
+}
+
+// Carry propagation: all digits but the last in [0, 2^32), the last one has the sign
+void ReproducibleAccumulator::normalize() {
+    for (int i = 0; i < STREFLOP_REPRODUCIBLE_DIGITS - 1; ++i) {
+        int64 carry = digit[i] >> 32;
+        digit[i] &= 0xFFFFFFFF;
+        digit[i+1] += carry;
+    }
+    room = ReproducibleRoom;
+}
+
+static inline void addValue(ReproducibleAccumulator& acc, uint64 bits, const ReproducibleFormat& format) {
+    bool negative;
+    uint64 mantissa;
+    int exponent = 0;
+    int special = decompose(bits, format, negative, mantissa, exponent);
+    if (special) {
+        acc.special |= special;
+        return;
+    }
+    if (mantissa != 0) addBits(acc, mantissa, exponent + ReproducibleOffset, negative);
+}
+
+static inline void addProduct(ReproducibleAccumulator& acc, uint64 xbits, uint64 ybits, const ReproducibleFormat& format) {
+    bool xneg, yneg;
+    uint64 xm, ym;
+    int xe = 0, ye = 0;
+    int xs = decompose(xbits, format, xneg, xm, xe);
+    int ys = decompose(ybits, format, yneg, ym, ye);
+    bool negative = xneg != yneg;
+    if (xs || ys) {
+        // NaN, or infinity times 0, or an infinity of the sign of the product
+        if ((xs | ys) & 4) acc.special |= 4;
+        else if ((!xs && xm == 0) || (!ys && ym == 0)) acc.special |= 4;
+        else acc.special |= negative ? 2 : 1;
+        return;
+    }
+    if (xm == 0 || ym == 0) return;
+    // 53x53 bits product from 32 bits halves, each partial product fits in 64 bits
+    uint64 x0 = xm & 0xFFFFFFFF, x1 = xm >> 32;
+    uint64 y0 = ym & 0xFFFFFFFF, y1 = ym >> 32;
+    int position = xe + ye + ReproducibleOffset;
+    addBits(acc, x0 * y0, position, negative);
+    if (x1 | y1) addBits(acc, x0 * y1 + x1 * y0, position + 32, negative);
+    if (x1 && y1) addBits(acc, x1 * y1, position + 64, negative);
+}
+
+void ReproducibleAccumulator::add(Simple x) {addValue(*this, bitsOf(x), SimpleFormat);}
+void ReproducibleAccumulator::add(Double x) {addValue(*this, bitsOf(x), DoubleFormat);}
+void ReproducibleAccumulator::add_product(Simple x, Simple y) {addProduct(*this, bitsOf(x), bitsOf(y), SimpleFormat);}
+void ReproducibleAccumulator::add_product(Double x, Double y) {addProduct(*this, bitsOf(x), bitsOf(y), DoubleFormat);}
+
+void ReproducibleAccumulator::merge(const ReproducibleAccumulator& other) {
+    ReproducibleAccumulator part = other;
+    part.normalize();
+    normalize();
+    for (int i = 0; i < STREFLOP_REPRODUCIBLE_DIGITS; ++i) digit[i] += part.digit[i];
+    --room;
+    special |= part.special;
+}
+
+/* Round the exact sum times 2^-scale to the format, returns the bit pattern.
+   scaleForSqrt: ignore scale, and set it instead to an even power of 2 that brings the sum near 1
+*/
+static uint64 roundAccumulator(const ReproducibleAccumulator& source, const ReproducibleFormat& format, bool scaleForSqrt, int& scale) {
+    const uint64 signBit = uint64(1) << (format.mantissaBits + format.exponentBits);
+    const uint64 infinity = uint64((1 << format.exponentBits) - 1) << format.mantissaBits;
+    if (source.special) {
+        if ((source.special & 4) || (source.special == 3)) return infinity | (uint64(1) << (format.mantissaBits - 1)); // NaN
+        return (source.special == 2) ? (signBit | infinity) : infinity;
+    }
+
+    ReproducibleAccumulator acc = source;
+    acc.normalize();
+    uint64 sign = 0;
+    if (acc.digit[STREFLOP_REPRODUCIBLE_DIGITS - 1] < 0) {
+        sign = signBit;
+        for (int i = 0; i < STREFLOP_REPRODUCIBLE_DIGITS; ++i) acc.digit[i] = -acc.digit[i];
+        acc.normalize();
+    }
+
+    // Most significant bit
+    int top = STREFLOP_REPRODUCIBLE_DIGITS - 1;
+    while (top >= 0 && acc.digit[top] == 0) --top;
+    if (top < 0) {
+        scale = 0;
+        return 0;
+    }
+    int msb = 32 * top;
+    for (uint64 d = (uint64)acc.digit[top]; d > 1; d >>= 1) ++msb;
+
+    // The 64 bits from the msb down, and whether anything below is set
+    uint64 m = 0;
+    for (int pos = msb; pos > msb - 64; --pos) {
+        m <<= 1;
+        if (pos >= 0) m |= ((uint64)acc.digit[pos >> 5] >> (pos & 31)) & 1;
+    }
+    bool sticky = false;
+    int below = msb - 64;
+    if (below >= 0) {
+        for (int i = 0; i < (below >> 5) && !sticky; ++i) sticky = acc.digit[i] != 0;
+        if (((uint64)acc.digit[below >> 5] & ((uint64(2) << (below & 31)) - 1)) != 0) sticky = true;
+    }
+
+    // Exponent of the msb, and number of bits to keep
+    int e = msb - ReproducibleOffset;
+    if (scaleForSqrt) scale = (e >= 0) ? (e & ~1) : -((-e + 1) & ~1);
+    e -= scale;
+    const int precision = format.mantissaBits + 1;
+    const int emin = 1 - format.bias, emax = format.bias;
+    if (e > emax) return sign | infinity;
+    int keep = (e >= emin) ? precision : precision - (emin - e);
+    if (keep < 0) return sign;
+
+    // Round to nearest, ties to even
+    int drop = 64 - keep;
+    uint64 q = (keep > 0) ? (m >> drop) : 0;
+    bool roundBit = ((m >> (drop - 1)) & 1) != 0;
+    bool rest = sticky || (drop > 1 && (m & ((uint64(1) << (drop - 1)) - 1)) != 0);
+    if (roundBit && (rest || (q & 1))) ++q;
+
+    if (e < emin) return sign | q; // subnormal, or the smallest normal after rounding
+    if (q >> precision) {
+        q >>= 1;
+        if (++e > emax) return sign | infinity;
+    }
+    return sign | (uint64(e + format.bias) << format.mantissaBits) | (q & ((uint64(1) << format.mantissaBits) - 1));
+}
+
+template<> Simple ReproducibleAccumulator::result<Simple>() const {
+    int scale = 0;
+    uint32 bits = (uint32)roundAccumulator(*this, SimpleFormat, false, scale);
+    Simple x;
+    memcpy(static_cast<void*>(&x), &bits, sizeof(bits));
+    return x;
+}
+
+template<> Double ReproducibleAccumulator::result<Double>() const {
+    int scale = 0;
+    uint64 bits = roundAccumulator(*this, DoubleFormat, false, scale);
+    Double x;
+    memcpy(static_cast<void*>(&x), &bits, sizeof(bits));
+    return x;
+}
+
+template<> Simple ReproducibleAccumulator::sqrt_result<Simple>() const {
+    int scale = 0;
+    uint32 bits = (uint32)roundAccumulator(*this, SimpleFormat, true, scale);
+    Simple x;
+    memcpy(static_cast<void*>(&x), &bits, sizeof(bits));
+    return ldexp(sqrt(x), scale / 2);
+}
+
+template<> Double ReproducibleAccumulator::sqrt_result<Double>() const {
+    int scale = 0;
+    uint64 bits = roundAccumulator(*this, DoubleFormat, true, scale);
+    Double x;
+    memcpy(static_cast<void*>(&x), &bits, sizeof(bits));
+    return ldexp(sqrt(x), scale / 2);
+}
+
+// The array functions, for one chunk
+template<typename T> static void sumChunk(const T* x, size_t n, ReproducibleAccumulator* acc) {
+    for (size_t i = 0; i < n; ++i) acc->add(x[i]);
+}
+
+template<typename T> static void dotChunk(const T* x, const T* y, size_t n, ReproducibleAccumulator* acc) {
+    for (size_t i = 0; i < n; ++i) acc->add_product(x[i], y[i]);
+}
+
+template<typename T> static void squareChunk(const T* x, size_t n, ReproducibleAccumulator* acc) {
+    for (size_t i = 0; i < n; ++i) acc->add_product(x[i], x[i]);
+}
+
+Simple reproducible_sum(const Simple* x, size_t n) {
+    ReproducibleAccumulator acc;
+    sumChunk(x, n, &acc);
+    return acc.result<Simple>();
+}
+
+Double reproducible_sum(const Double* x, size_t n) {
+    ReproducibleAccumulator acc;
+    sumChunk(x, n, &acc);
+    return acc.result<Double>();
+}
+
+Simple reproducible_dot(const Simple* x, const Simple* y, size_t n) {
+    ReproducibleAccumulator acc;
+    dotChunk(x, y, n, &acc);
+    return acc.result<Simple>();
+}
+
+Double reproducible_dot(const Double* x, const Double* y, size_t n) {
+    ReproducibleAccumulator acc;
+    dotChunk(x, y, n, &acc);
+    return acc.result<Double>();
+}
+
+Simple reproducible_norm2(const Simple* x, size_t n) {
+    ReproducibleAccumulator acc;
+    squareChunk(x, n, &acc);
+    return acc.sqrt_result<Simple>();
+}
+
+Double reproducible_norm2(const Double* x, size_t n) {
+    ReproducibleAccumulator acc;
+    squareChunk(x, n, &acc);
+    return acc.sqrt_result<Double>();
+}
+
+#ifndef STREFLOP_NO_THREADS
+
+// Each thread sums a contiguous chunk in its own accumulator, merged at the end
+template<typename T> static ReproducibleAccumulator parallelReduce(const T* x, const T* y, size_t n, int threads, bool squares) {
+    if (threads < 1) threads = 1;
+    if ((size_t)threads > n) threads = (n > 0) ? (int)n : 1;
+    std::vector<ReproducibleAccumulator> parts(threads);
+    std::vector<std::thread> workers;
+    size_t chunk = n / threads, extra = n % threads, start = 0;
+    for (int t = 0; t < threads; ++t) {
+        size_t count = chunk + ((size_t)t < extra ? 1 : 0);
+        if (squares) workers.push_back(std::thread(squareChunk<T>, x + start, count, &parts[t]));
+        else if (y) workers.push_back(std::thread(dotChunk<T>, x + start, y + start, count, &parts[t]));
+        else workers.push_back(std::thread(sumChunk<T>, x + start, count, &parts[t]));
+        start += count;
+    }
+    for (int t = 0; t < threads; ++t) {
+        workers[t].join();
+        if (t > 0) parts[0].merge(parts[t]);
+    }
+    return parts[0];
+}
+
+Simple reproducible_sum(const Simple* x, size_t n, int threads) {
+    return parallelReduce<Simple>(x, 0, n, threads, false).result<Simple>();
+}
+
+Double reproducible_sum(const Double* x, size_t n, int threads) {
+    return parallelReduce<Double>(x, 0, n, threads, false).result<Double>();
+}
+
+Simple reproducible_dot(const Simple* x, const Simple* y, size_t n, int threads) {
+    return parallelReduce<Simple>(x, y, n, threads, false).result<Simple>();
+}
+
+Double reproducible_dot(const Double* x, const Double* y, size_t n, int threads) {
+    return parallelReduce<Double>(x, y, n, threads, false).result<Double>();
+}
+
+Simple reproducible_norm2(const Simple* x, size_t n, int threads) {
+    return parallelReduce<Simple>(x, 0, n, threads, true).sqrt_result<Simple>();
+}
+
+Double reproducible_norm2(const Double* x, size_t n, int threads) {
+    return parallelReduce<Double>(x, 0, n, threads, true).sqrt_result<Double>();
+}
+
+#endif
+
+}
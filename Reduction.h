@@ -0,0 +1,109 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Included by the main streflop include file
+#ifndef STREFLOP_REDUCTION_H
+#define STREFLOP_REDUCTION_H
+
+// size_t, for the array functions
+#include <stddef.h>
+
+/*
+    A floating-point sum depends on the order of the additions: splitting an array in chunks
+    for several threads, or for packed instructions, changes the bits of the result.
+
+    The functions below compute the exact sum, dot product or sum of squares in a wide fixed
+    point accumulator, with integer arithmetic only, and round it once at the end. The result
+    is the correctly rounded sum, so it does not depend on the order nor on the partitioning
+    of the data, and it is the same in all configurations.
+
+    The partial sums of an accumulator may be merged in any order, this is how the threaded
+    versions work. With OpenMP for example:
+
+        ReproducibleAccumulator total;
+        #pragma omp parallel
+        {
+            ReproducibleAccumulator part;
+            #pragma omp for
+            for (long i = 0; i < n; ++i) part.add(x[i]);
+            #pragma omp critical
+            total.merge(part);
+        }
+        Double sum = total.result<Double>();
+
+    Infinities and NaN follow the IEEE rules for the whole sum. An exact zero sum is +0.
+    Extended is not supported, its exponent range would need a much larger accumulator.
+*/
+
+namespace streflop {
+
+/// Digits of the accumulator: 32 bits each, from 2^-2176 up, enough for all Double products
+#define STREFLOP_REPRODUCIBLE_DIGITS 134
+
+struct ReproducibleAccumulator {
+    // Each digit holds a signed multiple of 2^32 of its weight, and is brought back to
+    // 32 bits when room reaches 0, so no addition may overflow.
+    SizedInteger<64>::Type digit[STREFLOP_REPRODUCIBLE_DIGITS];
+    SizedInteger<32>::Type room;
+    // Infinities and NaN seen: 1 for +inf, 2 for -inf, 4 for NaN
+    int special;
+
+    inline ReproducibleAccumulator() {clear();}
+    void clear();
+
+    void add(Simple x);
+    void add(Double x);
+    /// Adds the exact product x*y
+    void add_product(Simple x, Simple y);
+    void add_product(Double x, Double y);
+    /// Adds the partial sum of another accumulator
+    void merge(const ReproducibleAccumulator& other);
+
+    /// The sum correctly rounded to Simple or Double
+    template<typename T> T result() const;
+    /// The square root of the sum, for norms. The sum is scaled by an even power of 2
+    /// before rounding, so it does not overflow nor underflow.
+    template<typename T> T sqrt_result() const;
+
+    void normalize();
+};
+
+template<> Simple ReproducibleAccumulator::result<Simple>() const;
+template<> Double ReproducibleAccumulator::result<Double>() const;
+template<> Simple ReproducibleAccumulator::sqrt_result<Simple>() const;
+template<> Double ReproducibleAccumulator::sqrt_result<Double>() const;
+
+/// Correctly rounded sum of x[0..n-1]
+Simple reproducible_sum(const Simple* x, size_t n);
+Double reproducible_sum(const Double* x, size_t n);
+
+/// Correctly rounded sum of x[i]*y[i]
+Simple reproducible_dot(const Simple* x, const Simple* y, size_t n);
+Double reproducible_dot(const Double* x, const Double* y, size_t n);
+
+/// Euclidian norm, sqrt of the correctly rounded sum of the squares
+Simple reproducible_norm2(const Simple* x, size_t n);
+Double reproducible_norm2(const Double* x, size_t n);
+
+// Same as above, with the array split in contiguous chunks for that many std::thread.
+// The results do not depend on the number of threads. Not available with STREFLOP_NO_THREADS.
+#ifndef STREFLOP_NO_THREADS
+Simple reproducible_sum(const Simple* x, size_t n, int threads);
+Double reproducible_sum(const Double* x, size_t n, int threads);
+Simple reproducible_dot(const Simple* x, const Simple* y, size_t n, int threads);
+Double reproducible_dot(const Double* x, const Double* y, size_t n, int threads);
+Simple reproducible_norm2(const Simple* x, size_t n, int threads);
+Double reproducible_norm2(const Double* x, size_t n, int threads);
+#endif
+
+}
+
+#endif
@@ -0,0 +1,95 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Slow path counters, see SlowPathStats.h
+
+// memcpy for the stored inputs
+#include <string.h>
+#include "streflop.h"
+
+#ifdef STREFLOP_SLOWPATH_STATS
+
+namespace streflop {
+
+// Thread-local storage needs plain types: the inputs are kept as bytes, the wrapper types have constructors
+struct SlowPathStoredInput {
+    int function;
+    char x[sizeof(Double)];
+    char y[sizeof(Double)];
+};
+
+STREFLOP_THREAD_LOCAL unsigned int slowpath_mp_calls = 0;
+static STREFLOP_THREAD_LOCAL SlowPathCounters slowpath_counters_array[SlowPathFunctionCount];
+static STREFLOP_THREAD_LOCAL SlowPathStoredInput slowpath_ring[STREFLOP_SLOWPATH_RING_SIZE];
+// Total number of slow inputs seen, the next one goes at slowpath_ring_count % STREFLOP_SLOWPATH_RING_SIZE
+static STREFLOP_THREAD_LOCAL SizedUnsignedInteger<64>::Type slowpath_ring_count = 0;
+
+static const char* slowpath_names[SlowPathFunctionCount] = {
+    "exp", "log", "pow", "sin", "cos", "sincos", "tan", "asin", "acos", "atan", "atan2"
+};
+
+const char* slowpath_name(SlowPathFunction function) {
+    return slowpath_names[function];
+}
+
+const SlowPathCounters& slowpath_counters(SlowPathFunction function) {
+    return slowpath_counters_array[function];
+}
+
+int slowpath_inputs(SlowPathInput* inputs, int max) {
+    int n = (slowpath_ring_count < STREFLOP_SLOWPATH_RING_SIZE) ? (int)slowpath_ring_count : STREFLOP_SLOWPATH_RING_SIZE;
+    if (n > max) n = max;
+    for (int i = 0; i < n; ++i) {
+        const SlowPathStoredInput& stored = slowpath_ring[(slowpath_ring_count - n + i) % STREFLOP_SLOWPATH_RING_SIZE];
+        inputs[i].function = (SlowPathFunction)stored.function;
+        memcpy(static_cast<void*>(&inputs[i].x), stored.x, sizeof(Double));
+        memcpy(static_cast<void*>(&inputs[i].y), stored.y, sizeof(Double));
+    }
+    return n;
+}
+
+void slowpath_reset() {
+    memset(slowpath_counters_array, 0, sizeof(slowpath_counters_array));
+    slowpath_ring_count = 0;
+}
+
+void slowpath_record(SlowPathFunction function, Double x, Double y, bool slow) {
+    SlowPathCounters& counters = slowpath_counters_array[function];
+    if (!slow) {
+        ++counters.fast;
+        return;
+    }
+    ++counters.slow;
+
+    // Rare enough that the exponent may be computed with the library itself
+    int bucket;
+    if (isnan(x) || isinf(x)) bucket = STREFLOP_SLOWPATH_HISTOGRAM_SIZE - 1;
+    else if (x == Double(0.0)) bucket = 0;
+    else {
+        int e;
+        frexp(x, &e);
+        // 2^(e-1) <= |x| < 2^e
+        bucket = e + 31;
+        if (bucket < 0) bucket = 0;
+        if (bucket >= STREFLOP_SLOWPATH_HISTOGRAM_SIZE) bucket = STREFLOP_SLOWPATH_HISTOGRAM_SIZE - 1;
+    }
+    ++counters.histogram[bucket];
+
+    SlowPathStoredInput& stored = slowpath_ring[slowpath_ring_count % STREFLOP_SLOWPATH_RING_SIZE];
+    stored.function = function;
+    memcpy(stored.x, &x, sizeof(Double));
+    memcpy(stored.y, &y, sizeof(Double));
+    ++slowpath_ring_count;
+}
+
+}
+
+#endif
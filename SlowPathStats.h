@@ -0,0 +1,100 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Included by the main streflop include file when STREFLOP_SLOWPATH_STATS is defined
+#ifndef STREFLOP_SLOWPATH_STATS_H
+#define STREFLOP_SLOWPATH_STATS_H
+
+/*
+    The dbl-64 functions first compute the result in double or double-double precision, and
+    check it against an error bound. When the check fails, they fall back to the multi-precision
+    code of mpa.cpp, which is 100 to 1000 times slower. This happens for a few inputs only, but
+    these show as latency spikes.
+
+    When both the library and the program are compiled with STREFLOP_SLOWPATH_STATS, the Double
+    functions that have such a fallback count their fast and slow calls. The slow calls are
+    also sorted by the binary exponent of their first argument, and their inputs are kept in a
+    ring buffer. Everything is per thread, and the results are unchanged.
+
+    The Simple and Extended functions have no multi-precision fallback.
+*/
+
+namespace streflop {
+
+enum SlowPathFunction {
+    SlowPathExp,
+    SlowPathLog,
+    SlowPathPow,
+    SlowPathSin,
+    SlowPathCos,
+    SlowPathSincos,
+    SlowPathTan,
+    SlowPathAsin,
+    SlowPathAcos,
+    SlowPathAtan,
+    SlowPathAtan2,
+    SlowPathFunctionCount
+};
+
+/// Bucket i holds the slow calls with 2^(i-32) <= |x| < 2^(i-31)
+/// The first bucket also holds the smaller values and zeros, the last one the larger values, infinities and NaN
+#define STREFLOP_SLOWPATH_HISTOGRAM_SIZE 64
+
+/// Number of slow inputs kept per thread, the older ones are overwritten
+#ifndef STREFLOP_SLOWPATH_RING_SIZE
+#define STREFLOP_SLOWPATH_RING_SIZE 256
+#endif
+
+struct SlowPathCounters {
+    SizedUnsignedInteger<64>::Type fast;
+    SizedUnsignedInteger<64>::Type slow;
+    SizedUnsignedInteger<64>::Type histogram[STREFLOP_SLOWPATH_HISTOGRAM_SIZE];
+};
+
+/// One input that took the slow path. y is 0 for the functions of one argument.
+struct SlowPathInput {
+    SlowPathFunction function;
+    Double x;
+    Double y;
+};
+
+/// Name of the function, ex: "exp"
+const char* slowpath_name(SlowPathFunction function);
+
+/// Counters of the calling thread for that function
+const SlowPathCounters& slowpath_counters(SlowPathFunction function);
+
+/// Copy at most max of the last slow inputs of the calling thread, oldest first
+/// Returns the number copied
+int slowpath_inputs(SlowPathInput* inputs, int max);
+
+/// Clear the counters and the inputs of the calling thread
+void slowpath_reset();
+
+/// Incremented by each conversion to the multi-precision format in mpa.cpp, which all the
+/// fallbacks start with. Defined in SlowPathStats.cpp
+extern STREFLOP_THREAD_LOCAL unsigned int slowpath_mp_calls;
+
+/// Records a call, slow if the multi-precision code was used
+void slowpath_record(SlowPathFunction function, Double x, Double y, bool slow);
+
+/// Counts one call of a Math.h function, from its construction to its destruction
+struct SlowPathScope {
+    inline SlowPathScope(SlowPathFunction f, Double a, Double b) : function(f), x(a), y(b), mp_calls(slowpath_mp_calls) {}
+    inline ~SlowPathScope() {slowpath_record(function, x, y, slowpath_mp_calls != mp_calls);}
+    SlowPathFunction function;
+    Double x, y;
+    unsigned int mp_calls;
+};
+
+}
+
+#endif
@@ -33,6 +33,14 @@
 #error Unknown specialization size (N_SPECIALIZED)
 #endif
 
+// With STREFLOP_SOFT_INLINE, streflop.h includes this file once for each N_SPECIALIZED
+// instead of compiling it three times, and all the specializations are inline
+#if defined(STREFLOP_SOFT_INLINE)
+#define SF_INLINE inline
+#else
+#define SF_INLINE
+#endif
+
 // This file may include System.h and SoftFloat
 #include "System.h"
 
@@ -45,40 +53,40 @@ using namespace streflop::SoftFloat;
 
 // The template instanciations for N = 4, 8, 10 are done here
 
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator+=(const SoftFloatWrapper<N_SPECIALIZED>& f) {
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator+=(const SoftFloatWrapper<N_SPECIALIZED>& f) {
     value<SF_TYPE>() = SF_PREPEND(_add)(value<SF_TYPE>(), f.value<SF_TYPE>());
      return *this;
 }
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator-=(const SoftFloatWrapper<N_SPECIALIZED>& f) {
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator-=(const SoftFloatWrapper<N_SPECIALIZED>& f) {
     value<SF_TYPE>() = SF_PREPEND(_sub)(value<SF_TYPE>(), f.value<SF_TYPE>());
      return *this;
 }
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator*=(const SoftFloatWrapper<N_SPECIALIZED>& f) {
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator*=(const SoftFloatWrapper<N_SPECIALIZED>& f) {
     value<SF_TYPE>() = SF_PREPEND(_mul)(value<SF_TYPE>(), f.value<SF_TYPE>());
      return *this;
 }
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator/=(const SoftFloatWrapper<N_SPECIALIZED>& f) {
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator/=(const SoftFloatWrapper<N_SPECIALIZED>& f) {
     value<SF_TYPE>() = SF_PREPEND(_div)(value<SF_TYPE>(), f.value<SF_TYPE>());
      return *this;
 }
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator==(const SoftFloatWrapper<N_SPECIALIZED>& f) const {
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator==(const SoftFloatWrapper<N_SPECIALIZED>& f) const {
     return SF_PREPEND(_eq)(value<SF_TYPE>(), f.value<SF_TYPE>());
 }
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator!=(const SoftFloatWrapper<N_SPECIALIZED>& f) const {
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator!=(const SoftFloatWrapper<N_SPECIALIZED>& f) const {
     // Boolean negation is OK for equality comparison
     return !SF_PREPEND(_eq)(value<SF_TYPE>(), f.value<SF_TYPE>());
 }
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator<(const SoftFloatWrapper<N_SPECIALIZED>& f) const {
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator<(const SoftFloatWrapper<N_SPECIALIZED>& f) const {
     return SF_PREPEND(_lt)(value<SF_TYPE>(), f.value<SF_TYPE>());
 }
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator<=(const SoftFloatWrapper<N_SPECIALIZED>& f) const {
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator<=(const SoftFloatWrapper<N_SPECIALIZED>& f) const {
     return SF_PREPEND(_le)(value<SF_TYPE>(), f.value<SF_TYPE>());
 }
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator>(const SoftFloatWrapper<N_SPECIALIZED>& f) const {
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator>(const SoftFloatWrapper<N_SPECIALIZED>& f) const {
     // Take care of NaN, reverse arguments and do NOT take the boolean negation of <=
     return SF_PREPEND(_lt)(f.value<SF_TYPE>(), value<SF_TYPE>());
 }
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator>=(const SoftFloatWrapper<N_SPECIALIZED>& f) const {
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator>=(const SoftFloatWrapper<N_SPECIALIZED>& f) const {
     // Take care of NaN, reverse arguments and do NOT take the boolean negation of <
     return SF_PREPEND(_le)(f.value<SF_TYPE>(), value<SF_TYPE>());
 }
@@ -89,8 +97,10 @@ template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator>=(const SoftFloatWrapp
 // => sizeof is useable
 // Note: To avoid duplicate symbols, insert a third template argument corresponding to N_SPECIALIZED
 //       This is consistent with the use of SF_XXPEND macros
+#ifndef STREFLOP_SOFT_WRAPPER_GENERIC
 template<int N, typename T, bool is_large> struct IntConverter {
 };
+#endif
 
 // Specialization for large ints > 32 bits
 template<typename T> struct IntConverter<N_SPECIALIZED, T, true> {
@@ -115,48 +125,48 @@ template<typename T> struct IntConverter<N_SPECIALIZED, T, false> {
 };
 
 #define STREFLOP_X87DENORMAL_NATIVE_OPS_INT(native_type) \
-template<> SoftFloatWrapper<N_SPECIALIZED>::SoftFloatWrapper(const native_type f) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>::SoftFloatWrapper(const native_type f) { \
     value<SF_TYPE>() = IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator=(const native_type f) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator=(const native_type f) { \
     value<SF_TYPE>() = IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f); \
     return *this; \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED>::operator native_type() const { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>::operator native_type() const { \
     return IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_to_int(value<SF_TYPE>()); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator+=(const native_type f) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator+=(const native_type f) { \
     value<SF_TYPE>() = SF_PREPEND(_add)(value<SF_TYPE>(), IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f)); \
     return *this; \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator-=(const native_type f) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator-=(const native_type f) { \
     value<SF_TYPE>() = SF_PREPEND(_sub)(value<SF_TYPE>(), IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f)); \
     return *this; \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator*=(const native_type f) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator*=(const native_type f) { \
     value<SF_TYPE>() = SF_PREPEND(_mul)(value<SF_TYPE>(), IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f)); \
     return *this; \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator/=(const native_type f) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator/=(const native_type f) { \
     value<SF_TYPE>() = SF_PREPEND(_div)(value<SF_TYPE>(), IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f)); \
     return *this; \
 } \
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator==(const native_type f) const { \
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator==(const native_type f) const { \
     return SF_PREPEND(_eq)(value<SF_TYPE>(), IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f)); \
 } \
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator!=(const native_type f) const { \
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator!=(const native_type f) const { \
     return !SF_PREPEND(_eq)(value<SF_TYPE>(), IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f)); \
 } \
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator<(const native_type f) const { \
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator<(const native_type f) const { \
     return SF_PREPEND(_lt)(value<SF_TYPE>(), IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f)); \
 } \
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator<=(const native_type f) const { \
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator<=(const native_type f) const { \
     return SF_PREPEND(_le)(value<SF_TYPE>(), IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f)); \
 } \
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator>(const native_type f) const { \
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator>(const native_type f) const { \
     return SF_PREPEND(_lt)(IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f), value<SF_TYPE>()); \
 } \
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator>=(const native_type f) const { \
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator>=(const native_type f) const { \
     return SF_PREPEND(_le)(IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f), value<SF_TYPE>()); \
 }
 
@@ -170,6 +180,7 @@ template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator>=(const native_type f)
 // - this way, it would be possible to extend the scheme to other architectures
 //   Ex: could specialize for <long double, 10>, <long double, 12> and <long double, 16>
 // Note: read above note for specialization on N_SPECIALIZED
+#ifndef STREFLOP_SOFT_WRAPPER_GENERIC
 template<int N, typename ctype, int ctype_size> struct FloatConverter {
 };
 
@@ -177,6 +188,7 @@ template<int N, typename ctype, int ctype_size> struct FloatConverter {
 inline float32 float32_to_float32(float32 a_float) {return a_float;}
 inline float64 float64_to_float64(float64 a_float) {return a_float;}
 inline floatx80 floatx80_to_floatx80(floatx80 a_float) {return a_float;}
+#endif
 
 // Specialization for float32 when C float type size is 4
 template<> struct FloatConverter<N_SPECIALIZED, float, 4> {
@@ -276,48 +288,48 @@ template<> struct FloatConverter<N_SPECIALIZED, long double, 16> {
 
 
 #define STREFLOP_X87DENORMAL_NATIVE_OPS_FLOAT(native_type) \
-template<> SoftFloatWrapper<N_SPECIALIZED>::SoftFloatWrapper(const native_type f) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>::SoftFloatWrapper(const native_type f) { \
     value<SF_TYPE>() = FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator=(const native_type f) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator=(const native_type f) { \
     value<SF_TYPE>() = FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f); \
     return *this; \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED>::operator native_type() const { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>::operator native_type() const { \
     return FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_to_float(value<SF_TYPE>()); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator+=(const native_type f) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator+=(const native_type f) { \
     value<SF_TYPE>() = SF_PREPEND(_add)(value<SF_TYPE>(), FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f)); \
     return *this; \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator-=(const native_type f) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator-=(const native_type f) { \
     value<SF_TYPE>() = SF_PREPEND(_sub)(value<SF_TYPE>(), FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f)); \
     return *this; \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator*=(const native_type f) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator*=(const native_type f) { \
     value<SF_TYPE>() = SF_PREPEND(_mul)(value<SF_TYPE>(), FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f)); \
     return *this; \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator/=(const native_type f) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator/=(const native_type f) { \
     value<SF_TYPE>() = SF_PREPEND(_div)(value<SF_TYPE>(), FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f)); \
     return *this; \
 } \
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator==(const native_type f) const { \
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator==(const native_type f) const { \
     return SF_PREPEND(_eq)(value<SF_TYPE>(), FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f)); \
 } \
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator!=(const native_type f) const { \
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator!=(const native_type f) const { \
     return !SF_PREPEND(_eq)(value<SF_TYPE>(), FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f)); \
 } \
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator<(const native_type f) const { \
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator<(const native_type f) const { \
     return SF_PREPEND(_lt)(value<SF_TYPE>(), FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f)); \
 } \
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator<=(const native_type f) const { \
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator<=(const native_type f) const { \
     return SF_PREPEND(_le)(value<SF_TYPE>(), FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f)); \
 } \
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator>(const native_type f) const { \
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator>(const native_type f) const { \
     return SF_PREPEND(_lt)(FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f), value<SF_TYPE>()); \
 } \
-template<> bool SoftFloatWrapper<N_SPECIALIZED>::operator>=(const native_type f) const { \
+template<> SF_INLINE bool SoftFloatWrapper<N_SPECIALIZED>::operator>=(const native_type f) const { \
     return SF_PREPEND(_le)(FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f), value<SF_TYPE>()); \
 }
 
@@ -338,105 +350,105 @@ STREFLOP_X87DENORMAL_NATIVE_OPS_FLOAT(long double)
 
 /// binary operators
 /// use dummy argument factories to distinguish from integer conversion and avoid creating temporary object
-template<> SoftFloatWrapper<N_SPECIALIZED> operator+(const SoftFloatWrapper<N_SPECIALIZED>& f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) {
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator+(const SoftFloatWrapper<N_SPECIALIZED>& f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) {
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_add)(f1.value<SF_TYPE>(), f2.value<SF_TYPE>()), true);
 }
-template<> SoftFloatWrapper<N_SPECIALIZED> operator-(const SoftFloatWrapper<N_SPECIALIZED>& f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) {
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator-(const SoftFloatWrapper<N_SPECIALIZED>& f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) {
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_sub)(f1.value<SF_TYPE>(), f2.value<SF_TYPE>()), true);
 }
-template<> SoftFloatWrapper<N_SPECIALIZED> operator*(const SoftFloatWrapper<N_SPECIALIZED>& f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) {
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator*(const SoftFloatWrapper<N_SPECIALIZED>& f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) {
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_mul)(f1.value<SF_TYPE>(), f2.value<SF_TYPE>()), true);
 }
-template<> SoftFloatWrapper<N_SPECIALIZED> operator/(const SoftFloatWrapper<N_SPECIALIZED>& f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) {
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator/(const SoftFloatWrapper<N_SPECIALIZED>& f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) {
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_div)(f1.value<SF_TYPE>(), f2.value<SF_TYPE>()), true);
 }
 
 #define STREFLOP_X87DENORMAL_BINARY_OPS_INT(native_type) \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator+(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator+(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_add)(f1.value<SF_TYPE>(), IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f2)), true); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator-(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator-(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_sub)(f1.value<SF_TYPE>(), IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f2)), true); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator*(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator*(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_mul)(f1.value<SF_TYPE>(), IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f2)), true); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator/(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator/(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_div)(f1.value<SF_TYPE>(), IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f2)), true); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator+(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator+(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_add)(IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f1), f2.value<SF_TYPE>()), true); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator-(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator-(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_sub)(IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f1), f2.value<SF_TYPE>()), true); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator*(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator*(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_mul)(IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f1), f2.value<SF_TYPE>()), true); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator/(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator/(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_div)(IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(f1), f2.value<SF_TYPE>()), true); \
 } \
-template<> bool operator==(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
+template<> SF_INLINE bool operator==(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
     return SF_PREPEND(_eq)(IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(value), f.value<SF_TYPE>()); \
 } \
-template<> bool operator!=(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
+template<> SF_INLINE bool operator!=(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
     return !SF_PREPEND(_eq)(IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(value), f.value<SF_TYPE>()); \
 } \
-template<> bool operator<(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
+template<> SF_INLINE bool operator<(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
     return SF_PREPEND(_lt)(IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(value), f.value<SF_TYPE>()); \
 } \
-template<> bool operator<=(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
+template<> SF_INLINE bool operator<=(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
     return SF_PREPEND(_le)(IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(value), f.value<SF_TYPE>()); \
 } \
-template<> bool operator>(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
+template<> SF_INLINE bool operator>(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
     return SF_PREPEND(_lt)(f.value<SF_TYPE>(), IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(value)); \
 } \
-template<> bool operator>=(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
+template<> SF_INLINE bool operator>=(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
     return SF_PREPEND(_le)(f.value<SF_TYPE>(), IntConverter< N_SPECIALIZED, native_type, (sizeof(native_type)>4) >::convert_from_int(value)); \
 }
 
 
 #define STREFLOP_X87DENORMAL_BINARY_OPS_FLOAT(native_type) \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator+(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator+(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_add)(f1.value<SF_TYPE>(), FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f2)), true); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator-(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator-(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_sub)(f1.value<SF_TYPE>(), FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f2)), true); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator*(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator*(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_mul)(f1.value<SF_TYPE>(), FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f2)), true); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator/(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator/(const SoftFloatWrapper<N_SPECIALIZED>& f1, const native_type f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_div)(f1.value<SF_TYPE>(), FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f2)), true); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator+(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator+(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_add)(FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f1), f2.value<SF_TYPE>()), true); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator-(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator-(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_sub)(FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f1), f2.value<SF_TYPE>()), true); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator*(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator*(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_mul)(FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f1), f2.value<SF_TYPE>()), true); \
 } \
-template<> SoftFloatWrapper<N_SPECIALIZED> operator/(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator/(const native_type f1, const SoftFloatWrapper<N_SPECIALIZED>& f2) { \
     return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_div)(FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(f1), f2.value<SF_TYPE>()), true); \
 } \
-template<> bool operator==(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
+template<> SF_INLINE bool operator==(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
     return SF_PREPEND(_eq)(FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(value), f.value<SF_TYPE>()); \
 } \
-template<> bool operator!=(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
+template<> SF_INLINE bool operator!=(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
     return !SF_PREPEND(_eq)(FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(value), f.value<SF_TYPE>()); \
 } \
-template<> bool operator<(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
+template<> SF_INLINE bool operator<(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
     return SF_PREPEND(_lt)(FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(value), f.value<SF_TYPE>()); \
 } \
-template<> bool operator<=(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
+template<> SF_INLINE bool operator<=(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
     return SF_PREPEND(_le)(FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(value), f.value<SF_TYPE>()); \
 } \
-template<> bool operator>(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
+template<> SF_INLINE bool operator>(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
     return SF_PREPEND(_lt)(f.value<SF_TYPE>(), FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(value)); \
 } \
-template<> bool operator>=(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
+template<> SF_INLINE bool operator>=(const native_type value, const SoftFloatWrapper<N_SPECIALIZED>& f) { \
     return SF_PREPEND(_le)(f.value<SF_TYPE>(), FloatConverter< N_SPECIALIZED, native_type, sizeof(native_type)>::convert_from_float(value)); \
 }
 
@@ -456,41 +468,56 @@ STREFLOP_X87DENORMAL_BINARY_OPS_FLOAT(double)
 STREFLOP_X87DENORMAL_BINARY_OPS_FLOAT(long double)
 
 /// Unary operators
-template<> SoftFloatWrapper<N_SPECIALIZED> operator-(const SoftFloatWrapper<N_SPECIALIZED>& f) {
-    // We could do it right here by flipping the bit sign
-    // However, there is the exceptions handling and such, so...
-    return SoftFloatWrapper<N_SPECIALIZED>(SF_PREPEND(_sub)(SF_APPEND(int32_to_)(0), f.value<SF_TYPE>()), true);
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator-(const SoftFloatWrapper<N_SPECIALIZED>& f) {
+    // Flip the sign bit like the FPU does, and raise no exception.
+    // Subtracting from 0 would give -(+0) == +0, and keep the sign of NaN
+    SF_TYPE v = f.value<SF_TYPE>();
+#if N_SPECIALIZED == 96
+    v.high ^= 0x8000;
+#elif N_SPECIALIZED == 64
+    v ^= 0x8000000000000000ULL;
+#else
+    v ^= 0x80000000U;
+#endif
+    return SoftFloatWrapper<N_SPECIALIZED>(v, true);
 }
-template<> SoftFloatWrapper<N_SPECIALIZED> operator+(const SoftFloatWrapper<N_SPECIALIZED>& f) {
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED> operator+(const SoftFloatWrapper<N_SPECIALIZED>& f) {
     return f; // makes a copy
 }
 
 
-template<> SoftFloatWrapper<N_SPECIALIZED>::SoftFloatWrapper(const SoftFloatWrapper<32>& f) {
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>::SoftFloatWrapper(const SoftFloatWrapper<32>& f) {
     value<SF_TYPE>() = SF_APPEND(float32_to_)(f.value<float32>());
 }
 
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator=(const SoftFloatWrapper<32>& f) {
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator=(const SoftFloatWrapper<32>& f) {
     value<SF_TYPE>() = SF_APPEND(float32_to_)(f.value<float32>());
     return *this;
 }
 
-template<> SoftFloatWrapper<N_SPECIALIZED>::SoftFloatWrapper(const SoftFloatWrapper<64>& f) {
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>::SoftFloatWrapper(const SoftFloatWrapper<64>& f) {
     value<SF_TYPE>() = SF_APPEND(float64_to_)(f.value<float64>());
 }
 
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator=(const SoftFloatWrapper<64>& f) {
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator=(const SoftFloatWrapper<64>& f) {
     value<SF_TYPE>() = SF_APPEND(float64_to_)(f.value<float64>());
     return *this;
 }
 
-template<> SoftFloatWrapper<N_SPECIALIZED>::SoftFloatWrapper(const SoftFloatWrapper<96>& f) {
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>::SoftFloatWrapper(const SoftFloatWrapper<96>& f) {
     value<SF_TYPE>() = SF_APPEND(floatx80_to_)(f.value<floatx80>());
 }
 
-template<> SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator=(const SoftFloatWrapper<96>& f) {
+template<> SF_INLINE SoftFloatWrapper<N_SPECIALIZED>& SoftFloatWrapper<N_SPECIALIZED>::operator=(const SoftFloatWrapper<96>& f) {
     value<SF_TYPE>() = SF_APPEND(floatx80_to_)(f.value<floatx80>());
     return *this;
 }
 
 } // end of namespace
+
+// The generic templates above are defined only once, the macros are set again for the next size
+#define STREFLOP_SOFT_WRAPPER_GENERIC
+#undef SF_PREPEND
+#undef SF_APPEND
+#undef SF_TYPE
+#undef SF_INLINE
@@ -18,6 +18,7 @@
 /// Only the template declarations are done here
 /// The template instanciations for N = 4, 8, 10 are done in the CPP file
 /// this way, only these types will have defined symbols
+/// With STREFLOP_SOFT_INLINE, streflop.h includes the CPP file instead, see there
 
 /// This file should be included from within a streflop namespace
 }
@@ -25,16 +25,24 @@ template<typename ValueType> inline void X87DenormalSquashFunction(ValueType& va
 // Pro: branching may be costly, though the branching predictor may compensate when there are few denormals
 // Con: cmov forces an unconditional writeback to the mem just after read, which may be worse than the branch
 
+// The denormals are flushed to a zero of the same sign, like SSE does
+
 template<> inline void X87DenormalSquashFunction<float>(float& value) {
-    if ((reinterpret_cast<int*>(&value)[0] & 0x7F800000) == 0) value = 0.0f;
+    if ((reinterpret_cast<int*>(&value)[0] & 0x7F800000) == 0) reinterpret_cast<int*>(&value)[0] &= 0x80000000;
 }
 
 template<> inline void X87DenormalSquashFunction<double>(double& value) {
-    if ((reinterpret_cast<int*>(&value)[1] & 0x7FF00000) == 0) value = 0.0;
+    if ((reinterpret_cast<int*>(&value)[1] & 0x7FF00000) == 0) {
+        reinterpret_cast<int*>(&value)[0] = 0;
+        reinterpret_cast<int*>(&value)[1] &= 0x80000000;
+    }
 }
 
 template<> inline void X87DenormalSquashFunction<long double>(long double& value) {
-    if ((reinterpret_cast<short*>(&value)[4] & 0x7FFF) == 0) value = 0.0L;
+    if ((reinterpret_cast<short*>(&value)[4] & 0x7FFF) == 0) {
+        reinterpret_cast<int*>(&value)[0] = 0;
+        reinterpret_cast<int*>(&value)[1] = 0;
+    }
 }
 
 /// Wrapper class for the denormal squashing of X87
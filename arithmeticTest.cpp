@@ -15,6 +15,8 @@
 using namespace std;
 // clock
 #include <time.h>
+// memcpy for the bit patterns
+#include <string.h>
 
 #include "streflop.h"
 using namespace streflop;
@@ -56,19 +58,19 @@ template<class FloatType> void doTest(string s, string name) {
 
     ofstream basicfile((s + "_" + name + "_basic.bin").c_str());
     if (!basicfile) {
-        cout << "Problem creating binary file: " << basicfile << endl;
+        cout << "Problem creating binary file: " << s << "_" << name << "_basic.bin" << endl;
         exit(2);
     }
 
     ofstream infnanfile((s + "_" + name + "_nan.bin").c_str());
     if (!infnanfile) {
-        cout << "Problem creating binary file: " << infnanfile << endl;
+        cout << "Problem creating binary file: " << s << "_" << name << "_nan.bin" << endl;
         exit(3);
     }
 
     ofstream mathlibfile((s + "_" + name + "_lib.bin").c_str());
     if (!mathlibfile) {
-        cout << "Problem creating binary file: " << mathlibfile << endl;
+        cout << "Problem creating binary file: " << s << "_" << name << "_lib.bin" << endl;
         exit(4);
     }
 
@@ -160,8 +162,143 @@ template<class FloatType> ostream& displayHex(ostream& out, FloatType f) {
 }
 
 
+// Correctly rounded results of a few Double functions, computed with 300 bits. The
+// dbl-64 code reads its tables through indexed accessors: when these read the wrong
+// entry, exp and pow are wrong for all arguments and sin, cos and asin for many.
+struct KnownValue {
+    const char* name;
+    int function;
+    double x, y;
+    SizedUnsignedInteger<64>::Type bits;
+};
+static const KnownValue knownValues[] = {
+    {"exp(1)", 0, 1.0, 0.0, 0x4005bf0a8b145769ULL},
+    {"exp(-3.7)", 0, -3.7, 0.0, 0x3f99511fc6871044ULL},
+    {"exp(20.5)", 0, 20.5, 0.0, 0x41c7d6c4f0bcdd5cULL},
+    {"exp(0.001)", 0, 0.001, 0.0, 0x3ff0041919b7ee34ULL},
+    {"pow(2.5,3.3)", 1, 2.5, 3.3, 0x403491876092afc1ULL},
+    {"pow(10,-2.7)", 1, 10.0, -2.7, 0x3f60585e4c78b079ULL},
+    {"pow(0.7,12.25)", 1, 0.7, 12.25, 0x3f89edc0106da41cULL},
+    {"sin(0.5)", 2, 0.5, 0.0, 0x3fdeaee8744b05f0ULL},
+    {"sin(3)", 2, 3.0, 0.0, 0x3fc210386db6d55bULL},
+    {"sin(100)", 2, 100.0, 0.0, 0xbfe03425b78c4db8ULL},
+    {"sin(0.02)", 2, 0.02, 0.0, 0x3f947a87cda55867ULL},
+    {"cos(0.7)", 3, 0.7, 0.0, 0x3fe87996529f9d93ULL},
+    {"cos(12)", 3, 12.0, 0.0, 0x3feb00da046b65e3ULL},
+    {"cos(1.5)", 3, 1.5, 0.0, 0x3fb21bd54fc5f9a7ULL},
+    {"asin(0.3)", 4, 0.3, 0.0, 0x3fd380159e14f6ffULL},
+    {"asin(0.9)", 4, 0.9, 0.0, 0x3ff1ea93705fa172ULL},
+    {"asin(-0.6)", 4, -0.6, 0.0, 0xbfe4978fa3269ee1ULL},
+    // The hard arguments of mpcacheBench, which take the multi-precision fallbacks, or the
+    // double-length stage with STREFLOP_DOUBLE_LENGTH_STAGE. Then the argument of sin, cos
+    // and tan closest to a multiple of pi/2, the hardest case of the reduction.
+    // The table-driven exp of STREFLOP_TABLE_EXPLOG is not correctly rounded, and differs here
+#ifndef STREFLOP_TABLE_EXPLOG
+    {"exp(233.65911692699262)", 0, 233.65911692699262, 0.0, 0x5501227bdf169cf1ULL},
+    {"exp(659.5688183214932)", 0, 659.5688183214932, 0.0, 0x7b6788a81cca0c03ULL},
+    {"exp(-65.4684355388315)", 0, -65.4684355388315, 0.0, 0x3a0768cae339858aULL},
+    {"exp(-88.59126995240774)", 0, -88.59126995240774, 0.0, 0x37f23ff763ef1059ULL},
+    {"exp(343.58354547281715)", 0, 343.58354547281715, 0.0, 0x5ee9befac587ba34ULL},
+    {"exp(-425.50605288903154)", 0, -425.50605288903154, 0.0, 0x19917141e5657220ULL},
+    {"exp(-267.7477914660205)", 0, -267.7477914660205, 0.0, 0x27ca624b002445a7ULL},
+    {"exp(-549.0810779034371)", 0, -549.0810779034371, 0.0, 0x0e6cb59c01572435ULL},
+#endif
+    {"pow(19.505060740227307,13.5)", 1, 19.505060740227307, 13.5, 0x438d0003d6fc3436ULL},
+    {"pow(78.95625621941834,2.5)", 1, 78.95625621941834, 2.5, 0x40eb0c4ede112c6bULL},
+    {"pow(91.82494786360328,14.5)", 1, 91.82494786360328, 14.5, 0x45d774690e766627ULL},
+    {"pow(70.16116515842512,15.5)", 1, 70.16116515842512, 15.5, 0x45e0a016a5d0bf3cULL},
+    {"pow(68.75730414413302,11.5)", 1, 68.75730414413302, 11.5, 0x44523f2ef1638dfeULL},
+    {"pow(31.6378285940486,8.5)", 1, 31.6378285940486, 8.5, 0x42948a704e47c115ULL},
+    {"pow(96.55336839772765,0.5)", 1, 96.55336839772765, 0.5, 0x4023a6fe18d85bc0ULL},
+    {"pow(88.6408889087398,9.5)", 1, 88.6408889087398, 9.5, 0x43c612131d6038e0ULL},
+    {"sin(60597955244420.72)", 2, 60597955244420.72, 0.0, 0x3eff6bbab423f499ULL},
+    {"sin(51175932.357828274)", 2, 51175932.357828274, 0.0, 0xbfe325899551438fULL},
+    {"sin(9865307.344854169)", 2, 9865307.344854169, 0.0, 0x3fdb97ee3ac82c2eULL},
+    {"sin(210792622554444.44)", 2, 210792622554444.44, 0.0, 0xbfc1e58942b4cbf2ULL},
+    {"cos(32717640.431003775)", 3, 32717640.431003775, 0.0, 0x3fd36efc0305efd1ULL},
+    {"sin(6381956970095103*2^797)", 2, 5.319372648326541e+255, 0.0, 0x3ff0000000000000ULL},
+    {"cos(6381956970095103*2^797)", 3, 5.319372648326541e+255, 0.0, 0xbc214ae72e6ba22fULL},
+    {"tan(6381956970095103*2^797)", 5, 5.319372648326541e+255, 0.0, 0xc3bd9ba9a7975636ULL},
+    {"tan(60597955244420.72)", 5, 60597955244420.72, 0.0, 0x3eff6bbab4608afbULL},
+    {"tan(51175932.357828274)", 5, 51175932.357828274, 0.0, 0x3fe7e560aebd4b12ULL},
+    {"tan(9865307.344854169)", 5, 9865307.344854169, 0.0, 0xbfde94f7dbb368c6ULL},
+    {"tan(210792622554444.44)", 5, 210792622554444.44, 0.0, 0xbfc212fc52ae6171ULL},
+};
+
+// Returns the number of wrong results
+int checkKnownValues() {
+    streflop_init<Double>();
+    int failures = 0;
+    for (unsigned i = 0; i < sizeof(knownValues) / sizeof(knownValues[0]); ++i) {
+        const KnownValue& k = knownValues[i];
+        Double x = k.x, y = k.y, r;
+        switch (k.function) {
+            case 0: r = exp(x); break;
+            case 1: r = pow(x, y); break;
+            case 2: r = sin(x); break;
+            case 3: r = cos(x); break;
+            case 4: r = asin(x); break;
+            default: r = tan(x); break;
+        }
+        SizedUnsignedInteger<64>::Type bits;
+        memcpy(&bits, &r, sizeof(bits));
+        if (bits != k.bits) {
+            cout << "MISMATCH " << k.name << ": " << hex << bits << " instead of " << k.bits << dec << endl;
+            ++failures;
+        }
+    }
+    return failures;
+}
+
+// Compares the significant bytes only, Extended may be padded
+template<class FloatType> bool sameBits(FloatType a, FloatType b) {
+    return memcmp(&a, &b, sizeof(FloatType) < 10 ? sizeof(FloatType) : 10) == 0;
+}
+
+// sincos must give the same bits as sin and cos, for small, medium and huge arguments up to
+// the largest exponent of the type. Returns the number of arguments that differ.
+template<class FloatType> int checkSincos(const char* name, int maxExponent) {
+    streflop_init<FloatType>();
+    RandomState state;
+    RandomInit(42, state);
+    const int N = 3000;
+    FloatType x[N], sinx[N], cosx[N];
+    for (int i = 0; i < N; ++i) {
+        FloatType m = RandomIE<FloatType>(FloatType(-2.0), FloatType(2.0), state);
+        if (i % 3 == 0) x[i] = m * FloatType(4.0);
+        else if (i % 3 == 1) x[i] = m * FloatType(1e5);
+        else x[i] = ldexp(m, Random<true, true, int>(0, maxExponent - 1, state));
+    }
+    sincos(x, sinx, cosx, N);
+    int failures = 0;
+    for (int i = 0; i < N; ++i) {
+        FloatType s, c;
+        sincos(x[i], &s, &c);
+        FloatType sr = sin(x[i]), cr = cos(x[i]);
+        if (!sameBits(s, sr) || !sameBits(c, cr) || !sameBits(sinx[i], sr) || !sameBits(cosx[i], cr)) {
+            if (failures == 0) cout << "MISMATCH " << name << " sincos differs from sin and cos for " << (double)x[i] << endl;
+            ++failures;
+        }
+    }
+    return failures;
+}
+
 int main(int argc, const char** argv) {
 
+    if (checkKnownValues() != 0) {
+        cout << "Some Double functions give wrong results" << endl;
+        return 5;
+    }
+
+    int sincosFailures = checkSincos<Simple>("Simple", 127) + checkSincos<Double>("Double", 1023);
+#if defined(Extended)
+    sincosFailures += checkSincos<Extended>("Extended", 16383);
+#endif
+    if (sincosFailures != 0) {
+        cout << "sincos is not the same as sin and cos" << endl;
+        return 6;
+    }
+
     RandomInit(42);
 
     if (argc<2) {
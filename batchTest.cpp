@@ -0,0 +1,176 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Checks that the batch exp, log, sin and cos give the bits of the scalar functions, in
+// the four rounding modes, on random bit patterns, on random arguments over the ranges of
+// their fast paths, near 1 for log and near the multiples of pi/2 for sin and cos, and on
+// the special values. Also in place, and for all the sizes and offsets around the vector
+// length. Then times the scalar loops against the batch functions.
+// With SSE and denormals the batch functions run the packed kernels of the libm, see
+// libm/batch.h, in the other configurations they are loops over the scalar functions.
+
+#include <iostream>
+using namespace std;
+// clock
+#include <time.h>
+// memcpy and memcmp for the bit patterns
+#include <string.h>
+
+#include "streflop.h"
+using namespace streflop;
+
+typedef SizedUnsignedInteger<64>::Type uint64;
+typedef SizedUnsignedInteger<32>::Type uint32;
+
+static const int N = 1 << 16;
+static const int REPS = 50;
+
+static int failures = 0;
+
+static void fromBits(Simple& x, uint64 bits) {
+    uint32 b = (uint32)bits;
+    memcpy(static_cast<void*>(&x), &b, sizeof(b));
+}
+
+static void fromBits(Double& x, uint64 bits) {
+    memcpy(static_cast<void*>(&x), &bits, sizeof(bits));
+}
+
+static uint64 random64() {
+    uint64 high = Random<uint32>();
+    return (high << 32) | Random<uint32>();
+}
+
+// Arguments of the given function, 1 in 8 random bit patterns
+template<typename T> static void fill(const char* name, T* x, T limit) {
+    // Zeros, infinities, NaN, subnormals, the largest numbers, +-1
+    static const uint64 specials[] = {
+        0, 0x8000000000000000ULL, 0x7F800000, 0xFF800000, 0x7FC00000, 0x00000001, 0x807FFFFF, 0x7F7FFFFF, 0x3F800000, 0xBF800000,
+        0x7FF0000000000000ULL, 0xFFF0000000000000ULL, 0x7FF8000000000000ULL, 0x0000000000000001ULL, 0x800FFFFFFFFFFFFFULL,
+        0x7FEFFFFFFFFFFFFFULL, 0x3FF0000000000000ULL, 0xBFF0000000000000ULL
+    };
+    const int S = sizeof(specials) / sizeof(specials[0]);
+    const T pio2 = T(1.5707963267948966);
+    for (int i = 0; i < N; ++i) {
+        int kind = i & 7;
+        if (i < S) {
+            uint64 bits = specials[i];
+            if (sizeof(T) == 4 && bits >> 32) bits >>= 32;
+            fromBits(x[i], bits);
+        } else if (kind == 0) {
+            fromBits(x[i], random64());
+        } else if (name[0] == 'e') {
+            // The whole range of the fast path, small arguments, and near the limits
+            if (kind < 5) x[i] = RandomIE(-limit, limit);
+            else if (kind == 5) x[i] = RandomIE(T(-1.0), T(1.0));
+            else if (kind == 6) x[i] = RandomIE(T(-1.0), T(1.0)) * ldexp(T(1.0), -RandomII(10, 60));
+            else x[i] = (Random<uint32>() & 1 ? limit : -limit) + RandomIE(T(-3.0), T(3.0));
+        } else if (name[0] == 'l') {
+            // Positive bit patterns, all the exponents, and near 1
+            if (kind < 4) fromBits(x[i], random64() & (sizeof(T) == 4 ? 0x7FFFFFFFULL : 0x7FFFFFFFFFFFFFFFULL));
+            else if (kind == 4) x[i] = RandomIE(T(0.5), T(2.0));
+            else if (kind == 5) x[i] = T(1.0) + RandomIE(T(-0.04), T(0.04));
+            else if (kind == 6) x[i] = T(1.0) + RandomIE(T(-1.0), T(1.0)) * ldexp(T(1.0), -RandomII(10, 40));
+            else x[i] = RandomIE(T(0.0), limit);
+        } else {
+            // Reduced arguments in all the branches, and near the multiples of pi/2
+            if (kind < 3) x[i] = RandomIE(T(-4.0), T(4.0));
+            else if (kind == 3) x[i] = RandomIE(-limit, limit);
+            else if (kind == 4) x[i] = RandomIE(T(-1.0), T(1.0)) * ldexp(T(1.0), -RandomII(1, 40));
+            else if (kind == 5) x[i] = RandomIE(T(-1.0), T(1.0)) * ldexp(limit, RandomII(0, 10));
+            else x[i] = T(RandomII(-200, 200)) * pio2 + RandomIE(T(-1.0), T(1.0)) * ldexp(T(1.0), -RandomII(10, 30));
+        }
+    }
+}
+
+template<typename T> static bool same(T a, T b) {
+    return memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+template<typename T> static void report(const char* type, const char* name, const char* what, T x, T expected, T got) {
+    uint64 bx = 0, be = 0, bg = 0;
+    memcpy(&bx, &x, sizeof(T));
+    memcpy(&be, &expected, sizeof(T));
+    memcpy(&bg, &got, sizeof(T));
+    cout << "MISMATCH " << type << " " << name << " " << what << ": argument " << hex << bx
+         << " gives " << bg << " instead of " << be << dec << endl;
+    ++failures;
+}
+
+// Bits of the batch function against the scalar one, then the time of both per call
+template<typename T, T (*scalar)(T), void (*batch)(const T*, T*, size_t)>
+static void test(const char* type, const char* name, T limit, T timeLimit) {
+    static T x[N], expected[N], out[N];
+    RandomInit(12345);
+    fill(name, x, limit);
+
+    int modes[4] = {FE_TONEAREST, FE_UPWARD, FE_DOWNWARD, FE_TOWARDZERO};
+    const char* modeNames[4] = {"nearest", "upward", "downward", "towardzero"};
+    int before = failures;
+    for (int m = 0; m < 4 && failures == before; ++m) {
+        fesetround((FPU_RoundMode)modes[m]);
+        for (int i = 0; i < N; ++i) expected[i] = scalar(x[i]);
+        batch(x, out, N);
+        for (int i = 0; i < N && failures - before < 5; ++i) if (!same(expected[i], out[i])) report(type, name, modeNames[m], x[i], expected[i], out[i]);
+    }
+    fesetround(FE_TONEAREST);
+    for (int i = 0; i < N; ++i) expected[i] = scalar(x[i]);
+
+    // In place
+    memcpy(static_cast<void*>(out), x, sizeof(x));
+    batch(out, out, N);
+    for (int i = 0; i < N && failures - before < 5; ++i) if (!same(expected[i], out[i])) report(type, name, "in place", x[i], expected[i], out[i]);
+
+    // The lanes past the end are not written, whatever the size and offset
+    for (int offset = 0; offset < 8; ++offset) for (int n = 0; n <= 40; ++n) {
+        T guard[48];
+        for (int i = 0; i < 48; ++i) guard[i] = T(-7.0);
+        batch(x + offset * 41 + n, guard, n);
+        for (int i = 0; i < 48 && failures - before < 5; ++i) {
+            T want = i < n ? expected[offset * 41 + n + i] : T(-7.0);
+            if (!same(want, guard[i])) report(type, name, "size", i < n ? x[offset * 41 + n + i] : T(0.0), want, guard[i]);
+        }
+    }
+
+    // Times on the usual arguments
+    for (int i = 0; i < N; ++i) x[i] = RandomIE(name[0] == 'l' ? T(0.0) : -timeLimit, timeLimit);
+    T acc = T(0.0);
+    clock_t start = clock();
+    for (int r = 0; r < REPS; ++r) for (int i = 0; i < N; ++i) acc += scalar(x[i]);
+    clock_t mid = clock();
+    for (int r = 0; r < REPS; ++r) {
+        batch(x, out, N);
+        acc += out[r];
+    }
+    clock_t stop = clock();
+    double ts = double(mid - start) / CLOCKS_PER_SEC * 1e9 / (double(N) * REPS);
+    double tb = double(stop - mid) / CLOCKS_PER_SEC * 1e9 / (double(N) * REPS);
+    cout << type << " " << name << " in [" << (name[0] == 'l' ? 0.0 : -(double)timeLimit) << ", " << (double)timeLimit << "]: scalar "
+         << ts << " ns, batch " << tb << " ns, speedup " << ts / tb << " (" << (double)acc << ")" << endl;
+}
+
+int main(int argc, const char** argv) {
+
+    streflop_init<Double>();
+
+    // exp is finite and not subnormal in (-708, 709) for Double, (-87, 88) for Simple
+    test<Simple, streflop::exp, streflop::exp>("Simple", "exp", Simple(88.0), Simple(80.0));
+    test<Simple, streflop::log, streflop::log>("Simple", "log", Simple(1e30), Simple(1000.0));
+    test<Simple, streflop::sin, streflop::sin>("Simple", "sin", Simple(201.0), Simple(100.0));
+    test<Simple, streflop::cos, streflop::cos>("Simple", "cos", Simple(201.0), Simple(100.0));
+    test<Double, streflop::exp, streflop::exp>("Double", "exp", Double(708.0), Double(100.0));
+    test<Double, streflop::log, streflop::log>("Double", "log", Double(1e300), Double(1000.0));
+    test<Double, streflop::sin, streflop::sin>("Double", "sin", Double(1e8), Double(100.0));
+    test<Double, streflop::cos, streflop::cos>("Double", "cos", Double(1e8), Double(100.0));
+
+    cout << (failures ? "FAILED" : "OK") << endl;
+    return failures ? 1 : 0;
+}
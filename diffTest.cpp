@@ -0,0 +1,688 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Differential reproducibility test: evaluates every function of Math.h and the arithmetic
+// operators on the same inputs in each build, and compares the hashes of the results.
+//
+// The inputs are drawn from eight strata: random bit patterns, small, close to one, huge,
+// near a multiple of pi/2, denormal, integers and half-integers, and special values. Input
+// i only depends on i, so the work is split in blocks of BLOCK inputs over several threads,
+// and each block of each function gets a hash of its own. A difference between two builds
+// is then narrowed to its first block, whose inputs and results are listed by both builds
+// to find the first diverging input and the distance in ulps.
+//
+// Usage:
+//   diffTest [-size log2] [-threads n] [function...]     prints the hashes, 2^18 inputs by default
+//   diffTest -block type function index                   lists the inputs and results of a block
+//   diffTest -compare a.txt b.txt                         first different block of each function
+//   diffTest -diff buildA/diffTest buildB/diffTest [options of the first form]
+// The last form runs both programs, then lists their blocks to report the first diverging
+// input of each function. The comparisons return 1 if there is any difference.
+// The results of lrint, llrint, lround and llround out of the integer range are unspecified
+// and not compared, and all NaN are equal, see README.txt.
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+using namespace std;
+// popen
+#include <stdio.h>
+// memcpy for the bit patterns
+#include <string.h>
+// atoi, strtoull
+#include <stdlib.h>
+
+#if __cplusplus >= 201103L
+#include <thread>
+#endif
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#endif
+
+#include "streflop.h"
+using namespace streflop;
+
+typedef SizedUnsignedInteger<64>::Type uint64;
+typedef SizedUnsignedInteger<32>::Type uint32;
+typedef SizedUnsignedInteger<16>::Type uint16;
+
+static const int BLOCK = 4096;
+static const uint32 SEED = 20060101;
+
+#if defined(STREFLOP_SSE)
+#define STREFLOP_DIFF_FPU "sse"
+#elif defined(STREFLOP_X87)
+#define STREFLOP_DIFF_FPU "x87"
+#else
+#define STREFLOP_DIFF_FPU "soft"
+#endif
+#ifdef STREFLOP_NO_DENORMALS
+static const char* configName = STREFLOP_DIFF_FPU "-nd";
+#else
+static const char* configName = STREFLOP_DIFF_FPU;
+#endif
+
+// Biased exponents and number of stored fraction bits, the Extended explicit bit excluded.
+// The bits of pi/2 are those of fromBits below
+template<typename T> struct Format;
+template<> struct Format<Simple> {
+    static const char* name() {return "Simple";}
+    enum {bias = 127, maxBiased = 255, fraction = 23, pio2Exponent = 0};
+    static const uint64 pio2 = 0x3FC90FDBULL;
+};
+template<> struct Format<Double> {
+    static const char* name() {return "Double";}
+    enum {bias = 1023, maxBiased = 2047, fraction = 52, pio2Exponent = 0};
+    static const uint64 pio2 = 0x3FF921FB54442D18ULL;
+};
+#ifdef Extended
+template<> struct Format<Extended> {
+    static const char* name() {return "Extended";}
+    enum {bias = 16383, maxBiased = 32767, fraction = 63, pio2Exponent = 16383};
+    static const uint64 pio2 = 0xC90FDAA22168C235ULL;
+};
+#endif
+
+// Sign, biased exponent and fraction of the Simple and Double values
+template<typename T> static inline T fromBits(uint64 sign, uint64 exponent, uint64 fraction) {
+    uint64 b = (sign << (sizeof(T) * 8 - 1)) | (exponent << Format<T>::fraction) | fraction;
+    T x;
+    if (sizeof(T) == 4) {
+        uint32 b32 = (uint32)b;
+        memcpy(static_cast<void*>(&x), &b32, 4);
+    } else memcpy(static_cast<void*>(&x), &b, 8);
+    return x;
+}
+
+template<typename T> static inline uint64 toBits(T x) {
+    if (sizeof(T) == 4) {
+        uint32 b;
+        memcpy(&b, &x, 4);
+        return b;
+    }
+    uint64 b;
+    memcpy(&b, &x, 8);
+    return b;
+}
+
+// Moves x by that many ulps, in the same binade
+template<typename T> static inline T moveUlps(T x, int ulps) {
+    uint64 b = toBits(x);
+    uint64 f = b & ((1ULL << Format<T>::fraction) - 1);
+    if ((ulps > 0 && f + ulps < (1ULL << Format<T>::fraction)) || (ulps < 0 && f >= (uint64)(-ulps))) b += ulps;
+    T y;
+    if (sizeof(T) == 4) {
+        uint32 b32 = (uint32)b;
+        memcpy(static_cast<void*>(&y), &b32, 4);
+    } else memcpy(static_cast<void*>(&y), &b, 8);
+    return y;
+}
+
+#ifdef Extended
+template<> inline Extended fromBits<Extended>(uint64 sign, uint64 exponent, uint64 fraction) {
+    uint64 low = fraction | (exponent ? (1ULL << 63) : 0);
+    uint16 high = (uint16)((sign << 15) | exponent);
+    Extended x;
+    memset(static_cast<void*>(&x), 0, sizeof(x));
+    memcpy(static_cast<void*>(&x), &low, 8);
+    memcpy(reinterpret_cast<char*>(static_cast<void*>(&x)) + 8, &high, 2);
+    return x;
+}
+
+template<> inline Extended moveUlps<Extended>(Extended x, int ulps) {
+    uint64 low;
+    memcpy(&low, &x, 8);
+    // Keeps the explicit bit set
+    if ((ulps > 0 && low + ulps > low) || (ulps < 0 && low - (uint64)(-ulps) >= (1ULL << 63))) low += ulps;
+    memcpy(static_cast<void*>(&x), &low, 8);
+    return x;
+}
+#endif
+
+// Input number i of the given argument: the same bits in all the builds
+template<typename T> static T input(CounterRandomState& state, uint64 i) {
+    RandomSeek(i * 8, state);
+    uint32 w[5];
+    for (int k = 0; k < 5; ++k) w[k] = Random<uint32>(state);
+    const uint64 bias = Format<T>::bias, maxBiased = Format<T>::maxBiased, bits = Format<T>::fraction;
+    const uint64 mask = (1ULL << bits) - 1;
+    uint64 sign = w[0] >> 31;
+    uint64 fraction = ((uint64(w[1]) << 32) | w[2]) & mask;
+    switch (w[0] & 7) {
+        // Random bit patterns, infinities and NaN included
+        case 0: return fromBits<T>(sign, w[3] % (maxBiased + 1), fraction);
+        // Small
+        case 1: return fromBits<T>(sign, bias - 8 + w[3] % 10, fraction);
+        // Within a few ulps of one
+        case 2: return (w[3] & 256) ? fromBits<T>(sign, bias, w[3] & 255) : fromBits<T>(sign, bias - 1, mask - (w[3] & 255));
+        // Huge
+        case 3: return fromBits<T>(sign, bias + 20 + w[3] % (maxBiased - bias - 20), fraction);
+        // Near a multiple of pi/2, the worst cases of the argument reductions
+        case 4: {
+            T x = T(double(1 + w[3] % (1 << 20))) * fromBits<T>(0, Format<T>::pio2Exponent, Format<T>::pio2);
+            x = moveUlps(x, int(w[4] % 9) - 4);
+            return sign ? -x : x;
+        }
+        // Denormal
+        case 5: return fromBits<T>(sign, 0, fraction ? fraction : 1);
+        // Integers and half-integers, and around the limit above which all values are integers
+        case 6: {
+            if (w[4] & 1) {
+                T x = T(double(w[3] % 8192) * 0.5);
+                return sign ? -x : x;
+            }
+            return fromBits<T>(sign, bias + bits - 1 + (w[4] >> 1) % 3, fraction);
+        }
+        // Zero, infinity, NaN, one, smallest normal, largest finite, smallest denormal, one half
+        default: {
+            switch (w[3] % 8) {
+                case 0: return fromBits<T>(sign, 0, 0);
+                case 1: return fromBits<T>(sign, maxBiased, 0);
+                case 2: return fromBits<T>(sign, maxBiased, 1ULL << (bits - 1));
+                case 3: return fromBits<T>(sign, bias, 0);
+                case 4: return fromBits<T>(sign, 1, 0);
+                case 5: return fromBits<T>(sign, maxBiased - 1, mask);
+                case 6: return fromBits<T>(sign, 0, 1);
+                default: return fromBits<T>(sign, bias - 1, 0);
+            }
+        }
+    }
+}
+
+// Results of one call: up to two values and an integer
+template<typename T> struct Outcome {
+    T value[2];
+    long long int integer;
+    int values;
+};
+
+// Bits of a value, all NaN the same, see README.txt
+template<typename T> static inline void valueBits(T x, uint64& low, uint64& high) {
+    high = 0;
+    if (x != x) {
+        low = 0x7FF8000000000000ULL;
+        return;
+    }
+    if (sizeof(T) <= 8) low = toBits(x);
+    else {
+        uint16 h;
+        memcpy(&low, &x, 8);
+        memcpy(&h, reinterpret_cast<const char*>(&x) + 8, 2);
+        high = h;
+    }
+}
+
+// Hexadecimal bits of a value, "nan" for all NaN
+template<typename T> static string hexOf(T x) {
+    if (x != x) return "nan";
+    uint64 low, high;
+    valueBits(x, low, high);
+    ostringstream s;
+    s << hex << setfill('0');
+    if (sizeof(T) > 8) s << setw(4) << high << setw(16) << low;
+    else s << setw(sizeof(T) * 2) << low;
+    return s.str();
+}
+
+// Tested operations: a name, and a function of the arguments filling the outcome
+#define STREFLOP_DIFF_UNARY(f) struct Diff_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline void run(T x, T, T, int, Outcome<T>& o) {o.value[0] = streflop::f(x); o.values = 1;} \
+};
+#define STREFLOP_DIFF_BINARY(f) struct Diff_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline void run(T x, T y, T, int, Outcome<T>& o) {o.value[0] = streflop::f(x, y); o.values = 1;} \
+};
+#define STREFLOP_DIFF_INTEGER(f) struct Diff_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline void run(T x, T, T, int, Outcome<T>& o) {o.integer = (long long int)streflop::f(x);} \
+};
+// The rounding to an integer type, only within its range
+#define STREFLOP_DIFF_ROUNDING(f, type) struct Diff_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline void run(T x, T, T, int, Outcome<T>& o) { \
+        const T limit = streflop::ldexp(T(1.0), int(sizeof(type) * 8 - 1)); \
+        if (x > -limit && x < limit) o.integer = (long long int)streflop::f(x); \
+    } \
+};
+#define STREFLOP_DIFF_EXPONENT(f) struct Diff_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline void run(T x, T, T, int n, Outcome<T>& o) {o.value[0] = streflop::f(x, n); o.values = 1;} \
+};
+#define STREFLOP_DIFF_ORDER(f) struct Diff_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline void run(T x, T, T, int n, Outcome<T>& o) {o.value[0] = streflop::f(n % 9, x); o.values = 1;} \
+};
+#define STREFLOP_DIFF_OPERATOR(f, op) struct Diff_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline void run(T x, T y, T, int, Outcome<T>& o) {o.value[0] = x op y; o.values = 1;} \
+};
+
+#define STREFLOP_DIFF_UNARY_LIST(F) \
+    F(sqrt) F(cbrt) F(exp) F(log) F(log2) F(exp2) F(log10) \
+    F(sin) F(cos) F(tan) F(acos) F(asin) F(atan) \
+    F(cosh) F(sinh) F(tanh) F(acosh) F(asinh) F(atanh) \
+    F(fabs) F(floor) F(ceil) F(trunc) F(rint) F(round) F(nearbyint) F(logb) \
+    F(expm1) F(log1p) F(erf) F(j0) F(j1) F(y0) F(y1)
+#define STREFLOP_DIFF_BINARY_LIST(F) \
+    F(hypot) F(pow) F(atan2) F(fmod) F(remainder) F(nextafter) F(copysign)
+#define STREFLOP_DIFF_INTEGER_LIST(F) \
+    F(ilogb) F(signbit) F(fpclassify) F(isnan) F(isinf) F(isfinite) F(isnormal)
+#define STREFLOP_DIFF_EXPONENT_LIST(F) \
+    F(ldexp) F(scalbn) F(scalbln)
+#define STREFLOP_DIFF_ORDER_LIST(F) \
+    F(jn) F(yn)
+
+STREFLOP_DIFF_UNARY_LIST(STREFLOP_DIFF_UNARY)
+STREFLOP_DIFF_BINARY_LIST(STREFLOP_DIFF_BINARY)
+STREFLOP_DIFF_INTEGER_LIST(STREFLOP_DIFF_INTEGER)
+STREFLOP_DIFF_EXPONENT_LIST(STREFLOP_DIFF_EXPONENT)
+STREFLOP_DIFF_ORDER_LIST(STREFLOP_DIFF_ORDER)
+
+STREFLOP_DIFF_ROUNDING(lrint, long int)
+STREFLOP_DIFF_ROUNDING(llrint, long long int)
+STREFLOP_DIFF_ROUNDING(lround, long int)
+STREFLOP_DIFF_ROUNDING(llround, long long int)
+
+STREFLOP_DIFF_OPERATOR(add, +)
+STREFLOP_DIFF_OPERATOR(sub, -)
+STREFLOP_DIFF_OPERATOR(mul, *)
+STREFLOP_DIFF_OPERATOR(div, /)
+
+struct Diff_less {
+    static const char* name() {return "less";}
+    template<typename T> static inline void run(T x, T y, T, int, Outcome<T>& o) {o.integer = (x < y) ? 1 : 0;}
+};
+
+struct Diff_sincos {
+    static const char* name() {return "sincos";}
+    template<typename T> static inline void run(T x, T, T, int, Outcome<T>& o) {
+        streflop::sincos(x, &o.value[0], &o.value[1]);
+        o.values = 2;
+    }
+};
+
+struct Diff_frexp {
+    static const char* name() {return "frexp";}
+    template<typename T> static inline void run(T x, T, T, int, Outcome<T>& o) {
+        int e;
+        o.value[0] = streflop::frexp(x, &e);
+        o.values = 1;
+        // Unspecified for infinities and NaN
+        if (streflop::isfinite(x)) o.integer = e;
+    }
+};
+
+struct Diff_remquo {
+    static const char* name() {return "remquo";}
+    template<typename T> static inline void run(T x, T y, T, int, Outcome<T>& o) {
+        int q;
+        o.value[0] = streflop::remquo(x, y, &q);
+        o.values = 1;
+        // Only the sign and the three low bits are specified, and not at all for NaN results
+        if (o.value[0] == o.value[0]) o.integer = (q < 0) ? -((-q) & 7) : (q & 7);
+    }
+};
+
+struct Diff_fma {
+    static const char* name() {return "fma";}
+    template<typename T> static inline void run(T x, T y, T z, int, Outcome<T>& o) {o.value[0] = streflop::fma(x, y, z); o.values = 1;}
+};
+
+// The inputs of a block
+template<typename T> struct Inputs {
+    T x[BLOCK], y[BLOCK], z[BLOCK];
+    int n[BLOCK];
+};
+
+template<typename T> static void fillInputs(uint64 block, Inputs<T>& in) {
+    CounterRandomState sx, sy, sz, sn;
+    RandomInit(SEED, 0, sx);
+    RandomInit(SEED, 1, sy);
+    RandomInit(SEED, 2, sz);
+    RandomInit(SEED, 3, sn);
+    for (int k = 0; k < BLOCK; ++k) {
+        uint64 i = block * BLOCK + k;
+        in.x[k] = input<T>(sx, i);
+        in.y[k] = input<T>(sy, i);
+        in.z[k] = input<T>(sz, i);
+        // Mostly small exponents and orders, some out of any range
+        RandomSeek(i, sn);
+        uint32 w = Random<uint32>(sn);
+        in.n[k] = (w & 3) ? int((w >> 2) % 81) - 40 : int((w >> 2) % 80001) - 40000;
+    }
+}
+
+template<typename T> static inline void clear(Outcome<T>& o) {
+    o.value[0] = o.value[1] = T(0.0);
+    o.integer = 0;
+    o.values = 0;
+}
+
+template<typename T, typename F> static uint64 hashBlock(const Inputs<T>& in) {
+    uint64 h = 14695981039346656037ULL;
+    for (int k = 0; k < BLOCK; ++k) {
+        Outcome<T> o;
+        clear(o);
+        F::run(in.x[k], in.y[k], in.z[k], in.n[k], o);
+        for (int v = 0; v < o.values; ++v) {
+            uint64 low, high;
+            valueBits(o.value[v], low, high);
+            h = (h ^ low) * 1099511628211ULL;
+            h = (h ^ high) * 1099511628211ULL;
+        }
+        h = (h ^ (uint64)o.integer) * 1099511628211ULL;
+    }
+    return h;
+}
+
+// One line per input: index,x,y,z,n,values...,integer
+template<typename T, typename F> static void listBlock(uint64 block, const Inputs<T>& in) {
+    for (int k = 0; k < BLOCK; ++k) {
+        Outcome<T> o;
+        clear(o);
+        F::run(in.x[k], in.y[k], in.z[k], in.n[k], o);
+        cout << block * BLOCK + k << "," << hexOf(in.x[k]) << "," << hexOf(in.y[k]) << "," << hexOf(in.z[k]) << "," << in.n[k];
+        for (int v = 0; v < 2; ++v) cout << "," << ((v < o.values) ? hexOf(o.value[v]) : string("-"));
+        cout << "," << o.integer << endl;
+    }
+}
+
+template<typename T> struct Test {
+    const char* name;
+    uint64 (*hash)(const Inputs<T>& in);
+    void (*list)(uint64 block, const Inputs<T>& in);
+};
+
+template<typename T> static const Test<T>* tests() {
+#define STREFLOP_DIFF_TEST(f) {Diff_##f::name(), &hashBlock<T, Diff_##f>, &listBlock<T, Diff_##f>},
+    static const Test<T> all[] = {
+        STREFLOP_DIFF_TEST(add) STREFLOP_DIFF_TEST(sub) STREFLOP_DIFF_TEST(mul) STREFLOP_DIFF_TEST(div) STREFLOP_DIFF_TEST(less)
+        STREFLOP_DIFF_UNARY_LIST(STREFLOP_DIFF_TEST)
+        STREFLOP_DIFF_BINARY_LIST(STREFLOP_DIFF_TEST)
+        STREFLOP_DIFF_INTEGER_LIST(STREFLOP_DIFF_TEST)
+        STREFLOP_DIFF_TEST(lrint) STREFLOP_DIFF_TEST(llrint) STREFLOP_DIFF_TEST(lround) STREFLOP_DIFF_TEST(llround)
+        STREFLOP_DIFF_EXPONENT_LIST(STREFLOP_DIFF_TEST)
+        STREFLOP_DIFF_ORDER_LIST(STREFLOP_DIFF_TEST)
+        STREFLOP_DIFF_TEST(sincos) STREFLOP_DIFF_TEST(frexp) STREFLOP_DIFF_TEST(remquo) STREFLOP_DIFF_TEST(fma)
+        {0, 0, 0}
+    };
+#undef STREFLOP_DIFF_TEST
+    return all;
+}
+
+static int selectedCount = 0;
+static const char** selectedNames = 0;
+
+static bool selected(const char* name) {
+    if (selectedCount == 0) return true;
+    for (int i = 0; i < selectedCount; ++i) if (!strcmp(selectedNames[i], name)) return true;
+    return false;
+}
+
+// Hashes of the blocks first, first + step, ... of the selected tests
+template<typename T> struct Work {
+    vector<const Test<T>*> selection;
+    int blocks;
+    vector<uint64> hashes;
+};
+
+template<typename T> static void worker(Work<T>* work, int first, int step) {
+    // The FPU state belongs to each thread
+    streflop_init<T>();
+    Inputs<T>* in = new Inputs<T>;
+    for (int b = first; b < work->blocks; b += step) {
+        fillInputs<T>(b, *in);
+        for (size_t t = 0; t < work->selection.size(); ++t) work->hashes[t * work->blocks + b] = work->selection[t]->hash(*in);
+    }
+    delete in;
+}
+
+// A line per test: type,function,hash,hashes of the blocks separated by spaces
+template<typename T> static void hashType(int blocks, int threads) {
+    Work<T> work;
+    for (const Test<T>* t = tests<T>(); t->name; ++t) if (selected(t->name)) work.selection.push_back(t);
+    work.blocks = blocks;
+    work.hashes.resize(work.selection.size() * blocks);
+#if __cplusplus >= 201103L
+    vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) workers.push_back(std::thread(worker<T>, &work, t, threads));
+    for (int t = 0; t < threads; ++t) workers[t].join();
+#else
+    (void)threads;
+    worker<T>(&work, 0, 1);
+#endif
+    for (size_t t = 0; t < work.selection.size(); ++t) {
+        uint64 h = 14695981039346656037ULL;
+        ostringstream line;
+        line << hex << setfill('0');
+        for (int b = 0; b < blocks; ++b) {
+            uint64 bh = work.hashes[t * blocks + b];
+            h = (h ^ bh) * 1099511628211ULL;
+            line << " " << setw(16) << bh;
+        }
+        cout << Format<T>::name() << "," << work.selection[t]->name << "," << hex << setw(16) << setfill('0') << h << dec << setfill(' ') << "," << line.str().substr(1) << endl;
+    }
+}
+
+template<typename T> static int listType(const char* type, const char* function, int block) {
+    if (strcmp(type, Format<T>::name())) return 1;
+    for (const Test<T>* t = tests<T>(); t->name; ++t) {
+        if (strcmp(t->name, function)) continue;
+        streflop_init<T>();
+        Inputs<T>* in = new Inputs<T>;
+        fillInputs<T>(block, *in);
+        t->list(block, *in);
+        delete in;
+        return 0;
+    }
+    return 1;
+}
+
+// The hashes of a run, by "type,function"
+struct Hashes {
+    string config;
+    map<string, string> total;
+    map<string, vector<string> > blocks;
+};
+
+static void parseHashes(istream& stream, Hashes& h) {
+    string line;
+    while (getline(stream, line)) {
+        if (line.compare(0, 9, "# config ") == 0) h.config = line.substr(9);
+        if (line.empty() || line[0] == '#') continue;
+        size_t c1 = line.find(','), c2 = line.find(',', c1 + 1), c3 = line.find(',', c2 + 1);
+        if (c3 == string::npos) continue;
+        string key = line.substr(0, c2);
+        h.total[key] = line.substr(c2 + 1, c3 - c2 - 1);
+        istringstream blocks(line.substr(c3 + 1));
+        string b;
+        while (blocks >> b) h.blocks[key].push_back(b);
+    }
+}
+
+static bool readHashes(const char* name, Hashes& h) {
+    ifstream file(name);
+    if (!file) {
+        cout << "Cannot read " << name << endl;
+        return false;
+    }
+    parseHashes(file, h);
+    return true;
+}
+
+static bool runProgram(const string& command, string& output) {
+    FILE* pipe = popen(command.c_str(), "r");
+    if (!pipe) return false;
+    char buffer[4096];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), pipe)) > 0) output.append(buffer, count);
+    return pclose(pipe) == 0;
+}
+
+// Distance in ulps of two values printed by hexOf, counting the values in between
+static double ulps(const string& type, const string& a, const string& b) {
+    uint64 ha = 0, hb = 0, la, lb;
+    if (type == "Extended") {
+        ha = strtoull(a.substr(0, 4).c_str(), 0, 16);
+        hb = strtoull(b.substr(0, 4).c_str(), 0, 16);
+        la = strtoull(a.substr(4).c_str(), 0, 16);
+        lb = strtoull(b.substr(4).c_str(), 0, 16);
+        bool sa = (ha >> 15) != 0, sb = (hb >> 15) != 0;
+        ha &= 0x7FFF;
+        hb &= 0x7FFF;
+        if (sa == sb && ha == hb) return (la > lb) ? double(la - lb) : double(lb - la);
+        // The explicit bit only marks the normal numbers
+        double ma = double(ha) * 9223372036854775808.0 + double(la & 0x7FFFFFFFFFFFFFFFULL);
+        double mb = double(hb) * 9223372036854775808.0 + double(lb & 0x7FFFFFFFFFFFFFFFULL);
+        return (sa == sb) ? ((ma > mb) ? ma - mb : mb - ma) : ma + mb;
+    }
+    la = strtoull(a.c_str(), 0, 16);
+    lb = strtoull(b.c_str(), 0, 16);
+    int shift = (type == "Simple") ? 31 : 63;
+    uint64 sign = 1ULL << shift;
+    uint64 ma = la & (sign - 1), mb = lb & (sign - 1);
+    if ((la & sign) == (lb & sign)) return (ma > mb) ? double(ma - mb) : double(mb - ma);
+    return double(ma) + double(mb);
+}
+
+static void splitFields(const string& line, vector<string>& fields) {
+    fields.clear();
+    istringstream stream(line);
+    string field;
+    while (getline(stream, field, ',')) fields.push_back(field);
+}
+
+// Reports the first input of the block giving different results in both programs
+static void firstDifference(const string& key, const string& block, const char* programA, const char* programB, const string& nameA, const string& nameB) {
+    string type = key.substr(0, key.find(',')), function = key.substr(key.find(',') + 1);
+    string arguments = " -block " + type + " " + function + " " + block;
+    string listA, listB;
+    if (!runProgram(string("\"") + programA + "\"" + arguments, listA) || !runProgram(string("\"") + programB + "\"" + arguments, listB)) {
+        cout << key << ": cannot list block " << block << endl;
+        return;
+    }
+    istringstream streamA(listA), streamB(listB);
+    string lineA, lineB;
+    vector<string> a, b;
+    while (getline(streamA, lineA) && getline(streamB, lineB)) {
+        if (lineA == lineB) continue;
+        splitFields(lineA, a);
+        splitFields(lineB, b);
+        if (a.size() != 8 || b.size() != 8) break;
+        cout << key << ": input " << a[0] << ", x=" << a[1] << " y=" << a[2] << " z=" << a[3] << " n=" << a[4] << endl;
+        for (int v = 5; v < 7; ++v) {
+            if (a[v] == b[v]) continue;
+            cout << "    " << nameA << " " << a[v] << ", " << nameB << " " << b[v];
+            if (a[v] != "nan" && b[v] != "nan") cout << ", " << setprecision(15) << ulps(type, a[v], b[v]) << " ulps";
+            cout << endl;
+        }
+        if (a[7] != b[7]) cout << "    integer " << nameA << " " << a[7] << ", " << nameB << " " << b[7] << endl;
+        return;
+    }
+    cout << key << ": block " << block << " lists the same results" << endl;
+}
+
+// The functions with different results, and with both programs their first diverging input
+static int compare(const Hashes& a, const Hashes& b, const char* programA, const char* programB) {
+    string nameA = a.config.empty() ? string("first") : a.config;
+    string nameB = b.config.empty() ? string("second") : b.config;
+    if (nameA == nameB) {
+        nameA += "(1)";
+        nameB += "(2)";
+    }
+    int differences = 0, compared = 0;
+    for (map<string, string>::const_iterator it = a.total.begin(); it != a.total.end(); ++it) {
+        map<string, string>::const_iterator other = b.total.find(it->first);
+        if (other == b.total.end()) continue;
+        ++compared;
+        if (it->second == other->second) continue;
+        ++differences;
+        const vector<string>& ba = a.blocks.find(it->first)->second;
+        const vector<string>& bb = b.blocks.find(it->first)->second;
+        size_t block = 0;
+        while (block < ba.size() && block < bb.size() && ba[block] == bb[block]) ++block;
+        ostringstream index;
+        index << block;
+        if (programA) firstDifference(it->first, index.str(), programA, programB, nameA, nameB);
+        else cout << it->first << ": differs from block " << block << ", list it with -block " << it->first.substr(0, it->first.find(',')) << " " << it->first.substr(it->first.find(',') + 1) << " " << block << endl;
+    }
+    cout << compared << " functions compared, " << differences << " different" << endl;
+    return differences ? 1 : 0;
+}
+
+int main(int argc, const char** argv) {
+
+    if (argc >= 4 && !strcmp(argv[1], "-compare")) {
+        Hashes a, b;
+        if (!readHashes(argv[2], a) || !readHashes(argv[3], b)) return 2;
+        return compare(a, b, 0, 0);
+    }
+
+    if (argc >= 5 && !strcmp(argv[1], "-block")) {
+        int block = atoi(argv[4]);
+        int result = listType<Simple>(argv[2], argv[3], block) && listType<Double>(argv[2], argv[3], block);
+#ifdef Extended
+        if (result) result = listType<Extended>(argv[2], argv[3], block);
+#endif
+        if (result) cout << "No " << argv[2] << " " << argv[3] << " in this build" << endl;
+        return result;
+    }
+
+    if (argc >= 4 && !strcmp(argv[1], "-diff")) {
+        string options;
+        for (int i = 4; i < argc; ++i) options += string(" ") + argv[i];
+        string outputA, outputB;
+        if (!runProgram(string("\"") + argv[2] + "\"" + options, outputA) || !runProgram(string("\"") + argv[3] + "\"" + options, outputB)) {
+            cout << "Cannot run " << argv[2] << " and " << argv[3] << endl;
+            return 2;
+        }
+        istringstream streamA(outputA), streamB(outputB);
+        Hashes a, b;
+        parseHashes(streamA, a);
+        parseHashes(streamB, b);
+        return compare(a, b, argv[2], argv[3]);
+    }
+
+    int size = 18, threads = 1;
+#if __cplusplus >= 201103L
+    threads = (int)std::thread::hardware_concurrency();
+    if (threads < 1) threads = 1;
+#endif
+    int first = 1;
+    while (first + 1 < argc && argv[first][0] == '-') {
+        if (!strcmp(argv[first], "-size")) size = atoi(argv[first + 1]);
+        else if (!strcmp(argv[first], "-threads")) threads = atoi(argv[first + 1]);
+        else break;
+        first += 2;
+    }
+    selectedCount = argc - first;
+    selectedNames = argv + first;
+    if (size < 12) size = 12;
+    if (threads < 1) threads = 1;
+    int blocks = 1 << (size - 12);
+
+    cout << "# config " << configName << endl;
+    cout << "# " << blocks * BLOCK << " inputs per function in blocks of " << BLOCK << endl;
+    hashType<Simple>(blocks, threads);
+    hashType<Double>(blocks, threads);
+#ifdef Extended
+    hashType<Extended>(blocks, threads);
+#endif
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Hashes the results of the dispatched functions with each configuration of the dispatch
+// library that this processor supports, and checks they are all the same. Then times them.
+// Then runs again with STREFLOP_NO_AVX, and checks that AVX is not selected.
+
+#include <iostream>
+using namespace std;
+// clock
+#include <time.h>
+// memcpy for the bit patterns, strcmp
+#include <string.h>
+// getenv, system
+#include <stdlib.h>
+#include <string>
+
+#include "Dispatch.h"
+
+static const int N = 200000;
+
+static unsigned long long checksum;
+
+template<typename T> static void mix(T z) {
+    unsigned char bytes[sizeof(T)];
+    memcpy(bytes, &z, sizeof(T));
+    for (unsigned i = 0; i < sizeof(T); ++i) checksum = (checksum ^ bytes[i]) * 1099511628211ULL;
+}
+
+// Not the streflop generator, which is not dispatched
+static unsigned long long state;
+static double uniform() {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return double(state >> 11) / 9007199254740992.0;
+}
+
+template<typename T> static void hashType() {
+    using namespace streflop_dispatch;
+    init<T>();
+    state = 42;
+    for (int i = 0; i < N; ++i) {
+        // Mostly moderate arguments, some large ones
+        T x = T(ldexp(uniform() * 2.0 - 1.0, int(uniform() * 24.0) - 8));
+        T y = T(ldexp(uniform() * 2.0 - 1.0, int(uniform() * 24.0) - 8));
+        T z = T(uniform());
+#define STREFLOP_DISPATCH_MIX_UNARY(f) mix(f(x));
+#define STREFLOP_DISPATCH_MIX_BINARY(f) mix(f(x, y));
+        STREFLOP_DISPATCH_UNARY(STREFLOP_DISPATCH_MIX_UNARY)
+        STREFLOP_DISPATCH_BINARY(STREFLOP_DISPATCH_MIX_BINARY)
+#undef STREFLOP_DISPATCH_MIX_UNARY
+#undef STREFLOP_DISPATCH_MIX_BINARY
+        T s, c;
+        sincos(x, &s, &c);
+        mix(s);
+        mix(c);
+        mix(fma(x, y, z));
+        int e;
+        mix(frexp(x, &e));
+        mix(e);
+        mix(ldexp(x, e));
+    }
+}
+
+int main(int argc, const char** argv) {
+
+    using namespace streflop_dispatch;
+
+    cout << "selected: " << current->name << endl;
+
+    int failures = 0;
+    const bool noAvx = getenv("STREFLOP_NO_AVX") != 0;
+    if (noAvx && (configuration_supported("sse_avx") || !strcmp(current->name, "sse_avx"))) {
+        cout << "FAILED: sse_avx selected with STREFLOP_NO_AVX" << endl;
+        ++failures;
+    }
+
+    unsigned long long reference[2] = {0, 0};
+    const char* referenceName = 0;
+    for (const char* const* name = configuration_names(); *name; ++name) {
+        if (!select_configuration(*name)) {
+            cout << *name << ": not supported" << endl;
+            continue;
+        }
+        unsigned long long hashes[2];
+        clock_t start = clock();
+        checksum = 14695981039346656037ULL;
+        hashType<float>();
+        hashes[0] = checksum;
+        clock_t mid = clock();
+        checksum = 14695981039346656037ULL;
+        hashType<double>();
+        hashes[1] = checksum;
+        clock_t stop = clock();
+        cout << *name << ": float " << hex << hashes[0] << " double " << hashes[1] << dec
+             << ", " << double(mid - start) / CLOCKS_PER_SEC << " s and " << double(stop - mid) / CLOCKS_PER_SEC << " s" << endl;
+        if (!referenceName) {
+            referenceName = *name;
+            reference[0] = hashes[0];
+            reference[1] = hashes[1];
+        } else if (hashes[0] != reference[0] || hashes[1] != reference[1]) {
+            cout << "MISMATCH between " << referenceName << " and " << *name << endl;
+            ++failures;
+        }
+    }
+
+#ifndef _WIN32
+    // As on a processor without AVX
+    if (!noAvx) {
+        cout << "again with STREFLOP_NO_AVX:" << endl;
+        if (system((std::string("STREFLOP_NO_AVX=1 ") + argv[0]).c_str()) != 0) ++failures;
+    }
+#endif
+
+    cout << (failures ? "FAILED" : "OK") << endl;
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,204 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Checks the means and variances of the distributions of Distribution.h, the frequencies of
+// an alias table, and that the Fill functions give the same numbers as successive calls.
+// Then times them, the alias table against a linear scan of the cumulated weights.
+// The printed checksum must be the same for all configurations.
+
+#include <iostream>
+using namespace std;
+// clock
+#include <time.h>
+// memcpy for the bit patterns
+#include <string.h>
+
+#include "streflop.h"
+using namespace streflop;
+
+typedef SizedUnsignedInteger<64>::Type uint64;
+typedef SizedUnsignedInteger<32>::Type uint32;
+
+static const int N = 1000000;
+
+static Double values[N];
+static uint32 counts[N];
+
+static int failures = 0;
+
+static uint64 checksum = 1469598103934665603ULL;
+
+static void hashValue(uint64 b) {
+    checksum ^= b;
+    checksum *= 1099511628211ULL;
+}
+
+static void hashValue(Double z) {
+    uint64 b = 0;
+    memcpy(&b, &z, sizeof(b));
+    hashValue(b);
+}
+
+// Mean and variance of the numbers against the expected ones, within a few standard errors
+static void checkMoments(const char* name, Double mean, Double var, Double expectedMean, Double expectedVar) {
+    cout << name << ": mean " << (double)mean << " (should be " << (double)expectedMean << "), variance "
+         << (double)var << " (should be " << (double)expectedVar << ")" << endl;
+    Double tolerance = Double(6.0) * sqrt(expectedVar / Double(N)) + Double(1e-9);
+    if (fabs(mean - expectedMean) > tolerance || fabs(var - expectedVar) > Double(0.02) * expectedVar + Double(1e-9)) {
+        cout << "MISMATCH " << name << endl;
+        ++failures;
+    }
+}
+
+static void checkReals(const char* name, Double expectedMean, Double expectedVar) {
+    Double sum = Double(0.0), sum2 = Double(0.0);
+    for (int i = 0; i < N; ++i) {
+        sum += values[i];
+        sum2 += values[i] * values[i];
+        hashValue(values[i]);
+    }
+    Double mean = sum / Double(N);
+    checkMoments(name, mean, sum2 / Double(N) - mean * mean, expectedMean, expectedVar);
+}
+
+static void checkCounts(const char* name, Double expectedMean, Double expectedVar) {
+    Double sum = Double(0.0), sum2 = Double(0.0);
+    for (int i = 0; i < N; ++i) {
+        Double k = Double(counts[i]);
+        sum += k;
+        sum2 += k * k;
+        hashValue(uint64(counts[i]));
+    }
+    Double mean = sum / Double(N);
+    checkMoments(name, mean, sum2 / Double(N) - mean * mean, expectedMean, expectedVar);
+}
+
+// The Fill functions against successive calls, from copies of the same state
+static void checkFill() {
+    RandomState a = DefaultRandomState, b = DefaultRandomState;
+    Double reals[1000];
+    uint32 ints[1000];
+    bool same = true;
+    GammaRandomFill(reals, 1000, Double(0.3), Double(2.0), a);
+    for (int i = 0; i < 1000; ++i) same = same && (reals[i] == GammaRandom(Double(0.3), Double(2.0), b));
+    BetaRandomFill(reals, 1000, Double(0.5), Double(0.7), a);
+    for (int i = 0; i < 1000; ++i) same = same && (reals[i] == BetaRandom(Double(0.5), Double(0.7), b));
+    PoissonRandomFill(ints, 1000, Double(50.0), a);
+    for (int i = 0; i < 1000; ++i) same = same && (ints[i] == PoissonRandom(Double(50.0), b));
+    BinomialRandomFill(ints, 1000, 100000, Double(0.9), a);
+    for (int i = 0; i < 1000; ++i) same = same && (ints[i] == BinomialRandom(uint32(100000), Double(0.9), b));
+    if (!same) {
+        cout << "MISMATCH fill and successive calls" << endl;
+        ++failures;
+    }
+}
+
+static void showtime(const char* name, clock_t start, clock_t stop) {
+    double ns = double(stop - start) / CLOCKS_PER_SEC * 1e9 / double(N);
+    cout << "  " << name << ": " << ns << " ns/number" << endl;
+}
+
+int main(int argc, const char** argv) {
+
+    streflop_init<Double>();
+    RandomInit(42);
+
+    ExpRandomFill(values, N, Double(2.0));
+    checkReals("exponential, rate 2", Double(0.5), Double(0.25));
+    GammaRandomFill(values, N, Double(3.5), Double(2.0));
+    checkReals("gamma, shape 3.5, scale 2", Double(7.0), Double(14.0));
+    GammaRandomFill(values, N, Double(0.25), Double(1.0));
+    checkReals("gamma, shape 0.25", Double(0.25), Double(0.25));
+    BetaRandomFill(values, N, Double(2.0), Double(5.0));
+    checkReals("beta, shapes 2 and 5", Double(2.0) / Double(7.0), Double(10.0) / Double(49.0 * 8.0));
+    BetaRandomFill(values, N, Double(0.5), Double(0.5));
+    checkReals("beta, shapes 0.5 and 0.5", Double(0.5), Double(0.125));
+    PoissonRandomFill(counts, N, Double(3.0));
+    checkCounts("poisson, mean 3", Double(3.0), Double(3.0));
+    PoissonRandomFill(counts, N, Double(1000.0));
+    checkCounts("poisson, mean 1000", Double(1000.0), Double(1000.0));
+    BinomialRandomFill(counts, N, 20, Double(0.3));
+    checkCounts("binomial, 20 trials, p 0.3", Double(6.0), Double(4.2));
+    BinomialRandomFill(counts, N, 100000, Double(0.01));
+    checkCounts("binomial, 100000 trials, p 0.01", Double(1000.0), Double(990.0));
+    BinomialRandomFill(counts, N, 1000, Double(0.8));
+    checkCounts("binomial, 1000 trials, p 0.8", Double(800.0), Double(160.0));
+
+    // Weights 1..8 and a zero one
+    Double weights[9] = {1.0, 2.0, 3.0, 4.0, 0.0, 5.0, 6.0, 7.0, 8.0};
+    RandomAliasTable table(weights, 9);
+    table.fill(counts, N);
+    int frequency[9] = {0};
+    for (int i = 0; i < N; ++i) {
+        ++frequency[counts[i]];
+        hashValue(uint64(counts[i]));
+    }
+    cout << "alias table, weights 1..8 and 0:";
+    for (int i = 0; i < 9; ++i) {
+        Double expected = Double(N) * weights[i] / Double(36.0);
+        cout << " " << frequency[i];
+        if (fabs(Double(frequency[i]) - expected) > Double(6.0) * sqrt(expected) + Double(0.5)) ++failures;
+    }
+    cout << endl;
+    Double invalid[2] = {Double(1.0), Double(-1.0)};
+    if (table.build(invalid, 2) || table.size() != 0) {
+        cout << "MISMATCH negative weight accepted" << endl;
+        ++failures;
+    }
+
+    checkFill();
+
+    cout << "checksum: " << hex << checksum << dec << endl;
+
+    cout << "Timings:" << endl;
+    clock_t start = clock();
+    ExpRandomFill(values, N, Double(2.0));
+    showtime("exponential", start, clock());
+    start = clock();
+    GammaRandomFill(values, N, Double(3.5), Double(2.0));
+    showtime("gamma, shape 3.5", start, clock());
+    start = clock();
+    BetaRandomFill(values, N, Double(2.0), Double(5.0));
+    showtime("beta, shapes 2 and 5", start, clock());
+    start = clock();
+    PoissonRandomFill(counts, N, Double(3.0));
+    showtime("poisson, mean 3", start, clock());
+    start = clock();
+    PoissonRandomFill(counts, N, Double(1000.0));
+    showtime("poisson, mean 1000", start, clock());
+    start = clock();
+    for (int i = 0; i < N; ++i) counts[i] = PoissonRandom(Double(1000.0));
+    showtime("poisson, mean 1000, single calls", start, clock());
+    start = clock();
+    BinomialRandomFill(counts, N, 100000, Double(0.01));
+    showtime("binomial, mean 1000", start, clock());
+
+    // Weighted choice among 1000 items
+    static Double many[1000], cumulated[1000];
+    for (int i = 0; i < 1000; ++i) many[i] = Random01<true, false, Double>();
+    cumulated[0] = many[0];
+    for (int i = 1; i < 1000; ++i) cumulated[i] = cumulated[i-1] + many[i];
+    start = clock();
+    for (int i = 0; i < N; ++i) {
+        Double u = RandomIE(Double(0.0), cumulated[999]);
+        int k = 0;
+        while (k < 999 && cumulated[k] <= u) ++k;
+        counts[i] = k;
+    }
+    showtime("1000 weights, linear scan", start, clock());
+    start = clock();
+    table.build(many, 1000);
+    table.fill(counts, N);
+    showtime("1000 weights, alias table with its build", start, clock());
+
+    cout << (failures ? "FAILED" : "OK") << endl;
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,169 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Compares the Extended functions with the long double functions of the system libm on
+// random arguments, and fails when one differs by more than the bound given in README.txt.
+// Only meaningful where the system long double is the x87 80-bit format, as with glibc on x86.
+// The reference is not correctly rounded itself, so the bounds include its own error.
+
+#include <iostream>
+using namespace std;
+// memcpy for the bit patterns
+#include <string.h>
+
+#include "streflop.h"
+using namespace streflop;
+
+#if defined(Extended) && (defined(__i386__) || defined(__x86_64__))
+
+// The system libm, declared here rather than through math.h, which would clash with Math.h
+extern "C" {
+long double sqrtl(long double), cbrtl(long double), expl(long double), exp2l(long double), expm1l(long double);
+long double logl(long double), log2l(long double), log10l(long double), log1pl(long double);
+long double sinl(long double), cosl(long double), tanl(long double), asinl(long double), acosl(long double), atanl(long double);
+long double sinhl(long double), coshl(long double), tanhl(long double);
+long double powl(long double, long double), atan2l(long double, long double), hypotl(long double, long double);
+}
+
+typedef SizedUnsignedInteger<64>::Type uint64;
+
+static const int N = 20000;
+static int failures = 0;
+
+static long double toLongDouble(Extended x) {
+    long double r = 0;
+    memcpy(&r, &x, 10);
+    return r;
+}
+
+// Distance in ulps between two finite numbers of the 80-bit format, or 2^62 if too large
+static uint64 ulps(long double a, long double b) {
+    unsigned char ba[10], bb[10];
+    memcpy(ba, &a, 10);
+    memcpy(bb, &b, 10);
+    uint64 ma, mb;
+    unsigned short ea, eb;
+    memcpy(&ma, ba, 8); memcpy(&ea, ba + 8, 2);
+    memcpy(&mb, bb, 8); memcpy(&eb, bb + 8, 2);
+    if (ea == eb && ma == mb) return 0;
+    if ((ea & 0x8000) != (eb & 0x8000) || (ea & 0x7fff) > (eb & 0x7fff) + 1 || (eb & 0x7fff) > (ea & 0x7fff) + 1) return uint64(1) << 62;
+    // Consecutive exponents: the fractions continue each other, the explicit bit excluded
+    uint64 fa = ma & 0x7fffffffffffffffULL, fb = mb & 0x7fffffffffffffffULL;
+    if ((ea & 0x7fff) > (eb & 0x7fff)) return fa + (0x8000000000000000ULL - fb);
+    if ((eb & 0x7fff) > (ea & 0x7fff)) return fb + (0x8000000000000000ULL - fa);
+    return (fa > fb) ? fa - fb : fb - fa;
+}
+
+static void report(const char* name, double lo, double hi, uint64 worst, uint64 bound) {
+    cout << name << " on [" << lo << ", " << hi << "]: " << worst << " ulp (bound " << bound << ")" << endl;
+    if (worst > bound) {
+        cout << "FAILED: " << name << " is beyond its bound" << endl;
+        ++failures;
+    }
+}
+
+static void check1(const char* name, Extended (*f)(Extended), long double (*g)(long double), double lo, double hi, uint64 bound) {
+    RandomState state;
+    RandomInit(42, state);
+    uint64 worst = 0;
+    for (int i=0; i<N; ++i) {
+        Extended x = RandomII<Extended>(Extended(lo), Extended(hi), state);
+        uint64 d = ulps(toLongDouble(f(x)), g(toLongDouble(x)));
+        if (d > worst) worst = d;
+    }
+    report(name, lo, hi, worst, bound);
+}
+
+static void check2(const char* name, Extended (*f)(Extended, Extended), long double (*g)(long double, long double), double lo, double hi, double lo2, double hi2, uint64 bound) {
+    RandomState state;
+    RandomInit(42, state);
+    uint64 worst = 0;
+    for (int i=0; i<N; ++i) {
+        Extended x = RandomII<Extended>(Extended(lo), Extended(hi), state);
+        Extended y = RandomII<Extended>(Extended(lo2), Extended(hi2), state);
+        uint64 d = ulps(toLongDouble(f(x, y)), g(toLongDouble(x), toLongDouble(y)));
+        if (d > worst) worst = d;
+    }
+    report(name, lo, hi, worst, bound);
+}
+
+// Wrappers selecting the Extended overloads
+static Extended e_sqrt(Extended x) {return sqrt(x);}
+static Extended e_cbrt(Extended x) {return cbrt(x);}
+static Extended e_exp(Extended x) {return exp(x);}
+static Extended e_exp2(Extended x) {return exp2(x);}
+static Extended e_expm1(Extended x) {return expm1(x);}
+static Extended e_log(Extended x) {return log(x);}
+static Extended e_log2(Extended x) {return log2(x);}
+static Extended e_log10(Extended x) {return log10(x);}
+static Extended e_log1p(Extended x) {return log1p(x);}
+static Extended e_sin(Extended x) {return sin(x);}
+static Extended e_cos(Extended x) {return cos(x);}
+static Extended e_tan(Extended x) {return tan(x);}
+static Extended e_asin(Extended x) {return asin(x);}
+static Extended e_acos(Extended x) {return acos(x);}
+static Extended e_atan(Extended x) {return atan(x);}
+static Extended e_sinh(Extended x) {return sinh(x);}
+static Extended e_cosh(Extended x) {return cosh(x);}
+static Extended e_tanh(Extended x) {return tanh(x);}
+static Extended e_pow(Extended x, Extended y) {return pow(x, y);}
+static Extended e_atan2(Extended x, Extended y) {return atan2(x, y);}
+static Extended e_hypot(Extended x, Extended y) {return hypot(x, y);}
+
+int main(int argc, const char** argv) {
+    streflop_init<Extended>();
+
+    check1("sqrt", e_sqrt, ::sqrtl, 0.0, 1e6, 1);
+    check1("cbrt", e_cbrt, ::cbrtl, -1e6, 1e6, 1);
+    check1("exp", e_exp, ::expl, -11000.0, 11000.0, 1);
+    check1("exp", e_exp, ::expl, -1.0, 1.0, 1);
+    check1("exp2", e_exp2, ::exp2l, -16000.0, 16000.0, 1);
+    check1("expm1", e_expm1, ::expm1l, -1.0, 1.0, 2);
+    check1("expm1", e_expm1, ::expm1l, -1e-10, 1e-10, 2);
+    check1("log", e_log, ::logl, 0.5, 2.0, 1);
+    check1("log", e_log, ::logl, 1e-300, 1e300, 1);
+    check1("log2", e_log2, ::log2l, 0.5, 2.0, 1);
+    check1("log10", e_log10, ::log10l, 0.5, 2.0, 1);
+    check1("log1p", e_log1p, ::log1pl, -0.9, 1.0, 3);
+    check1("log1p", e_log1p, ::log1pl, -1.0, -0.99, 3);
+    check1("log1p", e_log1p, ::log1pl, -1e-15, 1e-15, 3);
+    check1("sin", e_sin, ::sinl, -10.0, 10.0, 1);
+    check1("sin", e_sin, ::sinl, -1e6, 1e6, 1);
+    check1("cos", e_cos, ::cosl, -10.0, 10.0, 1);
+    check1("cos", e_cos, ::cosl, -1e6, 1e6, 1);
+    check1("tan", e_tan, ::tanl, -1.6, 1.6, 2);
+    check1("tan", e_tan, ::tanl, -1e18, 1e18, 2);
+    check1("asin", e_asin, ::asinl, -1.0, 1.0, 2);
+    check1("acos", e_acos, ::acosl, -1.0, 1.0, 2);
+    check1("acos", e_acos, ::acosl, 0.99, 1.0, 2);
+    check1("atan", e_atan, ::atanl, -100.0, 100.0, 1);
+    check1("sinh", e_sinh, ::sinhl, -20.0, 20.0, 2);
+    check1("cosh", e_cosh, ::coshl, -20.0, 20.0, 2);
+    check1("tanh", e_tanh, ::tanhl, -5.0, 5.0, 3);
+    check2("pow", e_pow, ::powl, 0.0, 10.0, -50.0, 50.0, 3);
+    check2("pow", e_pow, ::powl, 0.999, 1.001, -1e7, 1e7, 3);
+    check2("pow", e_pow, ::powl, 1.0, 1e4, -1200.0, 1200.0, 3);
+    check2("atan2", e_atan2, ::atan2l, -10.0, 10.0, -10.0, 10.0, 1);
+    check2("hypot", e_hypot, ::hypotl, -10.0, 10.0, -10.0, 10.0, 1);
+
+    if (failures) return 1;
+    cout << "All Extended functions are within their bounds" << endl;
+    return 0;
+}
+
+#else
+
+int main(int argc, const char** argv) {
+    cout << "No Extended type, or no x87 long double to compare with" << endl;
+    return 0;
+}
+
+#endif
@@ -0,0 +1,211 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Checks fma on a few exact cases, and hashes its results on random arguments built
+// from integers: products that cancel with z, underflows, overflows, in the four
+// rounding modes. The printed checksums must be the same for all configurations.
+// Then times fma against a plain x*y+z.
+
+#include <iostream>
+using namespace std;
+// clock
+#include <time.h>
+// memcpy for the bit patterns
+#include <string.h>
+
+#include "streflop.h"
+using namespace streflop;
+
+typedef SizedUnsignedInteger<64>::Type uint64;
+typedef SizedUnsignedInteger<32>::Type uint32;
+
+static const int N = 1024;
+static const int REPS = 2000;
+static const int CASES = 200000;
+
+static uint64 random64() {
+    uint64 high = Random<uint32>();
+    return (high << 32) | Random<uint32>();
+}
+
+// Random bits above the given number of low zero bits, with the top one set
+static uint64 randomMantissa(int bits, int zeros) {
+    uint64 m = random64() >> (64 - bits);
+    m |= uint64(1) << (bits - 1);
+    return (m >> zeros) << zeros;
+}
+
+// Number from its sign, biased exponent and mantissa with the leading bit
+static Simple makeSimple(bool negative, int exponent, uint64 m) {
+    uint32 bits = (negative ? 0x80000000 : 0) | ((uint32)exponent << 23) | (uint32)(m & 0x7FFFFF);
+    Simple x;
+    memcpy(static_cast<void*>(&x), &bits, sizeof(bits));
+    return x;
+}
+
+static Double makeDouble(bool negative, int exponent, uint64 m) {
+    uint64 bits = (negative ? uint64(1) << 63 : 0) | ((uint64)exponent << 52) | (m & ((uint64(1) << 52) - 1));
+    Double x;
+    memcpy(static_cast<void*>(&x), &bits, sizeof(bits));
+    return x;
+}
+
+#ifdef Extended
+static Extended makeExtended(bool negative, int exponent, uint64 m) {
+    SizedUnsignedInteger<16>::Type high = (negative ? 0x8000 : 0) | exponent;
+    Extended x = Extended(0.0);
+    memcpy(static_cast<void*>(&x), &m, sizeof(m));
+    memcpy(reinterpret_cast<char*>(&x) + sizeof(m), &high, sizeof(high));
+    return x;
+}
+#endif
+
+static uint64 checksum;
+
+template<typename T> static void mix(T z) {
+    // 10 bytes for Extended, only the significant ones
+    unsigned char bytes[10] = {0};
+    memcpy(bytes, &z, sizeof(T) < 10 ? sizeof(T) : 10);
+    for (int i = 0; i < 10; ++i) checksum = (checksum ^ bytes[i]) * 1099511628211ULL;
+}
+
+static int failures = 0;
+
+static void check(const char* name, Double expected, Double z) {
+    uint64 a, b;
+    memcpy(&a, &expected, sizeof(a));
+    memcpy(&b, &z, sizeof(b));
+    if (a != b) {
+        cout << "MISMATCH " << name << ": " << hex << b << " instead of " << a << dec << endl;
+        ++failures;
+    }
+}
+
+/* Random arguments for a format of the given precision, bias and maximum biased exponent.
+   kind 0: products and addends of unrelated magnitudes
+   kind 1: z is nearly the opposite of the product, which is exact in the format
+   kind 2: results around the subnormals
+   kind 3: results around the overflow
+*/
+template<typename T> static void hashFormat(T (*make)(bool, int, uint64), int precision, int bias, int maxExponent) {
+    const int half = precision / 2;
+    for (int i = 0; i < CASES; ++i) {
+        int kind = i & 3;
+        bool sx = Random<uint32>() & 1, sy = Random<uint32>() & 1, sz = Random<uint32>() & 1;
+        int ex, ey, ez;
+        uint64 mx, my, mz;
+        if (kind == 1) {
+            // Mantissas of half the precision, so the product fits exactly in z
+            mx = randomMantissa(precision, precision - half);
+            my = randomMantissa(precision, precision - half);
+            ex = bias + RandomII(-30, 30);
+            ey = bias + RandomII(-30, 30);
+            uint64 p = (mx >> (precision - half)) * (my >> (precision - half));
+            int shift = 0;
+            while (!(p >> (2 * half - 1 + shift))) --shift;
+            // p has 2*half or 2*half-1 bits, bring it to the precision
+            int bits = 2 * half + shift;
+            mz = p << (precision - bits);
+            ez = ex + ey - bias + (bits - 2 * half + 1);
+            mz += (uint64)RandomII(-3, 3) << RandomII(0, 3);
+            sz = !(sx != sy);
+            if (!(mz >> (precision - 1))) mz = uint64(1) << (precision - 1);
+            if (mz >> precision) mz = (uint64(1) << precision) - 1;
+        } else {
+            mx = randomMantissa(precision, 0);
+            my = randomMantissa(precision, 0);
+            mz = randomMantissa(precision, 0);
+            int target = (kind == 2) ? RandomII(-precision - 3, 3) : (kind == 3) ? maxExponent + RandomII(-3, 1) : bias + RandomII(-20, 20);
+            ex = bias + RandomII(-bias / 2, bias / 2);
+            ey = target - ex + bias;
+            ez = target + RandomII(-precision - 2, precision + 2);
+        }
+        if (ex < 1 || ex >= maxExponent || ey < 1 || ey >= maxExponent) continue;
+        if (ez >= maxExponent) continue;
+        if (ez < 1) {
+            // subnormal z
+            mz >>= (1 - ez) < 63 ? (1 - ez) : 63;
+            ez = 0;
+        }
+        T x = make(sx, ex, mx), y = make(sy, ey, my), z = make(sz, ez, mz);
+        mix(fma(x, y, z));
+    }
+}
+
+static void hashAll(const char* mode) {
+    RandomInit(42);
+    checksum = 14695981039346656037ULL;
+    hashFormat<Simple>(makeSimple, 24, 127, 255);
+    cout << mode << " Simple " << hex << checksum << dec;
+    RandomInit(42);
+    checksum = 14695981039346656037ULL;
+    hashFormat<Double>(makeDouble, 53, 1023, 2047);
+    cout << " Double " << hex << checksum << dec;
+#ifdef Extended
+    RandomInit(42);
+    checksum = 14695981039346656037ULL;
+    hashFormat<Extended>(makeExtended, 64, 16383, 32767);
+    cout << " Extended " << hex << checksum << dec;
+#endif
+    cout << endl;
+}
+
+int main(int argc, const char** argv) {
+
+    streflop_init<Double>();
+
+    // 2^-52 is lost in the plain product, and is the whole result with fma
+    Double u = ldexp(Double(1.0), -52);
+    check("cancellation", -u * u, fma(Double(1.0) + u, Double(1.0) - u, Double(-1.0)));
+    check("tenth", makeDouble(false, 1023 - 54, 0), fma(Double(0.1), Double(10.0), Double(-1.0)));
+    check("exact zero", Double(0.0), fma(Double(2.0), Double(3.0), Double(-6.0)));
+    check("overflowing product", Double(1.0) / Double(0.0), fma(Double(1e300), Double(1e300), Double(-1e300)));
+    check("infinite addend", Double(-1.0) / Double(0.0), fma(Double(1e300), Double(1e300), Double(-1.0) / Double(0.0)));
+    check("underflow", ldexp(Double(1.0), -1074), fma(ldexp(Double(1.0), -600), ldexp(Double(1.0), -474), ldexp(Double(1.0), -1074) * Double(0.0)));
+    fesetround(FE_UPWARD);
+    check("upward", Double(1.0) + ldexp(Double(1.0), -52), fma(Double(1.0), Double(1.0), ldexp(Double(1.0), -60)));
+    fesetround(FE_DOWNWARD);
+    check("downward zero", -Double(0.0), fma(Double(2.0), Double(3.0), Double(-6.0)));
+    fesetround(FE_TONEAREST);
+
+    int modes[4] = {FE_TONEAREST, FE_UPWARD, FE_DOWNWARD, FE_TOWARDZERO};
+    const char* names[4] = {"nearest", "upward", "downward", "towardzero"};
+    for (int m = 0; m < 4; ++m) {
+        fesetround((FPU_RoundMode)modes[m]);
+        hashAll(names[m]);
+    }
+    fesetround(FE_TONEAREST);
+
+    static Double x[N], y[N], z[N], out[N];
+    RandomInit(1);
+    for (int i = 0; i < N; ++i) {
+        x[i] = RandomIE(Double(-1.0), Double(1.0));
+        y[i] = RandomIE(Double(-1.0), Double(1.0));
+        z[i] = RandomIE(Double(-1.0), Double(1.0));
+    }
+    fma(x, y, z, out, N);
+    for (int i = 0; i < N; ++i) check("batch", fma(x[i], y[i], z[i]), out[i]);
+
+    Double acc = Double(0.0);
+    clock_t start = clock();
+    for (int r = 0; r < REPS; ++r) for (int i = 0; i < N; ++i) acc += x[i] * y[i] + z[i];
+    clock_t mid = clock();
+    cout << "x*y+z: " << double(mid - start) / CLOCKS_PER_SEC * 1e9 / (double(N) * REPS) << " ns" << endl;
+    for (int r = 0; r < REPS; ++r) for (int i = 0; i < N; ++i) acc += fma(x[i], y[i], z[i]);
+    clock_t stop = clock();
+    cout << "fma: " << double(stop - mid) / CLOCKS_PER_SEC * 1e9 / (double(N) * REPS) << " ns" << endl;
+    for (int r = 0; r < REPS; ++r) fma(x, y, z, out, N);
+    cout << "batch fma: " << double(clock() - stop) / CLOCKS_PER_SEC * 1e9 / (double(N) * REPS) << " ns" << endl;
+    cout << "(" << (double)acc << ")" << endl;
+
+    cout << (failures ? "FAILED" : "OK") << endl;
+    return failures ? 1 : 0;
+}
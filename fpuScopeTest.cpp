@@ -0,0 +1,142 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Checks that FPUScope sets up the FPU even when foreign code changed the mode behind
+// streflop, and that it restores the foreign mode. Then times a callback guarded by
+// FPUScope against one calling streflop_init each time.
+
+#include <iostream>
+using namespace std;
+// clock
+#include <time.h>
+
+#include "streflop.h"
+using namespace streflop;
+
+#if defined(STREFLOP_X87) || defined(STREFLOP_SSE)
+
+#ifdef __GNUC__
+#define NOINLINE __attribute__ ((noinline))
+#else
+#define NOINLINE
+#endif
+
+static int failures = 0;
+
+static void check(const char* name, bool ok) {
+    if (!ok) {
+        cout << "FAILED: " << name << endl;
+        ++failures;
+    }
+}
+
+// Words as streflop_init<Double>() sets them, and as the foreign code below leaves them
+static unsigned short x87Double, x87Foreign;
+#if defined(STREFLOP_SSE)
+static int sseDouble, sseForeign;
+#endif
+
+// Another library switching to extended precision, and flushing the denormals on SSE
+static void foreignCode() {
+    unsigned short x87_mode;
+    STREFLOP_FSTCW(x87_mode);
+    x87_mode |= 0x0300;
+    STREFLOP_FLDCW(x87_mode);
+#if defined(STREFLOP_SSE)
+    int sse_mode;
+    STREFLOP_STMXCSR(sse_mode);
+#if defined(STREFLOP_NO_DENORMALS)
+    sse_mode &= 0xFFFF7FBF; // clear DAZ and FTZ
+#else
+    sse_mode |= 0x8040; // set DAZ and FTZ
+#endif
+    STREFLOP_LDMXCSR(sse_mode);
+#endif
+}
+
+static void checkForeignMode() {
+    streflop_init<Double>();
+    STREFLOP_FSTCW(x87Double);
+    foreignCode();
+    STREFLOP_FSTCW(x87Foreign);
+    check("foreign code changed the x87 word", x87Foreign != x87Double);
+#if defined(STREFLOP_SSE)
+    streflop_init<Double>();
+    STREFLOP_STMXCSR(sseDouble);
+    foreignCode();
+    STREFLOP_STMXCSR(sseForeign);
+    check("foreign code changed the SSE control bits", (sseForeign & 0xFFC0) != (sseDouble & 0xFFC0));
+#endif
+
+    {
+        FPUScope<Double> scope;
+        unsigned short x87_mode;
+        STREFLOP_FSTCW(x87_mode);
+        check("FPUScope sets the x87 word after foreign code", x87_mode == x87Double);
+#if defined(STREFLOP_SSE)
+        int sse_mode;
+        STREFLOP_STMXCSR(sse_mode);
+        check("FPUScope sets the SSE control bits after foreign code", (sse_mode & 0xFFC0) == (sseDouble & 0xFFC0));
+#endif
+        // Changed again inside the scope
+        fesetround(FE_UPWARD);
+    }
+    unsigned short x87_mode;
+    STREFLOP_FSTCW(x87_mode);
+    check("FPUScope restores the foreign x87 word", x87_mode == x87Foreign);
+#if defined(STREFLOP_SSE)
+    int sse_mode;
+    STREFLOP_STMXCSR(sse_mode);
+    check("FPUScope restores the foreign SSE control bits", (sse_mode & 0xFFC0) == (sseForeign & 0xFFC0));
+#endif
+}
+
+static NOINLINE Double callbackInit(Double x) {
+    streflop_init<Double>();
+    return x * Double(0.999999) + Double(1.0);
+}
+
+static NOINLINE Double callbackScope(Double x) {
+    FPUScope<Double> scope;
+    return x * Double(0.999999) + Double(1.0);
+}
+
+static void timings() {
+    const int N = 10000000;
+    streflop_init<Double>();
+    Double acc = 0.0;
+    clock_t start = clock();
+    for (int i=0; i<N; ++i) acc = callbackInit(acc);
+    clock_t stop = clock();
+    cout << "streflop_init each call: " << (stop - start) * 1e9 / CLOCKS_PER_SEC / N << " ns per call (" << (double)acc << ")" << endl;
+    acc = 0.0;
+    start = clock();
+    for (int i=0; i<N; ++i) acc = callbackScope(acc);
+    stop = clock();
+    cout << "FPUScope, mode already set: " << (stop - start) * 1e9 / CLOCKS_PER_SEC / N << " ns per call (" << (double)acc << ")" << endl;
+}
+
+int main(int argc, const char** argv) {
+    checkForeignMode();
+    timings();
+    if (failures) return 1;
+    cout << "All checks passed" << endl;
+    return 0;
+}
+
+#else
+
+int main(int argc, const char** argv) {
+    cout << "FPUScope has nothing to set up with SoftFloat" << endl;
+    return 0;
+}
+
+#endif
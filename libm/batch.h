@@ -0,0 +1,115 @@
+/* batch.h -- written for streflop.
+ * Vector types and helpers for the packed kernels of the batch functions,
+ * e_exp_batch.c, e_log_batch.c and s_sin_batch.c for double, e_expf_batch.c,
+ * e_logf_batch.c and s_sinf_batch.c for float. Each kernel does the very
+ * operations of the scalar function, in the same order, on all the lanes of
+ * a vector: IEEE754 rounds each lane as it rounds the scalar operation, so
+ * the results are the same bit for bit. The comparisons of the branches give
+ * masks, and the results of the branches are selected lane by lane. The
+ * table lookups and their indices are done lane by lane, in a loop. A lane
+ * that takes a branch the kernel does not handle, or whose result fails the
+ * accuracy check of the scalar code, is recomputed by the scalar function.
+ * The files must be compiled without contraction of the multiplications and
+ * additions into fused multiply-adds, -ffp-contract=off with GCC, as the
+ * scalar code is. The floating-point exception flags may be raised by lanes
+ * that the scalar code would not compute.
+ */
+
+#ifndef STREFLOP_LIBM_BATCH_H
+#define STREFLOP_LIBM_BATCH_H
+
+#ifdef STREFLOP_BATCH_PACKED
+
+/* 256-bit vectors of double when the library is compiled for AVX, 128-bit
+   otherwise. The float kernels are mostly integer operations on the bits,
+   AVX has them on 128-bit vectors only, so 256-bit vectors of float need AVX2 */
+#ifdef __AVX__
+#define DBATCH_BYTES 32
+#else
+#define DBATCH_BYTES 16
+#endif
+#ifdef __AVX2__
+#define FBATCH_BYTES 32
+#else
+#define FBATCH_BYTES 16
+#endif
+#define DLANES (DBATCH_BYTES / 8)
+#define FLANES (FBATCH_BYTES / 4)
+
+typedef double vdouble __attribute__ ((vector_size (DBATCH_BYTES)));
+typedef float vfloat __attribute__ ((vector_size (FBATCH_BYTES)));
+typedef int32_t vint __attribute__ ((vector_size (FBATCH_BYTES)));
+/* The types of the comparison results, 64-bit and 32-bit integers */
+typedef __typeof__ ((vdouble) {0} < (vdouble) {0}) vdmask;
+typedef __typeof__ ((vfloat) {0} < (vfloat) {0}) vfmask;
+
+static inline vdouble
+vd_load (const double *p)
+{
+  vdouble v;
+  __builtin_memcpy (&v, p, sizeof (v));
+  return v;
+}
+
+static inline void
+vd_store (double *p, vdouble v)
+{
+  __builtin_memcpy (p, &v, sizeof (v));
+}
+
+static inline vfloat
+vf_load (const float *p)
+{
+  vfloat v;
+  __builtin_memcpy (&v, p, sizeof (v));
+  return v;
+}
+
+static inline void
+vf_store (float *p, vfloat v)
+{
+  __builtin_memcpy (p, &v, sizeof (v));
+}
+
+/* m ? a : b, lane by lane. m has all bits set or none in each lane */
+static inline vdouble
+vd_select (vdmask m, vdouble a, vdouble b)
+{
+  return (vdouble) (((vdmask) a & m) | ((vdmask) b & ~m));
+}
+
+static inline vfloat
+vf_select (vfmask m, vfloat a, vfloat b)
+{
+  return (vfloat) (((vfmask) a & m) | ((vfmask) b & ~m));
+}
+
+static inline vint
+vi_select (vfmask m, vint a, vint b)
+{
+  return (a & m) | (b & ~m);
+}
+
+static inline int
+vd_any (vdmask m)
+{
+  int l;
+  for (l = 0; l < DLANES; l++)
+    if (m[l])
+      return 1;
+  return 0;
+}
+
+static inline int
+vf_any (vfmask m)
+{
+  int l;
+  for (l = 0; l < FLANES; l++)
+    if (m[l])
+      return 1;
+  return 0;
+}
+
+#endif
+
+#endif
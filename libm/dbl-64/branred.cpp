@@ -47,6 +47,7 @@
 /* Routine return integer (n mod 4)                                */
 /*******************************************************************/
 namespace streflop_libm {
+int __branred_head(Double x, Double r[6], Double *sum);
 int __branred(Double x, Double *a, Double *aa)
 {
   int i,k;
@@ -64,6 +65,9 @@ int __branred(Double x, Double *a, Double *aa)
   x1=t-(t-x);
   x2=x-x1;
   sum=0;
+#if defined(STREFLOP_INTEGER_RANGE_REDUCTION) && defined(STREFLOP_SOFT)
+  if (!__branred_head(x1,r,&sum)) {
+#endif
   u.x() = x1;
   k = (u.i[HIGH_HALF]>>20)&2047;
   k = (k-450)/24;
@@ -78,6 +82,9 @@ int __branred(Double x, Double *a, Double *aa)
     sum+=s;
     r[i]-=s;
   }
+#if defined(STREFLOP_INTEGER_RANGE_REDUCTION) && defined(STREFLOP_SOFT)
+  }
+#endif
   t=0;
   for (i=0;i<6;i++)
     t+=r[5-i];
@@ -94,6 +101,9 @@ int __branred(Double x, Double *a, Double *aa)
   sum1=sum;
   sum=0;
 
+#if defined(STREFLOP_INTEGER_RANGE_REDUCTION) && defined(STREFLOP_SOFT)
+  if (!__branred_head(x2,r,&sum)) {
+#endif
   u.x() = x2;
   k = (u.i[HIGH_HALF]>>20)&2047;
   k = (k-450)/24;
@@ -108,6 +118,9 @@ int __branred(Double x, Double *a, Double *aa)
     sum+=s;
     r[i]-=s;
   }
+#if defined(STREFLOP_INTEGER_RANGE_REDUCTION) && defined(STREFLOP_SOFT)
+  }
+#endif
   t=0;
   for (i=0;i<6;i++)
     t+=r[5-i];
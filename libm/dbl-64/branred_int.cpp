@@ -0,0 +1,136 @@
+/* See the import.pl script for potential modifications */
+/* branred_int.c -- written for streflop.
+ * __branred multiplies the two halves of its argument by 24-bit chunks of
+ * 2/pi, and removes the integer parts of the first products. These first
+ * steps are exact, so with STREFLOP_INTEGER_RANGE_REDUCTION and STREFLOP_SOFT
+ * defined they are done here with 64-bit integers, from the bits of the
+ * doubles, and give the same doubles. With hardware floating point each exact
+ * product is a single instruction, faster than its integer normalization, so
+ * the original code is kept there. The steps that round come after and are
+ * left in floating point, so the reduced argument is bit-identical. The
+ * integer removal by the big constant rounds to nearest: in another rounding
+ * mode, and for any argument not expected here, __branred_head returns 0 and
+ * the original code is used. import.pl inserts the calls in branred.cpp.
+ */
+
+#include "endian.h"
+#include "mydefs.h"
+#include "branred.h"
+#include "math_private.h"
+
+namespace streflop_libm {
+int __branred_head(Double x, Double r[6], Double *sum);
+
+#if defined(STREFLOP_INTEGER_RANGE_REDUCTION) && defined(STREFLOP_SOFT)
+
+/* The chunk i of 2/pi, an integer below 2^24 */
+static inline unsigned long long
+chunk (int i)
+{
+  u_int64_t ix;
+
+  EXTRACT_WORDS64 (ix, toverp[i]);
+  return ((ix & 0xfffffffffffffULL) | (1ULL << 52)) >> (1075 - (int) (ix >> 52));
+}
+
+/* The Double (-1)^sign*m*2^e, exact for m < 2^53 and a normal result, +0 for m = 0 */
+static inline Double
+make_double (u_int64_t m, int sign, int e)
+{
+  Double d;
+  int n;
+
+#ifdef __GNUC__
+  n = 63 - __builtin_clzll (m | 1);
+#else
+  for (n = 0; (m >> (n + 1)) != 0; n++)
+    ;
+#endif
+  INSERT_WORDS64 (d, (((u_int64_t) sign << 63) | ((u_int64_t) (1023 + n + e) << 52)
+		      | ((m << (52 - n)) & 0xfffffffffffffULL)) & -(u_int64_t) (m != 0));
+  return d;
+}
+
+/* x is one half of the scaled argument of __branred, x1 or x2. Sets r[] and
+   sum as the code of __branred does before adding the r[i] together */
+int
+__branred_head (Double x, Double r[6], Double *sum)
+{
+  u_int64_t ix, m, p, q, half, s;
+  long long f, fs;
+  int i, k, e, sh, l, rs, neg;
+
+  if (fegetround () != FE_TONEAREST)
+    return 0;
+
+  EXTRACT_WORDS64 (ix, x);
+  neg = (int) (ix >> 63);
+  e = (int) (ix >> 52) & 0x7ff;
+  m = ix & 0xfffffffffffffULL;
+  if (e == 0)
+    {
+      /* x2 is +0 when x has at most 26 significant bits */
+      if (m != 0 || neg)
+	return 0;
+      for (i = 0; i < 6; i++)
+	r[i] = make_double (0, 0, 0);
+      *sum = make_double (0, 0, 0);
+      return 1;
+    }
+  k = (e - 450) / 24;
+  if (k < 0)
+    k = 0;
+
+  /* x = m*2^(e-1075). Without its trailing zeros, m has at most 27 bits
+     after the split of __branred, and the products are below 2^51 */
+  m |= 1ULL << 52;
+#ifdef __GNUC__
+  i = __builtin_ctzll (m);
+#else
+  for (i = 0; ((m >> i) & 1) == 0; i++)
+    ;
+#endif
+  m >>= i;
+  e += i;
+  if (m >> 27)
+    return 0;
+
+  s = 0;
+  for (i = 0; i < 6; i++)
+    {
+      /* r[i] = p*2^sh */
+      p = m * chunk (k + i);
+      sh = e - 1075 + 576 - 24 * (k + i);
+      if (i >= 3)
+	{
+	  r[i] = make_double (p, neg, sh);
+	  continue;
+	}
+      /* Remove the nearest integer q, ties to even as (r[i]+big)-big. The
+	 rounding is not predictable, so there is no branch: p is shifted
+	 left by l, or rounded right by rs, at most 63 where q is 0 */
+      l = (sh > 0) ? sh : 0;
+      rs = (sh < 0) ? ((sh > -63) ? -sh : 63) : 0;
+      p <<= l;
+      half = (1ULL << rs) >> 1;
+      q = (p + half) >> rs;
+      q -= q & 1 & ((p & ((1ULL << rs) - 1)) == half) & (rs != 0);
+      f = (long long) (p - (q << rs));
+      fs = f >> 63;
+      s += q;
+      r[i] = make_double ((u_int64_t) ((f ^ fs) - fs), neg ^ (int) (fs & 1), sh - l);
+    }
+  *sum = make_double (s, neg, 0);
+  return 1;
+}
+
+#else
+
+int
+__branred_head (Double x, Double r[6], Double *sum)
+{
+  return 0;
+}
+
+#endif
+}
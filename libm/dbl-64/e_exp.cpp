@@ -48,6 +48,7 @@ Double __slowexp(Double);
 /* it computes the correctly rounded (to nearest) value of e^x             */
 /***************************************************************************/
 namespace streflop_libm {
+#ifndef STREFLOP_TABLE_EXPLOG
 Double __ieee754_exp(Double x) {
   Double bexp, t, eps, del, base, y, al, bet, res, rem, cor;
   mynumber junk1, junk2, binexp  = {{0,0}};
@@ -147,6 +148,7 @@ Double __ieee754_exp(Double x) {
     else return __slowexp(x);
   }
 }
+#endif
 
 /************************************************************************/
 /* Compute e^(x+xx)(Double-Length number) .The routine also receive     */
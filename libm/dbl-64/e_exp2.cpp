@@ -47,6 +47,7 @@ static const Double TWO1023 = 8.988465674311579539e+307;
 static const Double TWOM1000 = 9.3326361850321887899e-302;
 
 namespace streflop_libm {
+#ifndef STREFLOP_TABLE_EXPLOG
 Double
 __ieee754_exp2 (Double x)
 {
@@ -135,4 +136,5 @@ __ieee754_exp2 (Double x)
     /* Return x, if x is a NaN or Inf; or overflow, otherwise.  */
     return TWO1023*x;
 }
+#endif
 }
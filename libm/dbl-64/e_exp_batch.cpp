@@ -0,0 +1,103 @@
+/* See the import.pl script for potential modifications */
+/* e_exp_batch.c -- written for streflop.
+ * Packed version of the main branch of __ieee754_exp in e_exp.c, for the
+ * arguments with 2^-54 < |x| < 708.39, see batch.h. The other arguments,
+ * and the results that fail the accuracy check of e_exp.c and would go to
+ * __slowexp, are computed by __ieee754_exp. The tables of uexp.tbl are
+ * static, this file has its own copy. With STREFLOP_TABLE_EXPLOG, or
+ * without AVX, the batch exp calls the scalar function.
+ */
+
+#include "endian.h"
+#include "uexp.h"
+#include "mydefs.h"
+#include "MathLib.h"
+#include "uexp.tbl"
+#include "math_private.h"
+#include "batch.h"
+
+namespace streflop_libm {
+void __exp_batch(const Double *in, Double *out, size_t n);
+
+/* e_exp_tbl.c replaces __ieee754_exp with STREFLOP_TABLE_EXPLOG, and two lanes
+   are not faster than the scalar calls */
+#if defined(STREFLOP_BATCH_PACKED) && !defined(STREFLOP_TABLE_EXPLOG) && DLANES > 2
+
+/* The result for the lanes where the returned mask is set */
+static inline vdmask
+exp_lanes (vdouble x, vdouble *r)
+{
+  vdouble bexp, t, eps, del, base, y, y2, al, bet, res, rem, cor;
+  vdouble c0, c1, f0, f1, binexp;
+  vdmask ok;
+  mynumber junk2;
+  Double g[4][DLANES];
+  int4 i,j,l;
+
+  /* smallint < n < bigint for the high word n of |x|, as doubles */
+  y = (vdouble) ((vdmask) x & 0x7fffffffffffffffLL);
+  ok = (y >= (vdouble) ((vdmask) {0} + ((long long) (smallint + 1) << 32)))
+       & (y < (vdouble) ((vdmask) {0} + ((long long) bigint << 32)));
+  x = vd_select (ok, x, (vdouble) {0} + one);	/* in range for the tables */
+
+  y = x*log2e.x() + three51.x();
+  bexp = y - three51.x();      /*  multiply the result by 2**bexp        */
+
+  eps = bexp*ln_two2.x();      /* x = bexp*ln(2) + t - eps               */
+  t = x - bexp*ln_two1.x();
+
+  y2 = t + three33.x();
+  base = y2 - three33.x();      /* t rounded to a multiple of 2**-18      */
+  del = (t - base) - eps;    /*  x = bexp*ln(2) + base + del           */
+  eps = del + del*del*(p3.x()*del + p2.x());
+
+  /* The high word (low word of y + 1023) << 20, the low word 0: the shift
+     drops the other bits of y */
+  binexp = (vdouble) (((vdmask) y + 1023) << 52);
+
+  for (l = 0; l < DLANES; l++)
+    {
+      junk2.x() = y2[l];
+      i = ((junk2.i[LOW_HALF]>>8)&0xfffffffe)+356;
+      j = (junk2.i[LOW_HALF]&511)<<1;
+      g[0][l] = coar.x(i);
+      g[1][l] = coar.x(i+1);
+      g[2][l] = fine.x(j);
+      g[3][l] = fine.x(j+1);
+    }
+  c0 = vd_load (g[0]);
+  c1 = vd_load (g[1]);
+  f0 = vd_load (g[2]);
+  f1 = vd_load (g[3]);
+
+  al = c0*f0;
+  bet =(c0*f1 + c1*f0) + c1*f1;
+
+  rem=(bet + bet*eps)+al*eps;
+  res = al + rem;
+  cor = (al - res) + rem;
+  *r = res*binexp;
+  return ok & (res == (res+cor*err_0));
+}
+
+void
+__exp_batch(const Double *in, Double *out, size_t n)
+{
+  size_t i;
+  int l;
+
+  for (i = 0; i + DLANES <= n; i += DLANES)
+    {
+      vdouble x = vd_load (in + i), res;
+      vdmask ok = exp_lanes (x, &res);
+      vd_store (out + i, res);
+      for (l = 0; l < DLANES; l++)
+	if (!ok[l])
+	  out[i + l] = __ieee754_exp (x[l]);
+    }
+  for (; i < n; i++)
+    out[i] = __ieee754_exp (in[i]);
+}
+
+#endif
+}
@@ -49,6 +49,7 @@ void __mplog(mp_no *, mp_no *, int);
 /* An ultimate log routine. Given an IEEE Double machine number x     */
 /* it computes the correctly rounded (to nearest) value of log(x).   */
 /*********************************************************************/
+#ifndef STREFLOP_TABLE_EXPLOG
 Double __ieee754_log(Double x) {
 #define M 4
   static const int pr[M]={8,10,18,32};
@@ -203,4 +204,5 @@ Double __ieee754_log(Double x) {
   }
   return y1;
 }
+#endif
 }
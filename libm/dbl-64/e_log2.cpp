@@ -80,6 +80,7 @@ static const Double zero   =  0.0;
 static Double zero   =  0.0;
 #endif
 
+#ifndef STREFLOP_TABLE_EXPLOG
 #ifdef __STDC__
 	Double __ieee754_log2(Double x)
 #else
@@ -130,4 +131,5 @@ static Double zero   =  0.0;
 	    return dk-((s*(f-R))-f)/ln2;
 	}
 }
+#endif
 }
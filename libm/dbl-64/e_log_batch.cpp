@@ -0,0 +1,161 @@
+/* See the import.pl script for potential modifications */
+/* e_log_batch.c -- written for streflop.
+ * Packed version of the first stage of __ieee754_log in e_log.c, for the
+ * positive normal arguments, see batch.h. Both cases of the first stage are
+ * done, |x-1| <= 0.03 with polynomial II and the others with the tables.
+ * The other arguments, and the results that fail the accuracy check of the
+ * first stage, are computed by __ieee754_log. The tables of ulog.tbl are
+ * static, this file has its own copy. With STREFLOP_TABLE_EXPLOG, or
+ * without AVX, the batch log calls the scalar function.
+ */
+
+#include "endian.h"
+#include "dla.h"
+#include "mpa.h"
+#include "MathLib.h"
+#include "math_private.h"
+#include "batch.h"
+
+namespace streflop_libm {
+void __log_batch(const Double *in, Double *out, size_t n);
+
+/* e_log_tbl.c replaces __ieee754_log with STREFLOP_TABLE_EXPLOG, and two lanes
+   are not faster than the scalar calls */
+#if defined(STREFLOP_BATCH_PACKED) && !defined(STREFLOP_TABLE_EXPLOG) && DLANES > 2
+
+#define M 4
+#include "ulog.tbl"
+#include "ulog.h"
+
+/* ABS of mydefs.h, lane by lane */
+static inline vdouble
+vd_abs (vdouble x)
+{
+  return vd_select (x > 0, x, -x);
+}
+
+/* EADD of dla.h */
+static inline void
+vd_eadd (vdouble x, vdouble y, vdouble *z, vdouble *zz)
+{
+  *z = x + y;
+  *zz = vd_select (vd_abs (x) > vd_abs (y), (x - *z) + y, (y - *z) + x);
+}
+
+/* The result for the lanes where the returned mask is set */
+static inline vdmask
+log_lanes (vdouble x, vdouble *r)
+{
+  vdouble dbl_n,u,p0,q,r0,w,nln2a,luai,lubi,lvaj,lvbj,
+	  sij,ssij,ttij,A,B,B0,y,polI,polII,
+	  t8,a,aa,b,bb,c,p,hx,tx,hy,ty,di,dj,iu,iv;
+  vdmask ux, ok, near, far, gt, n, vi, vj;
+  Double g[5][DLANES];
+  int i,j,l;
+
+  ux = (vdmask) x >> 32;
+  ok = (ux >= 0x00100000) & (ux < 0x7ff00000);	/* positive normal */
+  *r = x;
+  x = vd_select (ok, x, (vdouble) {0} + ONE);
+
+  w = x-ONE;
+  far = vd_abs (w) > U03;
+  near = ok & ~far;
+  far &= ok;
+
+  /*--- Stage I, the case abs(x-1) < 0.03 */
+  if (vd_any (near))
+    {
+      t8 = MHALF*w;
+      /* EMULV(t8,w,a,aa,p,hx,tx,hy,ty) */
+      p=CN*t8;  hx=(t8-p)+p;  tx=t8-hx;
+      p=CN*w;  hy=(w-p)+p;  ty=w-hy;
+      a=t8*w; aa=(((hx*hy-a)+hx*ty)+tx*hy)+tx*ty;
+      vd_eadd (w, a, &b, &bb);
+
+      /* Evaluate polynomial II */
+      polII = (b0.d()+w*(b1.d()+w*(b2.d()+w*(b3.d()+w*(b4.d()+
+	      w*(b5.d()+w*(b6.d()+w*(b7.d()+w*b8.d()))))))))*w*w*w;
+      c = (aa+bb)+polII;
+
+      y = b+(c+b*E2);
+      *r = vd_select (near, y, *r);
+      near &= (y == b+(c-b*E2));
+    }
+
+  /*--- Stage I, the case abs(x-1) > 0.03 */
+  if (vd_any (far))
+    {
+      x = vd_select (far, x, (vdouble) {0} + 2.0);
+
+      /* Find n,u such that x = u*2**n,   1/sqrt(2) < u < sqrt(2)  */
+      n = (((vdmask) x >> 32) >> 20) - 1023;
+      u = (vdouble) (((vdmask) x & 0x000fffffffffffffLL) | 0x3ff0000000000000LL);
+      gt = u > SQRT_2;
+      u = vd_select (gt, u*HALF, u);  n -= gt;
+      dbl_n = __builtin_convertvector (n, vdouble);
+
+      /* Find i such that ui=1+(i-75)/2**8 is closest to u (i= 0,1,2,...,181) */
+      vi = (((vdmask) (u + h1.d()) >> 32) & 0x000fffff) >> 12;
+      for (l = 0; l < DLANES; l++)
+	g[0][l] = Iu[vi[l]].d();
+      iu = vd_load (g[0]);
+
+      /* Find j such that vj=1+(j-180)/2**16 is closest to v=u/ui (j= 0,...,361) */
+      vj = (((vdmask) (u*iu + h2.d()) >> 32) & 0x000fffff) >> 4;
+      for (l = 0; l < DLANES; l++)
+	{
+	  i = vi[l];  j = vj[l];
+	  g[0][l] = Iv[j].d();
+	  g[1][l] = Lu[i][0].d();  g[2][l] = Lu[i][1].d();
+	  g[3][l] = Lv[j][0].d();  g[4][l] = Lv[j][1].d();
+	}
+      iv = vd_load (g[0]);
+      luai = vd_load (g[1]);  lubi = vd_load (g[2]);
+      lvaj = vd_load (g[3]);  lvbj = vd_load (g[4]);
+      di = __builtin_convertvector (vi - 75, vdouble);
+      dj = __builtin_convertvector (vj - 180, vdouble);
+
+      /* Compute w=(u-ui*vj)/(ui*vj) */
+      p0=(ONE+di*DEL_U)*(ONE+dj*DEL_V);
+      q=u-p0;   r0=iu*iv;   w=q*r0;
+
+      /* Evaluate polynomial I */
+      polI = w+(a2.d()+a3.d()*w)*w*w;
+
+      /* Add up everything */
+      nln2a = dbl_n*LN2A;
+      vd_eadd (luai, lvaj, &sij, &ssij);
+      vd_eadd (nln2a, sij, &A, &ttij);
+      B0 = (((lubi+lvbj)+ssij)+ttij)+dbl_n*LN2B;
+      B  = polI+B0;
+
+      y = A+(B+E1);
+      *r = vd_select (far, y, *r);
+      far &= (y == A+(B-E1));
+    }
+
+  return near | far;
+}
+
+void
+__log_batch(const Double *in, Double *out, size_t n)
+{
+  size_t i;
+  int l;
+
+  for (i = 0; i + DLANES <= n; i += DLANES)
+    {
+      vdouble x = vd_load (in + i), res;
+      vdmask ok = log_lanes (x, &res);
+      vd_store (out + i, res);
+      for (l = 0; l < DLANES; l++)
+	if (!ok[l])
+	  out[i + l] = __ieee754_log (x[l]);
+    }
+  for (; i < n; i++)
+    out[i] = __ieee754_log (in[i]);
+}
+
+#endif
+}
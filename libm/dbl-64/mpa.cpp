@@ -66,7 +66,7 @@ static int mcr(const mp_no *x, const mp_no *y, int p) {
 
 
 /* acr() compares the absolute values of two multiple precision numbers */
-int __acr(const mp_no *x, const mp_no *y, int p) {
+int __acr_fp(const mp_no *x, const mp_no *y, int p) {
   int i;
 
   if      (X[0] == ZERO) {
@@ -255,6 +255,10 @@ void __dbl_mp(Double x, mp_no *y, int p) {
   int i,n;
   Double u;
 
+#ifdef STREFLOP_SLOWPATH_STATS
+  ++streflop::slowpath_mp_calls;
+#endif
+
   /* Sign */
   if      (x == ZERO)  {Y[0] = ZERO;  return; }
   else if (x >  ZERO)   Y[0] = ONE;
@@ -379,7 +383,7 @@ static void sub_magnitudes(const mp_no *x, const mp_no *y, mp_no *z, int p) {
 /* but not x&z or y&z. One guard digit is used. The error is less than    */
 /* one ulp. *x & *y are left unchanged.                                   */
 
-void __add(const mp_no *x, const mp_no *y, mp_no *z, int p) {
+void __add_fp(const mp_no *x, const mp_no *y, mp_no *z, int p) {
 
   int n;
 
@@ -403,7 +407,7 @@ void __add(const mp_no *x, const mp_no *y, mp_no *z, int p) {
 /* overlap but not x&z or y&z. One guard digit is used. The error is      */
 /* less than one ulp. *x & *y are left unchanged.                         */
 
-void __sub(const mp_no *x, const mp_no *y, mp_no *z, int p) {
+void __sub_fp(const mp_no *x, const mp_no *y, mp_no *z, int p) {
 
   int n;
 
@@ -428,7 +432,7 @@ void __sub(const mp_no *x, const mp_no *y, mp_no *z, int p) {
 /* truncated to p digits. In case p>3 the error is bounded by 1.001 ulp.   */
 /* *x & *y are left unchanged.                                             */
 
-void __mul(const mp_no *x, const mp_no *y, mp_no *z, int p) {
+void __mul_fp(const mp_no *x, const mp_no *y, mp_no *z, int p) {
 
   int i, i1, i2, j, k, k2;
   Double u;
@@ -61,12 +61,12 @@ inline const Double& d(int idx) const {return mantissa[idx];}
 typedef struct {
 inline Double& d() {return DOUBLE_FROM_INT_PTR(&i[0]);}
 inline Double& x() {return DOUBLE_FROM_INT_PTR(&i[0]);}
-inline Double& d(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
-inline Double& x(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
+inline Double& d(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
+inline Double& x(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
 inline const Double& d() const {return CONST_DOUBLE_FROM_INT_PTR(&i[0]);}
 inline const Double& x() const {return CONST_DOUBLE_FROM_INT_PTR(&i[0]);}
-inline const Double& d(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
-inline const Double& x(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
+inline const Double& d(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
+inline const Double& x(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
  int i[2];} number;
 
 #define  X   x->mantissa
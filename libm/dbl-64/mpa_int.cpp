@@ -0,0 +1,464 @@
+/* See the import.pl script for potential modifications */
+/* mpa_int.c -- written for streflop.
+ * The digits of the multi-precision numbers of mpa.c are integers below 2^24
+ * held in doubles, and the sums and products of digits are exact. So __add,
+ * __sub and __mul get the same digits with integer arithmetic. With
+ * STREFLOP_MP_INTEGER and STREFLOP_SOFT defined, the digits are read from
+ * the bits of the doubles into 64-bit integers, combined, and written back
+ * the same way: there is no floating-point operation at all, where each one
+ * would be a SoftFloat call. With hardware floating point a digit operation
+ * is a single instruction, faster than reading and writing the bits, so the
+ * original code is kept there. The mp_no layout is unchanged, so the
+ * functions using it and the results are the same. import.pl renames the
+ * original functions to *_fp.
+ */
+
+#include "endian.h"
+#include "mpa.h"
+#include "math_private.h"
+
+namespace streflop_libm {
+int __acr_fp(const mp_no *x, const mp_no *y, int p);
+void __add_fp(const mp_no *x, const mp_no *y, mp_no *z, int p);
+void __sub_fp(const mp_no *x, const mp_no *y, mp_no *z, int p);
+void __mul_fp(const mp_no *x, const mp_no *y, mp_no *z, int p);
+
+#if defined(STREFLOP_MP_INTEGER) && defined(STREFLOP_SOFT)
+
+#define RADIX_INT 16777216LL
+
+/* The digits 1..p, and the sign as -1, 0 or 1. Not named d, which import.pl
+   takes for a union field */
+typedef struct
+{
+  int s;
+  long long m[41];
+} mp_digits;
+
+/* Value of a digit, an integer below 2^53, from the bits of its Double */
+static inline long long
+digit_get (Double x)
+{
+  u_int32_t hx, lx;
+  int e;
+
+  EXTRACT_WORDS (hx, lx, x);
+  e = (hx >> 20) & 0x7ff;
+  if (e == 0)
+    return 0;
+  return (long long) (((((u_int64_t) (hx & 0xfffff) | 0x100000) << 32) | lx) >> (1075 - e));
+}
+
+/* The Double of a digit, exact */
+static inline void
+digit_set (Double *x, long long v)
+{
+  u_int64_t m;
+  int n;
+
+  if (v == 0)
+    {
+      INSERT_WORDS (*x, 0, 0);
+      return;
+    }
+#ifdef __GNUC__
+  n = 63 - __builtin_clzll ((unsigned long long) v);
+#else
+  for (n = 0; (v >> (n + 1)) != 0; n++)
+    ;
+#endif
+  m = (u_int64_t) v << (52 - n);
+  INSERT_WORDS (*x, ((u_int32_t) (1023 + n) << 20) | ((u_int32_t) (m >> 32) & 0xfffff), (u_int32_t) m);
+}
+
+static inline int
+sign_get (Double x)
+{
+  u_int32_t hx, lx;
+
+  EXTRACT_WORDS (hx, lx, x);
+  if (((hx & 0x7fffffff) | lx) == 0)
+    return 0;
+  return (hx & 0x80000000) ? -1 : 1;
+}
+
+static inline void
+sign_set (Double *x, int s)
+{
+  INSERT_WORDS (*x, (s == 0) ? 0 : ((s > 0) ? 0x3ff00000 : 0xbff00000), 0);
+}
+
+static void
+load (const mp_no *x, mp_digits *a, int p)
+{
+  int i;
+
+  a->s = sign_get (X[0]);
+  for (i = 1; i <= p; i++)
+    a->m[i] = digit_get (X[i]);
+}
+
+/* Digits first..last of z */
+static void
+store (const long long *d, mp_no *z, int first, int last)
+{
+  int i;
+
+  for (i = first; i <= last; i++)
+    digit_set (&Z[i], d[i]);
+}
+
+static int
+mcr (const long long *x, const long long *y, int p)
+{
+  int i;
+
+  for (i = 1; i <= p; i++)
+    {
+      if (x[i] == y[i])
+	continue;
+      else if (x[i] > y[i])
+	return 1;
+      else
+	return -1;
+    }
+  return 0;
+}
+
+static int
+acr (const mp_no *x, const mp_digits *a, const mp_no *y, const mp_digits *b, int p)
+{
+  if (a->s == 0)
+    return (b->s == 0) ? 0 : -1;
+  if (b->s == 0)
+    return 1;
+  if (EX > EY)
+    return 1;
+  if (EX < EY)
+    return -1;
+  return mcr (a->m, b->m, p);
+}
+
+/* The same steps as in mpa.c: abs(*x) >= abs(*y) > 0, the sign of *z is not set */
+static void
+add_magnitudes (const mp_no *x, const long long *xd, const mp_no *y, const long long *yd, mp_no *z, int p)
+{
+  long long zd[42];
+  int i, j, k, e;
+
+  e = EX;
+  i = p;
+  j = p + EY - EX;
+  k = p + 1;
+
+  if (j < 1)
+    {
+      __cpy (x, z, p);
+      return;
+    }
+  zd[k] = 0;
+
+  for (; j > 0; i--, j--)
+    {
+      zd[k] += xd[i] + yd[j];
+      if (zd[k] >= RADIX_INT)
+	{
+	  zd[k] -= RADIX_INT;
+	  zd[--k] = 1;
+	}
+      else
+	zd[--k] = 0;
+    }
+
+  for (; i > 0; i--)
+    {
+      zd[k] += xd[i];
+      if (zd[k] >= RADIX_INT)
+	{
+	  zd[k] -= RADIX_INT;
+	  zd[--k] = 1;
+	}
+      else
+	zd[--k] = 0;
+    }
+
+  if (zd[1] == 0)
+    {
+      for (i = 1; i <= p; i++)
+	zd[i] = zd[i + 1];
+    }
+  else
+    e += 1;
+
+  EZ = e;
+  store (zd, z, 1, p + 1);
+}
+
+/* abs(*x) > abs(*y) > 0, the sign of *z is not set */
+static void
+sub_magnitudes (const mp_no *x, const long long *xd, const mp_no *y, const long long *yd, mp_no *z, int p)
+{
+  long long zd[42];
+  int i, j, k, e;
+
+  e = EX;
+
+  if (EX == EY)
+    {
+      i = j = k = p;
+      zd[k] = zd[k + 1] = 0;
+    }
+  else
+    {
+      j = EX - EY;
+      if (j > p)
+	{
+	  __cpy (x, z, p);
+	  return;
+	}
+      else
+	{
+	  i = p;
+	  j = p + 1 - j;
+	  k = p;
+	  if (yd[j] > 0)
+	    {
+	      zd[k + 1] = RADIX_INT - yd[j--];
+	      zd[k] = -1;
+	    }
+	  else
+	    {
+	      zd[k + 1] = 0;
+	      zd[k] = 0;
+	      j--;
+	    }
+	}
+    }
+
+  for (; j > 0; i--, j--)
+    {
+      zd[k] += (xd[i] - yd[j]);
+      if (zd[k] < 0)
+	{
+	  zd[k] += RADIX_INT;
+	  zd[--k] = -1;
+	}
+      else
+	zd[--k] = 0;
+    }
+
+  for (; i > 0; i--)
+    {
+      zd[k] += xd[i];
+      if (zd[k] < 0)
+	{
+	  zd[k] += RADIX_INT;
+	  zd[--k] = -1;
+	}
+      else
+	zd[--k] = 0;
+    }
+
+  for (i = 1; zd[i] == 0; i++)
+    ;
+  e = e - i + 1;
+  for (k = 1; i <= p + 1;)
+    zd[k++] = zd[i++];
+  for (; k <= p;)
+    zd[k++] = 0;
+
+  EZ = e;
+  store (zd, z, 1, p + 1);
+}
+
+int
+__acr (const mp_no *x, const mp_no *y, int p)
+{
+  mp_digits a, b;
+
+  load (x, &a, p);
+  load (y, &b, p);
+  return acr (x, &a, y, &b, p);
+}
+
+void
+__add (const mp_no *x, const mp_no *y, mp_no *z, int p)
+{
+  mp_digits a, b;
+  int n;
+
+  load (x, &a, p);
+  load (y, &b, p);
+  if (a.s == 0)
+    {
+      __cpy (y, z, p);
+      return;
+    }
+  else if (b.s == 0)
+    {
+      __cpy (x, z, p);
+      return;
+    }
+
+  if (a.s == b.s)
+    {
+      if (acr (x, &a, y, &b, p) > 0)
+	{
+	  add_magnitudes (x, a.m, y, b.m, z, p);
+	  sign_set (&Z[0], a.s);
+	}
+      else
+	{
+	  add_magnitudes (y, b.m, x, a.m, z, p);
+	  sign_set (&Z[0], b.s);
+	}
+    }
+  else
+    {
+      if ((n = acr (x, &a, y, &b, p)) == 1)
+	{
+	  sub_magnitudes (x, a.m, y, b.m, z, p);
+	  sign_set (&Z[0], a.s);
+	}
+      else if (n == -1)
+	{
+	  sub_magnitudes (y, b.m, x, a.m, z, p);
+	  sign_set (&Z[0], b.s);
+	}
+      else
+	sign_set (&Z[0], 0);
+    }
+}
+
+void
+__sub (const mp_no *x, const mp_no *y, mp_no *z, int p)
+{
+  mp_digits a, b;
+  int n;
+
+  load (x, &a, p);
+  load (y, &b, p);
+  if (a.s == 0)
+    {
+      __cpy (y, z, p);
+      Z[0] = -Z[0];
+      return;
+    }
+  else if (b.s == 0)
+    {
+      __cpy (x, z, p);
+      return;
+    }
+
+  if (a.s != b.s)
+    {
+      if (acr (x, &a, y, &b, p) > 0)
+	{
+	  add_magnitudes (x, a.m, y, b.m, z, p);
+	  sign_set (&Z[0], a.s);
+	}
+      else
+	{
+	  add_magnitudes (y, b.m, x, a.m, z, p);
+	  sign_set (&Z[0], -b.s);
+	}
+    }
+  else
+    {
+      if ((n = acr (x, &a, y, &b, p)) == 1)
+	{
+	  sub_magnitudes (x, a.m, y, b.m, z, p);
+	  sign_set (&Z[0], a.s);
+	}
+      else if (n == -1)
+	{
+	  sub_magnitudes (y, b.m, x, a.m, z, p);
+	  sign_set (&Z[0], -b.s);
+	}
+      else
+	sign_set (&Z[0], 0);
+    }
+}
+
+/* The products of two digits are below 2^48, and at most 32 of them and a
+   carry are added: the 64-bit sums are exact, as are the doubles of mpa.c */
+void
+__mul (const mp_no *x, const mp_no *y, mp_no *z, int p)
+{
+  mp_digits a, b;
+  long long zd[42], u;
+  int i, i1, i2, j, k, k2;
+
+  a.s = sign_get (X[0]);
+  b.s = sign_get (Y[0]);
+  if (a.s == 0 || b.s == 0)
+    {
+      sign_set (&Z[0], 0);
+      return;
+    }
+  load (x, &a, p);
+  load (y, &b, p);
+
+  k2 = (p < 3) ? p + p : p + 3;
+  zd[k2] = 0;
+  for (k = k2; k > 1;)
+    {
+      if (k > p)
+	{
+	  i1 = k - p;
+	  i2 = p + 1;
+	}
+      else
+	{
+	  i1 = 1;
+	  i2 = k;
+	}
+      for (i = i1, j = i2 - 1; i < i2; i++, j--)
+	zd[k] += a.m[i] * b.m[j];
+
+      u = zd[k] >> 24;
+      zd[k] -= u << 24;
+      zd[--k] = u;
+    }
+
+  if (zd[1] == 0)
+    {
+      for (i = 1; i <= p; i++)
+	zd[i] = zd[i + 1];
+      EZ = EX + EY - 1;
+    }
+  else
+    EZ = EX + EY;
+
+  store (zd, z, 1, k2);
+  sign_set (&Z[0], a.s * b.s);
+}
+
+#else
+
+int
+__acr (const mp_no *x, const mp_no *y, int p)
+{
+  return __acr_fp (x, y, p);
+}
+
+void
+__add (const mp_no *x, const mp_no *y, mp_no *z, int p)
+{
+  __add_fp (x, y, z, p);
+}
+
+void
+__sub (const mp_no *x, const mp_no *y, mp_no *z, int p)
+{
+  __sub_fp (x, y, z, p);
+}
+
+void
+__mul (const mp_no *x, const mp_no *y, mp_no *z, int p)
+{
+  __mul_fp (x, y, z, p);
+}
+
+#endif
+}
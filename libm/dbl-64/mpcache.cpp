@@ -0,0 +1,155 @@
+/* See the import.pl script for potential modifications */
+/* mpcache.c -- written for streflop.
+ * The multi-precision fallbacks of the dbl-64 functions tend to be hit again
+ * and again by the same few arguments. With STREFLOP_MP_CACHE defined, their
+ * results are kept in a small per-thread table, keyed on the bit patterns of
+ * the arguments and on the rounding mode, so the costly computation is done
+ * once per argument. The table has STREFLOP_MP_CACHE_SIZE entries, a power of
+ * 2, in sets of 2: a new argument replaces the older of the two in its set.
+ * The fallbacks are deterministic, so the cached results are bit-identical.
+ * import.pl renames the original functions to *_nocache.
+ */
+
+#include "math.h"
+
+#include "math_private.h"
+
+namespace streflop_libm {
+
+Double __mpsin_nocache(Double x, Double dx);
+Double __mpcos_nocache(Double x, Double dx);
+Double __mpsin1_nocache(Double x);
+Double __mpcos1_nocache(Double x);
+Double __slowexp_nocache(Double x);
+Double __slowpow_nocache(Double x, Double y, Double z);
+
+#ifdef STREFLOP_MP_CACHE
+
+#ifndef STREFLOP_MP_CACHE_SIZE
+#define STREFLOP_MP_CACHE_SIZE 128
+#endif
+
+enum { MP_CACHE_MPSIN = 1, MP_CACHE_MPCOS, MP_CACHE_MPSIN1, MP_CACHE_MPCOS1, MP_CACHE_SLOWEXP, MP_CACHE_SLOWPOW };
+
+/* Plain words, the wrapper types cannot be thread-local. function is 0 for an empty entry */
+typedef struct
+{
+  u_int32_t key[6];
+  u_int32_t res[2];
+  int function;
+  int round;
+} mp_cache_entry;
+
+static STREFLOP_THREAD_LOCAL mp_cache_entry mp_cache[STREFLOP_MP_CACHE_SIZE];
+
+/* Fill the key and return the set it may be in, the most recent entry first */
+static mp_cache_entry *
+mp_cache_set (int function, Double a, Double b, Double c, u_int32_t key[6])
+{
+  u_int32_t h;
+  int i;
+
+  EXTRACT_WORDS (key[0], key[1], a);
+  EXTRACT_WORDS (key[2], key[3], b);
+  EXTRACT_WORDS (key[4], key[5], c);
+  h = function;
+  for (i = 0; i < 6; i++)
+    h = (h ^ key[i]) * 0x9e3779b1;
+  return &mp_cache[((h ^ (h >> 16)) * 2) & (STREFLOP_MP_CACHE_SIZE - 2)];
+}
+
+static int
+mp_cache_match (const mp_cache_entry *e, int function, const u_int32_t key[6], int round)
+{
+  int i;
+
+  if (e->function != function || e->round != round)
+    return 0;
+  for (i = 0; i < 6; i++)
+    if (e->key[i] != key[i])
+      return 0;
+  return 1;
+}
+
+static int
+mp_cache_get (const mp_cache_entry *set, int function, const u_int32_t key[6], int round, Double *res)
+{
+  int way;
+
+  for (way = 0; way < 2; way++)
+    if (mp_cache_match (&set[way], function, key, round))
+      {
+	INSERT_WORDS (*res, set[way].res[0], set[way].res[1]);
+	return 1;
+      }
+  return 0;
+}
+
+static Double
+mp_cache_put (mp_cache_entry *set, int function, const u_int32_t key[6], int round, Double res)
+{
+  int i;
+
+  set[1] = set[0];
+  for (i = 0; i < 6; i++)
+    set[0].key[i] = key[i];
+  EXTRACT_WORDS (set[0].res[0], set[0].res[1], res);
+  set[0].function = function;
+  set[0].round = round;
+  return res;
+}
+
+/* The rounding mode is only read when the fallback is taken */
+#define MP_CACHED(function, a, b, c, call) \
+  { \
+    u_int32_t key[6]; \
+    Double res; \
+    int round = fegetround (); \
+    mp_cache_entry *set = mp_cache_set (function, a, b, c, key); \
+    if (mp_cache_get (set, function, key, round, &res)) \
+      return res; \
+    return mp_cache_put (set, function, key, round, call); \
+  }
+
+#else
+
+#define MP_CACHED(function, a, b, c, call) return call;
+
+#endif
+
+Double
+__mpsin (Double x, Double dx)
+{
+  MP_CACHED (MP_CACHE_MPSIN, x, dx, 0.0, __mpsin_nocache (x, dx))
+}
+
+Double
+__mpcos (Double x, Double dx)
+{
+  MP_CACHED (MP_CACHE_MPCOS, x, dx, 0.0, __mpcos_nocache (x, dx))
+}
+
+Double
+__mpsin1 (Double x)
+{
+  MP_CACHED (MP_CACHE_MPSIN1, x, 0.0, 0.0, __mpsin1_nocache (x))
+}
+
+Double
+__mpcos1 (Double x)
+{
+  MP_CACHED (MP_CACHE_MPCOS1, x, 0.0, 0.0, __mpcos1_nocache (x))
+}
+
+Double
+__slowexp (Double x)
+{
+  MP_CACHED (MP_CACHE_SLOWEXP, x, 0.0, 0.0, __slowexp_nocache (x))
+}
+
+Double
+__slowpow (Double x, Double y, Double z)
+{
+  MP_CACHED (MP_CACHE_SLOWPOW, x, y, z, __slowpow_nocache (x, y, z))
+}
+}
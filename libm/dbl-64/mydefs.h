@@ -33,12 +33,12 @@ typedef int int4;
 typedef struct {
 inline Double& d() {return DOUBLE_FROM_INT_PTR(&i[0]);}
 inline Double& x() {return DOUBLE_FROM_INT_PTR(&i[0]);}
-inline Double& d(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
-inline Double& x(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
+inline Double& d(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
+inline Double& x(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
 inline const Double& d() const {return CONST_DOUBLE_FROM_INT_PTR(&i[0]);}
 inline const Double& x() const {return CONST_DOUBLE_FROM_INT_PTR(&i[0]);}
-inline const Double& d(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
-inline const Double& x(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
+inline const Double& d(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
+inline const Double& x(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
 int4 i[2];} mynumber;
 
 #define ABS(x)   (((x)>0)?(x):-(x))
@@ -31,6 +31,7 @@ static const Double two52[2] =
 };
 
 
+namespace streflop_libm {
 long long int
 __llrint (Double x)
 {
@@ -97,3 +98,4 @@ weak_alias (__llrint, llrint)
 strong_alias (__llrint, __llrintl)
 weak_alias (__llrint, llrintl)
 #endif
+}
@@ -24,6 +24,7 @@
 #include "math_private.h"
 
 
+namespace streflop_libm {
 long long int
 __llround (Double x)
 {
@@ -80,3 +81,4 @@ weak_alias (__llround, llround)
 strong_alias (__llround, __llroundl)
 weak_alias (__llround, llroundl)
 #endif
+}
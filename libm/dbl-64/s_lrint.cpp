@@ -31,6 +31,7 @@ static const Double two52[2] =
 };
 
 
+namespace streflop_libm {
 long int
 __lrint (Double x)
 {
@@ -97,3 +98,4 @@ weak_alias (__lrint, lrint)
 strong_alias (__lrint, __lrintl)
 weak_alias (__lrint, lrintl)
 #endif
+}
@@ -24,6 +24,7 @@
 #include "math_private.h"
 
 
+namespace streflop_libm {
 long int
 __lround (Double x)
 {
@@ -80,3 +81,4 @@ weak_alias (__lround, lround)
 strong_alias (__lround, __lroundl)
 weak_alias (__lround, lroundl)
 #endif
+}
@@ -76,9 +76,9 @@ static Double slow2(Double x);
 static Double sloww(Double x, Double dx, Double orig);
 static Double sloww1(Double x, Double dx, Double orig);
 static Double sloww2(Double x, Double dx, Double orig, int n);
-static Double bsloww(Double x, Double dx, Double orig, int n);
-static Double bsloww1(Double x, Double dx, Double orig, int n);
-static Double bsloww2(Double x, Double dx, Double orig, int n);
+Double bsloww(Double x, Double dx, Double orig, int n);
+Double bsloww1(Double x, Double dx, Double orig, int n);
+Double bsloww2(Double x, Double dx, Double orig, int n);
 int __branred(Double x, Double *a, Double *aa);
 static Double cslow2(Double x);
 static Double csloww(Double x, Double dx, Double orig);
@@ -702,12 +702,12 @@ static Double sloww(Double x,Double dx, Double orig) {
   struct {
 inline Double& d() {return DOUBLE_FROM_INT_PTR(&i[0]);}
 inline Double& x() {return DOUBLE_FROM_INT_PTR(&i[0]);}
-inline Double& d(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
-inline Double& x(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
+inline Double& d(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
+inline Double& x(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
 inline const Double& d() const {return CONST_DOUBLE_FROM_INT_PTR(&i[0]);}
 inline const Double& x() const {return CONST_DOUBLE_FROM_INT_PTR(&i[0]);}
-inline const Double& d(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
-inline const Double& x(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
+inline const Double& d(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
+inline const Double& x(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
 int4 i[2];} v;
   int4 n;
   x1=(x+th2_36)-th2_36;
@@ -838,7 +838,7 @@ static Double sloww2(Double x, Double dx, Double orig, int n) {
 /* result.And if result not accurate enough routine calls other routines    */
 /***************************************************************************/
 
-static Double bsloww(Double x,Double dx, Double orig,int n) {
+Double bsloww(Double x,Double dx, Double orig,int n) {
   static const Double th2_36 = 206158430208.0;   /*    1.5*2**37   */
   Double y,x1,x2,xx,r,t,res,cor,w[2];
 #if 0
@@ -846,12 +846,12 @@ static Double bsloww(Double x,Double dx, Double orig,int n) {
   struct {
 inline Double& d() {return DOUBLE_FROM_INT_PTR(&i[0]);}
 inline Double& x() {return DOUBLE_FROM_INT_PTR(&i[0]);}
-inline Double& d(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
-inline Double& x(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
+inline Double& d(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
+inline Double& x(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
 inline const Double& d() const {return CONST_DOUBLE_FROM_INT_PTR(&i[0]);}
 inline const Double& x() const {return CONST_DOUBLE_FROM_INT_PTR(&i[0]);}
-inline const Double& d(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
-inline const Double& x(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
+inline const Double& d(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
+inline const Double& x(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
 int4 i[2];} v;
 #endif
   x1=(x+th2_36)-th2_36;
@@ -880,7 +880,7 @@ int4 i[2];} v;
 /* And if result not  accurate enough routine calls  other routines         */
 /***************************************************************************/
 
-static Double bsloww1(Double x, Double dx, Double orig,int n) {
+Double bsloww1(Double x, Double dx, Double orig,int n) {
 mynumber u;
  Double sn,ssn,cs,ccs,s,c,w[2],y,y1,y2,c1,c2,xx,cor,res;
  static const Double t22 = 6291456.0;
@@ -923,7 +923,7 @@ mynumber u;
 /* And if result not accurate enough routine calls  other routines          */
 /***************************************************************************/
 
-static Double bsloww2(Double x, Double dx, Double orig, int n) {
+Double bsloww2(Double x, Double dx, Double orig, int n) {
 mynumber u;
  Double sn,ssn,cs,ccs,s,c,w[2],y,y1,y2,e1,e2,xx,cor,res;
  static const Double t22 = 6291456.0;
@@ -1014,12 +1014,12 @@ static Double csloww(Double x,Double dx, Double orig) {
   struct {
 inline Double& d() {return DOUBLE_FROM_INT_PTR(&i[0]);}
 inline Double& x() {return DOUBLE_FROM_INT_PTR(&i[0]);}
-inline Double& d(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
-inline Double& x(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
+inline Double& d(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
+inline Double& x(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
 inline const Double& d() const {return CONST_DOUBLE_FROM_INT_PTR(&i[0]);}
 inline const Double& x() const {return CONST_DOUBLE_FROM_INT_PTR(&i[0]);}
-inline const Double& d(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
-inline const Double& x(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}
+inline const Double& d(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
+inline const Double& x(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}
 int4 i[2];} v;
   int4 n;
   x1=(x+th2_36)-th2_36;
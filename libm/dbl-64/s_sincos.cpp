@@ -1,4 +1,13 @@
 /* See the import.pl script for potential modifications */
+/* s_sincos.c -- s_sincos.c from the dbl-64 directory, modified for streflop.
+ * The original calls __sin and __cos, so the argument reduction is done twice.
+ * For |x| >= 2^48 this is __branred, by far the costliest part. It is done once
+ * here, and the very same slow path routines as in s_sin.c are called on the
+ * result, so the values are bit-identical to those of __sin and __cos.
+ * Below 2^48 the reduction is a few operations only, and both functions are
+ * still called.
+ */
+
 /* Compute sine and cosine of argument.
    Copyright (C) 1997, 2001, 2005 Free Software Foundation, Inc.
    This file is part of the GNU C Library.
@@ -23,8 +32,13 @@
 
 #include "math_private.h"
 
-
 namespace streflop_libm {
+int __branred(Double x, Double *a, Double *aa);
+/* In s_sin.c, made extern by import.pl */
+Double bsloww(Double x, Double dx, Double orig, int n);
+Double bsloww1(Double x, Double dx, Double orig, int n);
+Double bsloww2(Double x, Double dx, Double orig, int n);
+
 void
 __sincos (Double x, Double *sinx, Double *cosx)
 {
@@ -33,13 +47,43 @@ __sincos (Double x, Double *sinx, Double *cosx)
   /* High word of x. */
   GET_HIGH_WORD (ix, x);
 
-  /* |x| ~< pi/4 */
   ix &= 0x7fffffff;
   if (ix>=0x7ff00000)
     {
       /* sin(Inf or NaN) is NaN */
       *sinx = *cosx = x - x;
     }
+  else if (ix>=0x42F00000)
+    {
+      /* 281474976710656 <|x| <2^1024, as in __sin and __cos */
+      Double a,da;
+      int n;
+
+      n = __branred (x, &a, &da);
+      switch (n)
+	{
+	case 0:
+	  if (a*a < 0.01588) *sinx = bsloww (a, da, x, n);
+	  else *sinx = bsloww1 (a, da, x, n);
+	  *cosx = bsloww2 (a, da, x, n);
+	  break;
+	case 1:
+	  *sinx = bsloww2 (a, da, x, n);
+	  if (a*a < 0.01588) *cosx = bsloww (-a, -da, x, n);
+	  else *cosx = bsloww1 (-a, -da, x, n);
+	  break;
+	case 2:
+	  if (a*a < 0.01588) *sinx = bsloww (-a, -da, x, n);
+	  else *sinx = bsloww1 (-a, -da, x, n);
+	  *cosx = bsloww2 (a, da, x, n);
+	  break;
+	default:
+	  *sinx = bsloww2 (a, da, x, n);
+	  if (a*a < 0.01588) *cosx = bsloww (a, da, x, n);
+	  else *cosx = bsloww1 (a, da, x, n);
+	  break;
+	}
+    }
   else
     {
       *sinx = __sin (x);
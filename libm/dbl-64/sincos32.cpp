@@ -51,6 +51,8 @@
 /* Multi  Precision number x and result stored at y             */
 /****************************************************************/
 namespace streflop_libm {
+int __mpsin_dla(Double x, Double dx, Double *res);
+int __mpcos_dla(Double x, Double dx, Double *res);
 static void ss32(mp_no *x, mp_no *y, int p) {
   int i;
   Double a;
@@ -188,10 +190,13 @@ Double __cos32(Double x, Double res, Double res1) {
 /*Compute sin(x+dx) as Multi Precision number and return result as */
 /* Double                                                          */
 /*******************************************************************/
-Double __mpsin(Double x, Double dx) {
+Double __mpsin_nocache(Double x, Double dx) {
   int p;
   Double y;
   mp_no a,b,c;
+#ifdef STREFLOP_DOUBLE_LENGTH_STAGE
+  if (__mpsin_dla(x,dx,&y)) return y;
+#endif
   p=32;
   __dbl_mp(x,&a,p);
   __dbl_mp(dx,&b,p);
@@ -206,10 +211,13 @@ Double __mpsin(Double x, Double dx) {
 /* Compute cos()of Double-length number (x+dx) as Multi Precision  */
 /* number and return result as Double                              */
 /*******************************************************************/
-Double __mpcos(Double x, Double dx) {
+Double __mpcos_nocache(Double x, Double dx) {
   int p;
   Double y;
   mp_no a,b,c;
+#ifdef STREFLOP_DOUBLE_LENGTH_STAGE
+  if (__mpcos_dla(x,dx,&y)) return y;
+#endif
   p=32;
   __dbl_mp(x,&a,p);
   __dbl_mp(dx,&b,p);
@@ -277,12 +285,15 @@ int __mpranred(Double x, mp_no *y, int p)
 /* Multi-Precision sin() function subroutine, for p=32.  It is     */
 /* based on the routines mpranred() and c32().                     */
 /*******************************************************************/
-Double __mpsin1(Double x)
+Double __mpsin1_nocache(Double x)
 {
   int p;
   int n;
   mp_no u,s,c;
   Double y;
+#ifdef STREFLOP_DOUBLE_LENGTH_STAGE
+  if (__mpsin_dla(x,0,&y)) return y;
+#endif
   p=32;
   n=__mpranred(x,&u,p);               /* n is 0, 1, 2 or 3 */
   __c32(&u,&c,&s,p);
@@ -316,13 +327,16 @@ Double __mpsin1(Double x)
 /* based  on the routines mpranred() and c32().                  */
 /*****************************************************************/
 
-Double __mpcos1(Double x)
+Double __mpcos1_nocache(Double x)
 {
   int p;
   int n;
   mp_no u,s,c;
   Double y;
 
+#ifdef STREFLOP_DOUBLE_LENGTH_STAGE
+  if (__mpcos_dla(x,0,&y)) return y;
+#endif
   p=32;
   n=__mpranred(x,&u,p);              /* n is 0, 1, 2 or 3 */
   __c32(&u,&c,&s,p);
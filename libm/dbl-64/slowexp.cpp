@@ -34,9 +34,10 @@
 
 namespace streflop_libm {
 void __mpexp(mp_no *x, mp_no *y, int p);
+int __slowexp_dla(Double x, Double *res);
 
 /*Converting from Double precision to Multi-precision and calculating  e^x */
-Double __slowexp(Double x) {
+Double __slowexp_nocache(Double x) {
   Double w,z,res,eps=3.0e-26;
 #if 0
   Double y;
@@ -47,6 +48,10 @@ Double __slowexp(Double x) {
 #endif
   mp_no mpx, mpy, mpz,mpw,mpeps,mpcor;
 
+#ifdef STREFLOP_DOUBLE_LENGTH_STAGE
+  if (__slowexp_dla(x,&res)) return res;
+#endif
+
   p=6;
   __dbl_mp(x,&mpx,p); /* Convert a Double precision number  x               */
                     /* into a multiple precision number mpx with prec. p. */
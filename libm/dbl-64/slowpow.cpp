@@ -41,8 +41,9 @@ void __mpexp(mp_no *x, mp_no *y, int p);
 void __mplog(mp_no *x, mp_no *y, int p);
 Double ulog(Double);
 Double __halfulp(Double x,Double y);
+int __slowpow_dla(Double x, Double y, Double z, Double *res);
 
-Double __slowpow(Double x, Double y, Double z) {
+Double __slowpow_nocache(Double x, Double y, Double z) {
   Double res,res1;
   mp_no mpx, mpy, mpz,mpw,mpp,mpr,mpr1;
   static const mp_no eps = {-3,{1.0,4.0}};
@@ -51,6 +52,9 @@ Double __slowpow(Double x, Double y, Double z) {
   res = __halfulp(x,y);        /* halfulp() returns -10 or x^y             */
   if (res >= 0) return res;  /* if result was really computed by halfulp */
                   /*  else, if result was not really computed by halfulp */
+#ifdef STREFLOP_DOUBLE_LENGTH_STAGE
+  if (__slowpow_dla(x,y,z,&res)) return res;
+#endif
   p = 10;         /*  p=precision   */
   __dbl_mp(x,&mpx,p);
   __dbl_mp(y,&mpy,p);
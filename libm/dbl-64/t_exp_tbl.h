@@ -0,0 +1,270 @@
+/* See the import.pl script for potential modifications */
+/* t_exp_tbl.h -- table shared by the table-driven exp and exp2.
+ * Written for streflop, see e_exp_tbl.c.
+ */
+
+/* exp2_128_hi[j] + exp2_128_lo[j] = 2^(j/128) to about 106 bits, j = 0..127.
+ * The high part is 2^(j/128) correctly rounded to Double, the low part is
+ * the rest correctly rounded. Computed with 80 digits decimal arithmetic.
+ */
+static const Double exp2_128_hi[128] = {
+  1.00000000000000000e+00,
+  1.00542990111280273e+00,
+  1.01088928605170048e+00,
+  1.01637831491095310e+00,
+  1.02189714865411663e+00,
+  1.02744594911876375e+00,
+  1.03302487902122841e+00,
+  1.03863410196137873e+00,
+  1.04427378242741375e+00,
+  1.04994408580068721e+00,
+  1.05564517836055716e+00,
+  1.06137722728926209e+00,
+  1.06714040067682370e+00,
+  1.07293486752597556e+00,
+  1.07876079775711986e+00,
+  1.08461836221330921e+00,
+  1.09050773266525769e+00,
+  1.09642908181637688e+00,
+  1.10238258330784089e+00,
+  1.10836841172367873e+00,
+  1.11438674259589243e+00,
+  1.12043775240960675e+00,
+  1.12652161860824185e+00,
+  1.13263851959871920e+00,
+  1.13878863475669156e+00,
+  1.14497214443180417e+00,
+  1.15118922995298267e+00,
+  1.15744007363375112e+00,
+  1.16372485877757748e+00,
+  1.17004376968325019e+00,
+  1.17639699165028122e+00,
+  1.18278471098434101e+00,
+  1.18920711500272103e+00,
+  1.19566439203982733e+00,
+  1.20215673145270308e+00,
+  1.20868432362658162e+00,
+  1.21524735998046896e+00,
+  1.22184603297275762e+00,
+  1.22848053610687002e+00,
+  1.23515106393693341e+00,
+  1.24185781207348400e+00,
+  1.24860097718920482e+00,
+  1.25538075702469110e+00,
+  1.26219735039425074e+00,
+  1.26905095719173322e+00,
+  1.27594177839639200e+00,
+  1.28287001607877826e+00,
+  1.28983587340666572e+00,
+  1.29683955465100964e+00,
+  1.30388126519193581e+00,
+  1.31096121152476441e+00,
+  1.31807960126606405e+00,
+  1.32523664315974132e+00,
+  1.33243254708316150e+00,
+  1.33966752405330292e+00,
+  1.34694178623294580e+00,
+  1.35425554693689265e+00,
+  1.36160902063822475e+00,
+  1.36900242297459052e+00,
+  1.37643597075453017e+00,
+  1.38390988196383202e+00,
+  1.39142437577192624e+00,
+  1.39897967253831124e+00,
+  1.40657599381901544e+00,
+  1.41421356237309515e+00,
+  1.42189260216916558e+00,
+  1.42961333839197002e+00,
+  1.43737599744898237e+00,
+  1.44518080697704665e+00,
+  1.45302799584905262e+00,
+  1.46091779418064704e+00,
+  1.46885043333698184e+00,
+  1.47682614593949935e+00,
+  1.48484516587275239e+00,
+  1.49290772829126484e+00,
+  1.50101406962642558e+00,
+  1.50916442759342284e+00,
+  1.51735904119821474e+00,
+  1.52559815074453842e+00,
+  1.53388199784095591e+00,
+  1.54221082540794074e+00,
+  1.55058487768499997e+00,
+  1.55900440023783693e+00,
+  1.56746963996555300e+00,
+  1.57598084510788650e+00,
+  1.58453826525249375e+00,
+  1.59314215134226700e+00,
+  1.60179275568269341e+00,
+  1.61049033194925428e+00,
+  1.61923513519486373e+00,
+  1.62802742185734783e+00,
+  1.63686744976696441e+00,
+  1.64575547815396495e+00,
+  1.65469176765619430e+00,
+  1.66367658032673638e+00,
+  1.67271017964159663e+00,
+  1.68179283050742900e+00,
+  1.69092479926930528e+00,
+  1.70010635371852348e+00,
+  1.70933776310046293e+00,
+  1.71861929812247793e+00,
+  1.72795123096183767e+00,
+  1.73733383527370622e+00,
+  1.74676738619916905e+00,
+  1.75625216037329945e+00,
+  1.76578843593327273e+00,
+  1.77537649252652119e+00,
+  1.78501661131893496e+00,
+  1.79470907500310717e+00,
+  1.80445416780662393e+00,
+  1.81425217550039886e+00,
+  1.82410338540705341e+00,
+  1.83400808640934243e+00,
+  1.84396656895862598e+00,
+  1.85397912508338547e+00,
+  1.86404604839778898e+00,
+  1.87416763411029996e+00,
+  1.88434417903233453e+00,
+  1.89457598158696561e+00,
+  1.90486334181767414e+00,
+  1.91520656139714740e+00,
+  1.92560594363612503e+00,
+  1.93606179349229435e+00,
+  1.94657441757923322e+00,
+  1.95714412417540018e+00,
+  1.96777122323317588e+00,
+  1.97845602638795093e+00,
+  1.98919884696726634e+00
+};
+
+static const Double exp2_128_lo[128] = {
+  0.00000000000000000e+00,
+  9.49918653545503176e-17,
+  -1.52347786033685772e-17,
+  -5.77217007319966003e-17,
+  5.10922502897344389e-17,
+  -4.95607417464537044e-17,
+  7.60083887402708849e-18,
+  5.99627378885251062e-17,
+  8.55188970553796489e-17,
+  5.59293784812700259e-17,
+  1.75932573877209198e-18,
+  -1.19735370853656576e-17,
+  -7.89985396684158212e-17,
+  -3.83966884335882381e-18,
+  -6.65666043605659260e-17,
+  3.16615284581634612e-17,
+  -3.04678207981247115e-17,
+  -5.91993348444931582e-17,
+  5.26603687157069439e-17,
+  -8.78681384518052662e-17,
+  1.04102784568455710e-16,
+  -6.20108590655417875e-17,
+  5.16585675879545674e-17,
+  3.23735616673800026e-17,
+  8.91281267602540778e-17,
+  4.64128989217001066e-17,
+  3.25071021886382721e-17,
+  -9.12387123113440029e-17,
+  3.82920483692409350e-17,
+  -1.84774420179000469e-18,
+  5.55420325421807896e-17,
+  1.54297543007907606e-17,
+  3.98201523146564611e-17,
+  4.61660367048148140e-17,
+  6.64498149925230124e-17,
+  -4.74672594522898410e-17,
+  -7.71263069268148813e-17,
+  -1.06110212114026912e-16,
+  -1.89878163130252995e-17,
+  -1.07552443443078414e-16,
+  4.65802759183693679e-17,
+  -8.26181099902196355e-17,
+  -6.71138982129687842e-18,
+  -3.08446488747384647e-17,
+  2.66793213134218610e-18,
+  9.91543024421429033e-17,
+  1.71359491824356097e-17,
+  8.94925753089759172e-17,
+  2.53825027948883150e-17,
+  8.64767559826787118e-17,
+  -7.18153613551945386e-17,
+  -5.45795582714915350e-17,
+  -2.85873121003886137e-17,
+  -5.10158663091674396e-17,
+  8.92728259483173198e-17,
+  3.22406510125467917e-17,
+  7.70094837980298946e-17,
+  1.53378766127066805e-18,
+  9.59379791911884877e-17,
+  -6.89858893587180104e-17,
+  -6.77051165879478629e-17,
+  -4.90617486528898932e-17,
+  -9.61421320905132307e-17,
+  7.03491481213642219e-18,
+  -9.66729331345291345e-17,
+  -1.60778289158902441e-17,
+  -1.20316424890536552e-17,
+  -4.20403401646755661e-17,
+  -3.02375813499398732e-17,
+  -5.77994860939610610e-17,
+  -5.60037718607521580e-17,
+  8.46588275653362761e-17,
+  -3.48399455689279580e-17,
+  1.07800867644074808e-16,
+  1.41929201542840358e-17,
+  -6.41376727579023504e-17,
+  -1.01645532775429504e-16,
+  -4.30869947204334080e-17,
+  -1.10249417123425609e-16,
+  8.87522684443844614e-17,
+  7.94983480969762086e-17,
+  -1.46007065906893852e-17,
+  3.78120705335752750e-17,
+  -1.03520617688497220e-16,
+  -1.01369164712783040e-17,
+  -1.93377170345857029e-17,
+  -1.00944065423119637e-16,
+  -6.05491745352778434e-17,
+  2.47071925697978879e-17,
+  2.09413341542290924e-17,
+  -6.71295508470708409e-17,
+  7.69832507131987557e-17,
+  -1.01256799136747726e-16,
+  9.64329430319602866e-17,
+  5.89099269671309967e-17,
+  -5.47671596459956308e-17,
+  8.19901002058149652e-17,
+  -9.66967147439488017e-17,
+  -8.02371937039770025e-18,
+  -9.86877945663293108e-17,
+  -1.85138041826311099e-17,
+  -1.07509818612046424e-16,
+  3.16438929929295695e-17,
+  -1.07522904835075145e-16,
+  2.96014069544887331e-17,
+  9.46131501808326787e-17,
+  6.42973179655657203e-17,
+  1.53304001210313138e-17,
+  1.82274584279120868e-17,
+  -5.17722240879331788e-17,
+  -9.96953153892034882e-17,
+  -1.01596278622770831e-16,
+  3.28310722424562720e-17,
+  -5.93974202694996455e-17,
+  9.76188749072759354e-17,
+  6.54091268062057171e-17,
+  -6.12276341300414256e-17,
+  -8.22659312553371091e-17,
+  3.40340353521652967e-17,
+  6.53385751471827863e-17,
+  -1.06199460561959626e-16,
+  -9.91496376969374093e-17,
+  1.03323859606763257e-16,
+  6.81102234953387718e-17,
+  8.96076779103666777e-17,
+  -1.03149280115311315e-16,
+  4.03887531092781666e-17,
+  8.20513263836919942e-18
+};
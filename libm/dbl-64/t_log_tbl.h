@@ -0,0 +1,670 @@
+/* See the import.pl script for potential modifications */
+/* t_log_tbl.h -- table shared by the table-driven log and log2.
+ * Written for streflop, see e_log_tbl.c.
+ */
+
+/* Interval i, i = 0..127, holds the z in [0x1.6p-1, 0x1.6p0) whose high word
+ * is in [0x3fe60000 + i*0x2000, 0x3fe60000 + (i+1)*0x2000), so it is 2^-8 wide
+ * below 1 and 2^-7 wide above. log_128_invc[i] is 1/c, for c the center of
+ * the interval, rounded to 10 bits so that z*invc is exact with a 43 bits z.
+ * It is 1 for the two intervals around 1, where log(z) is small.
+ * |z*invc - 1| <= 2^-7 on each interval.
+ *
+ * logc = -log(invc) = log_128_logc_hi[i] + log_128_logc_lo[i], the high part
+ * rounded to a multiple of 2^-42 so that k*ln2hi + log_128_logc_hi[i] is exact.
+ * The same for log2c = -log2(invc). Computed with 80 digits decimal arithmetic.
+ */
+static const Double log_128_invc[128] = {
+  1.45117187500000000e+00,
+  1.44140625000000000e+00,
+  1.43359375000000000e+00,
+  1.42578125000000000e+00,
+  1.41796875000000000e+00,
+  1.41015625000000000e+00,
+  1.40234375000000000e+00,
+  1.39453125000000000e+00,
+  1.38671875000000000e+00,
+  1.38085937500000000e+00,
+  1.37304687500000000e+00,
+  1.36523437500000000e+00,
+  1.35742187500000000e+00,
+  1.35156250000000000e+00,
+  1.34375000000000000e+00,
+  1.33593750000000000e+00,
+  1.33007812500000000e+00,
+  1.32226562500000000e+00,
+  1.31640625000000000e+00,
+  1.30859375000000000e+00,
+  1.30273437500000000e+00,
+  1.29687500000000000e+00,
+  1.28906250000000000e+00,
+  1.28320312500000000e+00,
+  1.27734375000000000e+00,
+  1.26953125000000000e+00,
+  1.26367187500000000e+00,
+  1.25781250000000000e+00,
+  1.25195312500000000e+00,
+  1.24609375000000000e+00,
+  1.24023437500000000e+00,
+  1.23437500000000000e+00,
+  1.22851562500000000e+00,
+  1.22265625000000000e+00,
+  1.21679687500000000e+00,
+  1.21093750000000000e+00,
+  1.20507812500000000e+00,
+  1.19921875000000000e+00,
+  1.19335937500000000e+00,
+  1.18750000000000000e+00,
+  1.18164062500000000e+00,
+  1.17773437500000000e+00,
+  1.17187500000000000e+00,
+  1.16601562500000000e+00,
+  1.16015625000000000e+00,
+  1.15625000000000000e+00,
+  1.15039062500000000e+00,
+  1.14453125000000000e+00,
+  1.14062500000000000e+00,
+  1.13476562500000000e+00,
+  1.13085937500000000e+00,
+  1.12500000000000000e+00,
+  1.12109375000000000e+00,
+  1.11523437500000000e+00,
+  1.11132812500000000e+00,
+  1.10546875000000000e+00,
+  1.10156250000000000e+00,
+  1.09570312500000000e+00,
+  1.09179687500000000e+00,
+  1.08789062500000000e+00,
+  1.08203125000000000e+00,
+  1.07812500000000000e+00,
+  1.07421875000000000e+00,
+  1.06835937500000000e+00,
+  1.06445312500000000e+00,
+  1.06054687500000000e+00,
+  1.05664062500000000e+00,
+  1.05078125000000000e+00,
+  1.04687500000000000e+00,
+  1.04296875000000000e+00,
+  1.03906250000000000e+00,
+  1.03515625000000000e+00,
+  1.02929687500000000e+00,
+  1.02539062500000000e+00,
+  1.02148437500000000e+00,
+  1.01757812500000000e+00,
+  1.01367187500000000e+00,
+  1.00976562500000000e+00,
+  1.00585937500000000e+00,
+  1.00000000000000000e+00,
+  1.00000000000000000e+00,
+  9.88281250000000000e-01,
+  9.80468750000000000e-01,
+  9.73632812500000000e-01,
+  9.65820312500000000e-01,
+  9.58984375000000000e-01,
+  9.52148437500000000e-01,
+  9.44335937500000000e-01,
+  9.37500000000000000e-01,
+  9.30664062500000000e-01,
+  9.23828125000000000e-01,
+  9.17968750000000000e-01,
+  9.11132812500000000e-01,
+  9.04296875000000000e-01,
+  8.98437500000000000e-01,
+  8.91601562500000000e-01,
+  8.85742187500000000e-01,
+  8.79882812500000000e-01,
+  8.74023437500000000e-01,
+  8.68164062500000000e-01,
+  8.62304687500000000e-01,
+  8.56445312500000000e-01,
+  8.50585937500000000e-01,
+  8.44726562500000000e-01,
+  8.38867187500000000e-01,
+  8.33984375000000000e-01,
+  8.28125000000000000e-01,
+  8.23242187500000000e-01,
+  8.18359375000000000e-01,
+  8.12500000000000000e-01,
+  8.07617187500000000e-01,
+  8.02734375000000000e-01,
+  7.97851562500000000e-01,
+  7.92968750000000000e-01,
+  7.88085937500000000e-01,
+  7.83203125000000000e-01,
+  7.78320312500000000e-01,
+  7.73437500000000000e-01,
+  7.68554687500000000e-01,
+  7.64648437500000000e-01,
+  7.59765625000000000e-01,
+  7.54882812500000000e-01,
+  7.50976562500000000e-01,
+  7.46093750000000000e-01,
+  7.42187500000000000e-01,
+  7.37304687500000000e-01,
+  7.33398437500000000e-01,
+  7.29492187500000000e-01
+};
+
+static const Double log_128_logc_hi[128] = {
+  -3.72371419678302118e-01,
+  -3.65619199561024288e-01,
+  -3.60184403574976386e-01,
+  -3.54719909102868769e-01,
+  -3.49225389785260631e-01,
+  -3.43700513853264056e-01,
+  -3.38144944008718085e-01,
+  -3.32558337300042695e-01,
+  -3.26940344995819032e-01,
+  -3.22706040857156040e-01,
+  -3.17032266771093418e-01,
+  -3.11326117194312246e-01,
+  -3.05587220525239900e-01,
+  -3.01261330578199704e-01,
+  -2.95464212893875811e-01,
+  -2.89633292582948343e-01,
+  -2.85237681109947516e-01,
+  -2.79346647872671383e-01,
+  -2.74905485872750432e-01,
+  -2.68953087345607855e-01,
+  -2.64465420876149437e-01,
+  -2.59957524436913445e-01,
+  -2.53915209980959844e-01,
+  -2.49359393445047317e-01,
+  -2.44782726417724916e-01,
+  -2.38647737850214980e-01,
+  -2.34021669461299098e-01,
+  -2.29374101064877323e-01,
+  -2.24704831881126665e-01,
+  -2.20013658305333593e-01,
+  -2.15300373853096971e-01,
+  -2.10564769107350003e-01,
+  -2.05806631660834682e-01,
+  -2.01025746060622623e-01,
+  -1.96221893747861031e-01,
+  -1.91394852999565046e-01,
+  -1.86544398865862604e-01,
+  -1.81670303107694053e-01,
+  -1.76772334132010656e-01,
+  -1.71850256926745715e-01,
+  -1.66903832991238232e-01,
+  -1.63592571687786403e-01,
+  -1.58605030176659056e-01,
+  -1.53592488353069712e-01,
+  -1.48554694323138392e-01,
+  -1.45182009844575077e-01,
+  -1.40101558612059307e-01,
+  -1.34995164537485834e-01,
+  -1.31576357788617315e-01,
+  -1.26426131812422682e-01,
+  -1.22977852533495025e-01,
+  -1.17783035656430002e-01,
+  -1.14304771280103523e-01,
+  -1.09064584616589855e-01,
+  -1.05555809086808949e-01,
+  -1.00269453163718936e-01,
+  -9.67296264584547316e-02,
+  -9.13962804831953690e-02,
+  -8.78248481155878835e-02,
+  -8.42406148876762018e-02,
+  -7.88400617077513743e-02,
+  -7.52234212375242350e-02,
+  -7.15936531869374448e-02,
+  -6.61241773825622658e-02,
+  -6.24611696237025171e-02,
+  -5.87846948944843462e-02,
+  -5.50946538069183589e-02,
+  -4.95339351223265112e-02,
+  -4.58095360313564015e-02,
+  -4.20712139207353175e-02,
+  -3.83188643020275777e-02,
+  -3.45523815067281248e-02,
+  -2.88759235018005711e-02,
+  -2.50736375521682930e-02,
+  -2.12568390254546102e-02,
+  -1.74254167138769844e-02,
+  -1.35792581263558532e-02,
+  -9.71824946896049369e-03,
+  -5.84227562421801849e-03,
+  0.00000000000000000e+00,
+  0.00000000000000000e+00,
+  1.17879557519700029e-02,
+  1.97245053477672627e-02,
+  2.67210356375926494e-02,
+  3.47774739766464336e-02,
+  4.18804972450743662e-02,
+  4.90343346016288706e-02,
+  5.72733101462290506e-02,
+  6.45385211375923973e-02,
+  7.18569019452388602e-02,
+  7.92292365474622784e-02,
+  8.55919303353402938e-02,
+  9.30666047520389839e-02,
+  1.00597570953368631e-01,
+  1.07098135556270790e-01,
+  1.14735925004424644e-01,
+  1.21329355484249390e-01,
+  1.27966547991036350e-01,
+  1.34648087324649168e-01,
+  1.41374570085645246e-01,
+  1.48146604995417874e-01,
+  1.54964813227252307e-01,
+  1.61829828746931526e-01,
+  1.68742298667666546e-01,
+  1.75702883615258543e-01,
+  1.81540611810987684e-01,
+  1.88591169807523329e-01,
+  1.94504847597499975e-01,
+  2.00453705117297432e-01,
+  2.07639364778287927e-01,
+  2.13667110575670449e-01,
+  2.19731410543317907e-01,
+  2.25832710739496179e-01,
+  2.31971465437709412e-01,
+  2.38148137329517340e-01,
+  2.44363197733036941e-01,
+  2.50617126809174806e-01,
+  2.56910413785135461e-01,
+  2.63243557182022414e-01,
+  2.68339109608632498e-01,
+  2.74745281421019172e-01,
+  2.81192757011922367e-01,
+  2.86380836093712787e-01,
+  2.92904016432885328e-01,
+  2.98153372319120535e-01,
+  3.04754056350475366e-01,
+  3.10066153835350633e-01,
+  3.15406620466546883e-01
+};
+
+static const Double log_128_logc_lo[128] = {
+  5.07378691049862151e-14,
+  5.95770946492931123e-14,
+  -3.14101284357935074e-14,
+  -6.02593863918127821e-14,
+  -2.76727112657366262e-14,
+  -5.43888832989906475e-14,
+  1.68695012281303904e-15,
+  -3.39068613367222871e-14,
+  -3.42884001266694616e-14,
+  9.10689124849898076e-14,
+  -6.37012660028303652e-14,
+  9.77434113526933524e-15,
+  -4.44471635156061919e-14,
+  3.79231648020931468e-14,
+  3.99341638438784391e-14,
+  -9.43339818951269031e-14,
+  -5.70654198774399266e-14,
+  -9.58254018048509218e-14,
+  -4.88167036467699861e-14,
+  1.03896307840029876e-13,
+  3.35041553320779201e-14,
+  -1.26217293988853161e-14,
+  -3.60017673263733462e-15,
+  -5.54100547611002814e-14,
+  3.39998110836183310e-14,
+  3.99705090953013414e-14,
+  -9.36821524381584787e-14,
+  3.14926506519148377e-14,
+  -3.55896844955497576e-14,
+  5.14966723414140784e-14,
+  -8.68916047876454135e-14,
+  3.65071888317905767e-16,
+  -9.80574556835860272e-14,
+  3.18818493754377370e-14,
+  -8.43272251985604991e-14,
+  -6.44085615069689207e-14,
+  -1.74252446709104156e-14,
+  5.93750633338470150e-14,
+  -7.68825252906833817e-14,
+  8.64923960721207091e-14,
+  -9.54456167865310709e-14,
+  1.08745639470742370e-13,
+  2.04723578004619554e-14,
+  -2.45904572977064931e-14,
+  1.24915489807515997e-15,
+  7.71800133682809851e-14,
+  -1.96141312801201613e-14,
+  -1.89961580415787680e-14,
+  -1.01957352237084735e-13,
+  1.92380069501930178e-14,
+  7.56605003101551715e-15,
+  4.65472974759844473e-14,
+  4.48895335223869926e-14,
+  8.74227293390198173e-14,
+  -1.41868674030831080e-14,
+  4.37863761707839791e-14,
+  -9.63806765855227741e-14,
+  6.83806381345575412e-15,
+  -3.49125875136412597e-15,
+  -1.00035395568953342e-13,
+  -2.46501890617661192e-14,
+  -6.32906595872454402e-14,
+  -7.13730822534317801e-14,
+  8.88449701660842803e-14,
+  -3.37730944371761137e-14,
+  5.66926711774237046e-14,
+  -5.53779191688518419e-14,
+  4.98803091079814256e-14,
+  6.21983419947579228e-14,
+  4.82631400055112824e-14,
+  -1.09021543022033016e-13,
+  6.83913974232877737e-14,
+  -5.39703209608758265e-14,
+  5.23320941495402893e-14,
+  3.94941818663325640e-14,
+  1.78510976017323060e-14,
+  -2.50004090879888067e-14,
+  3.91475588038155499e-14,
+  -1.03421215887868832e-14,
+  0.00000000000000000e+00,
+  0.00000000000000000e+00,
+  7.22375758020928837e-14,
+  1.13263997001422337e-14,
+  2.21144950419370559e-14,
+  9.45463083337986608e-14,
+  -8.71601984429868042e-14,
+  -2.29530647947806089e-14,
+  -7.02821679272417485e-14,
+  -2.12256080448099975e-14,
+  1.21216786950717008e-14,
+  1.12538825343134813e-13,
+  6.32200933369148407e-14,
+  7.02847200959676053e-14,
+  -9.49206327250952974e-14,
+  9.63101103351921745e-14,
+  5.99829321003710544e-14,
+  6.71008074664424210e-14,
+  7.88296379693808553e-14,
+  -5.14449010970108143e-14,
+  -9.67298342838390325e-14,
+  7.52063412839802306e-14,
+  1.77468651709290806e-14,
+  1.87729193995153584e-14,
+  -9.27733146087832483e-14,
+  -6.08198490511724305e-14,
+  -1.04453395302844434e-13,
+  2.66934315780158177e-14,
+  9.76630163815211259e-14,
+  7.26221516773877611e-14,
+  -4.34254225952425643e-14,
+  9.13305083861687414e-14,
+  -4.47285138599131386e-14,
+  -4.59678853401492060e-14,
+  6.57309773783197502e-14,
+  -1.30432647821005263e-14,
+  -9.83420129626977822e-14,
+  6.32487448038720645e-14,
+  -1.08221716467991239e-13,
+  2.74529819534948150e-14,
+  1.74949646151439101e-14,
+  4.23200762021453943e-14,
+  1.08765173375034185e-13,
+  9.63323796629575047e-14,
+  4.72745294051440629e-14,
+  -4.42040833387556859e-14,
+  -4.69755684185172682e-14,
+  -3.22830999796576749e-14,
+  8.89047982641828396e-14
+};
+
+static const Double log_128_log2c_hi[128] = {
+  -5.37218400538677088e-01,
+  -5.27477006060507847e-01,
+  -5.19636252843156399e-01,
+  -5.11752653767416632e-01,
+  -5.03825737995839518e-01,
+  -4.95855026887284112e-01,
+  -4.87840033822976693e-01,
+  -4.79780264029159298e-01,
+  -4.71675214392007547e-01,
+  -4.65566404809351297e-01,
+  -4.57380879072616153e-01,
+  -4.49148645375544220e-01,
+  -4.40869167610799195e-01,
+  -4.34628227636721931e-01,
+  -4.26264754702060600e-01,
+  -4.17852514885908022e-01,
+  -4.11510988011968948e-01,
+  -4.03012023575001876e-01,
+  -3.96604781181849830e-01,
+  -3.88017285345085838e-01,
+  -3.81542951184655976e-01,
+  -3.75039431346976926e-01,
+  -3.66322214245883515e-01,
+  -3.59749560322370598e-01,
+  -3.53146825498015460e-01,
+  -3.44295907915920907e-01,
+  -3.37621901992406492e-01,
+  -3.30916878114521751e-01,
+  -3.24180546618663357e-01,
+  -3.17412613764872731e-01,
+  -3.10612781659528991e-01,
+  -3.03780748177132409e-01,
+  -2.96916206879359379e-01,
+  -2.90018846932525776e-01,
+  -2.83088353023913442e-01,
+  -2.76124405274231322e-01,
+  -2.69126679149394477e-01,
+  -2.62094845370256735e-01,
+  -2.55028569818705364e-01,
+  -2.47927513443528369e-01,
+  -2.40791332161961691e-01,
+  -2.36014191900039805e-01,
+  -2.28818690495927513e-01,
+  -2.21587121264747111e-01,
+  -2.14319120800837482e-01,
+  -2.09453365628860411e-01,
+  -2.02123823830561378e-01,
+  -1.94756854422166725e-01,
+  -1.89824558879990946e-01,
+  -1.82394353404561116e-01,
+  -1.77419537989180753e-01,
+  -1.69925001442379653e-01,
+  -1.64906926675712384e-01,
+  -1.57346935362738805e-01,
+  -1.52284842306471546e-01,
+  -1.44658242831837924e-01,
+  -1.39551352398711970e-01,
+  -1.31856960608729423e-01,
+  -1.26704472843130134e-01,
+  -1.21533517340139952e-01,
+  -1.13742166049178195e-01,
+  -1.08524456778241074e-01,
+  -1.03287808412005688e-01,
+  -9.53970227926674852e-02,
+  -9.01124196643650066e-02,
+  -8.48083878042871220e-02,
+  -7.94847838267287443e-02,
+  -7.14623625565309339e-02,
+  -6.60891904576601519e-02,
+  -6.06959316876327648e-02,
+  -5.52824355011125590e-02,
+  -4.98485494506439863e-02,
+  -4.16591516373046034e-02,
+  -3.61736125535117026e-02,
+  -3.06671362468478037e-02,
+  -2.51395622785821615e-02,
+  -1.95907283577980706e-02,
+  -1.40204703150175192e-02,
+  -8.42862207059624780e-03,
+  0.00000000000000000e+00,
+  0.00000000000000000e+00,
+  1.70064253056807502e-02,
+  2.84564460491765203e-02,
+  3.85503056018023926e-02,
+  5.01732892410018394e-02,
+  6.04207856852099212e-02,
+  7.07415913630029536e-02,
+  8.26279205232367531e-02,
+  9.31094043914981739e-02,
+  1.03667596089962899e-01,
+  1.14303626660557711e-01,
+  1.23483053434938483e-01,
+  1.34266729148293962e-01,
+  1.45131616739718083e-01,
+  1.54509949055636753e-01,
+  1.65528950015868759e-01,
+  1.75041259471527155e-01,
+  1.84616704186510106e-01,
+  1.94256127848348115e-01,
+  2.03960391170312505e-01,
+  2.13730372351619735e-01,
+  2.23566967555370866e-01,
+  2.33471091401042941e-01,
+  2.43443677475852382e-01,
+  2.53485678861579800e-01,
+  2.61907740379456300e-01,
+  2.72079545436781700e-01,
+  2.80611179057814297e-01,
+  2.89193566300582461e-01,
+  2.99560281858930466e-01,
+  3.08256480828731583e-01,
+  3.17005416318352218e-01,
+  3.25807731854411031e-01,
+  3.34664082814924768e-01,
+  3.43575136722165553e-01,
+  3.52541573545067877e-01,
+  3.61564086009593666e-01,
+  3.70643379920466032e-01,
+  3.79780174492452716e-01,
+  3.87131502709053166e-01,
+  3.96373655013803727e-01,
+  4.05675396075139361e-01,
+  4.13160212038064856e-01,
+  4.22571171964364112e-01,
+  4.30144391669045945e-01,
+  4.39667165787568592e-01,
+  4.47330902485646220e-01,
+  4.55035567210870795e-01
+};
+
+static const Double log_128_log2c_lo[128] = {
+  8.08597630006021412e-14,
+  1.11790922738968338e-13,
+  -5.63715970340694953e-14,
+  3.70543014105727990e-14,
+  8.88238275317510985e-14,
+  1.13123993772595132e-13,
+  -7.46523053962589794e-14,
+  5.96007840277366435e-14,
+  -3.68624284487270089e-14,
+  -4.75471689644888600e-14,
+  8.08776289271276132e-14,
+  1.07801387681117628e-13,
+  -7.05836151443197800e-14,
+  -2.70167272015910642e-15,
+  -3.73390727664993223e-14,
+  1.01651234370888019e-14,
+  -1.02217405217186836e-13,
+  5.12576763307448608e-15,
+  -8.63479414580400001e-15,
+  -4.89424556483124203e-14,
+  7.09832349834938829e-14,
+  5.21694921496085089e-14,
+  6.77295812300309424e-14,
+  4.10056704261184686e-14,
+  -6.70801891973541168e-14,
+  1.04050679157690575e-13,
+  -1.01043379622472301e-13,
+  -9.52289050723510311e-14,
+  -7.76711965755935692e-14,
+  3.35390689132001069e-15,
+  7.90289987752465833e-16,
+  2.94847550908176559e-14,
+  7.01888332122376533e-14,
+  -9.25585593806985295e-14,
+  -8.84208311171525834e-14,
+  -6.23514882038853192e-15,
+  -2.34113094809706388e-14,
+  7.73467702751548549e-14,
+  -2.41685536013561982e-14,
+  -5.71248408353184638e-14,
+  4.83060293079303428e-15,
+  -4.49910866327667444e-14,
+  4.66353349283107928e-14,
+  -5.79088846728342352e-14,
+  7.16809502455766247e-14,
+  -8.93712056807859825e-14,
+  1.00675090530663469e-13,
+  -8.11492585140355436e-14,
+  -2.62842938462887955e-14,
+  3.22520928697339126e-14,
+  -5.58477342663892219e-14,
+  6.72899642724072672e-14,
+  2.45835591866864742e-14,
+  -1.03980978613879506e-13,
+  -1.10373523985014632e-13,
+  -4.43965028643840856e-14,
+  -8.15838978307359803e-14,
+  -6.34226505770390788e-14,
+  -5.99655841225319300e-14,
+  1.08193532875930676e-13,
+  -1.01349616545169685e-14,
+  7.20203140653432285e-14,
+  -1.62636433709271201e-14,
+  1.10923924682372694e-13,
+  7.63002616449198769e-14,
+  -7.44200068558095349e-14,
+  -8.65143730531551805e-14,
+  -9.32106841783956978e-14,
+  -1.12281050905174018e-13,
+  7.88283880205416762e-14,
+  -7.70422401151930600e-14,
+  8.24591960339830700e-14,
+  8.99862948157735087e-14,
+  2.67179356484361965e-14,
+  -9.35702189447420645e-14,
+  7.39327892641200625e-14,
+  -8.27435283055714990e-14,
+  8.28907993132581568e-14,
+  1.55188638456823221e-14,
+  0.00000000000000000e+00,
+  0.00000000000000000e+00,
+  9.12133576610531403e-15,
+  5.14887042973928461e-14,
+  1.68761358042157513e-15,
+  -1.12650578558975757e-13,
+  9.70153107049742679e-14,
+  2.40088235722781850e-14,
+  -7.79458795350574571e-14,
+  -1.67032603285508017e-14,
+  9.52005316661668567e-14,
+  4.70937687920824250e-14,
+  6.17965530115380008e-14,
+  -5.26843790255761798e-14,
+  4.55301916593546326e-14,
+  -1.19729105356148404e-14,
+  -9.07713417350418033e-14,
+  -4.95982948884074735e-14,
+  -4.86930357730869512e-14,
+  3.31133985162738288e-14,
+  -8.24657045489837323e-14,
+  -8.57345569246736138e-14,
+  -1.03917733640514664e-13,
+  9.24661131820254338e-14,
+  6.06369225367024947e-14,
+  -4.33420747363550305e-14,
+  5.33163794662719227e-14,
+  1.91206007771214787e-14,
+  1.03422584936319839e-13,
+  6.59422422828259660e-14,
+  -2.26265113560326109e-14,
+  -6.27629726583272507e-15,
+  -3.51150354046446903e-14,
+  -9.44639136018177860e-14,
+  -1.00996333947136338e-13,
+  5.41211356794239656e-14,
+  1.18254601892272905e-14,
+  -6.54430362044794670e-14,
+  -7.56508696122430387e-14,
+  6.08941232729609584e-14,
+  -9.38308259802668707e-14,
+  4.34009384384882473e-15,
+  1.32460439374553314e-14,
+  1.08619734924799580e-13,
+  -1.12801031516142167e-13,
+  6.21375442154313069e-15,
+  -9.84676321936689583e-15,
+  8.20047094712849379e-14,
+  -1.07914219021216290e-13
+};
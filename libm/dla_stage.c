@@ -0,0 +1,482 @@
+/* dla_stage.c -- written for streflop.
+ * __slowexp, __slowpow, the __mpsin and __mpcos functions of sincos32.c and
+ * tanMp of s_tan.c go from the fast paths straight to the multi-precision
+ * functions. With STREFLOP_DOUBLE_LENGTH_STAGE defined, they first try a
+ * double-length evaluation, about 100 bits, with the macros of dla.h. The
+ * result comes with an error bound, and is only returned when both ends of
+ * the bound round to the same double: this is the correctly rounded result,
+ * which is what the multi-precision code returns too. Otherwise, for the
+ * results that are not normal, and in the rounding modes other than to
+ * nearest, the functions below return 0 and the multi-precision code is used
+ * as before. The trigonometric functions reduce their argument by pi/2 with
+ * 64-bit integers and the 2/pi table of branred.h. log and atan already have
+ * such a stage in the IBM code. import.pl inserts the calls in slowexp.cpp,
+ * slowpow.cpp, sincos32.cpp and s_tan.cpp.
+ */
+
+#include "endian.h"
+#include "mydefs.h"
+#include "dla.h"
+#include "branred.h"
+#include "math_private.h"
+
+int __slowexp_dla(double x, double *res);
+int __slowpow_dla(double x, double y, double z, double *res);
+int __mpsin_dla(double x, double dx, double *res);
+int __mpcos_dla(double x, double dx, double *res);
+int __mptan_dla(double x, double *res);
+
+#ifdef STREFLOP_DOUBLE_LENGTH_STAGE
+
+#ifdef __STDC__
+static const double
+#else
+static double
+#endif
+zero	= 0.0,
+half	= 0.5,
+one	= 1.0,
+two	= 2.0,
+twom8	= 3.90625000000000000000e-03,	/* 2**-8=0x3F700000,0 */
+twom40	= 9.09494701772928237915e-13,	/* 2**-40=0x3D700000,0 */
+twom48	= 3.55271367880050092936e-15,	/* 2**-48=0x3CF00000,0 */
+twom72	= 2.11758236813575084767e-22,	/* 2**-72=0x3B700000,0 */
+twom1022= 2.22507385850720138309e-308,	/* 2**-1022=0x00100000,0 */
+three51	= 6.75539944105574400000e+15,	/* 3*2**51=0x43380000,0 */
+bound	= 746.0,			/* above the overflow and underflow thresholds */
+log2e	= 1.44269504088896338700e+00,	/* 0x3FF71547, 0x652B82FE */
+/* ln2 = ln2a + ln2b + ln2c, ln2a and ln2b have 42 bits so that n*ln2a and n*ln2b are exact */
+ln2a	= 6.93147180559890330187e-01,	/* 0x3FE62E42, 0xFEFA3800 */
+ln2b	= 5.49792301870720995199e-14,	/* 0x3D2EF357, 0x93C76000 */
+ln2c	= 1.16122272293625324218e-26,	/* 0x3A8CC01F, 0x97B57A08 */
+/* Taylor coefficients of exp(s) - 1, double-length up to 1/5! */
+c3	= 1.66666666666666657415e-01,	/* 0x3FC55555, 0x55555555 */
+cc3	= 9.25185853854297065662e-18,	/* 0x3C655555, 0x55555555 */
+c4	= 4.16666666666666643537e-02,	/* 0x3FA55555, 0x55555555 */
+cc4	= 2.31296463463574266415e-18,	/* 0x3C455555, 0x55555555 */
+c5	= 8.33333333333333321769e-03,	/* 0x3F811111, 0x11111111 */
+cc5	= 1.15648231731787138023e-19,	/* 0x3C011111, 0x11111111 */
+c6	= 1.38888888888888894189e-03,	/* 0x3F56C16C, 0x16C16C17 */
+c7	= 1.98412698412698412526e-04,	/* 0x3F2A01A0, 0x1A01A01A */
+c8	= 2.48015873015873015658e-05,	/* 0x3EFA01A0, 0x1A01A01A */
+c9	= 2.75573192239858925110e-06,	/* 0x3EC71DE3, 0xA556C734 */
+/* Taylor coefficients of sin(s) and cos(s), double-length up to 1/6! */
+pio4	= 0.78,				/* below pi/4, no reduction under it */
+lim	= 1.6,				/* the polynomials below hold up to there */
+s3	= 1.66666666666666657415e-01,	/* 0x3FC55555, 0x55555555 */
+ss3	= 9.25185853854297065662e-18,	/* 0x3C655555, 0x55555555 */
+s5	= 8.33333333333333321769e-03,	/* 0x3F811111, 0x11111111 */
+ss5	= 1.15648231731787138023e-19,	/* 0x3C011111, 0x11111111 */
+s7	= 1.98412698412698412526e-04,	/* 0x3F2A01A0, 0x1A01A01A */
+s9	= 2.75573192239858925110e-06,	/* 0x3EC71DE3, 0xA556C734 */
+s11	= 2.50521083854417202239e-08,	/* 0x3E5AE645, 0x67F544E4 */
+k4	= 4.16666666666666643537e-02,	/* 0x3FA55555, 0x55555555 */
+kk4	= 2.31296463463574266415e-18,	/* 0x3C455555, 0x55555555 */
+k6	= 1.38888888888888894189e-03,	/* 0x3F56C16C, 0x16C16C17 */
+kk6	= -5.30054395437357705906e-20,	/* 0xBBEF49F4, 0x9F49F49F */
+k8	= 2.48015873015873015658e-05,	/* 0x3EFA01A0, 0x1A01A01A */
+k10	= 2.75573192239858882758e-07,	/* 0x3E927E4F, 0xB7789F5C */
+k12	= 2.08767569878681001866e-09,	/* 0x3E21EED8, 0xEFF8D898 */
+/* Relative error bound of the results, times 1+|y| for x^y because of the
+   error of log(x). Each ADD2, MUL2 and DIV2 of dla.h is within 2^-102 of
+   the exact result, see the bounds given there. For exp, the reduction is
+   within 2^-103, the polynomial within 2^-98 with the rounding of its
+   steps, and each squaring of 1+e keeps the relative error of e and adds
+   two roundings: below 2^-96 in all. For sin and cos, the reduced argument
+   is within 2^-95, see reduce_dla, and the polynomials and the doublings of
+   the angle add 2^-97. tan adds a DIV2. The bound below, about 2^-80, is
+   2^14 times larger than these, and only sends about one result in 2^27
+   more to the multi-precision code */
+err	= 8.27180612553027674871e-25;	/* 2**-80=0x3AF00000,0 */
+
+/* exp(x+xx) = (y+yy)*2^n for |x| < 746, with 0.7 < y < 1.42 */
+static void
+exp_dla (double x, double xx, double *y, double *yy, int *n)
+{
+  double t, r, rr, s, ss, e, ee, u, uu;
+  double p, hx, tx, hy, ty, q, c, cc;
+  u_int32_t lo;
+  int i;
+
+  /* x+xx = n*ln2 + r+rr, with |r| < 0.35. x-n*ln2a is exact */
+  t = x * log2e + three51;
+  GET_LOW_WORD (lo, t);
+  *n = (int32_t) lo;
+  t -= three51;
+  r = x - t * ln2a;
+  ADD2 (r, xx, -t * ln2b, -t * ln2c, r, rr, u, uu)
+
+  /* e = exp(s)-1 for s = (r+rr)/256, |s| < 0.0014 so the terms of degree
+     6 and more only need the precision of a double */
+  s = r * twom8;
+  ss = rr * twom8;
+  u = c6 + s * (c7 + s * (c8 + s * c9));
+  MUL2 (u, zero, s, ss, e, ee, p, hx, tx, hy, ty, q, c, cc)
+  ADD2 (c5, cc5, e, ee, e, ee, u, uu)
+  MUL2 (e, ee, s, ss, e, ee, p, hx, tx, hy, ty, q, c, cc)
+  ADD2 (c4, cc4, e, ee, e, ee, u, uu)
+  MUL2 (e, ee, s, ss, e, ee, p, hx, tx, hy, ty, q, c, cc)
+  ADD2 (c3, cc3, e, ee, e, ee, u, uu)
+  MUL2 (e, ee, s, ss, e, ee, p, hx, tx, hy, ty, q, c, cc)
+  ADD2 (half, zero, e, ee, e, ee, u, uu)
+  MUL2 (e, ee, s, ss, e, ee, p, hx, tx, hy, ty, q, c, cc)
+  MUL2 (e, ee, s, ss, e, ee, p, hx, tx, hy, ty, q, c, cc)
+  ADD2 (s, ss, e, ee, e, ee, u, uu)
+
+  /* exp(256*s)-1 by squaring 1+e eight times, as e*(e+2) to keep the
+     relative precision of e */
+  for (i = 0; i < 8; i++)
+    {
+      ADD2 (two, zero, e, ee, u, uu, t, r)
+      MUL2 (e, ee, u, uu, e, ee, p, hx, tx, hy, ty, q, c, cc)
+    }
+  ADD2 (one, zero, e, ee, *y, *yy, t, r)
+}
+
+/* Sets *res to (y+yy)*2^n rounded to nearest if y+yy, with the relative
+   error e, rounds to a single double, and the result is normal */
+static int
+round_dla (double y, double yy, double e, int n, double *res)
+{
+  double w, z, scale;
+
+  if (n < -1021 || n > 1023)
+    return 0;
+  e *= y;
+  w = y + (yy + e);
+  z = y + (yy - e);
+  if (w != z)
+    return 0;
+  INSERT_WORDS (scale, (u_int32_t) (1023 + n) << 20, 0);
+  *res = w * scale;
+  return 1;
+}
+
+/* The chunk i of 2/pi, an integer below 2^24 */
+static inline u_int64_t
+chunk (int i)
+{
+  u_int64_t ix;
+
+  EXTRACT_WORDS64 (ix, toverp[i]);
+  return ((ix & 0xfffffffffffffULL) | (1ULL << 52)) >> (1075 - (int) (ix >> 52));
+}
+
+/* The chunks from k+11 on add less than 2^-19 units of z[9] to x*2/pi, as
+   m*2^b is below 2^77. The fraction of x*2/pi is at least 2^-62 for every
+   double x, the closest case being x = 6381956970095103*2^797, so its first
+   nonzero limb is at most z[j0+2] and the limbs read up to z[j0+6] give it
+   within 2^-95. So 11 chunks are enough for the worst case, and the -1
+   return below is only a safeguard. */
+#define CHUNKS 11
+
+/* x = n*pi/2 + r+rr for a finite |x| >= pi/4, |r| <= pi/4. Returns n mod 4,
+   or -1 when the fraction of x*2/pi is too close to an integer for the
+   chunks used here */
+static int
+reduce_dla (double x, double *r, double *rr)
+{
+  u_int64_t ix, m, v, cy, v1, v2, a[4], z[CHUNKS + 3];
+  double f, ff, u, uu, scale;
+  double p, hx, tx, hy, ty, q, c, cc;
+  int e, k, b, i, j, j0, n, neg;
+
+  /* x*2/pi = m*2^b times the chunks from k on, scaled so that the integer
+     part ends in z[j0]. The chunks before k only add multiples of 4 */
+  EXTRACT_WORDS64 (ix, x);
+  e = (int) (ix >> 52) & 0x7ff;
+  m = (ix & 0xfffffffffffffULL) | (1ULL << 52);
+  e -= 1075;
+  if (e >= 2)
+    {
+      k = (e - 2) / 24;
+      b = e - 2 - 24 * k;
+      j0 = 3;
+    }
+  else
+    {
+      k = 0;
+      j0 = 3 - (25 - e) / 24;
+      b = 24 * (3 - j0) - (2 - e);
+    }
+  /* m*2^b in 24-bit limbs, a[0] in two shifts as 72-b may reach 64 */
+  a[0] = (m >> (48 - b)) >> 24;
+  a[1] = (m >> (48 - b)) & 0xffffff;
+  a[2] = (m >> (24 - b)) & 0xffffff;
+  a[3] = (m << b) & 0xffffff;
+  for (j = 0; j < CHUNKS + 3; j++)
+    z[j] = 0;
+  for (j = 0; j < CHUNKS; j++)
+    {
+      v = chunk (k + j);
+      for (i = 0; i < 4; i++)
+	z[i + j] += a[i] * v;
+    }
+  for (cy = 0, j = CHUNKS + 2; j >= j0; j--)
+    {
+      v = z[j] + cy;
+      z[j] = v & 0xffffff;
+      cy = v >> 24;
+    }
+
+  /* n is in the two leading bits of z[j0], and a fraction above 1/2 is
+     taken as its difference to 1 */
+  n = (int) (z[j0] >> 22);
+  z[j0] &= 0x3fffff;
+  neg = (int) (z[j0] >> 21);
+  if (neg)
+    {
+      n++;
+      for (cy = 1, j = CHUNKS + 2; j >= j0; j--)
+	{
+	  v = (~z[j] & 0xffffff) + cy;
+	  z[j] = v & 0xffffff;
+	  cy = v >> 24;
+	}
+      z[j0] &= 0x3fffff;
+    }
+  for (i = j0; i <= CHUNKS + 2 && z[i] == 0; i++)
+    ;
+  if (i + 4 > CHUNKS + 2)
+    return -1;
+
+  /* The fraction is (v1 + v2*2^-48 + z[i+4]*2^-96)*2^(-22-24*(i-j0+1)) */
+  v1 = (z[i] << 24) | z[i + 1];
+  v2 = (z[i + 2] << 24) | z[i + 3];
+  INSERT_WORDS (scale, (u_int32_t) (1023 - 22 - 24 * (i - j0 + 1)) << 20, 0);
+  u = (double) (long long) v1 * scale;
+  uu = (double) (long long) v2 * (scale * twom48);
+  EADD (u, uu, f, ff)
+  u = (double) (long long) z[i + 4] * (scale * twom72);
+  ADD2 (f, ff, u, zero, f, ff, p, q)
+  MUL2 (f, ff, hp0.x, hp1.x, *r, *rr, p, hx, tx, hy, ty, q, c, cc)
+  if (neg != (x < zero))
+    {
+      *r = -*r;
+      *rr = -*rr;
+    }
+  return (x < zero) ? (-n & 3) : (n & 3);
+}
+
+/* sin(x+dx) = (s+ss) and cos(x+dx) = (c+cc) if n is 0, else the values for
+   the argument reduced by n*pi/2. Returns n mod 4, or -1 */
+static int
+sincos_dla (double x, double dx, double *s, double *ss, double *c, double *cc)
+{
+  double r, rr, t, tt, q, qq, u, uu, sn, ssn, cm, ccm;
+  double p, hx, tx, hy, ty, w, v, vv;
+  u_int32_t hi;
+  int i, n;
+
+  EADD (x, dx, r, rr)
+  GET_HIGH_WORD (hi, r);
+  if ((hi & 0x7ff00000) == 0x7ff00000)
+    return -1;
+  /* The callers reduce x+dx themselves, or pass dx = 0 */
+  n = 0;
+  if (!(ABS (r) < pio4))
+    {
+      if (rr == zero)
+	n = reduce_dla (r, &r, &rr);
+      else if (!(ABS (r) < lim))
+	n = -1;
+      if (n < 0)
+	return -1;
+    }
+
+  /* sin(t) - t and cos(t) - 1 for t = (r+rr)/256, then the angle is
+     doubled 8 times. The terms of degree 7 and more of sin(t)/t and of
+     degree 8 and more of cos(t) only need the precision of a double */
+  t = r * twom8;
+  tt = rr * twom8;
+  MUL2 (t, tt, t, tt, q, qq, p, hx, tx, hy, ty, w, v, vv)
+  u = s7 - q * (s9 - q * s11);
+  MUL2 (u, zero, q, qq, u, uu, p, hx, tx, hy, ty, w, v, vv)
+  ADD2 (-s5, -ss5, u, uu, u, uu, v, vv)
+  MUL2 (u, uu, q, qq, u, uu, p, hx, tx, hy, ty, w, v, vv)
+  ADD2 (s3, ss3, u, uu, u, uu, v, vv)
+  MUL2 (u, uu, q, qq, u, uu, p, hx, tx, hy, ty, w, v, vv)
+  MUL2 (u, uu, t, tt, u, uu, p, hx, tx, hy, ty, w, v, vv)
+  ADD2 (t, tt, -u, -uu, sn, ssn, v, vv)
+
+  u = k8 - q * (k10 - q * k12);
+  MUL2 (u, zero, q, qq, u, uu, p, hx, tx, hy, ty, w, v, vv)
+  ADD2 (-k6, -kk6, u, uu, u, uu, v, vv)
+  MUL2 (u, uu, q, qq, u, uu, p, hx, tx, hy, ty, w, v, vv)
+  ADD2 (k4, kk4, u, uu, u, uu, v, vv)
+  MUL2 (u, uu, q, qq, u, uu, p, hx, tx, hy, ty, w, v, vv)
+  ADD2 (-half, zero, u, uu, u, uu, v, vv)
+  MUL2 (u, uu, q, qq, cm, ccm, p, hx, tx, hy, ty, w, v, vv)
+
+  /* sin(2t) = 2*sin(t)*(1+cm) and cos(2t)-1 = 2*cm*(2+cm) */
+  for (i = 0; i < 8; i++)
+    {
+      ADD2 (one, zero, cm, ccm, u, uu, v, vv)
+      MUL2 (sn, ssn, u, uu, sn, ssn, p, hx, tx, hy, ty, w, v, vv)
+      sn *= two;
+      ssn *= two;
+      ADD2 (two, zero, cm, ccm, u, uu, v, vv)
+      MUL2 (cm, ccm, u, uu, cm, ccm, p, hx, tx, hy, ty, w, v, vv)
+      cm *= two;
+      ccm *= two;
+    }
+  *s = sn;
+  *ss = ssn;
+  ADD2 (one, zero, cm, ccm, *c, *cc, v, vv)
+  return n;
+}
+
+int
+__slowexp_dla (double x, double *res)
+{
+  double y, yy;
+  int n;
+
+  if (fegetround () != FE_TONEAREST || !(ABS (x) < bound))
+    return 0;
+  exp_dla (x, zero, &y, &yy, &n);
+  return round_dla (y, yy, err, n, res);
+}
+
+/* x^y for a normal x > 0, z is log(x) within 2^-40 */
+int
+__slowpow_dla (double x, double y, double z, double *res)
+{
+  double e, ee, t, tt, l, ll, w, ww, u, uu, s1, s2;
+  double p, hx, tx, hy, ty, q, c, cc;
+  int n, h;
+
+  if (fegetround () != FE_TONEAREST || !(x >= twom1022) || !(ABS (z) < bound))
+    return 0;
+
+  /* log(x) = z + log(1+t), with 1+t = x*exp(-z) computed as x*2^n*(e+ee).
+     x*2^n is exact, in two steps as 2^n may not be normal */
+  exp_dla (-z, zero, &e, &ee, &n);
+  h = n / 2;
+  INSERT_WORDS (s1, (u_int32_t) (1023 + h) << 20, 0);
+  INSERT_WORDS (s2, (u_int32_t) (1023 + n - h) << 20, 0);
+  u = x * s1 * s2;
+  MUL2 (u, zero, e, ee, u, uu, p, hx, tx, hy, ty, q, c, cc)
+  t = u - one;
+  if (!(ABS (t) < twom40))
+    return 0;
+  ADD2 (t, zero, uu, zero, t, tt, l, ll)
+
+  /* log(1+t) = t - t^2/2, the next term is below 2^-120 */
+  ADD2 (t, tt, -half * t * t, zero, t, tt, l, ll)
+  ADD2 (z, zero, t, tt, l, ll, u, uu)
+
+  MUL2 (y, zero, l, ll, w, ww, p, hx, tx, hy, ty, q, c, cc)
+  if (!(ABS (w) < bound))
+    return 0;
+  exp_dla (w, ww, &e, &ee, &n);
+  return round_dla (e, ee, err * (one + ABS (y)), n, res);
+}
+
+int
+__mpsin_dla (double x, double dx, double *res)
+{
+  double s, ss, c, cc;
+  int n;
+
+  if (fegetround () != FE_TONEAREST)
+    return 0;
+  n = sincos_dla (x, dx, &s, &ss, &c, &cc);
+  switch (n)
+    {
+    case 0:
+      return round_dla (s, ss, err, 0, res);
+    case 1:
+      return round_dla (c, cc, err, 0, res);
+    case 2:
+      return round_dla (-s, -ss, err, 0, res);
+    case 3:
+      return round_dla (-c, -cc, err, 0, res);
+    }
+  return 0;
+}
+
+int
+__mpcos_dla (double x, double dx, double *res)
+{
+  double s, ss, c, cc;
+  int n;
+
+  if (fegetround () != FE_TONEAREST)
+    return 0;
+  n = sincos_dla (x, dx, &s, &ss, &c, &cc);
+  /* Without the reduction cos(x+dx) may be small, its error is absolute */
+  if (n == 0 && !(ABS (x + dx) < pio4) && !(ABS (c) > half))
+    return 0;
+  switch (n)
+    {
+    case 0:
+      return round_dla (c, cc, err, 0, res);
+    case 1:
+      return round_dla (-s, -ss, err, 0, res);
+    case 2:
+      return round_dla (-c, -cc, err, 0, res);
+    case 3:
+      return round_dla (s, ss, err, 0, res);
+    }
+  return 0;
+}
+
+int
+__mptan_dla (double x, double *res)
+{
+  double s, ss, c, cc, t, tt;
+  double p, hx, tx, hy, ty, q, w, ww, u, uu;
+  int n;
+
+  if (fegetround () != FE_TONEAREST)
+    return 0;
+  n = sincos_dla (x, zero, &s, &ss, &c, &cc);
+  if (n < 0 || (n == 0 && !(ABS (x) < pio4) && !(ABS (c) > half)))
+    return 0;
+  if (n & 1)
+    {
+      DIV2 (c, cc, s, ss, t, tt, p, hx, tx, hy, ty, q, w, ww, u, uu)
+      t = -t;
+      tt = -tt;
+    }
+  else
+    {
+      DIV2 (s, ss, c, cc, t, tt, p, hx, tx, hy, ty, q, w, ww, u, uu)
+    }
+  return round_dla (t, tt, err, 0, res);
+}
+
+#else
+
+int
+__slowexp_dla (double x, double *res)
+{
+  return 0;
+}
+
+int
+__slowpow_dla (double x, double y, double z, double *res)
+{
+  return 0;
+}
+
+int
+__mpsin_dla (double x, double dx, double *res)
+{
+  return 0;
+}
+
+int
+__mpcos_dla (double x, double dx, double *res)
+{
+  return 0;
+}
+
+int
+__mptan_dla (double x, double *res)
+{
+  return 0;
+}
+
+#endif
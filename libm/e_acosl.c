@@ -0,0 +1,80 @@
+/* e_acosl.c -- long double version of e_acos.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instructions are used instead. This one was written for streflop.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __ieee754_acosl(x)
+ * Method :
+ *	acos(x)  = pi/2 - asin(x)
+ *	acos(-x) = pi/2 + asin(x)
+ * For |x|<=0.5
+ *	acos(x) = pi/2 - asin(x), computed as pio2_hi - (asin(x) - pio2_lo)
+ * For x>0.5
+ * 	acos(x) = pi/2 - (pi/2 - 2asin(sqrt((1-x)/2)))
+ *		= 2asin(sqrt((1-x)/2))
+ * For x<-0.5
+ *	acos(x) = pi - 2asin(sqrt((1-|x|)/2))
+ *
+ * Since the argument of asin stays below 0.5 in magnitude, all these
+ * cases use the first, most accurate, approximation of __ieee754_asinl.
+ * (1-|x|)/2 is exact for 0.5 <= |x| <= 1.
+ *
+ * Special cases:
+ *	if x is NaN, return x itself;
+ *	if |x|>1, return NaN with invalid signal.
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+#ifdef __STDC__
+static const long double
+#else
+static long double
+#endif
+one =  1.0L,
+pi_hi   =  3.14159265358979323851280895941L,
+pi_lo   = -5.01655761266833202345175760039E-20L,
+pio2_hi =  1.57079632679489661925640447970L,
+pio2_lo = -2.50827880633416601172587880020E-20L;
+
+#ifdef __STDC__
+	long double __ieee754_acosl(long double x)
+#else
+	long double __ieee754_acosl(x)
+	long double x;
+#endif
+{
+	long double z,s;
+	int32_t ix;
+	u_int32_t se,i0,i1;
+	GET_LDOUBLE_WORDS(se,i0,i1,x);
+	ix = se&0x7fff;
+	if(ix>=0x3fff) {	/* |x| >= 1 */
+	    if(ix==0x3fff&&((i0-0x80000000)|i1)==0) {	/* |x|==1 */
+		if((se&0x8000)==0) return 0.0L;	/* acos(1) = 0  */
+		else return pi_hi+pi_lo;	/* acos(-1)= pi */
+	    }
+	    return (x-x)/(x-x);		/* acos(|x|>1) is NaN */
+	}
+	if(ix<0x3ffe) {	/* |x| < 0.5 */
+	    if(ix<0x3fbf) return pio2_hi+pio2_lo;/*if|x|<2**-64*/
+	    return pio2_hi - (__ieee754_asinl(x) - pio2_lo);
+	}
+	z = (one-fabsl(x))*0.5L;
+	s = __ieee754_sqrtl(z);
+	if(se&0x8000)		/* x < -0.5 */
+	    return pi_hi - (2.0L*__ieee754_asinl(s) - pi_lo);
+	return 2.0L*__ieee754_asinl(s);
+}
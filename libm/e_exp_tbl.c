@@ -0,0 +1,242 @@
+/* e_exp_tbl.c -- table-driven versions of e_exp.c and e_exp2.c.
+ * Written for streflop. With STREFLOP_TABLE_EXPLOG defined, these replace the
+ * dbl-64 __ieee754_exp and __ieee754_exp2, which check their result against
+ * an error bound and fall back to multi-precision code when the check fails.
+ * These have a fixed cost and only use the basic IEEE operations, so the
+ * results are the same for all configurations. They are not correctly
+ * rounded: the error is below 0.51 ulp for exp and 0.512 ulp for exp2, see
+ * the bound below. On 400000 random arguments per function, subnormal results
+ * included, the largest error measured was 0.507 ulp, and the results differed
+ * from the correctly rounded ones for less than 0.2% of the arguments.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __ieee754_exp(x)
+ * Returns the exponential of x.
+ *
+ * Method
+ *   1. Argument reduction:
+ *	Given x, find r and integer k such that
+ *
+ *		x = k*ln2/128 + r,  |r| <= ln2/256.
+ *
+ *	k is the nearest integer to x*128/ln2. ln2/128 is split in
+ *	ln2_128hi + ln2_128lo, where ln2_128hi has only 35 bits so that
+ *	k*ln2_128hi is exact for all the k not leading to an overflow.
+ *
+ *   2. Approximation of exp(r) - 1 by its Taylor polynomial of degree 6,
+ *	p(r) = r + r^2/2 + ... + r^6/720, the error is below 2^-70.
+ *
+ *   3. Reconstruction: with k = 128*m + j, 0 <= j < 128,
+ *		exp(x) = 2^m * 2^(j/128) * (1 + p(r))
+ *	where 2^(j/128) = T_hi + T_lo is read from the table in t_exp_tbl.h:
+ *		exp(x) = 2^m * (T_hi + (T_lo + T_hi*p(r)))
+ *	Error bound, with ulp = 2^-52 the ulp of a result in [1,2):
+ *	- reduction: t*ln2_128hi and x - t*ln2_128hi are exact, the rounding
+ *	  of t*ln2_128lo and the error of ln2_128hi + ln2_128lo are below
+ *	  2^-78, and the rounding of r = hi - lo is at most 2^-62 as
+ *	  |r| < 2^-8. The relative error of exp(r) is below 1.001*2^-62.
+ *	- polynomial: the truncation error is below 2^-70, the rounding of
+ *	  the coefficients adds less than 2^-75.
+ *	- evaluation: the rounding of p = r + r*r*(...) is at most 2^-62 as
+ *	  |p| < 2^-8, the ones of r*r*(...) are below 2^-69. Times T_hi < 2,
+ *	  with the reduction and the truncation, this is below 2.02*2^-61.
+ *	- reconstruction: T_hi*p and T_lo + T_hi*p are below 2^-7, so each
+ *	  is rounded by at most 2^-61. The term T_lo*p left out is below
+ *	  2^-53*2^-8 = 2^-61. T_hi + T_lo is 2^(j/128) to 2^-106.
+ *	The sum is below 5.02*2^-61 = 0.0099 ulp, and the last addition
+ *	rounds by at most 0.5 ulp, so the error is below 0.51 ulp. A result
+ *	below 1 has j = 0, where T_hi*p and T_lo + T_hi*p are exact, and the
+ *	sum is below 2.02*2^-62, 0.004 of its ulp 2^-53.
+ *
+ *   4. Scaling by 2^m: exact for a normal result. A subnormal result is
+ *	first computed in the normal range as y = yhi + ylo, then rounded
+ *	once to the precision it has as a subnormal by adding 1, and only
+ *	then scaled. Scaling the rounded result would round it twice. The
+ *	error of y is that of z scaled by s <= 1/2, so the bound holds.
+ *
+ * Special cases:
+ *	exp(INF) is INF, exp(NaN) is NaN;
+ *	exp(-INF) is 0, and
+ *	for finite argument, only exp(0)=1 is exact.
+ *
+ * Overflow and Underflow:
+ *	if x > 7.09782712893383973096e+02 then exp(x) overflows
+ *	if x < -7.45133219101941108420e+02 then exp(x) underflows
+ *
+ * __ieee754_exp2(x)
+ *	Same method with x = k/128 + r, |r| <= 1/256, which is exact. The
+ *	polynomial is the Taylor one of 2^r - 1, with coefficients ln2^n/n!.
+ *	Q1 = ln2 is rounded by at most 2^-54, and Q1 + r*(...) as well, so
+ *	with the rounding of p = r*(...) the error of p is below 3*2^-62
+ *	plus less than 2^-70. Times T_hi < 2 this is 3.01*2^-61 instead of
+ *	2.02*2^-61, and the error is below 6.01*2^-61 + 0.5 ulp < 0.512 ulp.
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+#ifdef __STDC__
+static const double
+#else
+static double
+#endif
+one	= 1.0,
+halF[2]	= {0.5,-0.5,},
+huge	= 1.0e+300,
+twom1000= 9.33263618503218878990e-302,	/* 2**-1000=0x01700000,0 */
+twom1022= 2.22507385850720138309e-308,	/* 2**-1022=0x00100000,0 */
+o_threshold=  7.09782712893383973096e+02,  /* 0x40862E42, 0xFEFA39EF */
+u_threshold= -7.45133219101941108420e+02,  /* 0xc0874910, 0xD52D3051 */
+ln2_128hi =  5.41521234822539554536e-03,  /* 0x3F762E42, 0xFEFC0000, 35 bits */
+ln2_128lo = -1.00822814609977686658e-13,  /* 0xBD3C610C, 0xA86C3899 */
+invln2_128 = 1.84664965233787316142e+02,  /* 0x40671547, 0x652B82FE, 128/ln2 */
+/* Taylor coefficients of exp(r) - 1 */
+P2 = 5.00000000000000000000e-01,
+P3 = 1.66666666666666657415e-01,  /* 0x3FC55555, 0x55555555 */
+P4 = 4.16666666666666643537e-02,  /* 0x3FA55555, 0x55555555 */
+P5 = 8.33333333333333321769e-03,  /* 0x3F811111, 0x11111111 */
+P6 = 1.38888888888888894189e-03,  /* 0x3F56C16C, 0x16C16C17 */
+/* Taylor coefficients of 2^r - 1, ln2^n/n! */
+Q1 = 6.93147180559945286227e-01,  /* 0x3FE62E42, 0xFEFA39EF */
+Q2 = 2.40226506959100721827e-01,  /* 0x3FCEBFBD, 0xFF82C58F */
+Q3 = 5.55041086648215831190e-02,  /* 0x3FAC6B08, 0xD704A0C0 */
+Q4 = 9.61812910762847716197e-03,  /* 0x3F83B2AB, 0x6FBA4E77 */
+Q5 = 1.33335581464284434234e-03,  /* 0x3F55D87F, 0xE78A6731 */
+Q6 = 1.54035303933816087761e-04;  /* 0x3F243091, 0x2F86C787 */
+
+#include "t_exp_tbl.h"
+
+#ifdef STREFLOP_TABLE_EXPLOG
+
+/* Returns 2^m * (T_hi + (T_lo + T_hi*p)), for T = 2^(j/128) */
+#ifdef __STDC__
+static double exp_tbl_scale(int32_t m, int32_t j, double p)
+#else
+static double exp_tbl_scale(m,j,p)
+	int32_t m,j; double p;
+#endif
+{
+	double z,s,yhi,ylo,y,hi,lo;
+	u_int32_t hz;
+
+	if(m >= -1021) {			/* normal output */
+	    z = exp2_128_hi[j] + (exp2_128_lo[j] + exp2_128_hi[j]*p);
+	    GET_HIGH_WORD(hz,z);
+	    if(m > 1020) {			/* 2^m itself would overflow */
+		SET_HIGH_WORD(z,hz+((m-2)<<20));
+		return z*4.0;
+	    }
+	    SET_HIGH_WORD(z,hz+(m<<20));
+	    return z;
+	}
+    /* subnormal output, s = 2^(m+1022) is normal */
+	INSERT_WORDS(s,(u_int32_t)(m+1022+0x3ff)<<20,0);
+	yhi = s*exp2_128_hi[j];
+	ylo = s*(exp2_128_lo[j] + exp2_128_hi[j]*p);
+	y   = yhi + ylo;
+	if(y < one) {
+	    lo = (yhi - y) + ylo;		/* rounding error of y */
+	    hi = one + y;			/* rounds y to a multiple of 2^-52 */
+	    lo = ((one - hi) + y) + lo;
+	    y  = (hi + lo) - one;
+	}
+	return y*twom1022;			/* exact */
+}
+
+#ifdef __STDC__
+	double __ieee754_exp(double x)	/* default IEEE double exp */
+#else
+	double __ieee754_exp(x)	/* default IEEE double exp */
+	double x;
+#endif
+{
+	double hi,lo,r,p,t;
+	int32_t k,j,xsb;
+	u_int32_t hx;
+
+	GET_HIGH_WORD(hx,x);
+	xsb = (hx>>31)&1;		/* sign bit of x */
+	hx &= 0x7fffffff;		/* high word of |x| */
+
+    /* filter out non-finite argument */
+	if(hx >= 0x40862E42) {			/* if |x|>=709.78... */
+	    if(hx>=0x7ff00000) {
+		u_int32_t lx;
+		GET_LOW_WORD(lx,x);
+		if(((hx&0xfffff)|lx)!=0)
+		    return x+x; 		/* NaN */
+		else return (xsb==0)? x:0.0;	/* exp(+-inf)={inf,0} */
+	    }
+	    if(x > o_threshold) return huge*huge; /* overflow */
+	    if(x < u_threshold) return twom1000*twom1000; /* underflow */
+	}
+	else if(hx < 0x3c900000) {		/* when |x|<2**-54 */
+	    if(huge+x>one) return one+x;	/* trigger inexact */
+	}
+
+    /* argument reduction */
+	k  = (int32_t)(invln2_128*x+halF[xsb]);
+	t  = k;
+	hi = x - t*ln2_128hi;	/* t*ln2_128hi is exact here */
+	lo = t*ln2_128lo;
+	r  = hi - lo;
+
+    /* x is now in primary range */
+	p  = r + r*r*(P2+r*(P3+r*(P4+r*(P5+r*P6))));
+	j  = k&127;
+	return exp_tbl_scale((k-j)/128,j,p);
+}
+
+#ifdef __STDC__
+	double __ieee754_exp2(double x)
+#else
+	double __ieee754_exp2(x)
+	double x;
+#endif
+{
+	double r,p,t;
+	int32_t k,j,xsb;
+	u_int32_t hx;
+
+	GET_HIGH_WORD(hx,x);
+	xsb = (hx>>31)&1;		/* sign bit of x */
+	hx &= 0x7fffffff;		/* high word of |x| */
+
+    /* filter out non-finite argument */
+	if(hx >= 0x408ff000) {			/* if |x|>=1022 */
+	    if(hx>=0x7ff00000) {
+		u_int32_t lx;
+		GET_LOW_WORD(lx,x);
+		if(((hx&0xfffff)|lx)!=0)
+		    return x+x; 		/* NaN */
+		else return (xsb==0)? x:0.0;	/* exp2(+-inf)={inf,0} */
+	    }
+	    if(x >= 1024.0) return huge*huge; /* overflow */
+	    if(x <= -1075.0) return twom1000*twom1000; /* underflow */
+	}
+	else if(hx < 0x3c900000) {		/* when |x|<2**-54 */
+	    if(huge+x>one) return one+x;	/* trigger inexact */
+	}
+
+    /* argument reduction, exact */
+	k  = (int32_t)(128.0*x+halF[xsb]);
+	t  = k;
+	r  = x - t*7.8125e-03;	/* 1/128 */
+
+	p  = r*(Q1+r*(Q2+r*(Q3+r*(Q4+r*(Q5+r*Q6)))));
+	j  = k&127;
+	return exp_tbl_scale((k-j)/128,j,p);
+}
+
+#endif
@@ -0,0 +1,94 @@
+/* e_expf_batch.c -- written for streflop.
+ * Packed version of __ieee754_expf in e_expf.c, for the arguments with
+ * |x| < 88.72 whose result is not subnormal, see batch.h. The branches of
+ * the argument reduction are all computed, and selected lane by lane. The
+ * other arguments are computed by __ieee754_expf.
+ */
+
+#include "math.h"
+#include "math_private.h"
+#include "batch.h"
+
+void __expf_batch(const float *in, float *out, size_t n);
+
+#ifdef STREFLOP_BATCH_PACKED
+
+#ifdef __STDC__
+static const float
+#else
+static float
+#endif
+one	= 1.0,
+halF	= 0.5,
+ln2HI   = 6.9313812256e-01,	/* 0x3f317180 */
+ln2LO   = 9.0580006145e-06,	/* 0x3717f7d1 */
+invln2 =  1.4426950216e+00, 		/* 0x3fb8aa3b */
+P1   =  1.6666667163e-01, /* 0x3e2aaaab */
+P2   = -2.7777778450e-03, /* 0xbb360b61 */
+P3   =  6.6137559770e-05, /* 0x388ab355 */
+P4   = -1.6533901999e-06, /* 0xb5ddea0e */
+P5   =  4.1381369442e-08; /* 0x3331bb4c */
+
+/* The result for the lanes where the returned mask is set */
+static inline vfmask
+expf_lanes (vfloat x, vfloat *r)
+{
+	vfloat y,hi,lo,c,t,sh,sl,sf,h1,l1,r0;
+	vint k,k1,xsb,hx;
+	vfmask neg,red;
+
+	hx = (vint) x;
+	xsb = (hx>>31)&1;		/* sign bit of x */
+	hx &= 0x7fffffff;		/* high word of |x| */
+	neg = xsb != 0;
+	sh = vf_select(neg,(vfloat){0}-ln2HI,(vfloat){0}+ln2HI);	/* ln2HI[xsb] */
+	sl = vf_select(neg,(vfloat){0}-ln2LO,(vfloat){0}+ln2LO);	/* ln2LO[xsb] */
+	sf = vf_select(neg,(vfloat){0}-halF,(vfloat){0}+halF);	/* halF[xsb] */
+
+    /* argument reduction, |x| < 1.5 ln2 */
+	h1 = x-sh; l1=sl; k1 = 1-xsb-xsb;
+    /* and the others */
+	k  = __builtin_convertvector(invln2*x+sf,vint);
+	t  = __builtin_convertvector(k,vfloat);
+	hi = x - t*ln2HI;	/* t*ln2HI is exact here */
+	lo = t*ln2LO;
+	red = hx < 0x3F851592;
+	hi = vf_select(red,h1,hi);
+	lo = vf_select(red,l1,lo);
+	k = vi_select(red,k1,k);
+
+	red = hx > 0x3eb17218;		/* if  |x| > 0.5 ln2 */
+	x = vf_select(red,hi - lo,x);
+	k = red & k;
+
+    /* x is now in primary range */
+	t  = x*x;
+	c  = x - t*(P1+t*(P2+t*(P3+t*(P4+t*P5))));
+	r0 = one-((x*c)/(c-(float)2.0)-x);
+	y = one-((lo-(x*c)/((float)2.0-c))-hi);
+	y = (vfloat)((vint)y+(k<<23));	/* add k to y's exponent */
+	y = vf_select(k==0,r0,y);
+	*r = vf_select(hx < 0x31800000,one+x,y);	/* when |x|<2**-28 */
+	return (hx < 0x42b17218) & (k >= -125);
+}
+
+void
+__expf_batch(const float *in, float *out, size_t n)
+{
+  size_t i;
+  int l;
+
+  for (i = 0; i + FLANES <= n; i += FLANES)
+    {
+      vfloat x = vf_load (in + i), res;
+      vfmask ok = expf_lanes (x, &res);
+      vf_store (out + i, res);
+      for (l = 0; l < FLANES; l++)
+	if (!ok[l])
+	  out[i + l] = __ieee754_expf (x[l]);
+    }
+  for (; i < n; i++)
+    out[i] = __ieee754_expf (in[i]);
+}
+
+#endif
@@ -0,0 +1,121 @@
+/* e_expl.c -- long double version of e_exp.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instructions are used instead. This one was written for streflop.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __ieee754_expl(x)
+ * Returns the exponential of x.
+ *
+ * Method
+ *   1. Argument reduction:
+ *	Given x, find r and integer k such that
+ *
+ *		x = k*ln2/32 + r,  |r| <= ln2/64.
+ *
+ *	k is the nearest integer to x*32/ln2. ln2/32 is split in
+ *	ln2_32hi + ln2_32lo, where ln2_32hi has only 44 bits so that
+ *	k*ln2_32hi is exact for all the k not leading to an overflow.
+ *
+ *   2. Approximation of exp(r) - 1 by its Taylor polynomial p(r),
+ *	see t_expl.h.
+ *
+ *   3. Reconstruction: with k = 32*m + j, 0 <= j < 32,
+ *		exp(x) = 2^m * 2^(j/32) * (1 + p(r))
+ *	where 2^(j/32) = T_hi + T_lo is read from the table in t_expl.h:
+ *		exp(x) = 2^m * (T_hi + (T_lo + T_hi*p(r)))
+ *
+ * Special cases:
+ *	exp(INF) is INF, exp(NaN) is NaN;
+ *	exp(-INF) is 0, and
+ *	for finite argument, only exp(0)=1 is exact.
+ *
+ * Overflow and Underflow:
+ *	if x > 1.1356523406294143949e+04 then exp(x) overflows
+ *	if x < -1.1399498531488860559e+04 then exp(x) underflows
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+#ifdef __STDC__
+static const long double
+#else
+static long double
+#endif
+one	= 1.0L,
+halF[2]	= {0.5L,-0.5L,},
+huge	= 1.0e+4900L,
+tiny	= 1.0e-4900L,
+twom16000 = 3.31184022194550157139472849084E-4817L, /* 2^-16000 */
+o_threshold =  1.13565234062941439496796647290E+4L,
+u_threshold = -1.13994985314888605589800363305E+4L,
+ln2_32hi =  2.16608493924983491751845576800E-2L, /* 44 bits */
+ln2_32lo = -5.82558960538844725799442856763E-17L,
+invln2_32 = 4.61662413084468290364048570495E+1L; /* 32/ln2 */
+
+#include "t_expl.h"
+
+#ifdef __STDC__
+	long double __ieee754_expl(long double x)
+#else
+	long double __ieee754_expl(x)
+	long double x;
+#endif
+{
+	long double hi,lo,r,p,t,z;
+	int32_t k,j,m,xsb,ix;
+	u_int32_t se,i0,i1;
+
+	GET_LDOUBLE_WORDS(se,i0,i1,x);
+	xsb = (se>>15)&1;		/* sign bit of x */
+	ix = se&0x7fff;			/* exponent of x */
+
+    /* filter out non-finite argument */
+	if(ix >= 0x400c) {			/* if |x|>=8192 */
+	    if(ix==0x7fff) {
+		if(((i0&0x7fffffff)|i1)!=0)
+		    return x+x;		/* NaN */
+		if(xsb==0) return x;	/* exp(+inf)=+inf */
+		return 0.0L;		/* exp(-inf)=0 */
+	    }
+	    if(x > o_threshold) return huge*huge; /* overflow */
+	    if(x < u_threshold) return tiny*tiny; /* underflow */
+	}
+	else if(ix < 0x3fbd) {		/* when |x|<2**-66 */
+	    if(huge+x>one) return one+x;/* trigger inexact */
+	}
+
+    /* argument reduction */
+	k  = (int32_t)(invln2_32*x+halF[xsb]);
+	t  = k;
+	hi = x - t*ln2_32hi;	/* t*ln2_32hi is exact here */
+	lo = t*ln2_32lo;
+	r  = hi - lo;
+
+    /* x is now in primary range */
+	p  = r + r*r*(P2+r*(P3+r*(P4+r*(P5+r*(P6+r*(P7+r*P8))))));
+	j  = k&31;
+	m  = (k-j)/32;
+	z  = exp2_32_hi[j] + (exp2_32_lo[j] + exp2_32_hi[j]*p);
+
+    /* scale by 2^m */
+	GET_LDOUBLE_EXP(se,z);
+	if(m >= -16000) {
+	    if((int32_t)se+m >= 0x7fff) return huge*huge; /* overflow */
+	    SET_LDOUBLE_EXP(z,se+m);
+	    return z;
+	}
+	SET_LDOUBLE_EXP(z,se+m+16000);	/* subnormal output */
+	return z*twom16000;
+}
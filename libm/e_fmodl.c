@@ -0,0 +1,95 @@
+/* e_fmodl.c -- long double version of e_fmod.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instructions are used instead. This one was written for streflop.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/*
+ * __ieee754_fmodl(x,y)
+ * Return x mod y in exact arithmetic
+ * Method: shift and subtract, on the 64-bit mantissas.
+ *	The remainder mx is kept below my, so that 2*mx-my is computed
+ *	as mx-(my-mx) and never overflows.
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+#ifdef __STDC__
+static const long double one = 1.0L, Zero[] = {0.0L, -0.0L,};
+#else
+static long double one = 1.0L, Zero[] = {0.0L, -0.0L,};
+#endif
+
+#ifdef __STDC__
+	long double __ieee754_fmodl(long double x, long double y)
+#else
+	long double __ieee754_fmodl(x,y)
+	long double x,y ;
+#endif
+{
+	int32_t n,ix,iy,sx;
+	u_int32_t se,i0,i1;
+	u_int64_t mx,my;
+
+	GET_LDOUBLE_WORDS(se,i0,i1,x);
+	sx = (se>>15)&1;		/* sign of x */
+	ix = se&0x7fff;
+	mx = ((u_int64_t)i0<<32)|i1;
+	GET_LDOUBLE_WORDS(se,i0,i1,y);
+	iy = se&0x7fff;
+	my = ((u_int64_t)i0<<32)|i1;
+
+    /* purge off exception values */
+	if(my==0||(ix==0x7fff)||		/* y=0,or x not finite */
+	  (iy==0x7fff&&(my<<1)!=0))		/* or y is NaN */
+	    return (x*y)/(x*y);
+	if(ix<iy||(ix==iy&&mx<=my)) {
+	    if(ix<iy||mx<my) return x;	/* |x|<|y| return x */
+	    return Zero[sx];		/* |x|=|y| return x*0*/
+	}
+
+    /* normalize subnormal x and y */
+	if(ix==0) {
+	    for (ix = 1; (mx&0x8000000000000000ULL)==0; mx<<=1) ix -= 1;
+	}
+	if(iy==0) {
+	    for (iy = 1; (my&0x8000000000000000ULL)==0; my<<=1) iy -= 1;
+	}
+
+    /* fix point fmod */
+	if(mx>=my) mx -= my;
+	n = ix - iy;
+	while(n--) {
+	    if(mx==0)			/* return sign(x)*0 */
+		return Zero[sx];
+	    if(mx>=my-mx) mx -= my-mx;	/* 2*mx-my */
+	    else mx += mx;
+	}
+
+    /* convert back to floating value and restore the sign */
+	if(mx==0)			/* return sign(x)*0 */
+	    return Zero[sx];
+	while((mx&0x8000000000000000ULL)==0) {	/* normalize x */
+	    mx <<= 1;
+	    iy -= 1;
+	}
+	if(iy>=1) {		/* normalize output */
+	    SET_LDOUBLE_WORDS(x,(sx<<15)|iy,(u_int32_t)(mx>>32),(u_int32_t)mx);
+	} else {		/* subnormal output */
+	    mx >>= 1-iy;
+	    SET_LDOUBLE_WORDS(x,sx<<15,(u_int32_t)(mx>>32),(u_int32_t)mx);
+	    x *= one;		/* create necessary signal */
+	}
+	return x;		/* exact output */
+}
@@ -0,0 +1,113 @@
+/* e_log2l.c -- long double version of e_log2.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instructions are used instead. This one was written for streflop.
+ */
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __ieee754_log2l(x)
+ * Return the base 2 logarithm of x
+ *
+ * Method :
+ *	Compute log(1+f) as in e_logl.c, but keep the result as the sum
+ *	hi+lo, where hi has only 32 bits. Then
+ *		log2(x) = k + (hi+lo)*(ivln2hi+ivln2lo)
+ *	where ivln2hi has 32 bits too, so that hi*ivln2hi is exact.
+ *	k is added last with an extra correction, so the result is
+ *	exact for the powers of two.
+ *
+ * Special cases:
+ *	log2(x) is NaN with signal if x < 0;
+ *	log2(+INF) is +INF with no signal; log2(0) is -INF with signal;
+ *	log2(NaN) is that NaN with no signal;
+ *	log2(2**N) = N  for N=-16445,...,16383.
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+#ifdef __STDC__
+static const long double
+#else
+static long double
+#endif
+two64   =  1.84467440737095516160000000000E+19L,	/* 2^64 */
+Lg1 = 6.66666666666666666684736702875E-1L,  /* 2/3 */
+Lg2 = 4.00000000000000000005421010862E-1L,  /* 2/5 */
+Lg3 = 2.85714285714285714281842135098E-1L,  /* 2/7 */
+Lg4 = 2.22222222222222222219210549521E-1L,  /* 2/9 */
+Lg5 = 1.81818181818181818186746373511E-1L,  /* 2/11 */
+Lg6 = 1.53846153846153846155931158024E-1L,  /* 2/13 */
+Lg7 = 1.33333333333333333339657846006E-1L,  /* 2/15 */
+Lg8 = 1.17647058823529411765104486093E-1L,  /* 2/17 */
+Lg9 = 1.05263157894736842103123285186E-1L,  /* 2/19 */
+Lg10 = 9.52380952380952380939473783661E-2L,  /* 2/21 */
+Lg11 = 8.69565217391304347814302150299E-2L,  /* 2/23 */
+Lg12 = 7.99999999999999999983736967413E-2L,  /* 2/25 */
+ivln2hi =  1.44269504072144627571105957031L,	/* 32 bits */
+ivln2lo =  1.67517131648865110691648848044E-10L,
+zero   =  0.0L;
+
+#ifdef __STDC__
+	long double __ieee754_log2l(long double x)
+#else
+	long double __ieee754_log2l(x)
+	long double x;
+#endif
+{
+	long double f,hfsq,hi,lo,s,R,w,y,z,val_hi,val_lo;
+	int32_t k,ix;
+	u_int32_t se,i0,i1;
+
+	GET_LDOUBLE_WORDS(se,i0,i1,x);
+	ix = se&0x7fff;
+
+	k=0;
+	if (ix==0) {			/* x < 2**-16382  */
+	    if ((i0|i1)==0)
+		return -two64/zero;	/* log(+-0)=-inf */
+	    if (se&0x8000) return (x-x)/zero;	/* log(-#) = NaN */
+	    k -= 64; x *= two64; /* subnormal number, scale up x */
+	    GET_LDOUBLE_WORDS(se,i0,i1,x);
+	    ix = se&0x7fff;
+	}
+	if (se&0x8000) return (x-x)/zero;	/* log(-#) = NaN */
+	if (ix==0x7fff) return x+x;
+	k += ix-0x3fff;
+    /* normalize x or x/2 into [sqrt(2)/2, sqrt(2)) */
+	if (i0>0xb504f333) {
+	    SET_LDOUBLE_EXP(x,0x3ffe);
+	    k += 1;
+	} else SET_LDOUBLE_EXP(x,0x3fff);
+	f = x-1.0L;
+	y = (long double)k;
+	if (f==zero) return y;
+	s = f/(2.0L+f);
+	z = s*s;
+	R = z*(Lg1+z*(Lg2+z*(Lg3+z*(Lg4+z*(Lg5+z*(Lg6+z*(Lg7+z*(Lg8+z*(Lg9+z*(Lg10+z*(Lg11+z*Lg12)))))))))));
+	hfsq = 0.5L*f*f;
+
+    /* hi+lo = f - hfsq + s*(hfsq+R) = log(1+f), with hi on 32 bits */
+	hi = f-hfsq;
+	GET_LDOUBLE_WORDS(se,i0,i1,hi);
+	SET_LDOUBLE_WORDS(hi,se,i0,0);
+	lo = (f-hi)-hfsq+s*(hfsq+R);
+
+	val_hi = hi*ivln2hi;
+	val_lo = (lo+hi)*ivln2lo + lo*ivln2hi;
+
+    /* add k, the correction is exact as |val_hi| < 1 */
+	w = y + val_hi;
+	val_lo += (y - w) + val_hi;
+	val_hi = w;
+
+	return val_lo + val_hi;
+}
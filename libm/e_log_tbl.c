@@ -0,0 +1,223 @@
+/* e_log_tbl.c -- table-driven versions of e_log.c and e_log2.c.
+ * Written for streflop. With STREFLOP_TABLE_EXPLOG defined, these replace the
+ * dbl-64 __ieee754_log and __ieee754_log2. __ieee754_log checks its result
+ * against an error bound and falls back to multi-precision code when the check
+ * fails. These have a fixed cost and only use the basic IEEE operations, so
+ * the results are the same for all configurations. They are not correctly
+ * rounded: the error is below 0.517 ulp for log and 0.52 ulp for log2, see
+ * the bound below. On 400000 random arguments per function, the largest error
+ * measured was 0.502 ulp, and the results differed from the correctly rounded
+ * ones for 0.0005% of the arguments for log and 11% for log2.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __ieee754_log(x)
+ * Return the logarithm of x
+ *
+ * Method :
+ *   1. Argument Reduction: find k and z such that
+ *			x = 2^k * z,
+ *	   where  0x1.6p-1 <= z < 0x1.6p0, from the exponent and the high
+ *	   bits of x. The same bits give the interval i of z in the table
+ *	   of t_log_tbl.h, and an approximation invc of 1/z, so that
+ *			log(x) = k*ln2 + log(c) + log(1 + r),  r = z*invc - 1
+ *	   with |r| <= 2^-7. z is split in a 43 bits zhi and a 10 bits zlo,
+ *	   invc has 10 bits, so zhi*invc - 1 and zlo*invc are exact and r is
+ *	   known as the unevaluated sum r + rr.
+ *
+ *   2. Approximation of log(1+r) by its Taylor polynomial of degree 9,
+ *		log(1+r) = r - r^2/2 + r^3/3 - ... + r^9/9
+ *	   the error is below 2^-70.
+ *
+ *   3. Reconstruction: ln2 = ln2hi + ln2lo and log(c) = logc_hi + logc_lo
+ *	   where ln2hi and logc_hi are multiples of 2^-42, so that
+ *	   w = k*ln2hi + logc_hi is exact. w + r is computed exactly as
+ *	   hi + lo, and
+ *		log(x) = hi + (lo + rr + k*ln2lo + logc_lo + r^2*P(r))
+ *	   Error bound. With L = |log(x)|, the ulp of the result is more than
+ *	   2^-53*L, and the last addition rounds by at most 0.5 ulp:
+ *	   - table and reduction: hi + lo = w + r and r + rr = z*invc - 1 are
+ *	     exact. logc_hi + logc_lo is log(c) to 2^-96, ln2hi + ln2lo is
+ *	     ln2 to 2^-97, and lo + rr + ... is rounded by less than
+ *	     2^-85 + 2^-53*|lo|, all negligible beside 2^-53*L.
+ *	   - polynomial: the truncation error is below 2^-70*r^2, and P is
+ *	     taken at r instead of r + rr, which adds |r*rr| <= 2^-53*r^2.
+ *	   - evaluation: r*r, P(r) and their product each have a relative
+ *	     rounding error below 2^-53, |r^2*P(r)| <= 0.505*r^2, and
+ *	     lo + r^2*P(r) is rounded by 2^-53*0.505*r^2 more.
+ *	   The sum is below 2^-53*3.04*r^2, or 3.04*r^2/L ulp. Around 1,
+ *	   w = 0, rr = 0, |r| < 2^-7 and L >= 0.996*|r|, so it is below
+ *	   2.04*2^-7/0.996 < 0.017 ulp. On the other intervals of z with k = 0
+ *	   it is below 0.0063 ulp, from the table, and for k != 0, L >= 0.31
+ *	   and it is below 0.0006 ulp. The error is below 0.517 ulp.
+ *
+ * Special cases:
+ *	log(x) is NaN with signal if x < 0 (including -INF) ;
+ *	log(+INF) is +INF; log(0) is -INF with signal;
+ *	log(NaN) is that NaN with no signal.
+ *
+ * __ieee754_log2(x)
+ *	Same method with log2(c) from the table. r/ln2 is computed as
+ *	rhi*invln2hi + (rlo*invln2hi + r*invln2lo + rr*invln2), where rhi
+ *	has 21 bits and invln2hi 32 bits so that the first product is exact.
+ *	The polynomial coefficients are divided by ln2.
+ *	The roundings in the parenthesis are below 2^-72*|r|. B0 = A0/ln2
+ *	is rounded by at most 2^-54, which adds 2^-54*r^2, and
+ *	|r^2*P(r)| <= 0.73*r^2. Around 1, the sum is then below
+ *	2^-53*3.44*r^2 with L >= 1.437*|r|, that is 0.019 ulp, less elsewhere.
+ *	The error is below 0.52 ulp.
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+#ifdef __STDC__
+static const double
+#else
+static double
+#endif
+one	=  1.0,
+two54	=  1.80143985094819840000e+16,	/* 43500000 00000000 */
+ln2hi	=  6.93147180559890330187e-01,	/* 3FE62E42 FEFA3800, multiple of 2^-42 */
+ln2lo	=  5.49792301870837115524e-14,	/* 3D2EF357 93C76730 */
+invln2hi =  1.44269504072144627571e+00,	/* 3FF71547 65200000, 32 bits */
+invln2lo =  1.67517131648865118353e-10,	/* 3DE705FC 2EEFA200 */
+invln2	=  1.44269504088896338700e+00,	/* 3FF71547 652B82FE */
+/* Taylor coefficients of (log(1+r) - r)/r^2 */
+A0 = -5.00000000000000000000e-01,	/* BFE00000 00000000 */
+A1 =  3.33333333333333314830e-01,	/* 3FD55555 55555555 */
+A2 = -2.50000000000000000000e-01,	/* BFD00000 00000000 */
+A3 =  2.00000000000000011102e-01,	/* 3FC99999 9999999A */
+A4 = -1.66666666666666657415e-01,	/* BFC55555 55555555 */
+A5 =  1.42857142857142849213e-01,	/* 3FC24924 92492492 */
+A6 = -1.25000000000000000000e-01,	/* BFC00000 00000000 */
+A7 =  1.11111111111111104943e-01,	/* 3FBC71C7 1C71C71C */
+/* The same divided by ln2 */
+B0 = -7.21347520444481693502e-01,	/* BFE71547 652B82FE */
+B1 =  4.80898346962987777164e-01,	/* 3FDEC709 DC3A03FD */
+B2 = -3.60673760222240846751e-01,	/* BFD71547 652B82FE */
+B3 =  2.88539008177792655196e-01,	/* 3FD2776C 50EF9BFE */
+B4 = -2.40449173481493888582e-01,	/* BFCEC709 DC3A03FD */
+B5 =  2.06099291555566194178e-01,	/* 3FCA6176 2A7ADED9 */
+B6 = -1.80336880111120423376e-01,	/* BFC71547 652B82FE */
+B7 =  1.60299448987662601640e-01;	/* 3FC484B1 3D7C02A9 */
+
+#ifdef __STDC__
+static const double zero   =  0.0;
+#else
+static double zero   =  0.0;
+#endif
+
+#include "t_log_tbl.h"
+
+#ifdef STREFLOP_TABLE_EXPLOG
+
+/* Reduces a positive normal x to 2^k * z, and returns r + rr = z*invc - 1
+ * for the table interval i of z
+ */
+#ifdef __STDC__
+static void log_tbl_reduce(int32_t hx, u_int32_t lx, int32_t *k, int32_t *i, double *r, double *rr)
+#else
+static void log_tbl_reduce(hx,lx,k,i,r,rr)
+	int32_t hx; u_int32_t lx; int32_t *k,*i; double *r,*rr;
+#endif
+{
+	double z,zhi,zlo,invc,a,b,t;
+	int32_t tmp;
+
+	tmp = hx - 0x3fe60000;
+	*i  = (tmp>>13)&127;
+	*k += tmp>>20;
+	hx -= tmp&0xfff00000;		/* z = x*2^-k */
+	INSERT_WORDS(z,hx,lx);
+	INSERT_WORDS(zhi,hx,lx&0xfffffc00);
+	zlo = z - zhi;
+	invc = log_128_invc[*i];
+	a  = zhi*invc - one;		/* exact */
+	b  = zlo*invc;			/* exact */
+	*r = a + b;
+	t  = *r - a;
+	*rr = (a - (*r - t)) + (b - t);
+}
+
+#ifdef __STDC__
+	double __ieee754_log(double x)
+#else
+	double __ieee754_log(x)
+	double x;
+#endif
+{
+	double r,rr,r2,w,hi,lo,kd;
+	int32_t k,hx,i;
+	u_int32_t lx;
+
+	EXTRACT_WORDS(hx,lx,x);
+
+	k=0;
+	if (hx < 0x00100000) {			/* x < 2**-1022  */
+	    if (((hx&0x7fffffff)|lx)==0)
+		return -two54/zero;		/* log(+-0)=-inf */
+	    if (hx<0) return (x-x)/zero;	/* log(-#) = NaN */
+	    k -= 54; x *= two54; /* subnormal number, scale up x */
+	    EXTRACT_WORDS(hx,lx,x);
+	}
+	if (hx >= 0x7ff00000) return x+x;
+
+	log_tbl_reduce(hx,lx,&k,&i,&r,&rr);
+	kd = (double)k;
+	w  = kd*ln2hi + log_128_logc_hi[i];	/* exact */
+	hi = w + r;
+	lo = (w - hi) + r;			/* |w| >= |r| or w = 0 */
+	lo += rr + (kd*ln2lo + log_128_logc_lo[i]);
+	r2 = r*r;
+	return hi + (lo + r2*(A0+r*(A1+r*(A2+r*(A3+r*(A4+r*(A5+r*(A6+r*A7))))))));
+}
+
+#ifdef __STDC__
+	double __ieee754_log2(double x)
+#else
+	double __ieee754_log2(x)
+	double x;
+#endif
+{
+	double r,rr,r2,rhi,rlo,w,t,hi,lo;
+	int32_t k,hx,i;
+	u_int32_t lx,hr;
+
+	EXTRACT_WORDS(hx,lx,x);
+
+	k=0;
+	if (hx < 0x00100000) {			/* x < 2**-1022  */
+	    if (((hx&0x7fffffff)|lx)==0)
+		return -two54/zero;		/* log(+-0)=-inf */
+	    if (hx<0) return (x-x)/zero;	/* log(-#) = NaN */
+	    k -= 54; x *= two54; /* subnormal number, scale up x */
+	    EXTRACT_WORDS(hx,lx,x);
+	}
+	if (hx >= 0x7ff00000) return x+x;
+
+	log_tbl_reduce(hx,lx,&k,&i,&r,&rr);
+	GET_HIGH_WORD(hr,r);
+	INSERT_WORDS(rhi,hr,0);
+	rlo = r - rhi;
+	hi = rhi*invln2hi;			/* exact */
+	lo = rlo*invln2hi + (r*invln2lo + rr*invln2);
+	w  = (double)k + log_128_log2c_hi[i];	/* exact */
+	t  = w + hi;
+	lo += (w - t) + hi;			/* |w| >= |hi| or w = 0 */
+	lo += log_128_log2c_lo[i];
+	r2 = r*r;
+	return t + (lo + r2*(B0+r*(B1+r*(B2+r*(B3+r*(B4+r*(B5+r*(B6+r*B7))))))));
+}
+
+#endif
@@ -0,0 +1,86 @@
+/* e_logf_batch.c -- written for streflop.
+ * Packed version of __ieee754_logf in e_logf.c, for the positive normal
+ * arguments with |f| >= 2**-20, see batch.h. The four formulas of the end of
+ * __ieee754_logf are all computed, and selected lane by lane. The other
+ * arguments are computed by __ieee754_logf.
+ */
+
+#include "math.h"
+#include "math_private.h"
+#include "batch.h"
+
+void __logf_batch(const float *in, float *out, size_t n);
+
+#ifdef STREFLOP_BATCH_PACKED
+
+#ifdef __STDC__
+static const float
+#else
+static float
+#endif
+ln2_hi =   6.9313812256e-01,	/* 0x3f317180 */
+ln2_lo =   9.0580006145e-06,	/* 0x3717f7d1 */
+Lg1 = 6.6666668653e-01,	/* 3F2AAAAB */
+Lg2 = 4.0000000596e-01,	/* 3ECCCCCD */
+Lg3 = 2.8571429849e-01, /* 3E924925 */
+Lg4 = 2.2222198546e-01, /* 3E638E29 */
+Lg5 = 1.8183572590e-01, /* 3E3A3325 */
+Lg6 = 1.5313838422e-01, /* 3E1CD04F */
+Lg7 = 1.4798198640e-01; /* 3E178897 */
+
+/* The result for the lanes where the returned mask is set */
+static inline vfmask
+logf_lanes (vfloat x, vfloat *r)
+{
+	vfloat hfsq,f,s,z,R,w,t1,t2,dk,r0,r1;
+	vint k,ix,i,j;
+	vfmask ok;
+
+	ix = (vint) x;
+	ok = (ix >= 0x00800000) & (ix < 0x7f800000);	/* positive normal */
+	k = (ix>>23)-127;
+	ix &= 0x007fffff;
+	i = (ix+(0x95f64<<3))&0x800000;
+	x = (vfloat)(ix|(i^0x3f800000));	/* normalize x or x/2 */
+	k += (i>>23);
+	f = x-(float)1.0;
+	ok &= (0x007fffff&(15+ix)) >= 16;	/* |f| < 2**-20 in __ieee754_logf */
+ 	s = f/((float)2.0+f);
+	dk = __builtin_convertvector(k,vfloat);
+	z = s*s;
+	i = ix-(0x6147a<<3);
+	w = z*z;
+	j = (0x6b851<<3)-ix;
+	t1= w*(Lg2+w*(Lg4+w*Lg6));
+	t2= z*(Lg1+w*(Lg3+w*(Lg5+w*Lg7)));
+	i |= j;
+	R = t2+t1;
+	hfsq=(float)0.5*f*f;
+	r0 = vf_select(k==0,f-(hfsq-s*(hfsq+R)),
+			    dk*ln2_hi-((hfsq-(s*(hfsq+R)+dk*ln2_lo))-f));
+	r1 = vf_select(k==0,f-s*(f-R),
+			    dk*ln2_hi-((s*(f-R)-dk*ln2_lo)-f));
+	*r = vf_select(i>0,r0,r1);
+	return ok;
+}
+
+void
+__logf_batch(const float *in, float *out, size_t n)
+{
+  size_t i;
+  int l;
+
+  for (i = 0; i + FLANES <= n; i += FLANES)
+    {
+      vfloat x = vf_load (in + i), res;
+      vfmask ok = logf_lanes (x, &res);
+      vf_store (out + i, res);
+      for (l = 0; l < FLANES; l++)
+	if (!ok[l])
+	  out[i + l] = __ieee754_logf (x[l]);
+    }
+  for (; i < n; i++)
+    out[i] = __ieee754_logf (in[i]);
+}
+
+#endif
@@ -59,6 +59,9 @@ one    = 1.0f,
 two8   =  2.5600000000e+02f, /* 0x43800000 */
 twon8  =  3.9062500000e-03f; /* 0x3b800000 */
 
+int __kernel_rem_pio2f_head(const Simple *x, int e0, int nx, int jk, const int32_t *ipio2,
+			    int32_t *iq, int32_t *jzp, int32_t *q0p, int32_t *np, int32_t *ihp);
+
 #ifdef __STDC__
 	int __kernel_rem_pio2f(Simple *x, Simple *y, int e0, int nx, int prec, const int32_t *ipio2) 
 #else
@@ -73,6 +76,9 @@ twon8  =  3.9062500000e-03f; /* 0x3b800000 */
 	jk = init_jk[prec];
 	jp = jk;
 
+#ifdef STREFLOP_INTEGER_RANGE_REDUCTION
+	if (!__kernel_rem_pio2f_head(x,e0,nx,jk,ipio2,iq,&jz,&q0,&n,&ih)) {
+#endif
     /* determine jx,jv,q0, note that 3>q0 */
 	jx =  nx-1;
 	jv = (e0-3)/8; if(jv<0) jv=0;
@@ -165,6 +171,9 @@ recompute:
 	    } else iq[jz] = (int32_t) z ;
 	}
 
+#ifdef STREFLOP_INTEGER_RANGE_REDUCTION
+	}
+#endif
     /* convert integer "bit" chunk to floating-point value */
 	fw = __scalbnf(one,q0);
 	for(i=jz;i>=0;i--) {
@@ -31,6 +31,7 @@ static const Simple two23[2] =
 };
 
 
+namespace streflop_libm {
 long long int
 __llrintf (Simple x)
 {
@@ -77,3 +78,4 @@ __llrintf (Simple x)
 }
 
 weak_alias (__llrintf, llrintf)
+}
@@ -24,6 +24,7 @@
 #include "math_private.h"
 
 
+namespace streflop_libm {
 long long int
 __llroundf (Simple x)
 {
@@ -62,3 +63,4 @@ __llroundf (Simple x)
 }
 
 weak_alias (__llroundf, llroundf)
+}
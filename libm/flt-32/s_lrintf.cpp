@@ -31,6 +31,7 @@ static const Simple two23[2] =
 };
 
 
+namespace streflop_libm {
 long int
 __lrintf (Simple x)
 {
@@ -77,3 +78,4 @@ __lrintf (Simple x)
 }
 
 weak_alias (__lrintf, lrintf)
+}
@@ -24,6 +24,7 @@
 #include "math_private.h"
 
 
+namespace streflop_libm {
 long int
 __lroundf (Simple x)
 {
@@ -62,3 +63,4 @@ __lroundf (Simple x)
 }
 
 weak_alias (__lroundf, lroundf)
+}
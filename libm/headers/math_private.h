@@ -62,6 +62,7 @@ extern int __finite(Double x);
 
 #ifdef LIBM_COMPILING_LDBL96
 #if defined(Extended)
+#define __sqrtl __ieee754_sqrtl
 #define fabsl __fabsl
 extern Extended __cosl(Extended x);
 extern Extended __sinl(Extended x);
@@ -69,6 +69,34 @@ if (-r "ldbl-96/math_ldbl.h") {unlink "ldbl-96/math_ldbl.h";}
 # Roll back to the slower, but purely float version, and also overwrite the wrapper by a wraper to the float only version
 system("cp -f w_expf.c e_expf.c flt-32");
 
+# The ldbl-96 directory has no C code for the functions the x87 computes with its own instructions
+# Use the C versions written for streflop instead, see the comment at the beginning of each file
+system("cp -f e_acosl.c e_exp2l.c e_expl.c e_fmodl.c e_log10l.c e_log2l.c e_logl.c e_powl.c e_rem_pio2l.c e_sqrtl.c k_cosl.c k_sinl.c k_tanl.c s_atanl.c s_expm1l.c s_log1pl.c t_expl.h ldbl-96");
+
+# The dbl-64 sincos calls __sin and __cos, and so reduces large arguments twice
+# Use the version written for streflop instead, it calls the s_sin.c slow paths directly
+system("cp -f s_sincos.c dbl-64");
+
+# The multi-precision fallbacks are optionally cached, see the comment at the beginning of mpcache.c
+system("cp -f mpcache.c dbl-64");
+
+# The multi-precision additions and multiplications optionally use integers, see the comment at the beginning of mpa_int.c
+system("cp -f mpa_int.c dbl-64");
+
+# The exact part of the large argument reductions optionally uses integers, see the comment at the beginning of branred_int.c
+system("cp -f branred_int.c dbl-64");
+system("cp -f k_rem_pio2f_int.c flt-32");
+
+# exp, pow, sin, cos and tan optionally try a double-length evaluation before the multi-precision one, see the comment at the beginning of dla_stage.c
+system("cp -f dla_stage.c dbl-64");
+
+# Table-driven exp, exp2, log and log2 without multi-precision fallback, see the comment at the beginning of e_exp_tbl.c
+system("cp -f e_exp_tbl.c e_log_tbl.c t_exp_tbl.h t_log_tbl.h dbl-64");
+
+# Packed kernels for the batch exp, log, sin and cos, see the comment at the beginning of batch.h
+system("cp -f batch.h e_exp_batch.c e_log_batch.c s_sin_batch.c dbl-64");
+system("cp -f batch.h e_expf_batch.c e_logf_batch.c s_sinf_batch.c flt-32");
+
 # convert .c => .cpp for clarity
 @filelist = glob("flt-32/*.c dbl-64/*.c ldbl-96/*.c");
 foreach $f (@filelist) {
@@ -141,6 +169,208 @@ foreach $f ("ldbl-96/e_lgammal_r.cpp", "ldbl-96/s_cbrtl.cpp", "ldbl-96/s_logbl.c
     close FILE;
 }
 
+# The exponent difference in e_atan2l.c includes the sign bits, so atan2l(y,x) is wrong for x < 0
+foreach $f ("ldbl-96/e_atan2l.cpp") {
+    open(FILE,"<$f");
+    $content = "";
+    while(<FILE>) {
+        s/k = sy-sx;/k = iy-ix;/g;
+        $content.=$_;
+    }
+    close FILE;
+    open(FILE,">$f");
+    print FILE $content;
+    close FILE;
+}
+
+
+# s_sincos.c shares the __branred reduction with these s_sin.c routines
+foreach $f ("dbl-64/s_sin.cpp") {
+    open(FILE,"<$f");
+    $content = "";
+    while(<FILE>) {
+        s/^static double (bsloww[12]?)\(/double $1(/g;
+        $content.=$_;
+    }
+    close FILE;
+    open(FILE,">$f");
+    print FILE $content;
+    close FILE;
+}
+
+# mpa_int.c defines these functions, and calls the originals without STREFLOP_MP_INTEGER and STREFLOP_SOFT
+foreach $f ("dbl-64/mpa.cpp") {
+    open(FILE,"<$f");
+    $content = "";
+    while(<FILE>) {
+        s/^(int|void) __(acr|add|sub|mul)\(/$1 __$2_fp(/g;
+        $content.=$_;
+    }
+    close FILE;
+    open(FILE,">$f");
+    print FILE $content;
+    close FILE;
+}
+
+# mpcache.c defines these functions, and calls the originals when the result is not in the cache
+foreach $f ("dbl-64/sincos32.cpp", "dbl-64/slowexp.cpp", "dbl-64/slowpow.cpp") {
+    open(FILE,"<$f");
+    $content = "";
+    while(<FILE>) {
+        s/^double (__mpsin1?|__mpcos1?|__slowexp|__slowpow)\(/double $1_nocache(/g;
+        $content.=$_;
+    }
+    close FILE;
+    open(FILE,">$f");
+    print FILE $content;
+    close FILE;
+}
+
+# hypotl scaled the subnormal arguments by a number without the explicit integer bit, which
+# the x87 takes as invalid, and then kept the smaller argument first.
+foreach $f ("ldbl-96/e_hypotl.cpp") {
+    open(FILE,"<$f");
+    $content = "";
+    while(<FILE>) {
+        s/SET_LDOUBLE_WORDS\(t1, 0x7ffd, 0, 0\);/SET_LDOUBLE_WORDS(t1, 0x7ffd, 0x80000000, 0);/;
+        s/^(\s*)k -= 16382;$/$1k -= 16382;\n$1GET_LDOUBLE_EXP(ea,a);\n$1GET_LDOUBLE_EXP(eb,b);\n$1if(eb > ea) {t1=a;a=b;b=t1;j=ea;ea=eb;eb=j;}/;
+        $content.=$_;
+    }
+    close FILE;
+    open(FILE,">$f");
+    print FILE $content;
+    close FILE;
+}
+
+# scalblnl scaled the subnormal arguments by 2^52 instead of 2^63, and read the exponent in the
+# wrong word. Do as scalbnl.
+foreach $f ("ldbl-96/s_scalblnl.cpp") {
+    open(FILE,"<$f");
+    $content = "";
+    while(<FILE>) {
+        s/^two63(\s*)=.*$/two64   =  1.8446744073709551616e19l,/;
+        s/^twom63(\s*)=.*$/twom64  =  5.421010862427522170037e-20l,/;
+        s/x \*= two63;/x *= two64;/;
+        s/GET_LDOUBLE_EXP\(es,x\);/GET_LDOUBLE_EXP(hx,x);/;
+        s/k = \(hx&0x7fff\) - 63;/k = (hx&0x7fff) - 64;/;
+        s/if \(k <= -63\)/if (k <= -64)/;
+        s/k \+= 63;/k += 64;/;
+        s/return x\*twom63;/return x*twom64;/;
+        $content.=$_;
+    }
+    close FILE;
+    open(FILE,">$f");
+    print FILE $content;
+    close FILE;
+}
+
+# nextafterl gave numbers without the explicit integer bit when the step crossed a power of 2,
+# which the x87 takes as invalid, and always went toward zero for negative numbers since esy is
+# unsigned. Carry into the exponent and set the integer bit, and test the sign of y.
+$nextafterl_steps = <<'END_OF_STEPS';
+	if(esx<0x8000) {			/* x > 0 */
+	    if(ix>iy||((ix==iy) && (hx>hy||((hx==hy)&&(lx>ly))))) {
+	      /* x > y, x -= ulp */
+		if(lx==0) {
+		    if (hx<=0x80000000 && esx!=0) {
+			esx -= 1;
+			hx -= 1;
+			if ((esx&0x7fff)!=0) hx |= 0x80000000;
+		    } else hx -= 1;
+		}
+		lx -= 1;
+	    } else {				/* x < y, x += ulp */
+		lx += 1;
+		if(lx==0) {
+		    hx += 1;
+		    if (hx==0 || ((esx&0x7fff)==0 && hx==0x80000000)) {
+			esx += 1;
+			hx |= 0x80000000;
+		    }
+		}
+	    }
+	} else {				/* x < 0 */
+	    if(esy<0x8000||(ix>iy||((ix==iy)&&(hx>hy||((hx==hy)&&(lx>ly)))))){
+	      /* x < y, x -= ulp */
+		if(lx==0) {
+		    if (hx<=0x80000000 && (esx&0x7fff)!=0) {
+			esx -= 1;
+			hx -= 1;
+			if ((esx&0x7fff)!=0) hx |= 0x80000000;
+		    } else hx -= 1;
+		}
+		lx -= 1;
+	    } else {				/* x > y, x += ulp */
+		lx += 1;
+		if(lx==0) {
+		    hx += 1;
+		    if (hx==0 || ((esx&0x7fff)==0 && hx==0x80000000)) {
+			esx += 1;
+			hx |= 0x80000000;
+		    }
+		}
+	    }
+	}
+END_OF_STEPS
+foreach $f ("ldbl-96/s_nextafterl.cpp") {
+    open(FILE,"<$f");
+    $content = join("", <FILE>);
+    close FILE;
+    $content =~ s/int32_t hx,hy,ix,iy;\n(\s*)u_int32_t lx,ly,esx,esy;/int32_t ix,iy;\n$1u_int32_t hx,hy,lx,ly,esx,esy;/;
+    $content =~ s/\tif\(esx<0x8000\) \{.*?(?=\tesy = esx&0x7fff;)/$nextafterl_steps/s;
+    open(FILE,">$f");
+    print FILE $content;
+    close FILE;
+}
+
+# floorl and ceill returned -1 and 1 without the explicit integer bit, which the x87 takes as invalid
+foreach $f ("ldbl-96/s_floorl.cpp", "ldbl-96/s_ceill.cpp") {
+    open(FILE,"<$f");
+    $content = "";
+    while(<FILE>) {
+        s/\{ se=0xbfff;i0=i1=0;\}/{ se=0xbfff;i0=0x80000000;i1=0;}/;
+        s/\{ se=0x3fff;i0=0;i1=0;\}/{ se=0x3fff;i0=0x80000000;i1=0;}/;
+        $content.=$_;
+    }
+    close FILE;
+    open(FILE,">$f");
+    print FILE $content;
+    close FILE;
+}
+
+# The second tests of the first stages read t4 in the same expression that assigns it, which is
+# unspecified: with the SoftFloat wrappers the compiler may read the old value. Assign it before.
+foreach $f ("dbl-64/s_tan.cpp") {
+    open(FILE,"<$f");
+    $content = "";
+    while(<FILE>) {
+        s/^(\s*)if \(\(y=(\w+)([-+])\(t2-\(t4=(.*?)\)\)\)==(\w+)([-+])\(t2\+t4\)\)/$1t4=$4;\n$1if ((y=$2$3(t2-t4))==$5$6(t2+t4))/;
+        $content.=$_;
+    }
+    close FILE;
+    open(FILE,">$f");
+    print FILE $content;
+    close FILE;
+}
+
+# All the multi-precision fallbacks convert their input with __dbl_mp, count them for SlowPathStats.h
+foreach $f ("dbl-64/mpa.cpp") {
+    open(FILE,"<$f");
+    $content = "";
+    while(<FILE>) {
+        $content.=$_;
+        if (/^void __dbl_mp\(/) {
+            $_ = <FILE>; $content.=$_;
+            $_ = <FILE>; $content.=$_;
+            $_ = <FILE>; $content.=$_;
+            $content.="\n#ifdef STREFLOP_SLOWPATH_STATS\n  ++streflop::slowpath_mp_calls;\n#endif\n";
+        }
+    }
+    close FILE;
+    open(FILE,">$f");
+    print FILE $content;
+    close FILE;
+}
 
 # DOUBLE_FROM_INT_PTR(x) could simply be *reinterpret_cast<double*>(x)
 # for basic types, but may use a dedicated factory for Object wrappers
@@ -149,12 +379,12 @@ foreach $f ("ldbl-96/e_lgammal_r.cpp", "ldbl-96/s_cbrtl.cpp", "ldbl-96/s_logbl.c
 $xdaccessor=
  "inline Double& d() {return DOUBLE_FROM_INT_PTR(&i[0]);}\n"
 ."inline Double& x() {return DOUBLE_FROM_INT_PTR(&i[0]);}\n"
-."inline Double& d(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}\n"
-."inline Double& x(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}\n"
+."inline Double& d(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}\n"
+."inline Double& x(int idx) {return DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}\n"
 ."inline const Double& d() const {return CONST_DOUBLE_FROM_INT_PTR(&i[0]);}\n"
 ."inline const Double& x() const {return CONST_DOUBLE_FROM_INT_PTR(&i[0]);}\n"
-."inline const Double& d(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}\n"
-."inline const Double& x(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i))]);}\n"
+."inline const Double& d(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}\n"
+."inline const Double& x(int idx) const {return CONST_DOUBLE_FROM_INT_PTR(&i[idx*(sizeof(double)/sizeof(i[0]))]);}\n"
 ;
 
 @filelist = glob("flt-32/* dbl-64/* ldbl-96/*");
@@ -226,7 +456,7 @@ foreach $f (@filelist) {
         s/\?0:/?Double(0.0):/;
         s/:0;/:Double(0.0);/;
         # protect the new symbol names by namespace to avoid any conflict with system libm
-        if (((/#ifdef __STDC__/) || (/.*? (__|mcr|ss32)[a-z,A-Z,_,0-9]*?\(.*?{$/) || (/Double (atan2Mp|atanMp|slow|tanMp|__exp1|__ieee754_remainder|__ieee754_sqrt)/) || (/^(Simple|Double|Extended|void|int)$/) || ((/^#ifdef BIG_ENDI$/) && ($f =~ /(uatan|mpa2|mpexp|atnat|sincos32)/)) || (/^#define MM 5$/) || (/^void __mp(log|sqrt|exp|atan)\(/) || (/^int __(b|mp)ranred\(/)) && ($opened_namespace == 0)) {
+        if (((/#ifdef __STDC__/) || (/.*? (__|mcr|ss32)[a-z,A-Z,_,0-9]*?\(.*?{$/) || (/Double (atan2Mp|atanMp|slow|tanMp|__exp1|__ieee754_remainder|__ieee754_sqrt)/) || (/^(Simple|Double|Extended|void|int|long int|long long int)$/) || ((/^#ifdef BIG_ENDI$/) && ($f =~ /(uatan|mpa2|mpexp|atnat|sincos32)/)) || (/^#define MM 5$/) || (/^void __mp(log|sqrt|exp|atan)\(/) || (/^int __((b|mp)ranred|acr_fp|branred_head|kernel_rem_pio2f_head|slowexp_dla)\(/) || (/^void __[a-z0-9]+_batch\(/)) && ($opened_namespace == 0)) {
             $_ = "namespace streflop_libm {\n".$_;
             $opened_namespace = 1;
         }
@@ -257,6 +487,82 @@ foreach $f (@filelist) {
     close FILE;
 }
 
+# e_exp_tbl.c and e_log_tbl.c replace these functions when STREFLOP_TABLE_EXPLOG is defined
+# Done after the conversion so the guards are inside the namespace. e_exp.cpp keeps __exp1 for pow
+%tableExpLog = (
+    "dbl-64/e_exp.cpp" => '^Double __ieee754_exp\(Double x\) \{\n',
+    "dbl-64/e_log.cpp" => '^Double __ieee754_log\(Double x\) \{\n',
+    "dbl-64/e_exp2.cpp" => '^Double\n__ieee754_exp2 \(Double x\)\n',
+    "dbl-64/e_log2.cpp" => '^#ifdef __STDC__\n\tDouble __ieee754_log2\(Double x\)\n'
+);
+foreach $f (keys %tableExpLog) {
+    open(FILE,"<$f");
+    $content = join("", <FILE>);
+    close FILE;
+    $start = $tableExpLog{$f};
+    $content =~ s/($start.*?\n\}\n)/#ifndef STREFLOP_TABLE_EXPLOG\n$1#endif\n/sm;
+    open(FILE,">$f");
+    print FILE $content;
+    close FILE;
+}
+
+# branred_int.c and k_rem_pio2f_int.c do the exact part of these reductions with integers when
+# STREFLOP_INTEGER_RANGE_REDUCTION is defined, or return 0 and the original code is used. The
+# products of __branred are exact in one hardware instruction each, so its integer part is only
+# used with STREFLOP_SOFT
+open(FILE,"<dbl-64/branred.cpp");
+$content = join("", <FILE>);
+close FILE;
+$content =~ s/^(int __branred\(Double x)/int __branred_head(Double x, Double r[6], Double *sum);\n$1/m;
+$content =~ s/(  u\.x\(\) = (x[12]);\n.*?    r\[i\]-=s;\n  \}\n)/#if defined(STREFLOP_INTEGER_RANGE_REDUCTION) \&\& defined(STREFLOP_SOFT)\n  if (!__branred_head($2,r,&sum)) {\n#endif\n$1#if defined(STREFLOP_INTEGER_RANGE_REDUCTION) \&\& defined(STREFLOP_SOFT)\n  }\n#endif\n/sg;
+open(FILE,">dbl-64/branred.cpp");
+print FILE $content;
+close FILE;
+open(FILE,"<flt-32/k_rem_pio2f.cpp");
+$content = join("", <FILE>);
+close FILE;
+$content =~ s/^(#ifdef __STDC__\n\tint __kernel_rem_pio2f\()/int __kernel_rem_pio2f_head(const Simple *x, int e0, int nx, int jk, const int32_t *ipio2,\n\t\t\t    int32_t *iq, int32_t *jzp, int32_t *q0p, int32_t *np, int32_t *ihp);\n\n$1/m;
+$content =~ s/(    \/\* determine jx,jv,q0.*?\n)(    \/\* convert integer "bit" chunk)/#ifdef STREFLOP_INTEGER_RANGE_REDUCTION\n\tif (!__kernel_rem_pio2f_head(x,e0,nx,jk,ipio2,iq,&jz,&q0,&n,&ih)) {\n#endif\n$1#ifdef STREFLOP_INTEGER_RANGE_REDUCTION\n\t}\n#endif\n$2/s;
+open(FILE,">flt-32/k_rem_pio2f.cpp");
+print FILE $content;
+close FILE;
+
+# dla_stage.c tries a double-length evaluation when STREFLOP_DOUBLE_LENGTH_STAGE is defined, or
+# returns 0 and the multi-precision code is used
+open(FILE,"<dbl-64/slowexp.cpp");
+$content = join("", <FILE>);
+close FILE;
+$content =~ s/^(void __mpexp\(mp_no \*x, mp_no \*y, int p\);\n)/$1int __slowexp_dla(Double x, Double *res);\n/m;
+$content =~ s/(  mp_no mpx, mpy, mpz,mpw,mpeps,mpcor;\n)/$1\n#ifdef STREFLOP_DOUBLE_LENGTH_STAGE\n  if (__slowexp_dla(x,&res)) return res;\n#endif\n/;
+open(FILE,">dbl-64/slowexp.cpp");
+print FILE $content;
+close FILE;
+open(FILE,"<dbl-64/slowpow.cpp");
+$content = join("", <FILE>);
+close FILE;
+$content =~ s/^(Double __halfulp\(Double x,Double y\);\n)/$1int __slowpow_dla(Double x, Double y, Double z, Double *res);\n/m;
+$content =~ s/(  if \(res >= 0\) return res;  \/\* if result was really computed by halfulp \*\/\n.*?\n)/$1#ifdef STREFLOP_DOUBLE_LENGTH_STAGE\n  if (__slowpow_dla(x,y,z,&res)) return res;\n#endif\n/;
+open(FILE,">dbl-64/slowpow.cpp");
+print FILE $content;
+close FILE;
+open(FILE,"<dbl-64/sincos32.cpp");
+$content = join("", <FILE>);
+close FILE;
+$content =~ s/^(namespace streflop_libm \{\n)/$1int __mpsin_dla(Double x, Double dx, Double *res);\nint __mpcos_dla(Double x, Double dx, Double *res);\n/m;
+$content =~ s/^(Double (__mpsin|__mpcos)_nocache\(Double x, Double dx\) \{\n(?:.*\n)*?)(  p=32;\n)/$1#ifdef STREFLOP_DOUBLE_LENGTH_STAGE\n  if ($2_dla(x,dx,&y)) return y;\n#endif\n$3/mg;
+$content =~ s/^(Double (__mpsin|__mpcos)1_nocache\(Double x\)\n(?:.*\n)*?)(  p=32;\n)/$1#ifdef STREFLOP_DOUBLE_LENGTH_STAGE\n  if ($2_dla(x,0,&y)) return y;\n#endif\n$3/mg;
+open(FILE,">dbl-64/sincos32.cpp");
+print FILE $content;
+close FILE;
+open(FILE,"<dbl-64/s_tan.cpp");
+$content = join("", <FILE>);
+close FILE;
+$content =~ s/^(void __mptan\(Double, mp_no \*, int\);\n)/$1int __mptan_dla(Double x, Double *res);\n/m;
+$content =~ s/^(static Double tanMp\(Double x\)\n(?:.*\n)*?)(  p=32;\n)/$1#ifdef STREFLOP_DOUBLE_LENGTH_STAGE\n  if (__mptan_dla(x,&y)) return y;\n#endif\n$2/m;
+open(FILE,">dbl-64/s_tan.cpp");
+print FILE $content;
+close FILE;
+
 
 # ieee754.h union+accessor
 open(FILE,"<headers/ieee754.h");
@@ -368,6 +674,7 @@ MPRIV_LOOP: while(<FILE>) {
         push @convert,"#endif\n\n";
         push @convert,"#ifdef LIBM_COMPILING_LDBL96\n";
         push @convert,"#if defined(Extended)\n";
+        push @convert,"#define __sqrtl __ieee754_sqrtl\n";
         push @convert,"#define fabsl __fabsl\n";
         push @convert,"extern Extended __cosl(Extended x);\n";
         push @convert,"extern Extended __sinl(Extended x);\n";
@@ -0,0 +1,95 @@
+/* k_cosl.c -- long double version of k_cos.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instructions are used instead. This one was written for streflop.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/*
+ * __kernel_cosl( x,  y )
+ * kernel cos function on [-pi/4, pi/4], pi/4 ~ 0.785398164
+ * Input x is assumed to be bounded by ~pi/4 in magnitude.
+ * Input y is the tail of x.
+ *
+ * Algorithm, as in k_cos.c:
+ *	1. Since cos(-x) = cos(x), we need only to consider positive x.
+ *	2. if x < 2^-32, return 1 with inexact if x!=0.
+ *	3. cos(x) is approximated by its Taylor polynomial of degree 20
+ *	   on [0,1], with a remainder below 2^-69 relative to cos(x):
+ *		                         4            20
+ *		cos(x) ~ 1 - x*x/2 + C1*x + ... + C9*x
+ *	   where C[n] = (-1)^(n+1)/(2n+2)!.
+ *	4. let r = C1*x^4 + ... + C9*x^20, then
+ *	       cos(x) = 1 - x*x/2 + r
+ *	   since cos(x+y) ~ cos(x) - sin(x)*y
+ *			  ~ cos(x) - x*y,
+ *	   a correction term is necessary in cos(x) and hence
+ *		cos(x+y) = 1 - (x*x/2 - (r - x*y))
+ *	   For better accuracy when x > 0.3, let qx = |x|/4 with
+ *	   the last 32 bits mask off, and if x > 0.78125, let qx = 0.28125.
+ *	   Then
+ *		cos(x+y) = (1-qx) - ((x*x/2-qx) - (r-x*y)).
+ *	   Note that 1-qx and (x*x/2-qx) is EXACT here, and the
+ *	   magnitude of the latter is at least a quarter of x*x/2,
+ *	   thus, reducing the rounding error in the subtraction.
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+#ifdef __STDC__
+static const long double
+#else
+static long double
+#endif
+one =  1.0L,
+C1  =  4.16666666666666666677960439297E-2L, /*  1/4! */
+C2  = -1.38888888888888888884889011082E-3L, /* -1/6! */
+C3  =  2.48015873015873015872963353612E-5L, /*  1/8! */
+C4  = -2.75573192239858906513451786747E-7L, /* -1/10! */
+C5  =  2.08767569878680989789037668497E-9L, /*  1/12! */
+C6  = -1.14707455977297247139781276183E-11L, /* -1/14! */
+C7  =  4.77947733238738529751142976036E-14L, /*  1/16! */
+C8  = -1.56192069685862264628175514123E-16L, /* -1/18! */
+C9  =  4.11031762331216485840604831981E-19L; /*  1/20! */
+
+#ifdef __STDC__
+	long double __kernel_cosl(long double x, long double y)
+#else
+	long double __kernel_cosl(x, y)
+	long double x,y;
+#endif
+{
+	long double a,hz,z,r,qx;
+	int32_t ix;
+	u_int32_t se,i0;
+	GET_LDOUBLE_EXP(se,x);
+	GET_LDOUBLE_MSW(i0,x);
+	ix = se&0x7fff;			/* ix = |x|'s exponent */
+	if(ix<0x3fdf) {			/* if |x| < 2**-32 */
+	    if(((int)x)==0) return one;		/* generate inexact */
+	}
+	z  = x*x;
+	r  = z*(C1+z*(C2+z*(C3+z*(C4+z*(C5+z*(C6+z*(C7+z*(C8+z*C9))))))));
+	if(ix<0x3ffd||(ix==0x3ffd&&i0<0x9999999a)) 	/* if |x| < 0.3 */
+	    return one - (0.5L*z - (z*r - x*y));
+	else {
+	    if(ix>0x3ffe||(ix==0x3ffe&&i0>0xc8000000)) {	/* x > 0.78125 */
+		qx = 0.28125L;
+	    } else {
+		SET_LDOUBLE_WORDS(qx,ix-2,i0,0);	/* x/4 */
+	    }
+	    hz = 0.5L*z-qx;
+	    a  = one-qx;
+	    return a - (hz - (z*r-x*y));
+	}
+}
@@ -0,0 +1,191 @@
+/* k_rem_pio2f_int.c -- written for streflop.
+ * __kernel_rem_pio2f multiplies the 8-bit chunks of its argument by 8-bit
+ * chunks of 2/pi, and takes the chunks of the fraction of the product. All
+ * of this is integer arithmetic done with floats, so with
+ * STREFLOP_INTEGER_RANGE_REDUCTION defined it is done here with integers,
+ * with the same steps and the same results. The conversion of the fraction
+ * chunks to floats, multiplied by pi/2, is the only part that rounds and is
+ * left to the original code, so the reduced argument is bit-identical.
+ * __kernel_rem_pio2f_head returns 0 for the arguments not given by
+ * __ieee754_rem_pio2f, and the original code is used. import.pl inserts the
+ * call in k_rem_pio2f.cpp.
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+int __kernel_rem_pio2f_head(const float *x, int e0, int nx, int jk, const int32_t *ipio2,
+			    int32_t *iq, int32_t *jzp, int32_t *q0p, int32_t *np, int32_t *ihp);
+
+#ifdef STREFLOP_INTEGER_RANGE_REDUCTION
+
+/* The names of the variables are those of __kernel_rem_pio2f. The fraction
+   z, a float there, is fz*2^q0 here */
+int
+__kernel_rem_pio2f_head (const float *x, int e0, int nx, int jk, const int32_t *ipio2,
+			 int32_t *iq, int32_t *jzp, int32_t *q0p, int32_t *np, int32_t *ihp)
+{
+  int32_t jz, jx, jv, q0, n, ih, carry, i, j, k, m, z, fz, fw;
+  int32_t xi[3], f[20], q[20];
+
+  if (nx > 3)
+    return 0;
+
+  /* determine jx,jv,q0, note that 3>q0 */
+  jx = nx - 1;
+  jv = (e0 - 3) / 8;
+  if (jv < 0)
+    jv = 0;
+  q0 = e0 - 8 * (jv + 1);
+
+  /* set up f[0] to f[jx+jk] where f[jx+jk] = ipio2[jv+jk] */
+  for (i = 0; i <= jx; i++)
+    xi[i] = (int32_t) x[i];
+  j = jv - jx;
+  m = jx + jk;
+  for (i = 0; i <= m; i++, j++)
+    f[i] = (j < 0) ? 0 : ipio2[j];
+
+  /* compute q[0],q[1],...q[jk] */
+  for (i = 0; i <= jk; i++)
+    {
+      for (j = 0, fw = 0; j <= jx; j++)
+	fw += xi[j] * f[jx + i - j];
+      q[i] = fw;
+    }
+
+  jz = jk;
+recompute:
+  /* distill q[] into iq[] reversingly */
+  for (i = 0, j = jz, z = q[jz]; j > 0; i++, j--)
+    {
+      fw = z >> 8;
+      iq[i] = z - (fw << 8);
+      z = q[j - 1] + fw;
+    }
+
+  /* compute n, z is not negative */
+  if (q0 >= 0)
+    {
+      n = (z << q0) & 7;
+      fz = 0;
+    }
+  else
+    {
+      n = (z >> -q0) & 7;
+      fz = z & ((1 << -q0) - 1);
+    }
+  ih = 0;
+  if (q0 > 0)
+    {				/* need iq[jz-1] to determine n */
+      i = (iq[jz - 1] >> (8 - q0));
+      n += i;
+      iq[jz - 1] -= i << (8 - q0);
+      ih = iq[jz - 1] >> (7 - q0);
+    }
+  else if (q0 == 0)
+    ih = iq[jz - 1] >> 8;
+  else if (fz >= (1 << (-q0 - 1)))
+    ih = 2;
+
+  if (ih > 0)
+    {				/* q > 0.5 */
+      n += 1;
+      carry = 0;
+      for (i = 0; i < jz; i++)
+	{			/* compute 1-q */
+	  j = iq[i];
+	  if (carry == 0)
+	    {
+	      if (j != 0)
+		{
+		  carry = 1;
+		  iq[i] = 0x100 - j;
+		}
+	    }
+	  else
+	    iq[i] = 0xff - j;
+	}
+      if (q0 > 0)
+	{			/* rare case: chance is 1 in 12 */
+	  switch (q0)
+	    {
+	    case 1:
+	      iq[jz - 1] &= 0x7f;
+	      break;
+	    case 2:
+	      iq[jz - 1] &= 0x3f;
+	      break;
+	    }
+	}
+      if (ih == 2)
+	{
+	  fz = (1 << -q0) - fz;
+	  if (carry != 0)
+	    fz -= 1;
+	}
+    }
+
+  /* check if recomputation is needed */
+  if (fz == 0)
+    {
+      j = 0;
+      for (i = jz - 1; i >= jk; i--)
+	j |= iq[i];
+      if (j == 0)
+	{			/* need recomputation */
+	  for (k = 1; iq[jk - k] == 0; k++);	/* k = no. of terms needed */
+	  for (i = jz + 1; i <= jz + k; i++)
+	    {			/* add q[jz+1] to q[jz+k] */
+	      f[jx + i] = ipio2[jv + i];
+	      for (j = 0, fw = 0; j <= jx; j++)
+		fw += xi[j] * f[jx + i - j];
+	      q[i] = fw;
+	    }
+	  jz += k;
+	  goto recompute;
+	}
+    }
+
+  /* chop off zero terms */
+  if (fz == 0)
+    {
+      jz -= 1;
+      q0 -= 8;
+      while (iq[jz] == 0)
+	{
+	  jz--;
+	  q0 -= 8;
+	}
+    }
+  else
+    {				/* break z into 8-bit if necessary */
+      if (fz >= 256)
+	{
+	  fw = fz >> 8;
+	  iq[jz] = fz - (fw << 8);
+	  jz += 1;
+	  q0 += 8;
+	  iq[jz] = fw;
+	}
+      else
+	iq[jz] = fz;
+    }
+
+  *jzp = jz;
+  *q0p = q0;
+  *np = n;
+  *ihp = ih;
+  return 1;
+}
+
+#else
+
+int
+__kernel_rem_pio2f_head (const float *x, int e0, int nx, int jk, const int32_t *ipio2,
+			 int32_t *iq, int32_t *jzp, int32_t *q0p, int32_t *np, int32_t *ihp)
+{
+  return 0;
+}
+
+#endif
@@ -0,0 +1,115 @@
+/* k_tanl.c -- long double version of k_tan.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instructions are used instead. This one was written for streflop.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __kernel_tanl( x, y, k )
+ * kernel tan function on [-1, 1], which covers [-pi/4, pi/4]
+ * Input x is assumed to be bounded by 1 in magnitude.
+ * Input y is the tail of x.
+ * Input k indicates whether tan (if k = 1) or -1/tan (if k = -1) is returned.
+ *
+ * Algorithm, as in k_tan.c:
+ *	1. Since tan(-x) = -tan(x), we need only to consider positive x.
+ *	2. if x < 2^-33, return x with inexact if x!=0.
+ *	3. tan(x) is approximated by the [9/10] Pade approximant given by
+ *	   the continued fraction of Lambert,
+ *		tan(x) = x/(1-x^2/(3-x^2/(5-...x^2/19)))
+ *	   whose error is below 2^-73 relative to tan(x) on [0,0.6744].
+ *	   It is written as
+ *		tan(x) ~ x + x^3*T(x^2)/U(x^2)
+ *	   where T and U are polynomials of degree 4 and 5.
+ *	4. For x in [0.6744,1], let y = pi/4 - x, then
+ *		tan(x) = tan(pi/4-y) = 1 - 2*(tan(y) - (tan(y)^2)/(1+tan(y)))
+ *	5. -1/tan(x+y) is computed with a correction step, since the
+ *	   direct inverse could cost another half ulp.
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+#ifdef __STDC__
+static const long double
+#else
+static long double
+#endif
+one   =  1.0L,
+pio4  =  7.85398163397448309628202239852E-1L,
+pio4lo= -1.25413940316708300586293940010E-20L,
+T0  =  3.33333333333333333342368351437E-1L, /* 1/3 */
+T1  = -2.45614035087719298251914771397E-2L, /* -7/285 */
+T2  =  4.42282176028306059265717930899E-4L, /* 1/2261 */
+T3  = -2.18410951125089411989963754931E-6L, /* -2/915705 */
+T4  =  1.52734930856705882501482403648E-9L, /* 1/654729075 */
+U1  = -4.73684210526315789470831046915E-1L, /* -9/19 */
+U2  =  2.88957688338493292062072710993E-2L, /* 28/969 */
+U3  = -4.81596147230822153422670635868E-4L, /* -7/14535 */
+U4  =  2.26811372322208235520880990205E-6L, /* 1/440895 */
+U5  = -1.52734930856705882501482403648E-9L; /* -1/654729075 */
+
+#ifdef __STDC__
+	long double __kernel_tanl(long double x, long double y, int iy)
+#else
+	long double __kernel_tanl(x, y, iy)
+	long double x,y; int iy;
+#endif
+{
+	long double z,r,v,w,s;
+	int32_t ix,sx,big;
+	u_int32_t se,i0;
+	GET_LDOUBLE_EXP(se,x);
+	GET_LDOUBLE_MSW(i0,x);
+	sx = (se>>15)&1;
+	ix = se&0x7fff;			/* exponent of x */
+	if(ix<0x3fde) {			/* |x| < 2**-33 */
+	    if((int)x==0) {		/* generate inexact */
+		if(iy==1) return x;
+		return -one/(x+y);
+	    }
+	}
+	big = (ix==0x3ffe&&i0>=0xaca57a78)||ix>0x3ffe;	/* |x|>=0.6744 */
+	if(big) {
+	    if(sx) {x = -x; y = -y;}
+	    z = pio4-x;
+	    w = pio4lo-y;
+	    x = z+w; y = 0.0L;
+	}
+	z = x*x;
+	s = z*x;
+	r = T0+z*(T1+z*(T2+z*(T3+z*T4)));
+	v = one+z*(U1+z*(U2+z*(U3+z*(U4+z*U5))));
+	r = y + (z*y + s*(r/v));
+	w = x+r;
+	if(big) {
+	    v = (long double)iy;
+	    w = v-2.0L*(x-(w*w/(w+v)-r));
+	    if(sx) return -w;
+	    return w;
+	}
+	if(iy==1) return w;
+	else {
+     /*  compute -1.0/(x+r) accurately */
+	    long double a,t;
+	    GET_LDOUBLE_EXP(se,w);
+	    GET_LDOUBLE_MSW(i0,w);
+	    SET_LDOUBLE_WORDS(z,se,i0,0);
+	    v  = r-(z - x); 	/* z+v = r+x */
+	    t = a  = -one/w;	/* a = -1.0/w */
+	    GET_LDOUBLE_EXP(se,t);
+	    GET_LDOUBLE_MSW(i0,t);
+	    SET_LDOUBLE_WORDS(t,se,i0,0);
+	    s  = one+t*z;
+	    return t+a*(s+t*v);
+	}
+}
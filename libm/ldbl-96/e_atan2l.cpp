@@ -119,7 +119,7 @@ pi_lo   = -5.01655761266833202345176e-20l;/* 0xBFBE, 0xECE675D1, 0xFC8F8CBB */
 	if(iy==0x7fff) return (sy>=0x8000)? -pi_o_2-tiny: pi_o_2+tiny;
 
     /* compute y/x */
-	k = sy-sx;
+	k = iy-ix;
 	if(k > 70) z=pi_o_2+0.5l*pi_lo; 	/* |y/x| >  2**70 */
 	else if(sx>=0x8000&&k<-70) z=0.0l; 	/* |y|/x < -2**70 */
 	else z=__atanl(fabsl(y/x));	/* safe to do y/x */
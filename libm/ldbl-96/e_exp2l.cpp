@@ -0,0 +1,113 @@
+/* See the import.pl script for potential modifications */
+/* e_exp2l.c -- Extended version of e_exp2.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instructions are used instead. This one was written for streflop.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __ieee754_exp2l(x)
+ * Returns 2 raised to the power x.
+ *
+ * Method
+ *   1. Argument reduction:
+ *	x = k/32 + r, |r| <= 1/64, with k the nearest integer to 32*x.
+ *	x - k/32 is exact.
+ *
+ *   2. 2^r = exp(r*ln2) = 1 + p(r*ln2), see e_expl.c and t_expl.h.
+ *
+ *   3. With k = 32*m + j, 0 <= j < 32,
+ *		2^x = 2^m * (T_hi + (T_lo + T_hi*p(r*ln2)))
+ *	where T_hi + T_lo = 2^(j/32) is read from the table.
+ *
+ * Special cases:
+ *	exp2(INF) is INF, exp2(NaN) is NaN;
+ *	exp2(-INF) is 0, and
+ *	for finite argument, only exp2(integer) is exact.
+ *
+ * Overflow and Underflow:
+ *	if x >= 16384 then exp2(x) overflows
+ *	if x <= -16446 then exp2(x) underflows
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+namespace streflop_libm {
+#ifdef __STDC__
+static const Extended
+#else
+static Extended
+#endif
+one	= 1.0l,
+halF[2]	= {0.5l,-0.5l,},
+huge	= 1.0e+4900l,
+tiny	= 1.0e-4900l,
+twom16000 = 3.31184022194550157139472849084E-4817l, /* 2^-16000 */
+o_threshold =  1.6384E+4l,
+u_threshold = -1.6446E+4l,
+ln2	= 6.93147180559945309428690474185E-1l;
+
+#include "t_expl.h"
+
+#ifdef __STDC__
+	Extended __ieee754_exp2l(Extended x)
+#else
+	Extended __ieee754_exp2l(x)
+	Extended x;
+#endif
+{
+	Extended r,p,t,z;
+	int32_t k,j,m,xsb,ix;
+	u_int32_t se,i0,i1;
+
+	GET_LDOUBLE_WORDS(se,i0,i1,x);
+	xsb = (se>>15)&1;		/* sign bit of x */
+	ix = se&0x7fff;			/* exponent of x */
+
+    /* filter out non-finite argument */
+	if(ix >= 0x400c) {			/* if |x|>=8192 */
+	    if(ix==0x7fff) {
+		if(((i0&0x7fffffff)|i1)!=0)
+		    return x+x;		/* NaN */
+		if(xsb==0) return x;	/* exp2(+inf)=+inf */
+		return 0.0l;		/* exp2(-inf)=0 */
+	    }
+	    if(x >= o_threshold) return huge*huge; /* overflow */
+	    if(x <= u_threshold) return tiny*tiny; /* underflow */
+	}
+	else if(ix < 0x3fbd) {		/* when |x|<2**-66 */
+	    if(huge+x>one) return one+x;/* trigger inexact */
+	}
+
+    /* argument reduction */
+	k  = (int32_t)(x*32.0l+halF[xsb]);
+	t  = k;
+	r  = (x - t*0.03125l)*ln2;	/* x - t/32 is exact */
+
+    /* x is now in primary range */
+	p  = r + r*r*(P2+r*(P3+r*(P4+r*(P5+r*(P6+r*(P7+r*P8))))));
+	j  = k&31;
+	m  = (k-j)/32;
+	z  = exp2_32_hi[j] + (exp2_32_lo[j] + exp2_32_hi[j]*p);
+
+    /* scale by 2^m */
+	GET_LDOUBLE_EXP(se,z);
+	if(m >= -16000) {
+	    if((int32_t)se+m >= 0x7fff) return huge*huge; /* overflow */
+	    SET_LDOUBLE_EXP(z,se+m);
+	    return z;
+	}
+	SET_LDOUBLE_EXP(z,se+m+16000);	/* subnormal output */
+	return z*twom16000;
+}
+}
@@ -0,0 +1,117 @@
+/* See the import.pl script for potential modifications */
+/* e_log10l.c -- Extended version of e_log10.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instructions are used instead. This one was written for streflop.
+ */
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __ieee754_log10l(x)
+ * Return the base 10 logarithm of x
+ *
+ * Method :
+ *	Compute log(1+f) as in e_logl.c, but keep the result as the sum
+ *	hi+lo, where hi has only 32 bits. Then
+ *		log10(x) = k*log10(2) + (hi+lo)*(ivln10hi+ivln10lo)
+ *	where ivln10hi has 32 bits so that hi*ivln10hi is exact, and
+ *	log10(2) = log10_2hi + log10_2lo with k*log10_2hi exact.
+ *
+ * Special cases:
+ *	log10(x) is NaN with signal if x < 0;
+ *	log10(+INF) is +INF with no signal; log10(0) is -INF with signal;
+ *	log10(NaN) is that NaN with no signal.
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+namespace streflop_libm {
+#ifdef __STDC__
+static const Extended
+#else
+static Extended
+#endif
+two64   =  1.84467440737095516160000000000E+19l,	/* 2^64 */
+Lg1 = 6.66666666666666666684736702875E-1l,  /* 2/3 */
+Lg2 = 4.00000000000000000005421010862E-1l,  /* 2/5 */
+Lg3 = 2.85714285714285714281842135098E-1l,  /* 2/7 */
+Lg4 = 2.22222222222222222219210549521E-1l,  /* 2/9 */
+Lg5 = 1.81818181818181818186746373511E-1l,  /* 2/11 */
+Lg6 = 1.53846153846153846155931158024E-1l,  /* 2/13 */
+Lg7 = 1.33333333333333333339657846006E-1l,  /* 2/15 */
+Lg8 = 1.17647058823529411765104486093E-1l,  /* 2/17 */
+Lg9 = 1.05263157894736842103123285186E-1l,  /* 2/19 */
+Lg10 = 9.52380952380952380939473783661E-2l,  /* 2/21 */
+Lg11 = 8.69565217391304347814302150299E-2l,  /* 2/23 */
+Lg12 = 7.99999999999999999983736967413E-2l,  /* 2/25 */
+ivln10hi  =  4.34294481878168880939483642578E-1l,	/* 32 bits */
+ivln10lo  =  2.50829467116452763389434745069E-11l,
+log10_2hi =  3.01029995663981253528618253767E-1l,	/* 49 bits */
+log10_2lo = -5.83148793590429973607474050808E-17l,
+zero   =  0.0l;
+
+#ifdef __STDC__
+	Extended __ieee754_log10l(Extended x)
+#else
+	Extended __ieee754_log10l(x)
+	Extended x;
+#endif
+{
+	Extended f,hfsq,hi,lo,s,R,w,y,z,val_hi,val_lo,y2;
+	int32_t k,ix;
+	u_int32_t se,i0,i1;
+
+	GET_LDOUBLE_WORDS(se,i0,i1,x);
+	ix = se&0x7fff;
+
+	k=0;
+	if (ix==0) {			/* x < 2**-16382  */
+	    if ((i0|i1)==0)
+		return -two64/zero;	/* log(+-0)=-inf */
+	    if (se&0x8000) return (x-x)/zero;	/* log(-#) = NaN */
+	    k -= 64; x *= two64; /* subnormal number, scale up x */
+	    GET_LDOUBLE_WORDS(se,i0,i1,x);
+	    ix = se&0x7fff;
+	}
+	if (se&0x8000) return (x-x)/zero;	/* log(-#) = NaN */
+	if (ix==0x7fff) return x+x;
+	k += ix-0x3fff;
+    /* normalize x or x/2 into [sqrt(2)/2, sqrt(2)) */
+	if (i0>0xb504f333) {
+	    SET_LDOUBLE_EXP(x,0x3ffe);
+	    k += 1;
+	} else SET_LDOUBLE_EXP(x,0x3fff);
+	f = x-1.0l;
+	y = (Extended)k;
+	if (f==zero) return y*log10_2hi+y*log10_2lo;
+	s = f/(2.0l+f);
+	z = s*s;
+	R = z*(Lg1+z*(Lg2+z*(Lg3+z*(Lg4+z*(Lg5+z*(Lg6+z*(Lg7+z*(Lg8+z*(Lg9+z*(Lg10+z*(Lg11+z*Lg12)))))))))));
+	hfsq = 0.5l*f*f;
+
+    /* hi+lo = f - hfsq + s*(hfsq+R) = log(1+f), with hi on 32 bits */
+	hi = f-hfsq;
+	GET_LDOUBLE_WORDS(se,i0,i1,hi);
+	SET_LDOUBLE_WORDS(hi,se,i0,0);
+	lo = (f-hi)-hfsq+s*(hfsq+R);
+
+	val_hi = hi*ivln10hi;
+	y2 = y*log10_2hi;
+	val_lo = y*log10_2lo + (lo+hi)*ivln10lo + lo*ivln10hi;
+
+    /* add k*log10_2hi, the correction is exact */
+	w = y2 + val_hi;
+	val_lo += (y2 - w) + val_hi;
+	val_hi = w;
+
+	return val_lo + val_hi;
+}
+}
@@ -0,0 +1,118 @@
+/* See the import.pl script for potential modifications */
+/* e_logl.c -- Extended version of e_log.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instructions are used instead. This one was written for streflop.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __ieee754_logl(x)
+ * Return the logarithm of x
+ *
+ * Method, as in e_log.c:
+ *   1. Argument Reduction: find k and f such that
+ *			x = 2^k * (1+f),
+ *	   where  sqrt(2)/2 < 1+f < sqrt(2) .
+ *
+ *   2. Approximation of log(1+f).
+ *	Let s = f/(2+f) ; based on log(1+f) = log(1+s) - log(1-s)
+ *		 = 2s + 2/3 s**3 + 2/5 s**5 + .....,
+ *	     	 = 2s + s*R
+ *	|s| <= 0.1716l so the Taylor series R = Lg1*s**2 + ... + Lg12*s**24,
+ *	with Lg[n] = 2/(2n+1), has a remainder below 2^-70.
+ *	Note that 2s = f - s*f = f - hfsq + s*hfsq, where hfsq = f*f/2.
+ *	In order to guarantee error in log below 1ulp, we compute log
+ *	by
+ *		log(1+f) = f - (hfsq - s*(hfsq+R)).
+ *
+ *	3. Finally,  log(x) = k*ln2 + log(1+f).
+ *			    = k*ln2_hi+(f-(hfsq-(s*(hfsq+R)+k*ln2_lo)))
+ *	   Here ln2 is split into two floating point number:
+ *			ln2_hi + ln2_lo,
+ *	   where n*ln2_hi is always exact for |n| < 32768.
+ *
+ * Special cases:
+ *	log(x) is NaN with signal if x < 0 (including -INF) ;
+ *	log(+INF) is +INF; log(0) is -INF with signal;
+ *	log(NaN) is that NaN with no signal.
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+namespace streflop_libm {
+#ifdef __STDC__
+static const Extended
+#else
+static Extended
+#endif
+ln2_hi  =  6.93147180559945397249066445511E-1l,	/* 49 bits */
+ln2_lo  = -8.78318343240526578864250037720E-17l,
+two64   =  1.84467440737095516160000000000E+19l,	/* 2^64 */
+Lg1 = 6.66666666666666666684736702875E-1l,  /* 2/3 */
+Lg2 = 4.00000000000000000005421010862E-1l,  /* 2/5 */
+Lg3 = 2.85714285714285714281842135098E-1l,  /* 2/7 */
+Lg4 = 2.22222222222222222219210549521E-1l,  /* 2/9 */
+Lg5 = 1.81818181818181818186746373511E-1l,  /* 2/11 */
+Lg6 = 1.53846153846153846155931158024E-1l,  /* 2/13 */
+Lg7 = 1.33333333333333333339657846006E-1l,  /* 2/15 */
+Lg8 = 1.17647058823529411765104486093E-1l,  /* 2/17 */
+Lg9 = 1.05263157894736842103123285186E-1l,  /* 2/19 */
+Lg10 = 9.52380952380952380939473783661E-2l,  /* 2/21 */
+Lg11 = 8.69565217391304347814302150299E-2l,  /* 2/23 */
+Lg12 = 7.99999999999999999983736967413E-2l,  /* 2/25 */
+zero   =  0.0l;
+
+#ifdef __STDC__
+	Extended __ieee754_logl(Extended x)
+#else
+	Extended __ieee754_logl(x)
+	Extended x;
+#endif
+{
+	Extended hfsq,f,s,z,R,dk;
+	int32_t k,ix;
+	u_int32_t se,i0,i1;
+
+	GET_LDOUBLE_WORDS(se,i0,i1,x);
+	ix = se&0x7fff;
+
+	k=0;
+	if (ix==0) {			/* x < 2**-16382  */
+	    if ((i0|i1)==0)
+		return -two64/zero;	/* log(+-0)=-inf */
+	    if (se&0x8000) return (x-x)/zero;	/* log(-#) = NaN */
+	    k -= 64; x *= two64; /* subnormal number, scale up x */
+	    GET_LDOUBLE_WORDS(se,i0,i1,x);
+	    ix = se&0x7fff;
+	}
+	if (se&0x8000) return (x-x)/zero;	/* log(-#) = NaN */
+	if (ix==0x7fff) return x+x;
+	k += ix-0x3fff;
+    /* normalize x or x/2 into [sqrt(2)/2, sqrt(2)) */
+	if (i0>0xb504f333) {
+	    SET_LDOUBLE_EXP(x,0x3ffe);
+	    k += 1;
+	} else SET_LDOUBLE_EXP(x,0x3fff);
+	f = x-1.0l;
+	dk = (Extended)k;
+	if (f==zero) {
+	    if (k==0) return zero;
+	    return dk*ln2_hi+dk*ln2_lo;
+	}
+	s = f/(2.0l+f);
+	z = s*s;
+	R = z*(Lg1+z*(Lg2+z*(Lg3+z*(Lg4+z*(Lg5+z*(Lg6+z*(Lg7+z*(Lg8+z*(Lg9+z*(Lg10+z*(Lg11+z*Lg12)))))))))));
+	hfsq = 0.5l*f*f;
+	return dk*ln2_hi-((hfsq-(s*(hfsq+R)+dk*ln2_lo))-f);
+}
+}
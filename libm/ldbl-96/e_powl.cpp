@@ -0,0 +1,276 @@
+/* See the import.pl script for potential modifications */
+/* e_powl.c -- Extended version of e_pow.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instructions are used instead. This one was written for streflop.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __ieee754_powl(x,y) return x**y
+ *
+ *		      n
+ * Method:  Let x =  2   * (1+f)
+ *	1. Compute and return log2(x) in two pieces:
+ *		log2(x) = w1 + w2,
+ *	   where w1 has 32 bits, as in e_pow.c. The Taylor series of
+ *	   (3/2)*(log(x)-2s-2/3*s**3) is used up to s**24.
+ *	2. Perform y*log2(x) = n+y' by simulating multi-precision
+ *	   arithmetic shown below, where w1 and y1 have 32 bits so
+ *	   that y1*w1 is exact.
+ *	3. Return x**y = 2**n*exp(y'*log2), with the table of e_expl.c.
+ *
+ * Special cases, as in C99:
+ *	1.  (anything) ** 0  is 1
+ *	2.  1 ** (anything)  is 1
+ *	3.  (anything) ** NAN is NAN, NAN ** (anything) is NAN otherwise
+ *	4.  (anything) ** 1 is itself
+ *	5.  +-(|x| > 1) **  +INF is +INF
+ *	6.  +-(|x| > 1) **  -INF is +0
+ *	7.  +-(|x| < 1) **  +INF is +0
+ *	8.  +-(|x| < 1) **  -INF is +INF
+ *	9.  -1 ** +-INF is 1
+ *	10. +0 ** (+anything except 0, NAN)               is +0
+ *	11. -0 ** (+anything except 0, NAN, odd integer)  is +0
+ *	12. +0 ** (-anything except 0, NAN)               is +INF
+ *	13. -0 ** (-anything except 0, NAN, odd integer)  is +INF
+ *	14. -0 ** (odd integer) = -( +0 ** (odd integer) )
+ *	15. +INF ** (+anything except 0,NAN) is +INF
+ *	16. +INF ** (-anything except 0,NAN) is +0
+ *	17. -INF ** (anything)  = -0 ** (-anything)
+ *	18. (-anything) ** (integer) is (-1)**(integer)*(+anything**integer)
+ *	19. (-anything except 0 and inf) ** (non-integer) is NAN
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+namespace streflop_libm {
+#ifdef __STDC__
+static const Extended
+#else
+static Extended
+#endif
+bp[] = {1.0l, 1.5l,},
+dp_h[] = { 0.0l, 5.84962500724941492080688476562E-1l,}, /* log2(1.5l), 32 bits */
+dp_l[] = { 0.0l, -3.78531062694953261461178481861E-12l,},
+zero	=  0.0l,
+one	=  1.0l,
+two64	=  1.84467440737095516160000000000E+19l,	/* 2^64 */
+huge	=  1.0e+4900l,
+tiny	=  1.0e-4900l,
+twom16000 = 3.31184022194550157139472849084E-4817l, /* 2^-16000 */
+	/* poly coefs for (3/2)*(log(x)-2s-2/3*s**3 */
+L1  =  6.00000000000000000021684043450E-1l, /* 3/5 */
+L2  =  4.28571428571428571436315729803E-1l, /* 3/7 */
+L3  =  3.33333333333333333342368351437E-1l, /* 3/9 */
+L4  =  2.72727272727272727280119560267E-1l, /* 3/11 */
+L5  =  2.30769230769230769233896737036E-1l, /* 3/13 */
+L6  =  2.00000000000000000002710505431E-1l, /* 3/15 */
+L7  =  1.76470588235294117651044860928E-1l, /* 3/17 */
+L8  =  1.57894736842105263161461191357E-1l, /* 3/19 */
+L9  =  1.42857142857142857140921067549E-1l, /* 3/21 */
+L10 =  1.30434782608695652172145322545E-1l, /* 3/23 */
+L11 =  1.19999999999999999997560545112E-1l, /* 3/25 */
+cp    =  9.61796693925975604907031152324E-1l, /* 2/(3ln2) */
+cp_h  =  9.61796693969517946243286132812E-1l, /* head of cp, 32 bits */
+cp_l  = -4.35423413366696788097341013043E-11l, /* tail of cp_h */
+ln2   =  6.93147180559945309428690474185E-1l;
+
+#include "t_expl.h"
+
+#ifdef __STDC__
+	Extended __ieee754_powl(Extended x, Extended y)
+#else
+	Extended __ieee754_powl(x,y)
+	Extended x, y;
+#endif
+{
+	Extended z,ax,z_h,z_l,p_h,p_l;
+	Extended y1,t1,t2,r,s,t,u,v;
+	int32_t i,j,k,m,yisint,n;
+	int32_t ix,iy,sx,sy;
+	u_int32_t se,i0,i1,hi0,hi1;
+	u_int64_t my;
+
+	GET_LDOUBLE_WORDS(se,i0,i1,x);
+	sx = (se>>15)&1; ix = se&0x7fff;
+	GET_LDOUBLE_WORDS(se,hi0,hi1,y);
+	sy = (se>>15)&1; iy = se&0x7fff;
+
+    /* y==zero: x**0 = 1 */
+	if((iy|hi0|hi1)==0) return one;
+
+    /* x==1: 1**y = 1, even if y is NaN */
+	if(x == one) return one;
+
+    /* +-NaN return x+y */
+	if((ix==0x7fff&&((i0&0x7fffffff)|i1)!=0) ||
+	   (iy==0x7fff&&((hi0&0x7fffffff)|hi1)!=0))
+		return x+y;
+
+    /* determine if y is an odd int when x < 0
+     * yisint = 0	... y is not an integer
+     * yisint = 1	... y is an odd int
+     * yisint = 2	... y is an even int
+     */
+	yisint  = 0;
+	if(sx) {
+	    if(iy>=0x403f) yisint = 2;	/* |y| >= 2^64, even integer y */
+	    else if(iy>=0x3fff) {
+		k = iy-0x3fff;		/* exponent */
+		my = ((u_int64_t)hi0<<32)|hi1;
+		if(k==63) yisint = 2-(int32_t)(my&1);
+		else if((my<<(k+1))==0) yisint = 2-(int32_t)((my>>(63-k))&1);
+	    }
+	}
+
+    /* special value of y */
+	if(iy==0x7fff) {	/* y is +-inf */
+	    if(ix==0x3fff&&((i0&0x7fffffff)|i1)==0)
+		return one;		/* (-1)**+-inf is 1 */
+	    else if(ix>=0x3fff) {	/* (|x|>1)**+-inf = inf,0 */
+		if(sy==0) return y;
+		return zero;
+	    } else {			/* (|x|<1)**-,+inf = inf,0 */
+		if(sy) return -y;
+		return zero;
+	    }
+	}
+	if(iy==0x3fff&&((hi0&0x7fffffff)|hi1)==0) {	/* y is  +-1 */
+	    if(sy) return one/x;
+	    return x;
+	}
+	if(y==2.0l) return x*x;	/* y is  2 */
+	if(y==0.5l) {		/* y is  0.5l */
+	    if(sx==0)		/* x >= +0 */
+		return __ieee754_sqrtl(x);
+	}
+
+	ax   = fabsl(x);
+    /* special value of x */
+	if(ix==0x7fff||(ix|i0|i1)==0||(ix==0x3fff&&((i0&0x7fffffff)|i1)==0)){
+	    z = ax;			/*x is +-0,+-inf,+-1*/
+	    if(sy) z = one/z;		/* z = (1/|x|) */
+	    if(sx) {
+		if(ix==0x3fff&&yisint==0) {
+		    z = (z-z)/(z-z);	/* (-1)**non-int is NaN */
+		} else if(yisint==1)
+		    z = -z;		/* (x<0)**odd = -(|x|**odd) */
+	    }
+	    return z;
+	}
+
+    /* (x<0)**(non-int) is NaN */
+	if(sx&&yisint==0) return (x-x)/(x-x);
+
+    /* |y| is huge */
+	if(iy>=0x404d) {	/* if |y| >= 2**78 */
+	/* x != 1, so |y*log2(x)| > 16384 */
+	    if(ix<0x3fff) {	/* |x| < 1 */
+		if(sy) return huge*huge;
+		return tiny*tiny;
+	    }
+	    if(sy) return tiny*tiny;
+	    return huge*huge;
+	}
+
+	{
+	    Extended s2,s_h,s_l,t_h,t_l;
+	    n = 0;
+	/* take care subnormal number */
+	    if(ix==0)
+		{ax *= two64; n -= 64; GET_LDOUBLE_WORDS(se,i0,i1,ax); ix = se;}
+	    n  += ix-0x3fff;
+	    ix = 0x3fff;
+	/* determine interval */
+	    if(i0<=0x9cc470a0) k=0;		/* |x|<sqrt(3/2) */
+	    else if(i0<0xddb3d742) k=1;	/* |x|<sqrt(3)   */
+	    else {k=0;n+=1;ix=0x3ffe;}
+	    SET_LDOUBLE_WORDS(ax,ix,i0,i1);	/* normalize ax */
+
+	/* compute s = s_h+s_l = (x-1)/(x+1) or (x-1.5l)/(x+1.5l) */
+	    u = ax-bp[k];		/* bp[0]=1.0l, bp[1]=1.5l */
+	    v = one/(ax+bp[k]);
+	    s = u*v;
+	    GET_LDOUBLE_WORDS(se,i0,i1,s);
+	    SET_LDOUBLE_WORDS(s_h,se,i0,0);
+	/* t_h=ax+bp[k] High */
+	    t_h = ax+bp[k];
+	    GET_LDOUBLE_WORDS(se,i0,i1,t_h);
+	    SET_LDOUBLE_WORDS(t_h,se,i0,0);
+	    t_l = ax - (t_h-bp[k]);
+	    s_l = v*((u-s_h*t_h)-s_h*t_l);
+	/* compute log(ax) */
+	    s2 = s*s;
+	    r = s2*s2*(L1+s2*(L2+s2*(L3+s2*(L4+s2*(L5+s2*(L6+s2*(L7+s2*(L8+s2*(L9+s2*(L10+s2*L11))))))))));
+	    r += s_l*(s_h+s);
+	    s2  = s_h*s_h;
+	    t_h = 3.0l+s2+r;
+	    GET_LDOUBLE_WORDS(se,i0,i1,t_h);
+	    SET_LDOUBLE_WORDS(t_h,se,i0,0);
+	    t_l = r-((t_h-3.0l)-s2);
+	/* u+v = s*(1+...) */
+	    u = s_h*t_h;
+	    v = s_l*t_h+t_l*s;
+	/* 2/(3log2)*(s+...) */
+	    p_h = u+v;
+	    GET_LDOUBLE_WORDS(se,i0,i1,p_h);
+	    SET_LDOUBLE_WORDS(p_h,se,i0,0);
+	    p_l = v-(p_h-u);
+	    z_h = cp_h*p_h;		/* cp_h+cp_l = 2/(3*log2) */
+	    z_l = cp_l*p_h+p_l*cp+dp_l[k];
+	/* log2(ax) = (s+..)*2/(3*log2) = n + dp_h + z_h + z_l */
+	    t = (Extended)n;
+	    t1 = (((z_h+z_l)+dp_h[k])+t);
+	    GET_LDOUBLE_WORDS(se,i0,i1,t1);
+	    SET_LDOUBLE_WORDS(t1,se,i0,0);
+	    t2 = z_l-(((t1-t)-dp_h[k])-z_h);
+	}
+
+	s = one; /* s (sign of result -ve**odd) = -1 else = 1 */
+	if(sx&&yisint==1)
+	    s = -one;	/* (-ve)**(odd int) */
+
+    /* split up y into y1+y2 and compute (y1+y2)*(t1+t2) */
+	GET_LDOUBLE_WORDS(se,i0,i1,y);
+	SET_LDOUBLE_WORDS(y1,se,i0,0);
+	p_l = (y-y1)*t1+y*t2;
+	p_h = y1*t1;
+	z = p_l+p_h;
+	if(z > 1.65E+4l)			/* if z > 16500 */
+	    return s*huge*huge;			/* overflow */
+	if(z < -1.65E+4l)			/* if z < -16500 */
+	    return s*tiny*tiny;			/* underflow */
+
+    /*
+     * compute 2**(p_h+p_l), as in e_exp2l.c
+     */
+	if(z < zero) i = (int32_t)(z*32.0l-0.5l);
+	else i = (int32_t)(z*32.0l+0.5l);
+	t = i;
+	r = ((p_h-t*0.03125l)+p_l)*ln2;	/* p_h - t/32 is exact */
+	u = r + r*r*(P2+r*(P3+r*(P4+r*(P5+r*(P6+r*(P7+r*P8))))));
+	j = i&31;
+	m = (i-j)/32;
+	z = exp2_32_hi[j] + (exp2_32_lo[j] + exp2_32_hi[j]*u);
+
+    /* scale by 2^m */
+	GET_LDOUBLE_EXP(se,z);
+	if(m >= -16000) {
+	    if((int32_t)se+m >= 0x7fff) return s*huge*huge; /* overflow */
+	    SET_LDOUBLE_EXP(z,se+m);
+	    return s*z;
+	}
+	SET_LDOUBLE_EXP(z,se+m+16000);	/* subnormal output */
+	return s*(z*twom16000);
+}
+}
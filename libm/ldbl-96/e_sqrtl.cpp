@@ -0,0 +1,118 @@
+/* See the import.pl script for potential modifications */
+/* e_sqrtl.c -- Extended version of e_sqrt.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instruction is used instead. This one was written for streflop.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __ieee754_sqrtl(x)
+ * Return correctly rounded sqrt.
+ * Method:
+ *   Bit by bit method using integer arithmetic, as in e_sqrt.c.
+ *   1. Normalization
+ *	Scale x to m*2^e, with m a 64 bits integer whose leading bit
+ *	is set. Then N = m*2^64 (e even) or m*2^63 (e odd) is a 128
+ *	bits integer, and sqrt(x) = sqrt(N)*2^k for some integer k.
+ *
+ *   2. Bit by bit computation
+ *	The 64 bits integer root q of N is built one bit at a time,
+ *	from the leftmost. Each step brings down two bits of N into
+ *	the remainder r = N - q*q, and the next bit of q is set when
+ *	the remainder is at least 4*q+1 (that is, (2q+1)^2 <= 4*N).
+ *
+ *   3. Final rounding
+ *	After 64 steps, q is the truncated root and r the exact
+ *	remainder. The root is exact iff r == 0, and it is above
+ *	q+1/2 iff r > q (there are no ties).
+ *	The rounding mode is detected as in e_sqrt.c, by adding or
+ *	subtracting a tiny number to one.
+ *
+ * Special cases:
+ *	sqrt(+-0) = +-0 	... exact
+ *	sqrt(inf) = inf
+ *	sqrt(-ve) = NaN		... with invalid signal
+ *	sqrt(NaN) = NaN		... with invalid signal for signaling NaN
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+namespace streflop_libm {
+#ifdef __STDC__
+static	const Extended	one	= 1.0l, tiny=1.0e-4900l;
+#else
+static	Extended	one	= 1.0l, tiny=1.0e-4900l;
+#endif
+
+#ifdef __STDC__
+	Extended __ieee754_sqrtl(Extended x)
+#else
+	Extended __ieee754_sqrtl(x)
+	Extended x;
+#endif
+{
+	Extended z;
+	int32_t i,e;
+	u_int32_t se,i0,i1;
+	u_int64_t m,nh,nl,rh,rl,th,tl,q;
+
+	GET_LDOUBLE_WORDS(se,i0,i1,x);
+
+    /* take care of Inf and NaN */
+	if((se&0x7fff)==0x7fff) {
+	    if((se&0x8000)!=0&&((i0&0x7fffffff)|i1)==0)
+		return (x-x)/(x-x);	/* sqrt(-inf)=sNaN */
+	    return x*x+x;		/* sqrt(NaN)=NaN, sqrt(+inf)=+inf */
+	}
+    /* take care of zero and negative numbers */
+	if((i0|i1)==0) return x;	/* sqrt(+-0) = +-0 */
+	if(se&0x8000) return (x-x)/(x-x);	/* sqrt(-ve) = sNaN */
+
+    /* normalize x */
+	m = ((u_int64_t)i0<<32)|i1;
+	e = (se&0x7fff)-16383-63;
+	if((se&0x7fff)==0) e += 1;	/* subnormal: same scale as the minimum normal */
+	while((m&((u_int64_t)1<<63))==0) { m <<= 1; e -= 1; }
+
+    /* N = m*2^64 or m*2^63, with the remaining exponent even */
+	if(e&1) { nh = m>>1; nl = m<<63; e = (e-63)/2; }
+	else { nh = m; nl = 0; e = (e-64)/2; }
+
+    /* generate sqrt(N) bit by bit */
+	q = rh = rl = 0;
+	for(i=0;i<64;i++) {
+	    rh = (rh<<2)|(rl>>62); rl = (rl<<2)|(nh>>62);
+	    nh = (nh<<2)|(nl>>62); nl <<= 2;
+	    th = q>>62; tl = (q<<2)|1;
+	    if(rh>th||(rh==th&&rl>=tl)) {
+		rh -= th; if(rl<tl) rh -= 1; rl -= tl;
+		q = (q<<1)|1;
+	    } else q <<= 1;
+	}
+
+    /* use floating add to find out rounding direction */
+	if((rh|rl)!=0) {
+	    z = one-tiny; /* trigger inexact flag */
+	    if (z>=one) {
+		z = one+tiny;
+		if(z>one||rh!=0||rl>q) {
+		    q += 1;
+		    if(q==0) { q = (u_int64_t)1<<63; e += 1; }
+		}
+	    }
+	}
+
+	SET_LDOUBLE_WORDS(z,e+63+16383,(u_int32_t)(q>>32),(u_int32_t)q);
+	return z;
+}
+}
@@ -0,0 +1,81 @@
+/* See the import.pl script for potential modifications */
+/* k_sinl.c -- Extended version of k_sin.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instructions are used instead. This one was written for streflop.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __kernel_sinl( x, y, iy)
+ * kernel sin function on [-pi/4, pi/4], pi/4 ~ 0.7854l
+ * Input x is assumed to be bounded by ~pi/4 in magnitude.
+ * Input y is the tail of x.
+ * Input iy indicates whether y is 0. (if iy=0, y assume to be 0).
+ *
+ * Algorithm, as in k_sin.c:
+ *	1. Since sin(-x) = -sin(x), we need only to consider positive x.
+ *	2. if x < 2^-32, return x with inexact if x!=0.
+ *	3. sin(x) is approximated by its Taylor polynomial of degree 21
+ *	   on [0,1], with a remainder below 2^-74 relative to sin(x):
+ *		sin(x) ~ x + S1*x^3 + ... + S10*x^21
+ *	   where S[n] = (-1)^n/(2n+1)!.
+ *	4. sin(x+y) = sin(x) + sin'(x')*y
+ *		    ~ sin(x) + (1-x*x/2)*y
+ *	   For better accuracy, let
+ *		     3      2      2          2
+ *		r = x *(S2+x *(S3+x *(...+x *S10)))
+ *	   then                   3    2
+ *		sin(x) = x + (S1*x + (x *(r-y/2)+y))
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+namespace streflop_libm {
+#ifdef __STDC__
+static const Extended
+#else
+static Extended
+#endif
+half =  5.0E-1l,
+S1  = -1.66666666666666666671184175719E-1l, /* -1/3! */
+S2  =  8.33333333333333333372861537539E-3l, /*  1/5! */
+S3  = -1.98412698412698412698370682890E-4l, /* -1/7! */
+S4  =  2.75573192239858906518621665575E-6l, /*  1/9! */
+S5  = -2.50521083854417187746845202197E-8l, /* -1/11! */
+S6  =  1.60590438368216145992538343035E-10l, /*  1/13! */
+S7  = -7.64716373181981647601828761657E-13l, /* -1/15! */
+S8  =  2.81145725434552076316271450838E-15l, /*  1/17! */
+S9  = -8.22063524662432971671805709155E-18l, /* -1/19! */
+S10 =  1.95729410633912612301551424899E-20l; /*  1/21! */
+
+#ifdef __STDC__
+	Extended __kernel_sinl(Extended x, Extended y, int iy)
+#else
+	Extended __kernel_sinl(x, y, iy)
+	Extended x,y; int iy;		/* iy=0 if y is zero */
+#endif
+{
+	Extended z,r,v;
+	int32_t ix;
+	u_int32_t se;
+	GET_LDOUBLE_EXP(se,x);
+	ix = se&0x7fff;			/* exponent of x */
+	if(ix<0x3fdf)			/* |x| < 2**-32 */
+	   {if((int)x==0) return x;}	/* generate inexact */
+	z	=  x*x;
+	v	=  z*x;
+	r	=  S2+z*(S3+z*(S4+z*(S5+z*(S6+z*(S7+z*(S8+z*(S9+z*S10)))))));
+	if(iy==0) return x+v*(S1+z*r);
+	else      return x-((z*(half*y-v*r)-y)-v*S1);
+}
+}
@@ -0,0 +1,162 @@
+/* See the import.pl script for potential modifications */
+/* s_atanl.c -- Extended version of s_atan.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instructions are used instead. This one was written for streflop.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __atanl(x)
+ * Method
+ *   1. Reduce x to positive by atan(x) = -atan(-x).
+ *   2. For x > 1, use atan(x) = pi/2 - atan(1/x).
+ *   3. Now 0 <= y <= 1. Let c = j/16 be the nearest sixteenth to y,
+ *	and t = (y-c)/(1+y*c), then |t| <= 1/32 and
+ *		atan(y) = atan(c) + atan(t)
+ *	For y < 3/32, c = 0 is used instead of 1/16, since the sum above
+ *	would cancel too many bits.
+ *	For x > 1, t = (1-c*x)/(x+c) is computed from x directly, in
+ *	order not to round 1/x. c*x is exact with x split in two halves.
+ *	atan(c) is read from a table as the sum of two Extendeds.
+ *	atan(t) is approximated by its Taylor polynomial of degree 21,
+ *	with a remainder below 2^-79 relative to t for |t| < 3/32:
+ *		atan(t) ~ t + T1*t^3 + ... + T10*t^21
+ *	where T[n] = (-1)^n/(2n+1).
+ *
+ * Special cases:
+ *	atan(NaN) is NaN, atan(+-INF) is +-pi/2.
+ *	atan(x) is x with inexact for |x| < 2^-32.
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+namespace streflop_libm {
+#ifdef __STDC__
+static const Extended atanhi[] = {
+#else
+static Extended atanhi[] = {
+#endif
+  0.0l, /* atan(0/16) */
+  6.24188099959573484746785162341E-2l, /* atan(1/16) */
+  1.24354994546761435032821482144E-1l, /* atan(2/16) */
+  1.85347949995694764879512056455E-1l, /* atan(3/16) */
+  2.44978663126864154166270788615E-1l, /* atan(4/16) */
+  3.02884868374971405566731946779E-1l, /* atan(5/16) */
+  3.58770670270572220408346331144E-1l, /* atan(6/16) */
+  4.12410441597387306892751740461E-1l, /* atan(7/16) */
+  4.63647609000806116202409237759E-1l, /* atan(8/16) */
+  5.12389460310737706650631440031E-1l, /* atan(9/16) */
+  5.58599315343562435951917793941E-1l, /* atan(10/16) */
+  6.02287346134964181668114413526E-1l, /* atan(11/16) */
+  6.43501108793284386797375895561E-1l, /* atan(12/16) */
+  6.82316554874748078252100214058E-1l, /* atan(13/16) */
+  7.18829999621624505428199580770E-1l, /* atan(14/16) */
+  7.53151280962194389549755474400E-1l, /* atan(15/16) */
+  7.85398163397448309628202239852E-1l, /* atan(16/16) */
+};
+
+#ifdef __STDC__
+static const Extended atanlo[] = {
+#else
+static Extended atanlo[] = {
+#endif
+  0.0l,
+  -6.99403248643581612380003286162E-22l,
+  -1.46663298007883938929701562204E-21l,
+  6.51390477388673557143719031067E-21l,
+  5.81169259616401338805268281000E-21l,
+  -6.17585227349948038349598104515E-21l,
+  -1.24262672176843697638462211607E-20l,
+  7.03954920574887432818899749424E-21l,
+  1.18469937025062860668589144746E-20l,
+  1.59695805535516459640978276695E-20l,
+  1.95904224601710391552634854030E-20l,
+  1.40082806783055346963163582572E-20l,
+  5.43333315592098944902868110774E-21l,
+  4.32976765277975332020464414366E-21l,
+  -1.11854292439944035348793188510E-20l,
+  -2.50161041310434487537243357692E-20l,
+  -1.25413940316708300586293940010E-20l,
+};
+
+#ifdef __STDC__
+static const Extended
+#else
+static Extended
+#endif
+T1 = -3.33333333333333333342368351437E-1l, /* -1/3 */
+T2 =  2.00000000000000000002710505431E-1l, /*  1/5 */
+T3 = -1.42857142857142857140921067549E-1l, /* -1/7 */
+T4 =  1.11111111111111111109605274760E-1l, /*  1/9 */
+T5 = -9.09090909090909090933731867556E-2l, /* -1/11 */
+T6 =  7.69230769230769230779655790120E-2l, /*  1/13 */
+T7 = -6.66666666666666666698289230031E-2l, /* -1/15 */
+T8 =  5.88235294117647058825522430464E-2l, /*  1/17 */
+T9 = -5.26315789473684210515616425929E-2l, /* -1/19 */
+T10 = 4.76190476190476190469736891830E-2l, /*  1/21 */
+pio2_hi =  1.57079632679489661925640447970l,
+pio2_lo = -2.50827880633416601172587880020E-20l,
+one   = 1.0l,
+huge   = 1.0e+4900l;
+
+#ifdef __STDC__
+	Extended __atanl(Extended x)
+#else
+	Extended __atanl(x)
+	Extended x;
+#endif
+{
+	Extended y,c,t,z,p;
+	int32_t ix,j;
+	u_int32_t se,i0,i1;
+
+	GET_LDOUBLE_WORDS(se,i0,i1,x);
+	ix = se&0x7fff;
+	if(ix>=0x4041) {	/* if |x| >= 2^66 */
+	    if(ix==0x7fff&&((i0&0x7fffffff)|i1)!=0)
+		return x+x;		/* NaN */
+	    if(se&0x8000) return -pio2_hi-pio2_lo;
+	    else	  return  pio2_hi+pio2_lo;
+	}
+	if (ix < 0x3fdf) {	/* |x| < 2^-32 */
+	    if(huge+x>one) return x;	/* raise inexact */
+	}
+	y = fabsl(x);
+	if (ix >= 0x3fff) {	/* |x| >= 1 */
+	    j = (int32_t)(one/y*16.0l+0.5l);
+	    c = j*0.0625l;
+	    if (j==0) t = one/y;
+	    else {
+	    /* t = (1-c*y)/(y+c), with c*y computed exactly */
+		SET_LDOUBLE_WORDS(z,se&0x7fff,i0,0);
+		t = ((one-c*z)-c*(y-z))/(y+c);
+	    }
+	} else {
+	    j = (int32_t)(y*16.0l+0.5l);
+	    if (j==1) j = 0;	/* y < 3/32 */
+	    c = j*0.0625l;
+	    t = (y-c)/(one+y*c);
+	}
+	z = t*t;
+	p = t+t*z*(T1+z*(T2+z*(T3+z*(T4+z*(T5+z*(T6+z*(T7+z*(T8+z*(T9+z*T10)))))))));
+	if (ix >= 0x3fff) {
+	    z = pio2_hi-atanhi[j];	/* the rounding error is kept in y */
+	    y = (pio2_hi-z)-atanhi[j];
+	    z = z+((y+(pio2_lo-atanlo[j]))-p);
+	}
+	else
+	    z = atanhi[j]+(atanlo[j]+p);
+	if(se&0x8000) return -z;
+	return z;
+}
+}
@@ -55,7 +55,7 @@ static Extended huge = 1.0e4930l;
 		if(huge+x>0.0l) {/* return 0*sign(x) if |x|<1 */
 		    if(sx==0) {se=0;i0=i1=0;}
 		    else if(((se&0x7fff)|i0|i1)!=0)
-			{ se=0xbfff;i0=i1=0;}
+			{ se=0xbfff;i0=0x80000000;i1=0;}
 		}
 	    } else {
 		i = (0x7fffffff)>>j0;
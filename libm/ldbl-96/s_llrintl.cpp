@@ -31,6 +31,7 @@ static const Extended two63[2] =
 };
 
 
+namespace streflop_libm {
 long long int
 __llrintl (Extended x)
 {
@@ -76,3 +77,4 @@ __llrintl (Extended x)
 }
 
 weak_alias (__llrintl, llrintl)
+}
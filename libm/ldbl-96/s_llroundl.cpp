@@ -24,6 +24,7 @@
 #include "math_private.h"
 
 
+namespace streflop_libm {
 long long int
 __llroundl (Extended x)
 {
@@ -80,3 +81,4 @@ __llroundl (Extended x)
 }
 
 weak_alias (__llroundl, llroundl)
+}
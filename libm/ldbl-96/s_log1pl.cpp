@@ -0,0 +1,124 @@
+/* See the import.pl script for potential modifications */
+/* s_log1pl.c -- Extended version of s_log1p.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instructions are used instead. This one was written for streflop.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __log1pl(x)
+ * Returns the natural logarithm of 1+x.
+ *
+ * Method :
+ *   1. Argument Reduction: find k and f such that
+ *			1+x = 2^k * (1+f),
+ *	   where  sqrt(2)/2 < 1+f < sqrt(2) .
+ *
+ *      Note. If k=0, then f=x is exact. However, if k!=0, then f
+ *	may not be representable exactly. In that case, a correction
+ *	term is need. Let u=1+x rounded. Let c = (1+x)-u, then
+ *	log(1+x) - log(u) ~ c/u. Thus, we proceed to compute log(u),
+ *	and add back the correction term c/u.
+ *
+ *   2. Approximation of log(1+f), as in e_logl.c.
+ *
+ *   3. Finally, log1p(x) = k*ln2 + log(1+f) + c/u.
+ *		 = k*ln2_hi+(f-(hfsq-(s*(hfsq+R)+(k*ln2_lo+c))))
+ *
+ * Special cases:
+ *	log1p(x) is NaN with signal if x < -1 (including -INF) ;
+ *	log1p(+INF) is +INF; log1p(-1) is -INF with signal;
+ *	log1p(NaN) is that NaN with no signal.
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+namespace streflop_libm {
+#ifdef __STDC__
+static const Extended
+#else
+static Extended
+#endif
+ln2_hi  =  6.93147180559945397249066445511E-1l,	/* 49 bits */
+ln2_lo  = -8.78318343240526578864250037720E-17l,
+two64   =  1.84467440737095516160000000000E+19l,	/* 2^64 */
+Lg1 = 6.66666666666666666684736702875E-1l,  /* 2/3 */
+Lg2 = 4.00000000000000000005421010862E-1l,  /* 2/5 */
+Lg3 = 2.85714285714285714281842135098E-1l,  /* 2/7 */
+Lg4 = 2.22222222222222222219210549521E-1l,  /* 2/9 */
+Lg5 = 1.81818181818181818186746373511E-1l,  /* 2/11 */
+Lg6 = 1.53846153846153846155931158024E-1l,  /* 2/13 */
+Lg7 = 1.33333333333333333339657846006E-1l,  /* 2/15 */
+Lg8 = 1.17647058823529411765104486093E-1l,  /* 2/17 */
+Lg9 = 1.05263157894736842103123285186E-1l,  /* 2/19 */
+Lg10 = 9.52380952380952380939473783661E-2l,  /* 2/21 */
+Lg11 = 8.69565217391304347814302150299E-2l,  /* 2/23 */
+Lg12 = 7.99999999999999999983736967413E-2l,  /* 2/25 */
+sqrt2m1 =  4.14213562373095048801688724209E-1l,	/* sqrt(2)-1 */
+sqrt2_2m1 = -2.92893218813452475599155637895E-1l,	/* sqrt(2)/2-1 */
+zero   =  0.0l;
+
+#ifdef __STDC__
+	Extended __log1pl(Extended x)
+#else
+	Extended __log1pl(x)
+	Extended x;
+#endif
+{
+	Extended hfsq,f,c,s,z,R,u,dk;
+	int32_t k,ix;
+	u_int32_t se,i0,i1;
+
+	GET_LDOUBLE_WORDS(se,i0,i1,x);
+	ix = se&0x7fff;
+
+	if (ix==0x7fff) {
+	    if ((se&0x8000)&&((i0&0x7fffffff)|i1)==0)
+		return (x-x)/(x-x);	/* log1p(-inf)=NaN */
+	    return x+x;			/* log1p(+inf or NaN) */
+	}
+	if (ix<0x3fbe) {		/* |x| < 2**-65 */
+	    if(two64+x>zero)	/* raise inexact */
+		return x;
+	}
+	if (x>sqrt2_2m1&&x<sqrt2m1) {	/* sqrt(2)/2 < 1+x < sqrt(2) */
+	    k = 0; f = x; c = zero;
+	} else {
+	    if (x<=-1.0l) {
+		if (x==-1.0l) return -two64/zero;	/* log1p(-1)=-inf */
+		return (x-x)/(x-x);			/* log1p(x<-1)=NaN */
+	    }
+	    u = 1.0l+x;
+	    GET_LDOUBLE_WORDS(se,i0,i1,u);
+	    k = (se&0x7fff)-0x3fff;
+	    if (k<66) {
+	    /* correction term */
+		if (k>0) c = 1.0l-(u-x);
+		else c = x-(u-1.0l);
+		c /= u;
+	    } else c = zero;
+	/* normalize u or u/2 into [sqrt(2)/2, sqrt(2)) */
+	    if (i0>0xb504f333) {
+		SET_LDOUBLE_EXP(u,0x3ffe);
+		k += 1;
+	    } else SET_LDOUBLE_EXP(u,0x3fff);
+	    f = u-1.0l;
+	}
+	dk = (Extended)k;
+	s = f/(2.0l+f);
+	z = s*s;
+	R = z*(Lg1+z*(Lg2+z*(Lg3+z*(Lg4+z*(Lg5+z*(Lg6+z*(Lg7+z*(Lg8+z*(Lg9+z*(Lg10+z*(Lg11+z*Lg12)))))))))));
+	hfsq = 0.5l*f*f;
+	return dk*ln2_hi-((hfsq-(s*(hfsq+R)+(dk*ln2_lo+c)))-f);
+}
+}
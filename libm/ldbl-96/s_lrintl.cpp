@@ -31,6 +31,7 @@ static const Extended two63[2] =
 };
 
 
+namespace streflop_libm {
 long int
 __lrintl (Extended x)
 {
@@ -88,3 +89,4 @@ __lrintl (Extended x)
 }
 
 weak_alias (__lrintl, lrintl)
+}
@@ -24,6 +24,7 @@
 #include "math_private.h"
 
 
+namespace streflop_libm {
 long int
 __lroundl (Extended x)
 {
@@ -80,3 +81,4 @@ __lroundl (Extended x)
 }
 
 weak_alias (__lroundl, lroundl)
+}
@@ -37,8 +37,8 @@ namespace streflop_libm {
 	Extended x,y;
 #endif
 {
-	int32_t hx,hy,ix,iy;
-	u_int32_t lx,ly,esx,esy;
+	int32_t ix,iy;
+	u_int32_t hx,hy,lx,ly,esx,esy;
 
 	GET_LDOUBLE_WORDS(esx,hx,lx,x);
 	GET_LDOUBLE_WORDS(esy,hy,ly,y);
@@ -58,31 +58,42 @@ namespace streflop_libm {
 	    if(ix>iy||((ix==iy) && (hx>hy||((hx==hy)&&(lx>ly))))) {
 	      /* x > y, x -= ulp */
 		if(lx==0) {
-		    if (hx==0) esx -= 1;
-		    hx -= 1;
+		    if (hx<=0x80000000 && esx!=0) {
+			esx -= 1;
+			hx -= 1;
+			if ((esx&0x7fff)!=0) hx |= 0x80000000;
+		    } else hx -= 1;
 		}
 		lx -= 1;
 	    } else {				/* x < y, x += ulp */
 		lx += 1;
 		if(lx==0) {
 		    hx += 1;
-		    if (hx==0)
+		    if (hx==0 || ((esx&0x7fff)==0 && hx==0x80000000)) {
 			esx += 1;
+			hx |= 0x80000000;
+		    }
 		}
 	    }
 	} else {				/* x < 0 */
-	    if(esy>=0||(ix>iy||((ix==iy)&&(hx>hy||((hx==hy)&&(lx>ly)))))){
+	    if(esy<0x8000||(ix>iy||((ix==iy)&&(hx>hy||((hx==hy)&&(lx>ly)))))){
 	      /* x < y, x -= ulp */
 		if(lx==0) {
-		    if (hx==0) esx -= 1;
-		    hx -= 1;
+		    if (hx<=0x80000000 && (esx&0x7fff)!=0) {
+			esx -= 1;
+			hx -= 1;
+			if ((esx&0x7fff)!=0) hx |= 0x80000000;
+		    } else hx -= 1;
 		}
 		lx -= 1;
 	    } else {				/* x > y, x += ulp */
 		lx += 1;
 		if(lx==0) {
 		    hx += 1;
-		    if (hx==0) esx += 1;
+		    if (hx==0 || ((esx&0x7fff)==0 && hx==0x80000000)) {
+			esx += 1;
+			hx |= 0x80000000;
+		    }
 		}
 	    }
 	}
@@ -35,8 +35,8 @@ static const Extended
 #else
 static Extended
 #endif
-two63   =  4.50359962737049600000e+15l,
-twom63  =  1.08420217248550443400e-19l,
+two64   =  1.8446744073709551616e19l,
+twom64  =  5.421010862427522170037e-20l,
 huge   = 1.0e+4900l,
 tiny   = 1.0e-4900l;
 
@@ -52,9 +52,9 @@ tiny   = 1.0e-4900l;
         k = es&0x7fff;				/* extract exponent */
         if (k==0) {				/* 0 or subnormal x */
             if ((lx|(hx&0x7fffffff))==0) return x; /* +-0 */
-	    x *= two63;
-	    GET_LDOUBLE_EXP(es,x);
-	    k = (hx&0x7fff) - 63;
+	    x *= two64;
+	    GET_LDOUBLE_EXP(hx,x);
+	    k = (hx&0x7fff) - 64;
 	    }
         if (k==0x7fff) return x+x;		/* NaN or Inf */
         k = k+n;
@@ -64,11 +64,11 @@ tiny   = 1.0e-4900l;
 	  return tiny*__copysignl(tiny,x);
         if (k > 0) 				/* normal result */
 	    {SET_LDOUBLE_EXP(x,(es&0x8000)|k); return x;}
-        if (k <= -63)
+        if (k <= -64)
 	    return tiny*__copysignl(tiny,x); 	/*underflow*/
-        k += 63;				/* subnormal result */
+        k += 64;				/* subnormal result */
 	SET_LDOUBLE_EXP(x,(es&0x8000)|k);
-        return x*twom63;
+        return x*twom64;
 }
 weak_alias (__scalblnl, scalblnl)
 }
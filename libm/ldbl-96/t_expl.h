@@ -0,0 +1,92 @@
+/* See the import.pl script for potential modifications */
+/* t_expl.h -- table and polynomial shared by the Extended exponentials.
+ * Written for streflop, see e_expl.c.
+ */
+
+/* exp2_32_hi[j] + exp2_32_lo[j] = 2^(j/32) to about 128 bits, j = 0..31.
+ * The high part is 2^(j/32) correctly rounded to the 64 bits format.
+ */
+static const Extended exp2_32_hi[32] = {
+  1.00000000000000000000000000000l,
+  1.02189714865411667820815216912l,
+  1.04427378242741384034662083247l,
+  1.06714040067682361812972241522l,
+  1.09050773266525765920875040704l,
+  1.11438674259589253628943694707l,
+  1.13878863475669165369712210190l,
+  1.16372485877757751379386191859l,
+  1.18920711500272106668756738612l,
+  1.21524735998046887815605271443l,
+  1.24185781207348404863409496723l,
+  1.26905095719173322259699238090l,
+  1.29683955465100966592158215906l,
+  1.32523664315974129459391184227l,
+  1.35425554693689272826688518858l,
+  1.38390988196383195492356055212l,
+  1.41421356237309504876378807303l,
+  1.44518080697704662002534697907l,
+  1.47682614593949931142396331252l,
+  1.50916442759342273971338854732l,
+  1.54221082540794082358596300830l,
+  1.57598084510788648650910642735l,
+  1.61049033194925430819213763023l,
+  1.64575547815396484451107295133l,
+  1.68179283050742908603783498656l,
+  1.71861929812247791560329140959l,
+  1.75625216037329948310947297374l,
+  1.79470907500310718641484131197l,
+  1.83400808640934246350733677344l,
+  1.87416763411029990130021033456l,
+  1.91520656139714729382025892868l,
+  1.95714412417540026896574378856l,
+};
+
+static const Extended exp2_32_lo[32] = {
+  0.0l,
+  2.63279656671808825698889072248E-20l,
+  -2.46543537266552522715549367098E-20l,
+  3.97987057774545042498032917105E-20l,
+  -1.73975128203485699087587372381E-21l,
+  1.93760098472853604488273849291E-20l,
+  6.70818194561129537528248779727E-21l,
+  1.97116805026291864625383418943E-20l,
+  2.99325844384495236898834128430E-20l,
+  -3.95324630955113339898936470560E-20l,
+  -4.04174985073250644572949113476E-20l,
+  -4.25732998715750399616834661172E-20l,
+  1.21719587275113721949260940508E-20l,
+  3.56252532287040871141222545802E-20l,
+  3.11295515590775609567708647631E-20l,
+  -5.09010248523856635542874493656E-20l,
+  3.79006511778651415924254432851E-20l,
+  1.16592624056987417979499770710E-20l,
+  -3.70558321432657474340710181999E-20l,
+  5.26310037108122035892669268134E-20l,
+  2.63288537887326328689413193961E-20l,
+  -5.38362671631122006134156258577E-20l,
+  -1.26169628716121734403746282936E-20l,
+  7.68377339838742458267241813004E-21l,
+  2.44159659108350938235259450050E-20l,
+  2.60529668710165809815833576490E-20l,
+  2.68764563446325538747830092581E-21l,
+  1.28619301556137002014552710559E-20l,
+  -2.02535838545129577942873024683E-20l,
+  2.97886153895801909418326566376E-20l,
+  5.23523416198050986778051740650E-20l,
+  5.25784630640104637322417354794E-20l,
+};
+
+/* expm1(r) = r + r^2*(P2 + r*(P3 + ... + r*P8)) for |r| <= ln2/64,
+ * the Taylor coefficients P[n] = 1/n! rounded to Extended.
+ * The remainder is below 2^-70 relative to the result.
+ * In the directed rounding modes |r| may reach ln2/32, still with
+ * a remainder below 2^-66.
+ */
+static const Extended
+P2 = 5.0e-1l,
+P3 = 1.66666666666666666671184175719E-1l,
+P4 = 4.16666666666666666677960439297E-2l,
+P5 = 8.33333333333333333372861537539E-3l,
+P6 = 1.38888888888888888884889011082E-3l,
+P7 = 1.98412698412698412698370682890E-4l,
+P8 = 2.48015873015873015872963353612E-5l;
@@ -0,0 +1,159 @@
+/* s_atanl.c -- long double version of s_atan.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instructions are used instead. This one was written for streflop.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __atanl(x)
+ * Method
+ *   1. Reduce x to positive by atan(x) = -atan(-x).
+ *   2. For x > 1, use atan(x) = pi/2 - atan(1/x).
+ *   3. Now 0 <= y <= 1. Let c = j/16 be the nearest sixteenth to y,
+ *	and t = (y-c)/(1+y*c), then |t| <= 1/32 and
+ *		atan(y) = atan(c) + atan(t)
+ *	For y < 3/32, c = 0 is used instead of 1/16, since the sum above
+ *	would cancel too many bits.
+ *	For x > 1, t = (1-c*x)/(x+c) is computed from x directly, in
+ *	order not to round 1/x. c*x is exact with x split in two halves.
+ *	atan(c) is read from a table as the sum of two long doubles.
+ *	atan(t) is approximated by its Taylor polynomial of degree 21,
+ *	with a remainder below 2^-79 relative to t for |t| < 3/32:
+ *		atan(t) ~ t + T1*t^3 + ... + T10*t^21
+ *	where T[n] = (-1)^n/(2n+1).
+ *
+ * Special cases:
+ *	atan(NaN) is NaN, atan(+-INF) is +-pi/2.
+ *	atan(x) is x with inexact for |x| < 2^-32.
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+#ifdef __STDC__
+static const long double atanhi[] = {
+#else
+static long double atanhi[] = {
+#endif
+  0.0L, /* atan(0/16) */
+  6.24188099959573484746785162341E-2L, /* atan(1/16) */
+  1.24354994546761435032821482144E-1L, /* atan(2/16) */
+  1.85347949995694764879512056455E-1L, /* atan(3/16) */
+  2.44978663126864154166270788615E-1L, /* atan(4/16) */
+  3.02884868374971405566731946779E-1L, /* atan(5/16) */
+  3.58770670270572220408346331144E-1L, /* atan(6/16) */
+  4.12410441597387306892751740461E-1L, /* atan(7/16) */
+  4.63647609000806116202409237759E-1L, /* atan(8/16) */
+  5.12389460310737706650631440031E-1L, /* atan(9/16) */
+  5.58599315343562435951917793941E-1L, /* atan(10/16) */
+  6.02287346134964181668114413526E-1L, /* atan(11/16) */
+  6.43501108793284386797375895561E-1L, /* atan(12/16) */
+  6.82316554874748078252100214058E-1L, /* atan(13/16) */
+  7.18829999621624505428199580770E-1L, /* atan(14/16) */
+  7.53151280962194389549755474400E-1L, /* atan(15/16) */
+  7.85398163397448309628202239852E-1L, /* atan(16/16) */
+};
+
+#ifdef __STDC__
+static const long double atanlo[] = {
+#else
+static long double atanlo[] = {
+#endif
+  0.0L,
+  -6.99403248643581612380003286162E-22L,
+  -1.46663298007883938929701562204E-21L,
+  6.51390477388673557143719031067E-21L,
+  5.81169259616401338805268281000E-21L,
+  -6.17585227349948038349598104515E-21L,
+  -1.24262672176843697638462211607E-20L,
+  7.03954920574887432818899749424E-21L,
+  1.18469937025062860668589144746E-20L,
+  1.59695805535516459640978276695E-20L,
+  1.95904224601710391552634854030E-20L,
+  1.40082806783055346963163582572E-20L,
+  5.43333315592098944902868110774E-21L,
+  4.32976765277975332020464414366E-21L,
+  -1.11854292439944035348793188510E-20L,
+  -2.50161041310434487537243357692E-20L,
+  -1.25413940316708300586293940010E-20L,
+};
+
+#ifdef __STDC__
+static const long double
+#else
+static long double
+#endif
+T1 = -3.33333333333333333342368351437E-1L, /* -1/3 */
+T2 =  2.00000000000000000002710505431E-1L, /*  1/5 */
+T3 = -1.42857142857142857140921067549E-1L, /* -1/7 */
+T4 =  1.11111111111111111109605274760E-1L, /*  1/9 */
+T5 = -9.09090909090909090933731867556E-2L, /* -1/11 */
+T6 =  7.69230769230769230779655790120E-2L, /*  1/13 */
+T7 = -6.66666666666666666698289230031E-2L, /* -1/15 */
+T8 =  5.88235294117647058825522430464E-2L, /*  1/17 */
+T9 = -5.26315789473684210515616425929E-2L, /* -1/19 */
+T10 = 4.76190476190476190469736891830E-2L, /*  1/21 */
+pio2_hi =  1.57079632679489661925640447970L,
+pio2_lo = -2.50827880633416601172587880020E-20L,
+one   = 1.0L,
+huge   = 1.0e+4900L;
+
+#ifdef __STDC__
+	long double __atanl(long double x)
+#else
+	long double __atanl(x)
+	long double x;
+#endif
+{
+	long double y,c,t,z,p;
+	int32_t ix,j;
+	u_int32_t se,i0,i1;
+
+	GET_LDOUBLE_WORDS(se,i0,i1,x);
+	ix = se&0x7fff;
+	if(ix>=0x4041) {	/* if |x| >= 2^66 */
+	    if(ix==0x7fff&&((i0&0x7fffffff)|i1)!=0)
+		return x+x;		/* NaN */
+	    if(se&0x8000) return -pio2_hi-pio2_lo;
+	    else	  return  pio2_hi+pio2_lo;
+	}
+	if (ix < 0x3fdf) {	/* |x| < 2^-32 */
+	    if(huge+x>one) return x;	/* raise inexact */
+	}
+	y = fabsl(x);
+	if (ix >= 0x3fff) {	/* |x| >= 1 */
+	    j = (int32_t)(one/y*16.0L+0.5L);
+	    c = j*0.0625L;
+	    if (j==0) t = one/y;
+	    else {
+	    /* t = (1-c*y)/(y+c), with c*y computed exactly */
+		SET_LDOUBLE_WORDS(z,se&0x7fff,i0,0);
+		t = ((one-c*z)-c*(y-z))/(y+c);
+	    }
+	} else {
+	    j = (int32_t)(y*16.0L+0.5L);
+	    if (j==1) j = 0;	/* y < 3/32 */
+	    c = j*0.0625L;
+	    t = (y-c)/(one+y*c);
+	}
+	z = t*t;
+	p = t+t*z*(T1+z*(T2+z*(T3+z*(T4+z*(T5+z*(T6+z*(T7+z*(T8+z*(T9+z*T10)))))))));
+	if (ix >= 0x3fff) {
+	    z = pio2_hi-atanhi[j];	/* the rounding error is kept in y */
+	    y = (pio2_hi-z)-atanhi[j];
+	    z = z+((y+(pio2_lo-atanlo[j]))-p);
+	}
+	else
+	    z = atanhi[j]+(atanlo[j]+p);
+	if(se&0x8000) return -z;
+	return z;
+}
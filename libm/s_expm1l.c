@@ -0,0 +1,133 @@
+/* s_expm1l.c -- long double version of s_expm1.c.
+ * The ldbl-96 directory of the GNU libm has no C version of this function,
+ * the x87 instructions are used instead. This one was written for streflop.
+ */
+
+/*
+ * ====================================================
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ *
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ * ====================================================
+ */
+
+/* __expm1l(x)
+ * Returns exp(x)-1, the exponential of x minus 1.
+ *
+ * Method
+ *   1. When |x| < 0.25, expm1(x) is approximated by its Taylor
+ *	polynomial of degree 15, with a remainder below 2^-74 relative
+ *	to expm1(x):
+ *		expm1(x) ~ x + Q2*x^2 + ... + Q15*x^15
+ *	where Q[n] = 1/n!.
+ *	Otherwise, argument reduction, as in e_expl.c:
+ *		x = k*ln2/32 + r,  |r| <= ln2/64.
+ *
+ *   2. With k = 32*m + j, 0 <= j < 32, and T_hi + T_lo = 2^(j/32):
+ *		expm1(x) = 2^m * (T_hi - 2^-m + (T_lo + T_hi*p(r)))
+ *	T_hi - 2^-m is exact for -1 <= m <= 63, which covers all the
+ *	cases where the subtraction of 1 cancels some bits.
+ *	Outside of this range, 1 is subtracted after the scaling.
+ *
+ * Special cases:
+ *	expm1(INF) is INF, expm1(NaN) is NaN;
+ *	expm1(-INF) is -1, and
+ *	for finite argument, only expm1(0)=0 is exact.
+ *
+ * Overflow:
+ *	if x > 1.1356523406294143949e+04 then expm1(x) overflows
+ */
+
+#include "math.h"
+#include "math_private.h"
+
+#ifdef __STDC__
+static const long double
+#else
+static long double
+#endif
+one	= 1.0L,
+halF[2]	= {0.5L,-0.5L,},
+huge	= 1.0e+4900L,
+tiny	= 1.0e-4900L,
+o_threshold =  1.13565234062941439496796647290E+4L,
+ln2_32hi =  2.16608493924983491751845576800E-2L, /* 44 bits */
+ln2_32lo = -5.82558960538844725799442856763E-17L,
+invln2_32 = 4.61662413084468290364048570495E+1L, /* 32/ln2 */
+Q2  = 5.00000000000000000000000000000E-1L, /* 1/2! */
+Q3  = 1.66666666666666666671184175719E-1L, /* 1/3! */
+Q4  = 4.16666666666666666677960439297E-2L, /* 1/4! */
+Q5  = 8.33333333333333333372861537539E-3L, /* 1/5! */
+Q6  = 1.38888888888888888884889011082E-3L, /* 1/6! */
+Q7  = 1.98412698412698412698370682890E-4L, /* 1/7! */
+Q8  = 2.48015873015873015872963353612E-5L, /* 1/8! */
+Q9  = 2.75573192239858906518621665575E-6L, /* 1/9! */
+Q10 = 2.75573192239858906513451786747E-7L, /* 1/10! */
+Q11 = 2.50521083854417187746845202197E-8L, /* 1/11! */
+Q12 = 2.08767569878680989789037668497E-9L, /* 1/12! */
+Q13 = 1.60590438368216145992538343035E-10L, /* 1/13! */
+Q14 = 1.14707455977297247139781276183E-11L, /* 1/14! */
+Q15 = 7.64716373181981647601828761657E-13L; /* 1/15! */
+
+#include "t_expl.h"
+
+#ifdef __STDC__
+	long double __expm1l(long double x)
+#else
+	long double __expm1l(x)
+	long double x;
+#endif
+{
+	long double hi,lo,r,p,t,z,twopm;
+	int32_t k,j,m,xsb,ix;
+	u_int32_t se,i0,i1;
+
+	GET_LDOUBLE_WORDS(se,i0,i1,x);
+	xsb = (se>>15)&1;		/* sign bit of x */
+	ix = se&0x7fff;			/* exponent of x */
+
+    /* filter out huge and non-finite argument */
+	if(ix >= 0x4004) {			/* if |x|>=32 */
+	    if(ix==0x7fff) {
+		if(((i0&0x7fffffff)|i1)!=0)
+		    return x+x;		/* NaN */
+		if(xsb==0) return x;	/* expm1(+inf)=+inf */
+		return -one;		/* expm1(-inf)=-1 */
+	    }
+	    if(x > o_threshold) return huge*huge; /* overflow */
+	    if(x < -4.6E+1L) return tiny-one;	/* exp(x) < 2^-66, return -1 with inexact */
+	}
+	else if(ix < 0x3fbd) {		/* when |x|<2**-66 */
+	    t = huge+x;	/* return x with inexact flags when x!=0 */
+	    return x - (t-(huge+x));
+	}
+	else if(ix < 0x3ffd)		/* |x| < 0.25 */
+	    return x + x*x*(Q2+x*(Q3+x*(Q4+x*(Q5+x*(Q6+x*(Q7+x*(Q8+x*(Q9+x*(Q10+x*(Q11+x*(Q12+x*(Q13+x*(Q14+x*Q15)))))))))))));
+
+    /* argument reduction */
+	k  = (int32_t)(invln2_32*x+halF[xsb]);
+	t  = k;
+	hi = x - t*ln2_32hi;	/* t*ln2_32hi is exact here */
+	lo = t*ln2_32lo;
+	r  = hi - lo;
+
+	p  = r + r*r*(P2+r*(P3+r*(P4+r*(P5+r*(P6+r*(P7+r*P8))))));
+	j  = k&31;
+	m  = (k-j)/32;
+	lo = exp2_32_lo[j] + exp2_32_hi[j]*p;
+	if(m>=-1&&m<=63) {
+	    SET_LDOUBLE_WORDS(twopm,0x3fff-m,0x80000000,0);	/* 2^-m */
+	    z = (exp2_32_hi[j] - twopm) + lo;
+	    GET_LDOUBLE_EXP(se,z);
+	    SET_LDOUBLE_EXP(z,se+m);
+	    return z;
+	}
+	z = exp2_32_hi[j] + lo;
+	GET_LDOUBLE_EXP(se,z);
+	if((int32_t)se+m >= 0x7fff) return huge*huge; /* overflow */
+	SET_LDOUBLE_EXP(z,se+m);
+	return z - one;
+}
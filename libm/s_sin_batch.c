@@ -0,0 +1,445 @@
+/* s_sin_batch.c -- written for streflop.
+ * Packed versions of __sin and __cos of s_sin.c for |x| < 105414350, see
+ * batch.h. The branches of these functions depend on the argument and,
+ * after the reduction by pi/2, on the quadrant and on the size of the
+ * reduced argument. The batch is taken by chunks, and the elements of a
+ * chunk are first sorted by branch, so that each branch runs on full
+ * vectors. The reductions are done element by element while sorting, with
+ * the code of s_sin.c. The larger arguments, and the results that fail the
+ * accuracy checks of s_sin.c and would go to its slow paths, are computed
+ * by __sin and __cos. The sincos.tbl table is static, this file has its own
+ * copy.
+ */
+
+#include "endian.h"
+#include "mydefs.h"
+#include "usncs.h"
+#include "MathLib.h"
+#include "sincos.tbl"
+#include "math_private.h"
+#include "batch.h"
+
+void __sin_batch(const double *in, double *out, size_t n);
+void __cos_batch(const double *in, double *out, size_t n);
+
+#ifdef STREFLOP_BATCH_PACKED
+
+static const double
+	  sn3 = -1.66666666666664880952546298448555E-01,
+	  sn5 =  8.33333214285722277379541354343671E-03,
+	  cs2 =  4.99999999999999999999950396842453E-01,
+	  cs4 = -4.16666666666664434524222570944589E-02,
+	  cs6 =  1.38888874007937613028114285595617E-03;
+
+#define CHUNK 64
+
+/* The elements of a chunk that take the same branch: their index in the
+   chunk, the argument of the branch a + da, the eps of the accuracy check
+   and whether the result is negated */
+typedef struct
+{
+  int n;
+  int idx[CHUNK];
+  double a[CHUNK], da[CHUNK], eps[CHUNK];
+  int neg[CHUNK];
+} branch;
+
+static inline void
+push (branch *b, int e, double a, double da, double eps, int neg)
+{
+  b->idx[b->n] = e;
+  b->a[b->n] = a;
+  b->da[b->n] = da;
+  b->eps[b->n] = eps;
+  b->neg[b->n] = neg;
+  b->n++;
+}
+
+/* The cnt values from v, the last one repeated in the lanes above */
+static inline vdouble
+gather (const double *v, int cnt)
+{
+  vdouble r;
+  int l;
+  for (l = 0; l < DLANES; l++)
+    r[l] = v[l < cnt ? l : cnt - 1];
+  return r;
+}
+
+static inline vdmask
+gather_neg (const int *v, int cnt)
+{
+  vdmask r;
+  int l;
+  for (l = 0; l < DLANES; l++)
+    r[l] = v[l < cnt ? l : cnt - 1] ? -1 : 0;
+  return r;
+}
+
+/* The results of the first cnt lanes, f is called on the elements whose
+   lane is not set in ok */
+static inline void
+scatter (double *out, const double *x, const int *idx, int cnt,
+	 vdouble res, vdmask ok, double (*f) (double))
+{
+  int l;
+  for (l = 0; l < cnt; l++)
+    out[idx[l]] = ok[l] ? res[l] : f (x[idx[l]]);
+}
+
+/* The entries of sincos.tbl for u = big + y */
+static inline void
+table (vdouble u, vdouble *sn, vdouble *ssn, vdouble *cs, vdouble *ccs)
+{
+  double t[4][DLANES];
+  mynumber v;
+  int4 k, l;
+  for (l = 0; l < DLANES; l++)
+    {
+      v.x = u[l];
+      k = v.i[LOW_HALF]<<2;
+      t[0][l] = sincos.x[k];
+      t[1][l] = sincos.x[k+1];
+      t[2][l] = sincos.x[k+2];
+      t[3][l] = sincos.x[k+3];
+    }
+  *sn = vd_load (t[0]);
+  *ssn = vd_load (t[1]);
+  *cs = vd_load (t[2]);
+  *ccs = vd_load (t[3]);
+}
+
+/* sin, 2^-26 < |x| < 0.25 */
+static void
+sin_small (const branch *b, const double *x, double *out)
+{
+  vdouble a, xx, t, res, cor;
+  int p, cnt;
+  for (p = 0; p < b->n; p += cnt)
+    {
+      cnt = b->n - p < DLANES ? b->n - p : DLANES;
+      a = gather (b->a + p, cnt);
+      xx = a*a;
+      /*Taylor series */
+      t = ((((s5.x*xx + s4.x)*xx + s3.x)*xx + s2.x)*xx + s1.x)*(xx*a);
+      res = a+t;
+      cor = (a-res)+t;
+      scatter (out, x, b->idx + p, cnt, res, res == res + 1.07*cor, __sin);
+    }
+}
+
+/* sin, 0.25 < |x| < 0.855469 */
+static void
+sin_table (const branch *b, const double *x, double *out)
+{
+  vdouble a, u, y, xx, s, c, sn, ssn, cs, ccs, res, cor;
+  vdmask m;
+  int p, cnt;
+  for (p = 0; p < b->n; p += cnt)
+    {
+      cnt = b->n - p < DLANES ? b->n - p : DLANES;
+      a = gather (b->a + p, cnt);
+      m = a > 0;
+      u = vd_select (m, big.x+a, big.x-a);
+      y = vd_select (m, a-(u-big.x), a+(u-big.x));
+      xx=y*y;
+      s = y + y*xx*(sn3 +xx*sn5);
+      c = xx*(cs2 +xx*(cs4 + xx*cs6));
+      table (u, &sn, &ssn, &cs, &ccs);
+      sn = vd_select (m, sn, -sn);
+      ssn = vd_select (m, ssn, -ssn);
+      cor=(ssn+s*ccs-sn*c)+cs*s;
+      res=sn+cor;
+      cor=(sn-res)+cor;
+      scatter (out, x, b->idx + p, cnt, res, res==res+1.025*cor, __sin);
+    }
+}
+
+/* sin, 0.855469 < |x| < 2.426265 */
+static void
+sin_hp (const branch *b, const double *x, double *out)
+{
+  vdouble a, u, y, xx, s, c, sn, ssn, cs, ccs, res, cor;
+  vdmask m, ge;
+  int p, cnt;
+  for (p = 0; p < b->n; p += cnt)
+    {
+      cnt = b->n - p < DLANES ? b->n - p : DLANES;
+      a = gather (b->a + p, cnt);
+      m = a > 0;
+      y = vd_select (m, hp0.x-a, hp0.x+a);
+      ge = y >= 0;
+      u = vd_select (ge, big.x+y, big.x-y);
+      y = vd_select (ge, (y-(u-big.x))+hp1.x, (-hp1.x) - (y+(u-big.x)));
+      xx=y*y;
+      s = y + y*xx*(sn3 +xx*sn5);
+      c = xx*(cs2 +xx*(cs4 + xx*cs6));
+      table (u, &sn, &ssn, &cs, &ccs);
+      cor=(ccs-s*ssn-cs*c)-sn*s;
+      res=cs+cor;
+      cor=(cs-res)+cor;
+      scatter (out, x, b->idx + p, cnt, vd_select (m, res, -res), res==res+1.020*cor, __sin);
+    }
+}
+
+/* cos, 2^-27 < |x| < 0.855469 */
+static void
+cos_table (const branch *b, const double *x, double *out)
+{
+  vdouble u, y, xx, s, c, sn, ssn, cs, ccs, res, cor;
+  int p, cnt;
+  for (p = 0; p < b->n; p += cnt)
+    {
+      cnt = b->n - p < DLANES ? b->n - p : DLANES;
+      y = gather (b->a + p, cnt);
+      y = vd_select (y > 0, y, -y);
+      u = big.x+y;
+      y = y-(u-big.x);
+      xx=y*y;
+      s = y + y*xx*(sn3 +xx*sn5);
+      c = xx*(cs2 +xx*(cs4 + xx*cs6));
+      table (u, &sn, &ssn, &cs, &ccs);
+      cor=(ccs-s*ssn-cs*c)-sn*s;
+      res=cs+cor;
+      cor=(cs-res)+cor;
+      scatter (out, x, b->idx + p, cnt, res, res==res+1.020*cor, __cos);
+    }
+}
+
+/* sin(a+da) for the reduced arguments with a*a < 0.01588 */
+static void
+red_taylor (const branch *b, const double *x, double *out, double (*f) (double))
+{
+  vdouble a, da, eps, xx, t, res, cor;
+  int p, cnt;
+  for (p = 0; p < b->n; p += cnt)
+    {
+      cnt = b->n - p < DLANES ? b->n - p : DLANES;
+      a = gather (b->a + p, cnt);
+      da = gather (b->da + p, cnt);
+      eps = gather (b->eps + p, cnt);
+      xx = a*a;
+      /*Taylor series */
+      t = (((((s5.x*xx + s4.x)*xx + s3.x)*xx + s2.x)*xx + s1.x)*a - 0.5*da)*xx+da;
+      res = a+t;
+      cor = (a-res)+t;
+      cor = vd_select (cor>0, 1.02*cor+eps, 1.02*cor -eps);
+      scatter (out, x, b->idx + p, cnt, res, res == res + cor, f);
+    }
+}
+
+/* sin(a+da) for the other reduced arguments */
+static void
+red_sin (const branch *b, const double *x, double *out, double (*f) (double))
+{
+  vdouble a, da, eps, t, db, u, y, xx, s, c, sn, ssn, cs, ccs, res, cor;
+  vdmask m;
+  int p, cnt;
+  for (p = 0; p < b->n; p += cnt)
+    {
+      cnt = b->n - p < DLANES ? b->n - p : DLANES;
+      a = gather (b->a + p, cnt);
+      da = gather (b->da + p, cnt);
+      eps = gather (b->eps + p, cnt);
+      m = a > 0;
+      t = vd_select (m, a, -a);
+      db = vd_select (m, da, -da);
+      u=big.x+t;
+      y=t-(u-big.x);
+      xx=y*y;
+      s = y + (db+y*xx*(sn3 +xx*sn5));
+      c = y*db+xx*(cs2 +xx*(cs4 + xx*cs6));
+      table (u, &sn, &ssn, &cs, &ccs);
+      cor=(ssn+s*ccs-sn*c)+cs*s;
+      res=sn+cor;
+      cor=(sn-res)+cor;
+      cor = vd_select (cor>0, 1.035*cor+eps, 1.035*cor-eps);
+      scatter (out, x, b->idx + p, cnt, vd_select (m, res, -res), res==res+cor, f);
+    }
+}
+
+/* cos(a+da) for the reduced arguments */
+static void
+red_cos (const branch *b, const double *x, double *out, double (*f) (double))
+{
+  vdouble a, da, eps, u, y, xx, s, c, sn, ssn, cs, ccs, res, cor;
+  vdmask m;
+  int p, cnt;
+  for (p = 0; p < b->n; p += cnt)
+    {
+      cnt = b->n - p < DLANES ? b->n - p : DLANES;
+      a = gather (b->a + p, cnt);
+      da = gather (b->da + p, cnt);
+      eps = gather (b->eps + p, cnt);
+      m = a<0;
+      a = vd_select (m, -a, a);
+      da = vd_select (m, -da, da);
+      u=big.x+a;
+      y=a-(u-big.x)+da;
+      xx=y*y;
+      table (u, &sn, &ssn, &cs, &ccs);
+      s = y + y*xx*(sn3 +xx*sn5);
+      c = xx*(cs2 +xx*(cs4 + xx*cs6));
+      cor=(ccs-s*ssn-cs*c)-sn*s;
+      res=cs+cor;
+      cor=(cs-res)+cor;
+      cor = vd_select (cor>0, 1.025*cor+eps, 1.025*cor-eps);
+      scatter (out, x, b->idx + p, cnt, vd_select (gather_neg (b->neg + p, cnt), -res, res), res==res+cor, f);
+    }
+}
+
+static void
+sin_chunk (const double *x, double *out, int cnt)
+{
+  branch small, tbl, hp, taylor, rsin, rcos;
+  double t,xn,y,a,da,eps,xx;
+  mynumber u,v;
+  int4 e,k,m,n;
+
+  small.n = tbl.n = hp.n = taylor.n = rsin.n = rcos.n = 0;
+  for (e = 0; e < cnt; e++)
+    {
+      u.x = x[e];
+      m = u.i[HIGH_HALF];
+      k = 0x7fffffff&m;              /* no sign           */
+      if (k < 0x3e500000)            /* if x->0 =>sin(x)=x */
+	out[e] = x[e];
+      else if (k < 0x3fd00000)
+	push (&small, e, x[e], 0, 0, 0);
+      else if (k < 0x3feb6000)
+	push (&tbl, e, x[e], 0, 0, 0);
+      else if (k < 0x400368fd)
+	push (&hp, e, x[e], 0, 0, 0);
+      else if (k < 0x419921FB)
+	{
+	  t = (x[e]*hpinv.x + toint.x);
+	  xn = t - toint.x;
+	  v.x = t;
+	  y = (x[e] - xn*mp1.x) - xn*mp2.x;
+	  n =v.i[LOW_HALF]&3;
+	  da = xn*mp3.x;
+	  a=y-da;
+	  da = (y-a)-da;
+	  eps = ABS(x[e])*1.2e-30;
+
+	  if (n == 0 || n == 2)
+	    {
+	      xx = a*a;
+	      if (n) {a=-a;da=-da;}
+	      if (xx < 0.01588)
+		push (&taylor, e, a, da, eps, 0);
+	      else
+		push (&rsin, e, a, da, eps, 0);
+	    }
+	  else
+	    push (&rcos, e, a, da, eps, n&2);
+	}
+      else
+	out[e] = __sin (x[e]);
+    }
+
+  sin_small (&small, x, out);
+  sin_table (&tbl, x, out);
+  sin_hp (&hp, x, out);
+  red_taylor (&taylor, x, out, __sin);
+  red_sin (&rsin, x, out, __sin);
+  red_cos (&rcos, x, out, __sin);
+}
+
+static void
+cos_chunk (const double *x, double *out, int cnt)
+{
+  branch tbl, taylor, rsin, rcos;
+  double t,xn,y,a,da,eps,xx;
+  mynumber u,v;
+  int4 e,k,m,n;
+
+  tbl.n = taylor.n = rsin.n = rcos.n = 0;
+  for (e = 0; e < cnt; e++)
+    {
+      u.x = x[e];
+      m = u.i[HIGH_HALF];
+      k = 0x7fffffff&m;
+      if (k < 0x3e400000 )		/* |x|<2^-27 => cos(x)=1 */
+	out[e] = 1.0;
+      else if (k < 0x3feb6000 )
+	push (&tbl, e, x[e], 0, 0, 0);
+      else if (k <  0x400368fd )
+	{
+	  y=hp0.x-ABS(x[e]);
+	  a=y+hp1.x;
+	  da=(y-a)+hp1.x;
+	  xx=a*a;
+	  if (xx < 0.01588)
+	    push (&taylor, e, a, da, 1.0e-31, 0);
+	  else
+	    push (&rsin, e, a, da, 1.0e-31, 0);
+	}
+      else if (k < 0x419921FB )
+	{
+	  t = (x[e]*hpinv.x + toint.x);
+	  xn = t - toint.x;
+	  v.x = t;
+	  y = (x[e] - xn*mp1.x) - xn*mp2.x;
+	  n =v.i[LOW_HALF]&3;
+	  da = xn*mp3.x;
+	  a=y-da;
+	  da = (y-a)-da;
+	  eps = ABS(x[e])*1.2e-30;
+
+	  if (n == 1 || n == 3)
+	    {
+	      xx = a*a;
+	      if (n == 1) {a=-a;da=-da;}
+	      if (xx < 0.01588)
+		push (&taylor, e, a, da, eps, 0);
+	      else
+		push (&rsin, e, a, da, eps, 0);
+	    }
+	  else
+	    push (&rcos, e, a, da, eps, n);
+	}
+      else
+	out[e] = __cos (x[e]);
+    }
+
+  cos_table (&tbl, x, out);
+  red_taylor (&taylor, x, out, __cos);
+  red_sin (&rsin, x, out, __cos);
+  red_cos (&rcos, x, out, __cos);
+}
+
+/* The chunk is copied first, out may be the same array as in */
+void
+__sin_batch(const double *in, double *out, size_t n)
+{
+  double x[CHUNK];
+  size_t i;
+  int e, cnt;
+
+  for (i = 0; i < n; i += cnt)
+    {
+      cnt = n - i < CHUNK ? n - i : CHUNK;
+      for (e = 0; e < cnt; e++)
+	x[e] = in[i + e];
+      sin_chunk (x, out + i, cnt);
+    }
+}
+
+void
+__cos_batch(const double *in, double *out, size_t n)
+{
+  double x[CHUNK];
+  size_t i;
+  int e, cnt;
+
+  for (i = 0; i < n; i += cnt)
+    {
+      cnt = n - i < CHUNK ? n - i : CHUNK;
+      for (e = 0; e < cnt; e++)
+	x[e] = in[i + e];
+      cos_chunk (x, out + i, cnt);
+    }
+}
+
+#endif
@@ -0,0 +1,95 @@
+/* s_sincos.c -- s_sincos.c from the dbl-64 directory, modified for streflop.
+ * The original calls __sin and __cos, so the argument reduction is done twice.
+ * For |x| >= 2^48 this is __branred, by far the costliest part. It is done once
+ * here, and the very same slow path routines as in s_sin.c are called on the
+ * result, so the values are bit-identical to those of __sin and __cos.
+ * Below 2^48 the reduction is a few operations only, and both functions are
+ * still called.
+ */
+
+/* Compute sine and cosine of argument.
+   Copyright (C) 1997, 2001, 2005 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+   Contributed by Ulrich Drepper <drepper@cygnus.com>, 1997.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, write to the Free
+   Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+   02111-1307 USA.  */
+
+#include "math.h"
+
+#include "math_private.h"
+
+int __branred(double x, double *a, double *aa);
+/* In s_sin.c, made extern by import.pl */
+double bsloww(double x, double dx, double orig, int n);
+double bsloww1(double x, double dx, double orig, int n);
+double bsloww2(double x, double dx, double orig, int n);
+
+void
+__sincos (double x, double *sinx, double *cosx)
+{
+  int32_t ix;
+
+  /* High word of x. */
+  GET_HIGH_WORD (ix, x);
+
+  ix &= 0x7fffffff;
+  if (ix>=0x7ff00000)
+    {
+      /* sin(Inf or NaN) is NaN */
+      *sinx = *cosx = x - x;
+    }
+  else if (ix>=0x42F00000)
+    {
+      /* 281474976710656 <|x| <2^1024, as in __sin and __cos */
+      double a,da;
+      int n;
+
+      n = __branred (x, &a, &da);
+      switch (n)
+	{
+	case 0:
+	  if (a*a < 0.01588) *sinx = bsloww (a, da, x, n);
+	  else *sinx = bsloww1 (a, da, x, n);
+	  *cosx = bsloww2 (a, da, x, n);
+	  break;
+	case 1:
+	  *sinx = bsloww2 (a, da, x, n);
+	  if (a*a < 0.01588) *cosx = bsloww (-a, -da, x, n);
+	  else *cosx = bsloww1 (-a, -da, x, n);
+	  break;
+	case 2:
+	  if (a*a < 0.01588) *sinx = bsloww (-a, -da, x, n);
+	  else *sinx = bsloww1 (-a, -da, x, n);
+	  *cosx = bsloww2 (a, da, x, n);
+	  break;
+	default:
+	  *sinx = bsloww2 (a, da, x, n);
+	  if (a*a < 0.01588) *cosx = bsloww (a, da, x, n);
+	  else *cosx = bsloww1 (a, da, x, n);
+	  break;
+	}
+    }
+  else
+    {
+      *sinx = __sin (x);
+      *cosx = __cos (x);
+    }
+}
+weak_alias (__sincos, sincos)
+#ifdef NO_LONG_DOUBLE
+strong_alias (__sincos, __sincosl)
+weak_alias (__sincos, sincosl)
+#endif
@@ -0,0 +1,178 @@
+/* s_sinf_batch.c -- written for streflop.
+ * Packed versions of __sinf and __cosf of s_sinf.c and s_cosf.c, for
+ * |x| <= 2^7*(pi/2), see batch.h. The argument is reduced as in the first
+ * cases of __ieee754_rem_pio2f, with one iteration for the medium size, and
+ * both __kernel_sinf and __kernel_cosf are computed, the quadrant selects the
+ * result lane by lane. The arguments near pi/2, those that need more
+ * iterations of the reduction, the large ones, infinities and NaNs are
+ * computed by __sinf and __cosf. The npio2_hw table of e_rem_pio2f.c is
+ * static, this file has its own copy.
+ */
+
+#include "math.h"
+#include "math_private.h"
+#include "batch.h"
+
+void __sinf_batch(const float *in, float *out, size_t n);
+void __cosf_batch(const float *in, float *out, size_t n);
+float __sinf(float x);
+
+#ifdef STREFLOP_BATCH_PACKED
+
+#ifdef __STDC__
+static const int32_t npio2_hw[] = {
+#else
+static int32_t npio2_hw[] = {
+#endif
+0x3fc90f00, 0x40490f00, 0x4096cb00, 0x40c90f00, 0x40fb5300, 0x4116cb00,
+0x412fed00, 0x41490f00, 0x41623100, 0x417b5300, 0x418a3a00, 0x4196cb00,
+0x41a35c00, 0x41afed00, 0x41bc7e00, 0x41c90f00, 0x41d5a000, 0x41e23100,
+0x41eec200, 0x41fb5300, 0x4203f200, 0x420a3a00, 0x42108300, 0x4216cb00,
+0x421d1400, 0x42235c00, 0x4229a500, 0x422fed00, 0x42363600, 0x423c7e00,
+0x4242c700, 0x42490f00
+};
+
+#ifdef __STDC__
+static const float
+#else
+static float
+#endif
+one =  1.0000000000e+00, /* 0x3f800000 */
+half =  5.0000000000e-01, /* 0x3f000000 */
+invpio2 =  6.3661980629e-01, /* 0x3f22f984 */
+pio2_1  =  1.5707855225e+00, /* 0x3fc90f80 */
+pio2_1t =  1.0804334124e-05, /* 0x37354443 */
+S1  = -1.6666667163e-01, /* 0xbe2aaaab */
+S2  =  8.3333337680e-03, /* 0x3c088889 */
+S3  = -1.9841270114e-04, /* 0xb9500d01 */
+S4  =  2.7557314297e-06, /* 0x3638ef1b */
+S5  = -2.5050759689e-08, /* 0xb2d72f34 */
+S6  =  1.5896910177e-10, /* 0x2f2ec9d3 */
+C1  =  4.1666667908e-02, /* 0x3d2aaaab */
+C2  = -1.3888889225e-03, /* 0xbab60b61 */
+C3  =  2.4801587642e-05, /* 0x37d00d01 */
+C4  = -2.7557314297e-07, /* 0xb493f27c */
+C5  =  2.0875723372e-09, /* 0x310f74f6 */
+C6  = -1.1359647598e-11; /* 0xad47d74e */
+
+/* __kernel_sinf and __kernel_cosf of the reduced argument x+y in ks and kc,
+   and the quadrant in n, for the lanes where the returned mask is set */
+static inline vfmask
+sincosf_lanes (vfloat x, vfloat *ks, vfloat *kc, vint *n)
+{
+	vfloat z,w,t,r,v,fn,y0,y1,z0,z1,a,hz,qx;
+	vint hx,ix,m,high;
+	vfmask ok,direct,pos,fail;
+	int32_t l,i,j;
+
+	hx = (vint) x;
+	ix = hx&0x7fffffff;
+	direct = ix<=0x3f490fd8;	/* |x| ~<= pi/4 , no need for reduction */
+	ok = ix<=0x43490f80;		/* |x| ~<= 2^7*(pi/2), medium size */
+
+    /* |x| < 3pi/4, special case with n=+-1, near pi/2 in __sinf and __cosf */
+	ok &= ~((ix<0x4016cbe4) & ((ix&0xfffffff0)==0x3fc90fd0));
+	pos = hx>0;
+	z = x - pio2_1;
+	y0 = z - pio2_1t;
+	y1 = (z-y0)-pio2_1t;
+	z = x + pio2_1;
+	z0 = z + pio2_1t;
+	z1 = (z-z0)+pio2_1t;
+	y0 = vf_select(pos,y0,z0);
+	y1 = vf_select(pos,y1,z1);
+
+    /* medium size, the first round only */
+	t  = (vfloat)ix;			/* fabsf(x) */
+	m  = __builtin_convertvector(t*invpio2+half,vint);
+	fn = __builtin_convertvector(m,vfloat);
+	r  = t-fn*pio2_1;
+	w  = fn*pio2_1t;	/* 1st round good to 40 bit */
+	z0 = r-w;
+	z1 = (r-z0)-w;
+	high = (vint)z0;
+	fail = (vfmask){0};
+	for (l = 0; l < FLANES; l++)
+	    if(ix[l]>=0x4016cbe4 && ix[l]<=0x43490f80 &&
+	       !(m[l]<32&&(int32_t)(ix[l]&0xffffff00)!=npio2_hw[m[l]-1])) {
+		j  = ix[l]>>23;
+		i = j-((high[l]>>23)&0xff);
+		if(i>8) fail[l] = -1;	/* 2nd iteration needed */
+	    }
+	ok &= ~fail;
+	z0 = vf_select(pos,z0,-z0);
+	z1 = vf_select(pos,z1,-z1);
+	m = vi_select(pos,m,-m);
+
+	pos = ix<0x4016cbe4;
+	y0 = vf_select(pos,y0,z0);
+	y1 = vf_select(pos,y1,z1);
+	*n = vi_select(pos,vi_select(hx>0,(vint){0}+1,(vint){0}-1),m);
+	x = vf_select(direct,x,y0);
+	y0 = vf_select(direct,(vfloat){0},y1);
+	*n = vi_select(direct,(vint){0},*n);
+
+    /* __kernel_sinf(x,y0,iy) with iy=0 for the direct lanes */
+	ix = (vint)x&0x7fffffff;
+	z	=  x*x;
+	v	=  z*x;
+	r	=  S2+z*(S3+z*(S4+z*(S5+z*S6)));
+	*ks = vf_select(direct,x+v*(S1+z*r),x-((z*(half*y0-v*r)-y0)-v*S1));
+	*ks = vf_select(ix<0x32000000,x,*ks);	/* |x| < 2**-27 */
+
+    /* __kernel_cosf(x,y0) */
+	r  = z*(C1+z*(C2+z*(C3+z*(C4+z*(C5+z*C6)))));
+	qx = vf_select(ix>0x3f480000,(vfloat){0}+(float)0.28125,(vfloat)(ix-0x01000000));
+	hz = (float)0.5*z-qx;
+	a  = one-qx;
+	*kc = vf_select(ix<0x3e99999a,one - ((float)0.5*z - (z*r - x*y0)),
+				       a - (hz - (z*r-x*y0)));
+	*kc = vf_select(ix<0x32000000,(vfloat){0}+one,*kc);
+	return ok;
+}
+
+void
+__sinf_batch(const float *in, float *out, size_t n)
+{
+  size_t i;
+  int l;
+
+  for (i = 0; i + FLANES <= n; i += FLANES)
+    {
+      vfloat x = vf_load (in + i), ks, kc, res;
+      vint q;
+      vfmask ok = sincosf_lanes (x, &ks, &kc, &q);
+      q &= 3;
+      res = vf_select (q == 0, ks, vf_select (q == 1, kc, vf_select (q == 2, -ks, -kc)));
+      vf_store (out + i, res);
+      for (l = 0; l < FLANES; l++)
+	if (!ok[l])
+	  out[i + l] = __sinf (x[l]);
+    }
+  for (; i < n; i++)
+    out[i] = __sinf (in[i]);
+}
+
+void
+__cosf_batch(const float *in, float *out, size_t n)
+{
+  size_t i;
+  int l;
+
+  for (i = 0; i + FLANES <= n; i += FLANES)
+    {
+      vfloat x = vf_load (in + i), ks, kc, res;
+      vint q;
+      vfmask ok = sincosf_lanes (x, &ks, &kc, &q);
+      q &= 3;
+      res = vf_select (q == 0, kc, vf_select (q == 1, -ks, vf_select (q == 2, -kc, ks)));
+      vf_store (out + i, res);
+      for (l = 0; l < FLANES; l++)
+	if (!ok[l])
+	  out[i + l] = __cosf (x[l]);
+    }
+  for (; i < n; i++)
+    out[i] = __cosf (in[i]);
+}
+
+#endif
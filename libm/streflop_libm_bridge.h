@@ -69,6 +69,7 @@ using namespace streflop;
 
 // u_int32_t is not C99 compliant
 typedef streflop::uint32_t u_int32_t;
+typedef streflop::uint64_t u_int64_t;
 
 /////////////////////////////////////////////////////////////////////////////
 // Common definitions
@@ -379,6 +380,19 @@ do {                                \
   (d) = f; \
 } while (0)
 
+// All 64 bits at once: a Double written as two 32-bit halves is slow to load again
+#define EXTRACT_WORDS64(i,d)        \
+do {                                \
+  Double f = (d);                   \
+  (i) = *reinterpret_cast<streflop::uint64_t*>(&f);  \
+} while (0)
+
+#define INSERT_WORDS64(d,i)         \
+do {                                \
+  streflop::uint64_t ii = (i);      \
+  (d) = *reinterpret_cast<Double*>(&ii); \
+} while (0)
+
 #endif
 
 // Extended
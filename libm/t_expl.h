@@ -0,0 +1,91 @@
+/* t_expl.h -- table and polynomial shared by the long double exponentials.
+ * Written for streflop, see e_expl.c.
+ */
+
+/* exp2_32_hi[j] + exp2_32_lo[j] = 2^(j/32) to about 128 bits, j = 0..31.
+ * The high part is 2^(j/32) correctly rounded to the 64 bits format.
+ */
+static const long double exp2_32_hi[32] = {
+  1.00000000000000000000000000000L,
+  1.02189714865411667820815216912L,
+  1.04427378242741384034662083247L,
+  1.06714040067682361812972241522L,
+  1.09050773266525765920875040704L,
+  1.11438674259589253628943694707L,
+  1.13878863475669165369712210190L,
+  1.16372485877757751379386191859L,
+  1.18920711500272106668756738612L,
+  1.21524735998046887815605271443L,
+  1.24185781207348404863409496723L,
+  1.26905095719173322259699238090L,
+  1.29683955465100966592158215906L,
+  1.32523664315974129459391184227L,
+  1.35425554693689272826688518858L,
+  1.38390988196383195492356055212L,
+  1.41421356237309504876378807303L,
+  1.44518080697704662002534697907L,
+  1.47682614593949931142396331252L,
+  1.50916442759342273971338854732L,
+  1.54221082540794082358596300830L,
+  1.57598084510788648650910642735L,
+  1.61049033194925430819213763023L,
+  1.64575547815396484451107295133L,
+  1.68179283050742908603783498656L,
+  1.71861929812247791560329140959L,
+  1.75625216037329948310947297374L,
+  1.79470907500310718641484131197L,
+  1.83400808640934246350733677344L,
+  1.87416763411029990130021033456L,
+  1.91520656139714729382025892868L,
+  1.95714412417540026896574378856L,
+};
+
+static const long double exp2_32_lo[32] = {
+  0.0L,
+  2.63279656671808825698889072248E-20L,
+  -2.46543537266552522715549367098E-20L,
+  3.97987057774545042498032917105E-20L,
+  -1.73975128203485699087587372381E-21L,
+  1.93760098472853604488273849291E-20L,
+  6.70818194561129537528248779727E-21L,
+  1.97116805026291864625383418943E-20L,
+  2.99325844384495236898834128430E-20L,
+  -3.95324630955113339898936470560E-20L,
+  -4.04174985073250644572949113476E-20L,
+  -4.25732998715750399616834661172E-20L,
+  1.21719587275113721949260940508E-20L,
+  3.56252532287040871141222545802E-20L,
+  3.11295515590775609567708647631E-20L,
+  -5.09010248523856635542874493656E-20L,
+  3.79006511778651415924254432851E-20L,
+  1.16592624056987417979499770710E-20L,
+  -3.70558321432657474340710181999E-20L,
+  5.26310037108122035892669268134E-20L,
+  2.63288537887326328689413193961E-20L,
+  -5.38362671631122006134156258577E-20L,
+  -1.26169628716121734403746282936E-20L,
+  7.68377339838742458267241813004E-21L,
+  2.44159659108350938235259450050E-20L,
+  2.60529668710165809815833576490E-20L,
+  2.68764563446325538747830092581E-21L,
+  1.28619301556137002014552710559E-20L,
+  -2.02535838545129577942873024683E-20L,
+  2.97886153895801909418326566376E-20L,
+  5.23523416198050986778051740650E-20L,
+  5.25784630640104637322417354794E-20L,
+};
+
+/* expm1(r) = r + r^2*(P2 + r*(P3 + ... + r*P8)) for |r| <= ln2/64,
+ * the Taylor coefficients P[n] = 1/n! rounded to long double.
+ * The remainder is below 2^-70 relative to the result.
+ * In the directed rounding modes |r| may reach ln2/32, still with
+ * a remainder below 2^-66.
+ */
+static const long double
+P2 = 5.0e-1L,
+P3 = 1.66666666666666666671184175719E-1L,
+P4 = 4.16666666666666666677960439297E-2L,
+P5 = 8.33333333333333333372861537539E-3L,
+P6 = 1.38888888888888888884889011082E-3L,
+P7 = 1.98412698412698412698370682890E-4L,
+P8 = 2.48015873015873015872963353612E-5L;
@@ -0,0 +1,463 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Times every function of Math.h and the arithmetic operators, for each type, on four
+// domains of arguments: small, huge, near a multiple of pi/2, and denormal. With
+// STREFLOP_SOFT, the SoftFloat operations are also timed directly.
+//
+// The latency is measured with each argument depending on the previous result, the
+// throughput with independent arguments. The results are printed as CSV lines:
+//   config,type,function,domain,latency_ns,throughput_ns,checksum
+// The checksum hashes the results, it must be the same in the configurations that give
+// the same results (see the configurations grid in README.txt).
+//
+// Usage:
+//   mathBench [-time ms] [function...]     only the given functions, at least ms per measure
+//   mathBench -compare old.csv new.csv [tolerance]
+// The second form lists the measures of new.csv slower than those of old.csv by more
+// than the tolerance (default 0.1 for 10%), and the changed checksums. It returns 1 if
+// there are any, for use in scripts.
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <map>
+using namespace std;
+// clock
+#include <time.h>
+// memcpy for the bit patterns
+#include <string.h>
+// atof
+#include <stdlib.h>
+
+#include "streflop.h"
+using namespace streflop;
+
+typedef SizedUnsignedInteger<64>::Type uint64;
+typedef SizedUnsignedInteger<32>::Type uint32;
+typedef SizedUnsignedInteger<16>::Type uint16;
+
+static const int N = 1024;
+static const int DOMAINS = 4;
+static const char* domainNames[DOMAINS] = {"small", "huge", "nearpi", "denormal"};
+
+#if defined(STREFLOP_SSE)
+#define STREFLOP_BENCH_FPU "sse"
+#elif defined(STREFLOP_X87)
+#define STREFLOP_BENCH_FPU "x87"
+#else
+#define STREFLOP_BENCH_FPU "soft"
+#endif
+#ifdef STREFLOP_NO_DENORMALS
+static const char* configName = STREFLOP_BENCH_FPU "-nd";
+#else
+static const char* configName = STREFLOP_BENCH_FPU;
+#endif
+
+static double minSeconds = 0.02;
+static int selectedCount = 0;
+static const char** selectedNames = 0;
+
+// Loaded at run time so the compiler cannot remove the dependencies of the latency loops
+static volatile uint64 zeroMask = 0;
+
+template<typename T> struct Format;
+template<> struct Format<Simple> {
+    static const char* name() {return "Simple";}
+    enum {minExponent = -126, maxExponent = 127, precision = 24};
+};
+template<> struct Format<Double> {
+    static const char* name() {return "Double";}
+    enum {minExponent = -1022, maxExponent = 1023, precision = 53};
+};
+#ifdef Extended
+template<> struct Format<Extended> {
+    static const char* name() {return "Extended";}
+    enum {minExponent = -16382, maxExponent = 16383, precision = 64};
+};
+#endif
+
+// Significant bits of a result, the Extended exponent folded in the top bits.
+// The bits of NaN values may differ between configurations, see README.txt
+template<typename T> static inline uint64 bitsOf(T x) {
+    if (x != x) return 0x7FF8000000000000ULL;
+    if (sizeof(T) == 4) {
+        uint32 b;
+        memcpy(&b, &x, 4);
+        return b;
+    }
+    uint64 b;
+    memcpy(&b, &x, 8);
+    if (sizeof(T) > 8) {
+        uint16 high;
+        memcpy(&high, reinterpret_cast<const char*>(&x) + 8, 2);
+        b ^= uint64(high) << 48;
+    }
+    return b;
+}
+
+// Flips the low bits of x by d, which is always 0
+template<typename T> static inline T inject(T x, uint64 d) {
+    if (sizeof(T) == 4) {
+        uint32 b;
+        memcpy(&b, &x, 4);
+        b ^= (uint32)d;
+        memcpy(static_cast<void*>(&x), &b, 4);
+    } else {
+        uint64 b;
+        memcpy(&b, &x, 8);
+        b ^= d;
+        memcpy(static_cast<void*>(&x), &b, 8);
+    }
+    return x;
+}
+
+static inline uint64 bitsOf(long long int x) {return (uint64)x;}
+
+// Benchmarked operations: a name, and a function of the arguments returning the bits of the results
+#define STREFLOP_BENCH_UNARY(f) struct Bench_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline uint64 run(T x, T, int) {return bitsOf(streflop::f(x));} \
+};
+#define STREFLOP_BENCH_BINARY(f) struct Bench_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline uint64 run(T x, T y, int) {return bitsOf(streflop::f(x, y));} \
+};
+#define STREFLOP_BENCH_INTEGER(f) struct Bench_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline uint64 run(T x, T, int) {return bitsOf((long long int)streflop::f(x));} \
+};
+#define STREFLOP_BENCH_EXPONENT(f) struct Bench_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline uint64 run(T x, T, int n) {return bitsOf(streflop::f(x, n));} \
+};
+#define STREFLOP_BENCH_ORDER(f) struct Bench_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline uint64 run(T x, T, int n) {return bitsOf(streflop::f((n & 3) + 2, x));} \
+};
+#define STREFLOP_BENCH_OPERATOR(f, op) struct Bench_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline uint64 run(T x, T y, int) {return bitsOf(x op y);} \
+};
+
+#define STREFLOP_BENCH_UNARY_LIST(F) \
+    F(sqrt) F(cbrt) F(exp) F(log) F(log2) F(exp2) F(log10) \
+    F(sin) F(cos) F(tan) F(acos) F(asin) F(atan) \
+    F(cosh) F(sinh) F(tanh) F(acosh) F(asinh) F(atanh) \
+    F(fabs) F(floor) F(ceil) F(trunc) F(rint) F(round) F(nearbyint) F(logb) \
+    F(expm1) F(log1p) F(erf) F(j0) F(j1) F(y0) F(y1)
+#define STREFLOP_BENCH_BINARY_LIST(F) \
+    F(hypot) F(pow) F(atan2) F(fmod) F(remainder) F(nextafter) F(copysign)
+#define STREFLOP_BENCH_INTEGER_LIST(F) \
+    F(lrint) F(llrint) F(lround) F(llround) F(ilogb) F(signbit) \
+    F(fpclassify) F(isnan) F(isinf) F(isfinite) F(isnormal)
+#define STREFLOP_BENCH_EXPONENT_LIST(F) \
+    F(ldexp) F(scalbn) F(scalbln)
+#define STREFLOP_BENCH_ORDER_LIST(F) \
+    F(jn) F(yn)
+
+STREFLOP_BENCH_UNARY_LIST(STREFLOP_BENCH_UNARY)
+STREFLOP_BENCH_BINARY_LIST(STREFLOP_BENCH_BINARY)
+STREFLOP_BENCH_INTEGER_LIST(STREFLOP_BENCH_INTEGER)
+STREFLOP_BENCH_EXPONENT_LIST(STREFLOP_BENCH_EXPONENT)
+STREFLOP_BENCH_ORDER_LIST(STREFLOP_BENCH_ORDER)
+
+STREFLOP_BENCH_OPERATOR(add, +)
+STREFLOP_BENCH_OPERATOR(sub, -)
+STREFLOP_BENCH_OPERATOR(mul, *)
+STREFLOP_BENCH_OPERATOR(div, /)
+
+struct Bench_less {
+    static const char* name() {return "less";}
+    template<typename T> static inline uint64 run(T x, T y, int) {return (x < y) ? 1 : 0;}
+};
+
+struct Bench_sincos {
+    static const char* name() {return "sincos";}
+    template<typename T> static inline uint64 run(T x, T, int) {
+        T s, c;
+        streflop::sincos(x, &s, &c);
+        return bitsOf(s) ^ (bitsOf(c) << 1);
+    }
+};
+
+struct Bench_frexp {
+    static const char* name() {return "frexp";}
+    template<typename T> static inline uint64 run(T x, T, int) {
+        int e;
+        return bitsOf(streflop::frexp(x, &e)) ^ (uint64)e;
+    }
+};
+
+struct Bench_remquo {
+    static const char* name() {return "remquo";}
+    template<typename T> static inline uint64 run(T x, T y, int) {
+        int q;
+        return bitsOf(streflop::remquo(x, y, &q)) ^ (uint64)q;
+    }
+};
+
+struct Bench_fma {
+    static const char* name() {return "fma";}
+    template<typename T> static inline uint64 run(T x, T y, int) {return bitsOf(streflop::fma(x, y, x));}
+};
+
+static bool selected(const char* name) {
+    if (selectedCount == 0) return true;
+    for (int i = 0; i < selectedCount; ++i) if (!strcmp(selectedNames[i], name)) return true;
+    return false;
+}
+
+// Arguments of the given domain, random signs
+template<typename T> static void fillDomain(int domain, T* x, int* n) {
+    const T pio2 = T(2.0) * atan(T(1.0));
+    for (int i = 0; i < N; ++i) {
+        T m = RandomIE(T(1.0), T(2.0));
+        switch (domain) {
+            case 0: x[i] = ldexp(m, RandomII(-8, 0)); break;
+            case 1: x[i] = ldexp(m, RandomII(20, Format<T>::maxExponent - 1)); break;
+            case 2: {
+                x[i] = T(double(RandomII(1, 1 << 20))) * pio2;
+                int ulps = RandomII(-4, 4);
+                for (int u = 0; u < ulps; ++u) x[i] = nextafter(x[i], T(0.0));
+                for (int u = 0; u > ulps; --u) x[i] = nextafter(x[i], T(2.0) * x[i]);
+                break;
+            }
+            default: x[i] = ldexp(m, RandomII(Format<T>::minExponent - Format<T>::precision + 1, Format<T>::minExponent - 1)); break;
+        }
+        if (Random<uint32>() & 1) x[i] = -x[i];
+        n[i] = RandomII(-40, 40);
+    }
+}
+
+// Nanoseconds per call, repeating the loop until it takes long enough for clock()
+template<typename T, typename F> static double timeLatency(const T* x, const T* y, const int* n, uint64& sink) {
+    const uint64 mask = zeroMask;
+    for (long reps = 1; ; reps *= 2) {
+        uint64 dep = 0;
+        clock_t start = clock();
+        for (long r = 0; r < reps; ++r) for (int i = 0; i < N; ++i) dep = F::run(inject(x[i], dep & mask), y[i], n[i]);
+        double seconds = double(clock() - start) / CLOCKS_PER_SEC;
+        sink += dep;
+        if (seconds >= minSeconds) return seconds * 1e9 / (double(reps) * N);
+    }
+}
+
+template<typename T, typename F> static double timeThroughput(const T* x, const T* y, const int* n, uint64& sink) {
+    for (long reps = 1; ; reps *= 2) {
+        uint64 acc = 0;
+        clock_t start = clock();
+        for (long r = 0; r < reps; ++r) for (int i = 0; i < N; ++i) acc += F::run(x[i], y[i], n[i]);
+        double seconds = double(clock() - start) / CLOCKS_PER_SEC;
+        sink += acc;
+        if (seconds >= minSeconds) return seconds * 1e9 / (double(reps) * N);
+    }
+}
+
+static uint64 sink = 0;
+
+template<typename T, typename F> static void benchFunction(const char* typeName, T (*x)[N], T (*y)[N], int (*n)[N]) {
+    if (!selected(F::name())) return;
+    for (int d = 0; d < DOMAINS; ++d) {
+        uint64 checksum = 14695981039346656037ULL;
+        for (int i = 0; i < N; ++i) checksum = (checksum ^ F::run(x[d][i], y[d][i], n[d][i])) * 1099511628211ULL;
+        double latency = timeLatency<T, F>(x[d], y[d], n[d], sink);
+        double throughput = timeThroughput<T, F>(x[d], y[d], n[d], sink);
+        cout << configName << "," << typeName << "," << F::name() << "," << domainNames[d] << ","
+             << fixed << setprecision(2) << latency << "," << throughput << ","
+             << hex << setw(16) << setfill('0') << checksum << dec << setfill(' ') << endl;
+    }
+}
+
+// The same arguments for all the functions of a type
+template<typename T> static void prepare(T (*x)[N], T (*y)[N], int (*n)[N]) {
+    streflop_init<T>();
+    RandomInit(42);
+    for (int d = 0; d < DOMAINS; ++d) {
+        fillDomain<T>(d, x[d], n[d]);
+        fillDomain<T>(d, y[d], n[d]);
+    }
+}
+
+template<typename T> static void benchType() {
+    static T x[DOMAINS][N], y[DOMAINS][N];
+    static int n[DOMAINS][N];
+    prepare<T>(x, y, n);
+    const char* typeName = Format<T>::name();
+#define STREFLOP_BENCH_RUN(f) benchFunction<T, Bench_##f>(typeName, x, y, n);
+    STREFLOP_BENCH_RUN(add) STREFLOP_BENCH_RUN(sub) STREFLOP_BENCH_RUN(mul) STREFLOP_BENCH_RUN(div) STREFLOP_BENCH_RUN(less)
+    STREFLOP_BENCH_UNARY_LIST(STREFLOP_BENCH_RUN)
+    STREFLOP_BENCH_BINARY_LIST(STREFLOP_BENCH_RUN)
+    STREFLOP_BENCH_INTEGER_LIST(STREFLOP_BENCH_RUN)
+    STREFLOP_BENCH_EXPONENT_LIST(STREFLOP_BENCH_RUN)
+    STREFLOP_BENCH_ORDER_LIST(STREFLOP_BENCH_RUN)
+    STREFLOP_BENCH_RUN(sincos) STREFLOP_BENCH_RUN(frexp) STREFLOP_BENCH_RUN(remquo) STREFLOP_BENCH_RUN(fma)
+#undef STREFLOP_BENCH_RUN
+}
+
+#ifdef STREFLOP_SOFT
+
+// The SoftFloat operations on the bits of the wrapper types
+using namespace streflop::SoftFloat;
+
+static inline float32 toSoft(Simple x) {float32 a; memcpy(&a, &x, sizeof(a)); return a;}
+static inline float64 toSoft(Double x) {float64 a; memcpy(&a, &x, sizeof(a)); return a;}
+static inline floatx80 toSoft(Extended x) {
+    floatx80 a;
+    memcpy(&a.low, &x, 8);
+    memcpy(&a.high, reinterpret_cast<const char*>(&x) + 8, 2);
+    return a;
+}
+static inline uint64 bitsOf(floatx80 a) {return a.low ^ (uint64(a.high) << 48);}
+static inline uint64 bitsOf(float64 a) {return (uint64)a;}
+static inline uint64 bitsOf(float32 a) {return (uint32)a;}
+
+#define STREFLOP_BENCH_SOFT_BINARY(f) struct Bench_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline uint64 run(T x, T y, int) {return bitsOf(f(toSoft(x), toSoft(y)));} \
+};
+#define STREFLOP_BENCH_SOFT_UNARY(f) struct Bench_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline uint64 run(T x, T, int) {return bitsOf(f(toSoft(x)));} \
+};
+#define STREFLOP_BENCH_SOFT_INTEGER(f) struct Bench_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline uint64 run(T x, T y, int) {return (uint64)f(toSoft(x));} \
+};
+#define STREFLOP_BENCH_SOFT_COMPARE(f) struct Bench_##f { \
+    static const char* name() {return #f;} \
+    template<typename T> static inline uint64 run(T x, T y, int) {return (uint64)f(toSoft(x), toSoft(y));} \
+};
+
+#define STREFLOP_BENCH_SOFT_LIST(F, BINARY, UNARY, INTEGER, COMPARE, t) \
+    F(BINARY, t##_add) F(BINARY, t##_sub) F(BINARY, t##_mul) F(BINARY, t##_div) F(BINARY, t##_rem) \
+    F(UNARY, t##_sqrt) F(UNARY, t##_round_to_int) \
+    F(INTEGER, t##_to_int32) F(INTEGER, t##_to_int32_round_to_zero) F(INTEGER, t##_to_int64) \
+    F(COMPARE, t##_eq) F(COMPARE, t##_le) F(COMPARE, t##_lt)
+
+#define STREFLOP_BENCH_SOFT_DEFINE(kind, f) kind(f)
+STREFLOP_BENCH_SOFT_LIST(STREFLOP_BENCH_SOFT_DEFINE, STREFLOP_BENCH_SOFT_BINARY, STREFLOP_BENCH_SOFT_UNARY, STREFLOP_BENCH_SOFT_INTEGER, STREFLOP_BENCH_SOFT_COMPARE, float32)
+STREFLOP_BENCH_SOFT_LIST(STREFLOP_BENCH_SOFT_DEFINE, STREFLOP_BENCH_SOFT_BINARY, STREFLOP_BENCH_SOFT_UNARY, STREFLOP_BENCH_SOFT_INTEGER, STREFLOP_BENCH_SOFT_COMPARE, float64)
+STREFLOP_BENCH_SOFT_LIST(STREFLOP_BENCH_SOFT_DEFINE, STREFLOP_BENCH_SOFT_BINARY, STREFLOP_BENCH_SOFT_UNARY, STREFLOP_BENCH_SOFT_INTEGER, STREFLOP_BENCH_SOFT_COMPARE, floatx80)
+#undef STREFLOP_BENCH_SOFT_DEFINE
+
+static void benchSoftFloat() {
+    const char* typeName = "SoftFloat";
+#define STREFLOP_BENCH_SOFT_RUN(kind, f) benchFunction<T, Bench_##f>(typeName, x, y, n);
+    {
+        typedef Simple T;
+        static T x[DOMAINS][N], y[DOMAINS][N];
+        static int n[DOMAINS][N];
+        prepare<T>(x, y, n);
+        STREFLOP_BENCH_SOFT_LIST(STREFLOP_BENCH_SOFT_RUN, , , , , float32)
+    }
+    {
+        typedef Double T;
+        static T x[DOMAINS][N], y[DOMAINS][N];
+        static int n[DOMAINS][N];
+        prepare<T>(x, y, n);
+        STREFLOP_BENCH_SOFT_LIST(STREFLOP_BENCH_SOFT_RUN, , , , , float64)
+    }
+    {
+        typedef Extended T;
+        static T x[DOMAINS][N], y[DOMAINS][N];
+        static int n[DOMAINS][N];
+        prepare<T>(x, y, n);
+        STREFLOP_BENCH_SOFT_LIST(STREFLOP_BENCH_SOFT_RUN, , , , , floatx80)
+    }
+#undef STREFLOP_BENCH_SOFT_RUN
+}
+
+#endif
+
+// Measures of a CSV file, by type, function and domain
+struct Measure {
+    double latency, throughput;
+    string checksum;
+};
+
+static bool readMeasures(const char* fileName, map<string, Measure>& measures) {
+    ifstream file(fileName);
+    if (!file) {
+        cerr << "Cannot read " << fileName << endl;
+        return false;
+    }
+    string line;
+    while (getline(file, line)) {
+        if (line.empty() || line[0] == '#' || line.compare(0, 7, "config,") == 0) continue;
+        string fields[7];
+        istringstream stream(line);
+        for (int i = 0; i < 7; ++i) getline(stream, fields[i], ',');
+        Measure m;
+        m.latency = atof(fields[4].c_str());
+        m.throughput = atof(fields[5].c_str());
+        m.checksum = fields[6];
+        measures[fields[1] + "," + fields[2] + "," + fields[3]] = m;
+    }
+    return true;
+}
+
+static int compare(const char* oldName, const char* newName, double tolerance) {
+    map<string, Measure> before, after;
+    if (!readMeasures(oldName, before) || !readMeasures(newName, after)) return 2;
+    int problems = 0;
+    cout << "type,function,domain,problem,old,new" << endl;
+    for (map<string, Measure>::const_iterator it = after.begin(); it != after.end(); ++it) {
+        map<string, Measure>::const_iterator old = before.find(it->first);
+        if (old == before.end()) continue;
+        const Measure& a = old->second;
+        const Measure& b = it->second;
+        if (b.latency > a.latency * (1.0 + tolerance)) {
+            cout << it->first << ",latency," << a.latency << "," << b.latency << endl;
+            ++problems;
+        }
+        if (b.throughput > a.throughput * (1.0 + tolerance)) {
+            cout << it->first << ",throughput," << a.throughput << "," << b.throughput << endl;
+            ++problems;
+        }
+        if (a.checksum != b.checksum) {
+            cout << it->first << ",checksum," << a.checksum << "," << b.checksum << endl;
+            ++problems;
+        }
+    }
+    return problems ? 1 : 0;
+}
+
+int main(int argc, const char** argv) {
+
+    if (argc >= 4 && !strcmp(argv[1], "-compare")) {
+        return compare(argv[2], argv[3], (argc >= 5) ? atof(argv[4]) : 0.1);
+    }
+
+    int first = 1;
+    if (argc >= 3 && !strcmp(argv[1], "-time")) {
+        minSeconds = atof(argv[2]) / 1000.0;
+        first = 3;
+    }
+    selectedCount = argc - first;
+    selectedNames = argv + first;
+
+    cout << "config,type,function,domain,latency_ns,throughput_ns,checksum" << endl;
+    benchType<Simple>();
+    benchType<Double>();
+#ifdef Extended
+    benchType<Extended>();
+#endif
+#ifdef STREFLOP_SOFT
+    benchSoftFloat();
+#endif
+    // Keeps the results alive
+    cout << "# " << hex << sink << dec << endl;
+
+    return 0;
+}
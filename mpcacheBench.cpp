@@ -0,0 +1,111 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Times the Double functions on arguments that take the multi-precision fallback, and on
+// ordinary arguments for comparison. Build the library once as usual and once with
+// STREFLOP_MP_CACHE to see the gain of the cache, with STREFLOP_MP_INTEGER and STREFLOP_SOFT to see
+// the gain of the integer digit arithmetic when the fallback is computed, or with
+// STREFLOP_DOUBLE_LENGTH_STAGE to see exp, pow, sin and cos avoid most of their fallbacks.
+// The checksum must not change.
+
+#include <iostream>
+using namespace std;
+// clock
+#include <time.h>
+// memcpy for the checksum
+#include <string.h>
+
+#include "streflop.h"
+using namespace streflop;
+
+typedef SizedUnsignedInteger<64>::Type uint64;
+
+// Found with STREFLOP_SLOWPATH_STATS on random arguments, in all configurations
+static const double hard_exp[] = {
+    233.65911692699262, 659.5688183214932, -65.4684355388315, -88.59126995240774,
+    343.58354547281715, -425.50605288903154, -267.7477914660205, -549.0810779034371
+};
+static const double hard_pow[][2] = {
+    {19.505060740227307, 13.5}, {78.95625621941834, 2.5}, {91.82494786360328, 14.5}, {70.16116515842512, 15.5},
+    {68.75730414413302, 11.5}, {31.6378285940486, 8.5}, {96.55336839772765, 0.5}, {88.6408889087398, 9.5}
+};
+static const double hard_sin[] = {
+    60597955244420.72, 51175932.357828274, 9865307.344854169, 210792622554444.44
+};
+static const double hard_cos[] = {
+    32717640.431003775
+};
+
+#define COUNT(a) (int)(sizeof(a)/sizeof(a[0]))
+
+static const int N = 1024;
+static const int REPS = 200;
+
+static Double x[N], y[N];
+
+static uint64 checksum = 0;
+
+static void mix(Double z) {
+    uint64 bits = 0;
+    memcpy(&bits, &z, sizeof(bits) < sizeof(Double) ? sizeof(bits) : sizeof(Double));
+    checksum = checksum * 31 + bits;
+}
+
+static void showtime(const char* name, clock_t start, clock_t stop) {
+    double ns = double(stop - start) / CLOCKS_PER_SEC * 1e9 / (double(N) * REPS);
+    cout << name << ": " << ns << " ns/call" << endl;
+}
+
+#define BENCH_UNARY(name, func) { \
+    clock_t start = clock(); \
+    for (int r = 0; r < REPS; ++r) for (int i = 0; i < N; ++i) mix(func(x[i])); \
+    showtime(name, start, clock()); \
+}
+
+#define BENCH_BINARY(name, func) { \
+    clock_t start = clock(); \
+    for (int r = 0; r < REPS; ++r) for (int i = 0; i < N; ++i) mix(func(x[i], y[i])); \
+    showtime(name, start, clock()); \
+}
+
+int main(int argc, const char** argv) {
+
+    streflop_init<Double>();
+    RandomInit(42);
+
+#ifdef STREFLOP_MP_CACHE
+    cout << "Multi-precision fallbacks cached (the library must be built with STREFLOP_MP_CACHE too)" << endl;
+#else
+    cout << "Multi-precision fallbacks computed at each call" << endl;
+#endif
+
+    // Adversarial sets: the few hard arguments again and again
+    for (int i = 0; i < N; ++i) x[i] = Double(hard_exp[i % COUNT(hard_exp)]);
+    BENCH_UNARY("exp, hard arguments", exp)
+    for (int i = 0; i < N; ++i) {x[i] = Double(hard_pow[i % COUNT(hard_pow)][0]); y[i] = Double(hard_pow[i % COUNT(hard_pow)][1]);}
+    BENCH_BINARY("pow, hard arguments", pow)
+    for (int i = 0; i < N; ++i) x[i] = Double(hard_sin[i % COUNT(hard_sin)]);
+    BENCH_UNARY("sin, hard arguments", sin)
+    for (int i = 0; i < N; ++i) x[i] = Double(hard_cos[i % COUNT(hard_cos)]);
+    BENCH_UNARY("cos, hard arguments", cos)
+
+    // Ordinary arguments, the cache must not slow them down
+    for (int i = 0; i < N; ++i) {x[i] = RandomIE(Double(-20.0), Double(20.0)); y[i] = RandomIE(Double(0.0), Double(4.0));}
+    BENCH_UNARY("exp, random arguments", exp)
+    BENCH_UNARY("sin, random arguments", sin)
+    BENCH_UNARY("cos, random arguments", cos)
+    for (int i = 0; i < N; ++i) x[i] = fabs(x[i]);
+    BENCH_BINARY("pow, random arguments", pow)
+
+    cout << "checksum: " << hex << checksum << dec << endl;
+
+    return 0;
+}
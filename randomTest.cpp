@@ -15,6 +15,8 @@
 using namespace std;
 // clock
 #include <time.h>
+// memcmp
+#include <string.h>
 
 #include "streflop.h"
 using namespace streflop;
@@ -32,8 +34,24 @@ template<typename F> void checkNRandom() {
     }
     mean /= N;
     var = sqrt(var/N - mean*mean);
-    cout << "meanN (should be 345.6): " << mean << endl;
-    cout << "varN (should be 78.9): " << var << endl;
+    cout << "meanN (should be 345.6): " << (double)mean << endl;
+    cout << "varN (should be 78.9): " << (double)var << endl;
+}
+
+template<typename F> void checkNRandomZiggurat() {
+    streflop_init<F>();
+    F mean = 0.0;
+    F var = 0.0;
+    int N = 1000000;
+    for (int i=0; i<N; ++i) {
+        F value = NRandomZiggurat<F>(345.6, 78.9);
+        mean += value;
+        var += value * value;
+    }
+    mean /= N;
+    var = sqrt(var/N - mean*mean);
+    cout << "meanZ (should be 345.6): " << (double)mean << endl;
+    cout << "varZ (should be 78.9): " << (double)var << endl;
 }
 
 template<bool IEmin, bool IEmax, typename F> void checkRandom() {
@@ -48,8 +66,130 @@ template<bool IEmin, bool IEmax, typename F> void checkRandom() {
     }
     mean /= N;
     var = sqrt(var/N - mean*mean);
-    cout << "mean<"<<IEmin<<","<<IEmax<<"> (should be 400): " << mean << endl;
-    cout << "var<"<<IEmin<<","<<IEmax<<"> = " << var << endl;
+    cout << "mean<"<<IEmin<<","<<IEmax<<"> (should be 400): " << (double)mean << endl;
+    cout << "var<"<<IEmin<<","<<IEmax<<"> = " << (double)var << endl;
+}
+
+void checkJump() {
+    RandomState stepped = DefaultRandomState, jumped = DefaultRandomState;
+    for (int i=0; i<1024; ++i) Random<SizedUnsignedInteger<STREFLOP_RANDOM_GEN_SIZE>::Type>(stepped);
+    RandomJump(10, jumped);
+    cout << "stepped 1024 times: " << Random<SizedUnsignedInteger<32>::Type>(stepped) << endl;
+    cout << "jumped (should be the same): " << Random<SizedUnsignedInteger<32>::Type>(jumped) << endl;
+    RandomState child;
+    RandomSplit(DefaultRandomState, 1, child);
+    RandomJump(STREFLOP_RANDOM_SPLIT_LOG2, DefaultRandomState);
+    cout << "substream 1: " << Random<SizedUnsignedInteger<32>::Type>(child) << endl;
+    cout << "jumped 2^" << STREFLOP_RANDOM_SPLIT_LOG2 << " (should be the same): " << Random<SizedUnsignedInteger<32>::Type>() << endl;
+}
+
+// Returns 1 and reports the mismatch if got is not the expected value
+int checkKnownAnswer(const char* name, SizedUnsignedInteger<32>::Type got, SizedUnsignedInteger<32>::Type expected) {
+    if (got == expected) return 0;
+    cout << "MISMATCH " << name << ": " << got << " instead of " << expected << endl;
+    return 1;
+}
+
+// Outputs of the reference implementations, returns the number of mismatches
+int checkKnownAnswers() {
+    int failures = 0;
+#if STREFLOP_RANDOM_GEN_SIZE == 32
+    RandomState state;
+    SizedUnsignedInteger<32>::Type draws[1003];
+    // mt19937ar.c, seeded with init_genrand(5489)
+    RandomInit(5489, state);
+    failures += checkKnownAnswer("MT19937 output 0", Random<SizedUnsignedInteger<32>::Type>(state), 3499211612U);
+    for (int i=1; i<9999; ++i) Random<SizedUnsignedInteger<32>::Type>(state);
+    failures += checkKnownAnswer("MT19937 output 9999", Random<SizedUnsignedInteger<32>::Type>(state), 4123659995U);
+    // SFMT19937.out.txt of the SFMT distribution, seeded with init_gen_rand(1234)
+    RandomInit(1234, STREFLOP_SFMT19937, state);
+    for (int i=0; i<1003; ++i) draws[i] = Random<SizedUnsignedInteger<32>::Type>(state);
+    failures += checkKnownAnswer("SFMT19937 output 0", draws[0], 3440181298U);
+    failures += checkKnownAnswer("SFMT19937 output 1", draws[1], 1564997079U);
+    failures += checkKnownAnswer("SFMT19937 output 2", draws[2], 1510669302U);
+    failures += checkKnownAnswer("SFMT19937 output 3", draws[3], 2930277156U);
+    failures += checkKnownAnswer("SFMT19937 output 4", draws[4], 1452439940U);
+    failures += checkKnownAnswer("SFMT19937 output 1000", draws[1000], 2920566502U);
+    failures += checkKnownAnswer("SFMT19937 output 1001", draws[1001], 4272800458U);
+    failures += checkKnownAnswer("SFMT19937 output 1002", draws[1002], 1414760822U);
+    // Jumps of 2^20 state words, from the same references stepped one number at a time
+    RandomInit(5489, state);
+    RandomJump(20, state);
+    failures += checkKnownAnswer("MT19937 output 2^20", Random<SizedUnsignedInteger<32>::Type>(state), 2584674843U);
+    failures += checkKnownAnswer("MT19937 output 2^20+1", Random<SizedUnsignedInteger<32>::Type>(state), 522800898U);
+    RandomInit(1234, STREFLOP_SFMT19937, state);
+    RandomJump(20, state);
+    failures += checkKnownAnswer("SFMT19937 output 4*2^20", Random<SizedUnsignedInteger<32>::Type>(state), 1087128086U);
+    failures += checkKnownAnswer("SFMT19937 output 4*2^20+1", Random<SizedUnsignedInteger<32>::Type>(state), 806788987U);
+    // Threefry-4x32-20 known answers of Random123, the key and counter are all zero
+    CounterRandomState counterState;
+    RandomInit(0, 0, counterState);
+    failures += checkKnownAnswer("Threefry zero block word 0", Random<SizedUnsignedInteger<32>::Type>(counterState), 0x9c6ca96aU);
+    failures += checkKnownAnswer("Threefry zero block word 1", Random<SizedUnsignedInteger<32>::Type>(counterState), 0xe17eae66U);
+    failures += checkKnownAnswer("Threefry zero block word 2", Random<SizedUnsignedInteger<32>::Type>(counterState), 0xfc10ecd4U);
+    failures += checkKnownAnswer("Threefry zero block word 3", Random<SizedUnsignedInteger<32>::Type>(counterState), 0x5256a7d8U);
+    // Seed 42, stream 7: the key is {7, 0, 42, 0}
+    RandomInit(42, 7, counterState);
+    failures += checkKnownAnswer("Threefry seed 42 stream 7 word 0", Random<SizedUnsignedInteger<32>::Type>(counterState), 0x5546b783U);
+    // Words 2 and 3 of block 0x123456789, then word 0 of the next block, with the key set directly
+    counterState.key[0] = 0xa4093822U;
+    counterState.key[1] = 0x299f31d0U;
+    counterState.key[2] = 0x082efa98U;
+    counterState.key[3] = 0xec4e6c89U;
+    RandomSeek(4 * 0x123456789ULL + 2, counterState);
+    failures += checkKnownAnswer("RandomSeek word 2", Random<SizedUnsignedInteger<32>::Type>(counterState), 0x84cdba7eU);
+    failures += checkKnownAnswer("RandomSeek word 3", Random<SizedUnsignedInteger<32>::Type>(counterState), 0x7a9d1abcU);
+    failures += checkKnownAnswer("RandomSeek next block word 0", Random<SizedUnsignedInteger<32>::Type>(counterState), 0x469b1d2eU);
+#endif
+    return failures;
+}
+
+// Returns the number of fill results that differ from single draws on a copy of the state
+template<typename F, class State> int checkFillMatchesDraws(const char* name, State& state) {
+    // Start past the beginning of a block, and cross the next block boundaries
+    const int N = 1500;
+    F filled[N], drawn[N];
+    for (int i=0; i<3; ++i) Random12<true, false, F>(state);
+    State copy = state;
+    RandomFill12<true, false, F>(filled, N, state);
+    for (int i=0; i<N; ++i) drawn[i] = Random12<true, false, F>(copy);
+    int failures = 0;
+    for (int i=0; i<N; ++i) if (memcmp(&filled[i], &drawn[i], sizeof(F)) != 0) ++failures;
+    if (failures != 0) cout << "MISMATCH " << name << ": " << failures << " fill results differ from single draws" << endl;
+    return failures;
+}
+
+int checkFill() {
+    int failures = 0;
+    RandomState state;
+    RandomInit(42, STREFLOP_MT19937, state);
+    failures += checkFillMatchesDraws<Simple>("MT19937 Simple", state);
+    failures += checkFillMatchesDraws<Double>("MT19937 Double", state);
+    RandomInit(42, STREFLOP_SFMT19937, state);
+    failures += checkFillMatchesDraws<Simple>("SFMT19937 Simple", state);
+    failures += checkFillMatchesDraws<Double>("SFMT19937 Double", state);
+    CounterRandomState counterState;
+    RandomInit(42, 0, counterState);
+    failures += checkFillMatchesDraws<Simple>("Threefry Simple", counterState);
+    failures += checkFillMatchesDraws<Double>("Threefry Double", counterState);
+    return failures;
+}
+
+void checkIntegerMethods() {
+    RandomState multiplyState = DefaultRandomState;
+    RandomSetIntegerMethod(STREFLOP_INTEGER_MULTIPLY, multiplyState);
+    int N = 1000000;
+    double meanMask = 0.0, meanMultiply = 0.0, meanMaskChar = 0.0, meanMultiplyChar = 0.0;
+    for (int i=0; i<N; ++i) {
+        meanMask += Random<true, true, SizedUnsignedInteger<32>::Type>(0, 0x80000000U);
+        meanMultiply += Random<true, true, SizedUnsignedInteger<32>::Type>(0, 0x80000000U, multiplyState);
+        meanMaskChar += Random<true, true, unsigned char>(0, 128);
+        meanMultiplyChar += Random<true, true, unsigned char>(0, 128, multiplyState);
+    }
+    cout << "mean in [0,2^31], mask (should be 1073741824): " << meanMask / N << endl;
+    cout << "mean in [0,2^31], multiply (should be 1073741824): " << meanMultiply / N << endl;
+    cout << "mean in [0,128], mask (should be 64): " << meanMaskChar / N << endl;
+    cout << "mean in [0,128], multiply (should be 64): " << meanMultiplyChar / N << endl;
 }
 
 template<typename FloatType> void showrate( clock_t start, clock_t stop, int reps )
@@ -71,18 +211,89 @@ template<typename FloatType> void randomTimings() {
     stop = clock();
     showrate<FloatType>(start,stop,50);
 
+    cout << "  Integers in [0,2^32-1], SFMT   ";
+    RandomState sfmtState;
+    RandomInit(RandomSeed(), STREFLOP_SFMT19937, sfmtState);
+    start = clock();
+    for(int i = 0; i < 50000000; ++i ) Random<SizedUnsignedInteger<32>::Type>(sfmtState);
+    stop = clock();
+    showrate<FloatType>(start,stop,50);
+
+    cout << "  Integers, counter generator    ";
+    CounterRandomState counterState;
+    RandomInit(RandomSeed(), 0, counterState);
+    start = clock();
+    for(int i = 0; i < 50000000; ++i ) Random<SizedUnsignedInteger<32>::Type>(counterState);
+    stop = clock();
+    showrate<FloatType>(start,stop,50);
+
     cout << "  Integers in [0,100]            ";
     start = clock();
     for(int i = 0; i < 50000000; ++i ) Random<true, true, SizedUnsignedInteger<32>::Type>(0,100);
     stop = clock();
     showrate<FloatType>(start,stop,50);
 
+    // Worst cases of the mask method, just above a power of two. Ranges near half of the
+    // draw size, like [0,2^31], reject half of the draws with both methods.
+    RandomState multiplyState = DefaultRandomState;
+    RandomSetIntegerMethod(STREFLOP_INTEGER_MULTIPLY, multiplyState);
+
+    cout << "  Integers in [0,100], multiply  ";
+    start = clock();
+    for(int i = 0; i < 50000000; ++i ) Random<true, true, SizedUnsignedInteger<32>::Type>(0,100,multiplyState);
+    stop = clock();
+    showrate<FloatType>(start,stop,50);
+
+    cout << "  Integers in [0,2^20]           ";
+    start = clock();
+    for(int i = 0; i < 50000000; ++i ) Random<true, true, SizedUnsignedInteger<32>::Type>(0,0x100000U);
+    stop = clock();
+    showrate<FloatType>(start,stop,50);
+
+    cout << "  Integers in [0,2^20], multiply ";
+    start = clock();
+    for(int i = 0; i < 50000000; ++i ) Random<true, true, SizedUnsignedInteger<32>::Type>(0,0x100000U,multiplyState);
+    stop = clock();
+    showrate<FloatType>(start,stop,50);
+
+    cout << "  Integers in [0,128]            ";
+    start = clock();
+    for(int i = 0; i < 50000000; ++i ) Random<true, true, unsigned char>(0,128);
+    stop = clock();
+    showrate<FloatType>(start,stop,50);
+
+    cout << "  Integers in [0,128], multiply  ";
+    start = clock();
+    for(int i = 0; i < 50000000; ++i ) Random<true, true, unsigned char>(0,128,multiplyState);
+    stop = clock();
+    showrate<FloatType>(start,stop,50);
+
+    cout << "  Integers in [0,2^40]           ";
+    start = clock();
+    for(int i = 0; i < 50000000; ++i ) Random<true, true, SizedUnsignedInteger<64>::Type>(0,0x10000000000ULL);
+    stop = clock();
+    showrate<FloatType>(start,stop,50);
+
+    cout << "  Integers in [0,2^40], multiply ";
+    start = clock();
+    for(int i = 0; i < 50000000; ++i ) Random<true, true, SizedUnsignedInteger<64>::Type>(0,0x10000000000ULL,multiplyState);
+    stop = clock();
+    showrate<FloatType>(start,stop,50);
+
     cout << "  Reals in [1,2)                 ";
     start = clock();
     for(int i = 0; i < 50000000; ++i ) Random12<true, false, FloatType>();
     stop = clock();
     showrate<FloatType>(start,stop,50);
 
+    cout << "  Reals in [1,2), bulk fill      ";
+    FloatType* buffer = new FloatType[10000];
+    start = clock();
+    for(int i = 0; i < 5000; ++i ) RandomFill12<true, false, FloatType>(buffer, 10000);
+    stop = clock();
+    delete [] buffer;
+    showrate<FloatType>(start,stop,50);
+
     cout << "  Reals in [0,1)                 ";
     start = clock();
     for(int i = 0; i < 50000000; ++i ) Random01<true, false, FloatType>();
@@ -113,21 +324,35 @@ template<typename FloatType> void randomTimings() {
     for(int i = 0; i < 10000000; ++i ) NRandom<FloatType>(2.0, 7.0, &secondary);
     stop = clock();
     showrate<FloatType>(start,stop,20);
+
+    cout << "  Reals in normal, Ziggurat      ";
+    start = clock();
+    for(int i = 0; i < 20000000; ++i ) NRandomZiggurat<FloatType>(2.0, 7.0);
+    stop = clock();
+    showrate<FloatType>(start,stop,20);
 }
 
 
 int main(int argc, const char** argv) {
 
+    cout << "Checking known answers" << endl;
+    if (checkKnownAnswers() + checkFill() != 0) {
+        cout << "Some generators give wrong numbers" << endl;
+        return 1;
+    }
+
     cout << "Random seed: " << RandomInit() << endl;
 
     cout << "Checking Simple ranges" << endl;
     checkNRandom<Simple>();
+    checkNRandomZiggurat<Simple>();
     checkRandom<true, true, Simple>();
     checkRandom<true, false, Simple>();
     checkRandom<false, true, Simple>();
     checkRandom<false, false, Simple>();
     cout << "Checking Double ranges" << endl;
     checkNRandom<Double>();
+    checkNRandomZiggurat<Double>();
     checkRandom<true, true, Double>();
     checkRandom<true, false, Double>();
     checkRandom<false, true, Double>();
@@ -135,12 +360,19 @@ int main(int argc, const char** argv) {
 #if defined(Extended)
     cout << "Checking Extended ranges" << endl;
     checkNRandom<Extended>();
+    checkNRandomZiggurat<Extended>();
     checkRandom<true, true, Extended>();
     checkRandom<true, false, Extended>();
     checkRandom<false, true, Extended>();
     checkRandom<false, false, Extended>();
 #endif
 
+    cout << "Checking jump ahead" << endl;
+    checkJump();
+
+    cout << "Checking integer methods" << endl;
+    checkIntegerMethods();
+
     cout << "Checking Simple timings" << endl;
     randomTimings<Simple>();
     cout << "Checking Double timings" << endl;
@@ -0,0 +1,134 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Checks that the reproducible sums do not depend on the order of the data, on the chunks
+// of the accumulators and on the number of threads, and times them against a plain loop.
+// The printed sums must be the same for all configurations.
+
+#include <iostream>
+using namespace std;
+// clock
+#include <time.h>
+// memcpy for the bit patterns
+#include <string.h>
+
+#include "streflop.h"
+using namespace streflop;
+
+typedef SizedUnsignedInteger<64>::Type uint64;
+
+static const int N = 1000000;
+static const int REPS = 20;
+
+static Double x[N], y[N], shuffled[N];
+
+static uint64 bits(Double z) {
+    uint64 b = 0;
+    memcpy(&b, &z, sizeof(b));
+    return b;
+}
+
+static int failures = 0;
+
+static void check(const char* name, Double reference, Double z) {
+    if (bits(reference) != bits(z)) {
+        cout << "MISMATCH " << name << ": " << hex << bits(z) << " instead of " << bits(reference) << dec << endl;
+        ++failures;
+    }
+}
+
+static void showtime(const char* name, clock_t start, clock_t stop) {
+    double ns = double(stop - start) / CLOCKS_PER_SEC * 1e9 / (double(N) * REPS);
+    cout << name << ": " << ns << " ns/element" << endl;
+}
+
+int main(int argc, const char** argv) {
+
+    streflop_init<Double>();
+    RandomInit(42);
+
+    // Wide exponent range and both signs, so the plain sum depends on the order
+    for (int i = 0; i < N; ++i) {
+        x[i] = ldexp(RandomIE(Double(-1.0), Double(1.0)), RandomII(0, 80) - 40);
+        y[i] = RandomIE(Double(-1.0), Double(1.0));
+    }
+    for (int i = 0; i < N; ++i) shuffled[i] = x[N - 1 - i];
+    for (int i = N - 1; i > 0; --i) {
+        int j = RandomII(0, i);
+        Double t = shuffled[i]; shuffled[i] = shuffled[j]; shuffled[j] = t;
+    }
+
+    Double plainForward = Double(0.0), plainBackward = Double(0.0);
+    for (int i = 0; i < N; ++i) plainForward += x[i];
+    for (int i = N - 1; i >= 0; --i) plainBackward += x[i];
+    cout << "plain sum, forward and backward: " << hex << bits(plainForward) << " " << bits(plainBackward) << dec << endl;
+
+    Double sum = reproducible_sum(x, N);
+    Double dot = reproducible_dot(x, y, N);
+    Double norm = reproducible_norm2(x, N);
+    cout << "reproducible sum: " << hex << bits(sum) << dec << " " << (double)sum << endl;
+    cout << "reproducible dot: " << hex << bits(dot) << dec << " " << (double)dot << endl;
+    cout << "reproducible norm2: " << hex << bits(norm) << dec << " " << (double)norm << endl;
+
+    check("shuffled sum", sum, reproducible_sum(shuffled, N));
+
+    // Accumulators over chunks of various sizes, merged in reverse order
+    int chunks[] = {1, 7, 1000, 65536};
+    for (unsigned c = 0; c < sizeof(chunks) / sizeof(chunks[0]); ++c) {
+        ReproducibleAccumulator total;
+        for (int start = N; start > 0; start -= chunks[c]) {
+            ReproducibleAccumulator part;
+            int begin = (start > chunks[c]) ? start - chunks[c] : 0;
+            for (int i = begin; i < start; ++i) part.add(x[i]);
+            total.merge(part);
+        }
+        check("chunked sum", sum, total.result<Double>());
+    }
+
+#ifndef STREFLOP_NO_THREADS
+    for (int threads = 1; threads <= 8; ++threads) {
+        check("threaded sum", sum, reproducible_sum(x, N, threads));
+        check("threaded dot", dot, reproducible_dot(x, y, N, threads));
+        check("threaded norm2", norm, reproducible_norm2(x, N, threads));
+    }
+#endif
+
+    // Special values
+    Double special[3] = {Double(1.0), Double(1.0) / Double(0.0), Double(-1.0)};
+    check("infinity", special[1], reproducible_sum(special, 3));
+    special[2] = -special[1];
+    if (!isnan(reproducible_sum(special, 3))) {
+        cout << "MISMATCH inf - inf is not NaN" << endl;
+        ++failures;
+    }
+    Double huge[2] = {Double(1e300), Double(1e300)};
+    check("norm2 without overflow", Double(1e300) * sqrt(Double(2.0)), reproducible_norm2(huge, 2));
+
+    clock_t start = clock();
+    Double acc = Double(0.0);
+    for (int r = 0; r < REPS; ++r) for (int i = 0; i < N; ++i) acc += x[i];
+    showtime("plain sum", start, clock());
+    start = clock();
+    for (int r = 0; r < REPS; ++r) acc += reproducible_sum(x, N);
+    showtime("reproducible sum", start, clock());
+    start = clock();
+    for (int r = 0; r < REPS; ++r) acc += reproducible_dot(x, y, N);
+    showtime("reproducible dot", start, clock());
+#ifndef STREFLOP_NO_THREADS
+    start = clock();
+    for (int r = 0; r < REPS; ++r) acc += reproducible_sum(x, N, 4);
+    showtime("reproducible sum, 4 threads (CPU time)", start, clock());
+#endif
+    cout << "(" << (double)acc << ")" << endl;
+
+    cout << (failures ? "FAILED" : "OK") << endl;
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,118 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Checks the slow path counters of SlowPathStats.h: the fast and slow counts, the exponent
+// histogram, and the order of the ring buffer once it wraps around.
+// Both the library and this program must be built with STREFLOP_SLOWPATH_STATS.
+
+#include <iostream>
+using namespace std;
+
+#include "streflop.h"
+using namespace streflop;
+
+#ifdef STREFLOP_SLOWPATH_STATS
+
+typedef SizedUnsignedInteger<64>::Type uint64;
+
+// Arguments of mpcacheBench that take the multi-precision fallback, in the default configuration
+static const double hard_exp[] = {233.65911692699262, 659.5688183214932, -65.4684355388315, -88.59126995240774};
+
+static int failures = 0;
+
+static void check(const char* name, bool ok) {
+    if (!ok) {
+        cout << "FAILED: " << name << endl;
+        ++failures;
+    }
+}
+
+static void checkHistogram() {
+    slowpath_reset();
+    slowpath_record(SlowPathLog, Double(0.5), Double(0.0), false);
+    slowpath_record(SlowPathLog, Double(0.5), Double(0.0), false);
+    slowpath_record(SlowPathLog, Double(0.0), Double(0.0), true);
+    slowpath_record(SlowPathLog, Double(1.0), Double(0.0), true);
+    slowpath_record(SlowPathLog, Double(-1.5), Double(0.0), true);
+    slowpath_record(SlowPathLog, ldexp(Double(1.0), -40), Double(0.0), true);
+    slowpath_record(SlowPathLog, ldexp(Double(1.0), 40), Double(0.0), true);
+    slowpath_record(SlowPathLog, DoublePositiveInfinity, Double(0.0), true);
+    const SlowPathCounters& counters = slowpath_counters(SlowPathLog);
+    check("fast count", counters.fast == 2);
+    check("slow count", counters.slow == 6);
+    // 2^(i-32) <= |x| < 2^(i-31) in bucket i, clamped at both ends
+    check("zero and tiny values in the first bucket", counters.histogram[0] == 2);
+    check("1 and -1.5 in bucket 32", counters.histogram[32] == 2);
+    check("huge values and infinities in the last bucket", counters.histogram[STREFLOP_SLOWPATH_HISTOGRAM_SIZE - 1] == 2);
+    check("other functions untouched", slowpath_counters(SlowPathExp).fast == 0 && slowpath_counters(SlowPathExp).slow == 0);
+}
+
+static void checkRing() {
+    slowpath_reset();
+    SlowPathInput inputs[STREFLOP_SLOWPATH_RING_SIZE];
+    check("empty after reset", slowpath_inputs(inputs, STREFLOP_SLOWPATH_RING_SIZE) == 0);
+
+    // Not full yet: all of them, oldest first
+    for (int i = 0; i < 5; ++i) slowpath_record(SlowPathPow, Double(i), Double(-i), true);
+    int n = slowpath_inputs(inputs, STREFLOP_SLOWPATH_RING_SIZE);
+    bool ordered = (n == 5);
+    for (int i = 0; ordered && i < n; ++i) ordered = inputs[i].function == SlowPathPow && inputs[i].x == Double(i) && inputs[i].y == Double(-i);
+    check("ring before wrapping around", ordered);
+
+    // Wrapped around: the last STREFLOP_SLOWPATH_RING_SIZE, oldest first
+    const int total = STREFLOP_SLOWPATH_RING_SIZE + 37;
+    for (int i = 5; i < total; ++i) slowpath_record(SlowPathPow, Double(i), Double(-i), true);
+    n = slowpath_inputs(inputs, STREFLOP_SLOWPATH_RING_SIZE);
+    ordered = (n == STREFLOP_SLOWPATH_RING_SIZE);
+    for (int i = 0; ordered && i < n; ++i) ordered = inputs[i].x == Double(total - n + i);
+    check("ring after wrapping around", ordered);
+
+    // Fewer requested: the most recent ones
+    n = slowpath_inputs(inputs, 3);
+    check("last inputs only", n == 3 && inputs[0].x == Double(total - 3) && inputs[2].x == Double(total - 1));
+}
+
+static void checkCalls() {
+    streflop_init<Double>();
+    slowpath_reset();
+    const int N = 1000;
+    Double sum = 0.0;
+    for (int i = 0; i < N; ++i) sum += exp(Double(i) / Double(N));
+    for (int i = 0; i < 4; ++i) sum += exp(Double(hard_exp[i]));
+    const SlowPathCounters& counters = slowpath_counters(SlowPathExp);
+    check("every call counted", counters.fast + counters.slow == uint64(N + 4));
+    uint64 histogramTotal = 0;
+    for (int i = 0; i < STREFLOP_SLOWPATH_HISTOGRAM_SIZE; ++i) histogramTotal += counters.histogram[i];
+    check("histogram counts the slow calls", histogramTotal == counters.slow);
+    SlowPathInput inputs[STREFLOP_SLOWPATH_RING_SIZE];
+    int n = slowpath_inputs(inputs, STREFLOP_SLOWPATH_RING_SIZE);
+    check("ring holds the slow calls", uint64(n) == counters.slow);
+    cout << "exp: " << counters.fast << " fast calls, " << counters.slow << " slow calls (" << (double)sum << ")" << endl;
+    for (int i = 0; i < n; ++i) cout << "  slow input: " << (double)inputs[i].x << endl;
+}
+
+int main(int argc, const char** argv) {
+    checkHistogram();
+    checkRing();
+    checkCalls();
+    if (failures) return 1;
+    cout << "All checks passed" << endl;
+    return 0;
+}
+
+#else
+
+int main(int argc, const char** argv) {
+    cout << "Build the library and this program with STREFLOP_SLOWPATH_STATS to check the slow path counters" << endl;
+    return 0;
+}
+
+#endif
@@ -3,6 +3,8 @@ PROMINENT NOTICE: THIS IS A DERIVATIVE WORK OF THE ORIGINAL SOFTFLOAT CODE
 CHANGES:
     Renamed file to softfloat.cpp
     Make use of namespaces
+    The rounding mode, exception flags and related variables are thread-local
+    Split in a core and an other part, so the core can be inlined
 Nicolas Brodu, 2006
 =============================================================================*/
 
@@ -37,9 +39,27 @@ these four paragraphs for those parts of this code that are retained.
 
 =============================================================================*/
 
+// Streflop: the add, sub, mul, div, sqrt and comparison paths form the core part of this file.
+// With STREFLOP_SOFT_INLINE, streflop.h includes this file with STREFLOP_SOFT_INLINE_CORE defined
+// to get only the core, as inline functions. The library object then only compiles the other part.
+#if !defined(STREFLOP_SOFT_INLINE)
+#define SOFTFLOAT_CORE_PART
+#define SOFTFLOAT_OTHER_PART
+#define SOFTFLOAT_CORE
+#elif defined(STREFLOP_SOFT_INLINE_CORE)
+#define SOFTFLOAT_CORE_PART
+#define SOFTFLOAT_CORE inline
+#else
+#include "../streflop.h"
+#define SOFTFLOAT_OTHER_PART
+#endif
+
+#ifdef SOFTFLOAT_CORE_PART
 #include "milieu.h"
 #include "softfloat.h"
+#endif
 
+#ifdef SOFTFLOAT_OTHER_PART
 
 namespace streflop {
 namespace SoftFloat {
@@ -48,21 +68,25 @@ namespace SoftFloat {
 | Floating-point rounding mode, extended double-precision rounding precision,
 | and exception flags.
 *----------------------------------------------------------------------------*/
-int8 float_rounding_mode = float_round_nearest_even;
-int8 float_exception_flags = 0;
+STREFLOP_THREAD_LOCAL int8 float_rounding_mode = float_round_nearest_even;
+STREFLOP_THREAD_LOCAL int8 float_exception_flags = 0;
 #ifdef FLOATX80
-int8 floatx80_rounding_precision = 80;
+STREFLOP_THREAD_LOCAL int8 floatx80_rounding_precision = 80;
 #endif
 
 }
 }
 
+#endif
+
+#ifdef SOFTFLOAT_CORE_PART
 /*----------------------------------------------------------------------------
 | Primitive arithmetic functions, including multi-word arithmetic, and
 | division and square root approximations.  (Can be specialized to target if
 | desired.)
 *----------------------------------------------------------------------------*/
 #include "softfloat-macros"
+#endif
 
 /*----------------------------------------------------------------------------
 | Functions and definitions to determine:  (1) whether tininess for underflow
@@ -78,6 +102,8 @@ int8 floatx80_rounding_precision = 80;
 namespace streflop {
 namespace SoftFloat {
 
+#ifdef SOFTFLOAT_OTHER_PART
+
 /*----------------------------------------------------------------------------
 | Takes a 64-bit fixed-point value `absZ' with binary point between bits 6
 | and 7, and returns the properly rounded 32-bit integer corresponding to the
@@ -180,6 +206,9 @@ static int64 roundAndPackInt64( flag zSign, bits64 absZ0, bits64 absZ1 )
 
 }
 
+#endif
+#ifdef SOFTFLOAT_CORE_PART
+
 /*----------------------------------------------------------------------------
 | Returns the fraction bits of the single-precision floating-point value `a'.
 *----------------------------------------------------------------------------*/
@@ -666,7 +695,7 @@ static floatx80
     }
     if ( roundBits ) float_exception_flags |= float_flag_inexact;
     zSig0 += roundIncrement;
-    if ( zSig0 < roundIncrement ) {
+    if ( zSig0 < (bits64) roundIncrement ) {
         ++zExp;
         zSig0 = LIT64( 0x8000000000000000 );
     }
@@ -1052,6 +1081,9 @@ static float128
 
 #endif
 
+#endif
+#ifdef SOFTFLOAT_OTHER_PART
+
 /*----------------------------------------------------------------------------
 | Returns the result of converting the 32-bit two's complement integer `a'
 | to the single-precision floating-point format.  The conversion is performed
@@ -1566,6 +1598,9 @@ float32 float32_round_to_int( float32 a )
 
 }
 
+#endif
+#ifdef SOFTFLOAT_CORE_PART
+
 /*----------------------------------------------------------------------------
 | Returns the result of adding the absolute values of the single-precision
 | floating-point values `a' and `b'.  If `zSign' is 1, the sum is negated
@@ -1718,7 +1753,7 @@ static float32 subFloat32Sigs( float32 a, float32 b, flag zSign )
 | Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-float32 float32_add( float32 a, float32 b )
+SOFTFLOAT_CORE float32 float32_add( float32 a, float32 b )
 {
     flag aSign, bSign;
 
@@ -1739,7 +1774,7 @@ float32 float32_add( float32 a, float32 b )
 | for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-float32 float32_sub( float32 a, float32 b )
+SOFTFLOAT_CORE float32 float32_sub( float32 a, float32 b )
 {
     flag aSign, bSign;
 
@@ -1760,7 +1795,7 @@ float32 float32_sub( float32 a, float32 b )
 | for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-float32 float32_mul( float32 a, float32 b )
+SOFTFLOAT_CORE float32 float32_mul( float32 a, float32 b )
 {
     flag aSign, bSign, zSign;
     int16 aExp, bExp, zExp;
@@ -1820,7 +1855,7 @@ float32 float32_mul( float32 a, float32 b )
 | IEC/IEEE Standard for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-float32 float32_div( float32 a, float32 b )
+SOFTFLOAT_CORE float32 float32_div( float32 a, float32 b )
 {
     flag aSign, bSign, zSign;
     int16 aExp, bExp, zExp;
@@ -1876,6 +1911,9 @@ float32 float32_div( float32 a, float32 b )
 
 }
 
+#endif
+#ifdef SOFTFLOAT_OTHER_PART
+
 /*----------------------------------------------------------------------------
 | Returns the remainder of the single-precision floating-point value `a'
 | with respect to the corresponding value `b'.  The operation is performed
@@ -1976,13 +2014,16 @@ float32 float32_rem( float32 a, float32 b )
 
 }
 
+#endif
+#ifdef SOFTFLOAT_CORE_PART
+
 /*----------------------------------------------------------------------------
 | Returns the square root of the single-precision floating-point value `a'.
 | The operation is performed according to the IEC/IEEE Standard for Binary
 | Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-float32 float32_sqrt( float32 a )
+SOFTFLOAT_CORE float32 float32_sqrt( float32 a )
 {
     flag aSign;
     int16 aExp, zExp;
@@ -2036,7 +2077,7 @@ float32 float32_sqrt( float32 a )
 | according to the IEC/IEEE Standard for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-flag float32_eq( float32 a, float32 b )
+SOFTFLOAT_CORE flag float32_eq( float32 a, float32 b )
 {
 
     if (    ( ( extractFloat32Exp( a ) == 0xFF ) && extractFloat32Frac( a ) )
@@ -2058,7 +2099,7 @@ flag float32_eq( float32 a, float32 b )
 | Arithmetic.
 *----------------------------------------------------------------------------*/
 
-flag float32_le( float32 a, float32 b )
+SOFTFLOAT_CORE flag float32_le( float32 a, float32 b )
 {
     flag aSign, bSign;
 
@@ -2081,7 +2122,7 @@ flag float32_le( float32 a, float32 b )
 | according to the IEC/IEEE Standard for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-flag float32_lt( float32 a, float32 b )
+SOFTFLOAT_CORE flag float32_lt( float32 a, float32 b )
 {
     flag aSign, bSign;
 
@@ -2098,6 +2139,9 @@ flag float32_lt( float32 a, float32 b )
 
 }
 
+#endif
+#ifdef SOFTFLOAT_OTHER_PART
+
 /*----------------------------------------------------------------------------
 | Returns 1 if the single-precision floating-point value `a' is equal to
 | the corresponding value `b', and 0 otherwise.  The invalid exception is
@@ -2497,6 +2541,9 @@ float64 float64_round_to_int( float64 a )
 
 }
 
+#endif
+#ifdef SOFTFLOAT_CORE_PART
+
 /*----------------------------------------------------------------------------
 | Returns the result of adding the absolute values of the double-precision
 | floating-point values `a' and `b'.  If `zSign' is 1, the sum is negated
@@ -2649,7 +2696,7 @@ static float64 subFloat64Sigs( float64 a, float64 b, flag zSign )
 | Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-float64 float64_add( float64 a, float64 b )
+SOFTFLOAT_CORE float64 float64_add( float64 a, float64 b )
 {
     flag aSign, bSign;
 
@@ -2670,7 +2717,7 @@ float64 float64_add( float64 a, float64 b )
 | for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-float64 float64_sub( float64 a, float64 b )
+SOFTFLOAT_CORE float64 float64_sub( float64 a, float64 b )
 {
     flag aSign, bSign;
 
@@ -2691,7 +2738,7 @@ float64 float64_sub( float64 a, float64 b )
 | for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-float64 float64_mul( float64 a, float64 b )
+SOFTFLOAT_CORE float64 float64_mul( float64 a, float64 b )
 {
     flag aSign, bSign, zSign;
     int16 aExp, bExp, zExp;
@@ -2749,7 +2796,7 @@ float64 float64_mul( float64 a, float64 b )
 | the IEC/IEEE Standard for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-float64 float64_div( float64 a, float64 b )
+SOFTFLOAT_CORE float64 float64_div( float64 a, float64 b )
 {
     flag aSign, bSign, zSign;
     int16 aExp, bExp, zExp;
@@ -2813,6 +2860,9 @@ float64 float64_div( float64 a, float64 b )
 
 }
 
+#endif
+#ifdef SOFTFLOAT_OTHER_PART
+
 /*----------------------------------------------------------------------------
 | Returns the remainder of the double-precision floating-point value `a'
 | with respect to the corresponding value `b'.  The operation is performed
@@ -2898,19 +2948,21 @@ float64 float64_rem( float64 a, float64 b )
 
 }
 
+#endif
+#ifdef SOFTFLOAT_CORE_PART
+
 /*----------------------------------------------------------------------------
 | Returns the square root of the double-precision floating-point value `a'.
 | The operation is performed according to the IEC/IEEE Standard for Binary
 | Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-float64 float64_sqrt( float64 a )
+SOFTFLOAT_CORE float64 float64_sqrt( float64 a )
 {
     flag aSign;
     int16 aExp, zExp;
     bits64 aSig, zSig, doubleZSig;
     bits64 rem0, rem1, term0, term1;
-    float64 z;
 
     aSig = extractFloat64Frac( a );
     aExp = extractFloat64Exp( a );
@@ -2956,7 +3008,7 @@ float64 float64_sqrt( float64 a )
 | according to the IEC/IEEE Standard for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-flag float64_eq( float64 a, float64 b )
+SOFTFLOAT_CORE flag float64_eq( float64 a, float64 b )
 {
 
     if (    ( ( extractFloat64Exp( a ) == 0x7FF ) && extractFloat64Frac( a ) )
@@ -2978,7 +3030,7 @@ flag float64_eq( float64 a, float64 b )
 | Arithmetic.
 *----------------------------------------------------------------------------*/
 
-flag float64_le( float64 a, float64 b )
+SOFTFLOAT_CORE flag float64_le( float64 a, float64 b )
 {
     flag aSign, bSign;
 
@@ -3001,7 +3053,7 @@ flag float64_le( float64 a, float64 b )
 | according to the IEC/IEEE Standard for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-flag float64_lt( float64 a, float64 b )
+SOFTFLOAT_CORE flag float64_lt( float64 a, float64 b )
 {
     flag aSign, bSign;
 
@@ -3018,6 +3070,9 @@ flag float64_lt( float64 a, float64 b )
 
 }
 
+#endif
+#ifdef SOFTFLOAT_OTHER_PART
+
 /*----------------------------------------------------------------------------
 | Returns 1 if the double-precision floating-point value `a' is equal to the
 | corresponding value `b', and 0 otherwise.  The invalid exception is raised
@@ -3091,8 +3146,12 @@ flag float64_lt_quiet( float64 a, float64 b )
 
 }
 
+#endif
+
 #ifdef FLOATX80
 
+#ifdef SOFTFLOAT_OTHER_PART
+
 /*----------------------------------------------------------------------------
 | Returns the result of converting the extended double-precision floating-
 | point value `a' to the 32-bit two's complement integer format.  The
@@ -3406,6 +3465,9 @@ floatx80 floatx80_round_to_int( floatx80 a )
 
 }
 
+#endif
+#ifdef SOFTFLOAT_CORE_PART
+
 /*----------------------------------------------------------------------------
 | Returns the result of adding the absolute values of the extended double-
 | precision floating-point values `a' and `b'.  If `zSign' is 1, the sum is
@@ -3546,7 +3608,7 @@ static floatx80 subFloatx80Sigs( floatx80 a, floatx80 b, flag zSign )
 | Standard for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-floatx80 floatx80_add( floatx80 a, floatx80 b )
+SOFTFLOAT_CORE floatx80 floatx80_add( floatx80 a, floatx80 b )
 {
     flag aSign, bSign;
 
@@ -3567,7 +3629,7 @@ floatx80 floatx80_add( floatx80 a, floatx80 b )
 | IEC/IEEE Standard for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-floatx80 floatx80_sub( floatx80 a, floatx80 b )
+SOFTFLOAT_CORE floatx80 floatx80_sub( floatx80 a, floatx80 b )
 {
     flag aSign, bSign;
 
@@ -3588,7 +3650,7 @@ floatx80 floatx80_sub( floatx80 a, floatx80 b )
 | IEC/IEEE Standard for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-floatx80 floatx80_mul( floatx80 a, floatx80 b )
+SOFTFLOAT_CORE floatx80 floatx80_mul( floatx80 a, floatx80 b )
 {
     flag aSign, bSign, zSign;
     int32 aExp, bExp, zExp;
@@ -3647,7 +3709,7 @@ floatx80 floatx80_mul( floatx80 a, floatx80 b )
 | according to the IEC/IEEE Standard for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-floatx80 floatx80_div( floatx80 a, floatx80 b )
+SOFTFLOAT_CORE floatx80 floatx80_div( floatx80 a, floatx80 b )
 {
     flag aSign, bSign, zSign;
     int32 aExp, bExp, zExp;
@@ -3721,6 +3783,9 @@ floatx80 floatx80_div( floatx80 a, floatx80 b )
 
 }
 
+#endif
+#ifdef SOFTFLOAT_OTHER_PART
+
 /*----------------------------------------------------------------------------
 | Returns the remainder of the extended double-precision floating-point value
 | `a' with respect to the corresponding value `b'.  The operation is performed
@@ -3818,13 +3883,16 @@ floatx80 floatx80_rem( floatx80 a, floatx80 b )
 
 }
 
+#endif
+#ifdef SOFTFLOAT_CORE_PART
+
 /*----------------------------------------------------------------------------
 | Returns the square root of the extended double-precision floating-point
 | value `a'.  The operation is performed according to the IEC/IEEE Standard
 | for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-floatx80 floatx80_sqrt( floatx80 a )
+SOFTFLOAT_CORE floatx80 floatx80_sqrt( floatx80 a )
 {
     flag aSign;
     int32 aExp, zExp;
@@ -3895,7 +3963,7 @@ floatx80 floatx80_sqrt( floatx80 a )
 | Arithmetic.
 *----------------------------------------------------------------------------*/
 
-flag floatx80_eq( floatx80 a, floatx80 b )
+SOFTFLOAT_CORE flag floatx80_eq( floatx80 a, floatx80 b )
 {
 
     if (    (    ( extractFloatx80Exp( a ) == 0x7FFF )
@@ -3925,7 +3993,7 @@ flag floatx80_eq( floatx80 a, floatx80 b )
 | Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-flag floatx80_le( floatx80 a, floatx80 b )
+SOFTFLOAT_CORE flag floatx80_le( floatx80 a, floatx80 b )
 {
     flag aSign, bSign;
 
@@ -3958,7 +4026,7 @@ flag floatx80_le( floatx80 a, floatx80 b )
 | Arithmetic.
 *----------------------------------------------------------------------------*/
 
-flag floatx80_lt( floatx80 a, floatx80 b )
+SOFTFLOAT_CORE flag floatx80_lt( floatx80 a, floatx80 b )
 {
     flag aSign, bSign;
 
@@ -3984,6 +4052,9 @@ flag floatx80_lt( floatx80 a, floatx80 b )
 
 }
 
+#endif
+#ifdef SOFTFLOAT_OTHER_PART
+
 /*----------------------------------------------------------------------------
 | Returns 1 if the extended double-precision floating-point value `a' is equal
 | to the corresponding value `b', and 0 otherwise.  The invalid exception is
@@ -4085,6 +4156,10 @@ flag floatx80_lt_quiet( floatx80 a, floatx80 b )
 
 #endif
 
+#endif
+
+#ifdef SOFTFLOAT_OTHER_PART
+
 #ifdef FLOAT128
 
 /*----------------------------------------------------------------------------
@@ -5203,7 +5278,13 @@ flag float128_lt_quiet( float128 a, float128 b )
 }
 
 #endif
+#endif
+
 
 // Close namespaces
 }
 }
+
+#undef SOFTFLOAT_CORE_PART
+#undef SOFTFLOAT_OTHER_PART
+#undef SOFTFLOAT_CORE
@@ -7,17 +7,21 @@ CHANGES:
     Added variable to control the sending of real system traps
     Protect this header by a #define
     pack the fields of floatx80, just in case (should be useless)
+    The rounding mode, exception flags and related variables are thread-local
 Nicolas Brodu, 2006
 =============================================================================*/
 #ifndef SOFTFLOAT_H
 #define SOFTFLOAT_H
 
+// The rounding mode, flags and traps are per thread, see STREFLOP_THREAD_LOCAL in IntegerTypes.h
+// for platforms without thread-local storage.
+
 namespace streflop {
 namespace SoftFloat {
 
 // Control which of the softfloat exceptions will send real system traps
 // Uses streflop FE_XXX flags, see the softfloat-specialize file
-extern int float_exception_realtraps;
+extern STREFLOP_THREAD_LOCAL int float_exception_realtraps;
 
 /*============================================================================
 
@@ -71,13 +75,14 @@ typedef unsigned long long float64;
 #ifdef FLOATX80
 typedef struct {
     unsigned long long low;
-    unsigned short high
+    unsigned short high;
+}
 #ifdef __GNUC__
-    // Should be useless, since it's aligned at 64 already
-     __attribute__ ((__packed__));
+// Pack the whole structure, otherwise its size is 16 and it does not fit
+// in the 12-byte holder of SoftFloatWrapper<96>
+__attribute__ ((__packed__))
 #endif
-    ;
-} floatx80;
+floatx80;
 #endif
 #ifdef FLOAT128
 typedef struct {
@@ -88,7 +93,7 @@ typedef struct {
 /*----------------------------------------------------------------------------
 | Software IEC/IEEE floating-point underflow tininess-detection mode.
 *----------------------------------------------------------------------------*/
-extern char float_detect_tininess;
+extern STREFLOP_THREAD_LOCAL char float_detect_tininess;
 enum {
     float_tininess_after_rounding  = 0,
     float_tininess_before_rounding = 1
@@ -97,7 +102,7 @@ enum {
 /*----------------------------------------------------------------------------
 | Software IEC/IEEE floating-point rounding mode.
 *----------------------------------------------------------------------------*/
-extern char float_rounding_mode;
+extern STREFLOP_THREAD_LOCAL char float_rounding_mode;
 enum {
     float_round_nearest_even = 0,
     float_round_down         = 1,
@@ -108,7 +113,7 @@ enum {
 /*----------------------------------------------------------------------------
 | Software IEC/IEEE floating-point exception flags.
 *----------------------------------------------------------------------------*/
-extern char float_exception_flags;
+extern STREFLOP_THREAD_LOCAL char float_exception_flags;
 enum {
     float_flag_invalid   =  1,
     float_flag_divbyzero =  4,
@@ -119,9 +124,10 @@ enum {
 
 /*----------------------------------------------------------------------------
 | Routine to raise any or all of the software IEC/IEEE floating-point
-| exception flags.
+| exception flags.  The real system traps are sent by float_raise_traps.
 *----------------------------------------------------------------------------*/
 void float_raise( char );
+void float_raise_traps( char );
 
 /*----------------------------------------------------------------------------
 | Software IEC/IEEE integer-to-floating-point conversion routines.
@@ -228,7 +234,7 @@ float128 floatx80_to_float128( floatx80 );
 | Software IEC/IEEE extended double-precision rounding precision.  Valid
 | values are 32, 64, and 80.
 *----------------------------------------------------------------------------*/
-extern char floatx80_rounding_precision;
+extern STREFLOP_THREAD_LOCAL char floatx80_rounding_precision;
 
 /*----------------------------------------------------------------------------
 | Software IEC/IEEE extended double-precision operations.
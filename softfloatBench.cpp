@@ -0,0 +1,116 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Times the SoftFloat operations directly, without the wrapper overhead.
+// Build the library once as usual and once with STREFLOP_NO_INT128 to compare the
+// native 128-bit integer code with the portable one. The checksum must not change.
+
+#include <iostream>
+using namespace std;
+// clock
+#include <time.h>
+
+#include "streflop.h"
+using namespace streflop;
+
+#ifndef STREFLOP_SOFT
+
+int main(int argc, const char** argv) {
+    cout << "This benchmark is only meaningful with STREFLOP_SOFT" << endl;
+    return 0;
+}
+
+#else
+
+using namespace streflop::SoftFloat;
+
+typedef SizedUnsignedInteger<32>::Type uint32;
+typedef SizedUnsignedInteger<64>::Type uint64;
+
+static const int N = 4096;
+static const int REPS = 500;
+
+// Operands are normal numbers with close exponents, so the main paths are exercised
+static float32 a32[N], b32[N];
+static float64 a64[N], b64[N];
+static floatx80 a80[N], b80[N];
+
+static uint64 checksum = 0;
+
+static void showtime(const char* name, clock_t start, clock_t stop) {
+    double ns = double(stop - start) / CLOCKS_PER_SEC * 1e9 / (double(N) * REPS);
+    cout << name << ": " << ns << " ns/op" << endl;
+}
+
+#define BENCH_BINARY(func, type, a, b, mix) { \
+    clock_t start = clock(); \
+    for (int r = 0; r < REPS; ++r) for (int i = 0; i < N; ++i) { \
+        type z = func(a[i], b[i]); \
+        checksum = checksum * 31 + (mix); \
+    } \
+    showtime(#func, start, clock()); \
+}
+
+#define BENCH_UNARY(func, type, a, mix) { \
+    clock_t start = clock(); \
+    for (int r = 0; r < REPS; ++r) for (int i = 0; i < N; ++i) { \
+        type z = func(a[i]); \
+        checksum = checksum * 31 + (mix); \
+    } \
+    showtime(#func, start, clock()); \
+}
+
+int main(int argc, const char** argv) {
+
+    RandomInit(42);
+    for (int i = 0; i < N; ++i) {
+        uint32 s = Random<uint32>() & 0x80000000;
+        a32[i] = s | ((RandomII<uint32>(100, 154)) << 23) | (Random<uint32>() & 0x007FFFFF);
+        b32[i] = ((RandomII<uint32>(100, 154)) << 23) | (Random<uint32>() & 0x007FFFFF);
+        a64[i] = (uint64(s) << 32) | (uint64(RandomII<uint32>(1000, 1046)) << 52) | (Random<uint64>() & 0x000FFFFFFFFFFFFFULL);
+        b64[i] = (uint64(RandomII<uint32>(1000, 1046)) << 52) | (Random<uint64>() & 0x000FFFFFFFFFFFFFULL);
+        a80[i].high = (s >> 16) | RandomII<uint32>(16370, 16400);
+        a80[i].low = Random<uint64>() | 0x8000000000000000ULL;
+        b80[i].high = RandomII<uint32>(16370, 16400);
+        b80[i].low = Random<uint64>() | 0x8000000000000000ULL;
+    }
+
+#ifdef STREFLOP_NO_INT128
+    cout << "Portable 64-bit integer code" << endl;
+#else
+    cout << "Native 128-bit integer code, if supported by the compiler" << endl;
+#endif
+
+    BENCH_BINARY(float32_add, float32, a32, b32, z)
+    BENCH_BINARY(float32_sub, float32, a32, b32, z)
+    BENCH_BINARY(float32_mul, float32, a32, b32, z)
+    BENCH_BINARY(float32_div, float32, a32, b32, z)
+    BENCH_UNARY(float32_sqrt, float32, b32, z)
+
+    BENCH_BINARY(float64_add, float64, a64, b64, z)
+    BENCH_BINARY(float64_sub, float64, a64, b64, z)
+    BENCH_BINARY(float64_mul, float64, a64, b64, z)
+    BENCH_BINARY(float64_div, float64, a64, b64, z)
+    BENCH_UNARY(float64_sqrt, float64, b64, z)
+
+    BENCH_BINARY(floatx80_add, floatx80, a80, b80, z.low ^ z.high)
+    BENCH_BINARY(floatx80_sub, floatx80, a80, b80, z.low ^ z.high)
+    BENCH_BINARY(floatx80_mul, floatx80, a80, b80, z.low ^ z.high)
+    BENCH_BINARY(floatx80_div, floatx80, a80, b80, z.low ^ z.high)
+    BENCH_BINARY(floatx80_rem, floatx80, a80, b80, z.low ^ z.high)
+    BENCH_UNARY(floatx80_sqrt, floatx80, b80, z.low ^ z.high)
+
+    cout << "checksum: " << hex << checksum << dec << endl;
+
+    return 0;
+}
+
+#endif
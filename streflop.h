@@ -57,14 +57,50 @@ namespace streflop {
 
 }
 
+// The batch functions of Math.h run packed kernels for the fast paths of the Simple and Double
+// exp, log, sin and cos, see libm/batch.h. These give the results of the scalar libm only with
+// the same FPU setup, SSE with denormals. The slow path counters would miss their calls.
+#if defined(STREFLOP_SSE) && defined(__SSE2__) && !defined(STREFLOP_NO_DENORMALS) && !defined(STREFLOP_SLOWPATH_STATS)
+#define STREFLOP_BATCH_PACKED 1
+#endif
+
 // Include the FPU settings file, so the user can initialize the library
 #include "FPUSettings.h"
 
+// Header-only SoftFloat arithmetic: the wrapper operators and the SoftFloat add, sub, mul, div,
+// sqrt and comparisons are defined inline here instead of in the library.
+// The compiler may then keep the values in registers and remove the temporaries.
+#if defined(STREFLOP_SOFT) && defined(STREFLOP_SOFT_INLINE)
+#define STREFLOP_SOFT_INLINE_CORE
+#include "softfloat/softfloat.cpp"
+#undef STREFLOP_SOFT_INLINE_CORE
+#define N_SPECIALIZED 32
+#include "SoftFloatWrapper.cpp"
+#undef N_SPECIALIZED
+#define N_SPECIALIZED 64
+#include "SoftFloatWrapper.cpp"
+#undef N_SPECIALIZED
+#define N_SPECIALIZED 96
+#include "SoftFloatWrapper.cpp"
+#undef N_SPECIALIZED
+#endif
+
+// Optional counters of the multi-precision fallbacks, used by the Math.h functions
+#ifdef STREFLOP_SLOWPATH_STATS
+#include "SlowPathStats.h"
+#endif
+
 // Now that types are defined, include the Math.h file for the prototypes
 #include "Math.h"
 
 // And now that math functions are defined, include the random numbers
 #include "Random.h"
 
+// Sums that do not depend on the order of the additions
+#include "Reduction.h"
+
+// Non-uniform distributions, on top of the random numbers
+#include "Distribution.h"
+
 #endif
 
@@ -0,0 +1,90 @@
+/*
+    streflop: STandalone REproducible FLOating-Point
+    Nicolas Brodu, 2006
+    Code released according to the GNU Lesser General Public License
+
+    Heavily relies on GNU Libm, itself depending on netlib fplibm, GNU MP, and IBM MP lib.
+    Uses SoftFloat too.
+
+    Please read the history and copyright information in the documentation provided with the source code
+*/
+
+// Times sin, cos and tan on arguments of increasing magnitude, one decade at a time. The large
+// ones need the full reduction by pi/2 of __branred for Double and __kernel_rem_pio2f for Simple.
+// Build the library once as usual and once with STREFLOP_INTEGER_RANGE_REDUCTION to see the gain
+// of the integer reduction. The checksum must not change.
+
+#include <iostream>
+using namespace std;
+// clock
+#include <time.h>
+// memcpy for the checksum
+#include <string.h>
+
+#include "streflop.h"
+using namespace streflop;
+
+typedef SizedUnsignedInteger<64>::Type uint64;
+
+static const int N = 1024;
+static const int REPS = 100;
+
+static const double double_decades[] = {1.0, 1e3, 1e6, 1e9, 1e12, 1e15, 1e20, 1e50, 1e100, 1e300};
+static const double simple_decades[] = {1.0, 1e3, 1e6, 1e9, 1e12, 1e15, 1e20, 1e30};
+
+#define COUNT(a) (int)(sizeof(a)/sizeof(a[0]))
+
+static uint64 checksum = 0;
+
+template<typename T> static void mix(T z) {
+    uint64 bits = 0;
+    memcpy(&bits, &z, sizeof(bits) < sizeof(T) ? sizeof(bits) : sizeof(T));
+    checksum = checksum * 31 + bits;
+}
+
+static double nanoseconds(clock_t start, clock_t stop) {
+    return double(stop - start) / CLOCKS_PER_SEC * 1e9 / (double(N) * REPS);
+}
+
+#define BENCH_UNARY(func) { \
+    clock_t start = clock(); \
+    for (int r = 0; r < REPS; ++r) for (int i = 0; i < N; ++i) mix(func(x[i])); \
+    cout << "\t" << nanoseconds(start, clock()); \
+}
+
+// Arguments in [d, 10*d), with both signs
+template<typename T> static void benchType(const char* name, const double* decades, int count) {
+    static T x[N];
+    cout << name << ", ns/call:" << endl << "magnitude\tsin\tcos\ttan" << endl;
+    for (int k = 0; k < count; ++k) {
+        for (int i = 0; i < N; ++i) {
+            x[i] = RandomIE(T(1.0), T(10.0)) * T(decades[k]);
+            if (i & 1) x[i] = -x[i];
+        }
+        cout << decades[k];
+        BENCH_UNARY(sin)
+        BENCH_UNARY(cos)
+        BENCH_UNARY(tan)
+        cout << endl;
+    }
+}
+
+int main(int argc, const char** argv) {
+
+    streflop_init<Double>();
+    RandomInit(42);
+
+#ifdef STREFLOP_INTEGER_RANGE_REDUCTION
+    cout << "Integer range reduction (the library must be built with STREFLOP_INTEGER_RANGE_REDUCTION too)" << endl;
+#else
+    cout << "Floating-point range reduction" << endl;
+#endif
+
+    benchType<Double>("Double", double_decades, COUNT(double_decades));
+    streflop_init<Simple>();
+    benchType<Simple>("Simple", simple_decades, COUNT(simple_decades));
+
+    cout << "checksum: " << hex << checksum << dec << endl;
+
+    return 0;
+}